@@ -5,6 +5,8 @@
 #include <dash/dart/if/dart_util.h>
 #include <dash/dart/if/dart_globmem.h>
 
+#include <stdbool.h>
+
 /**
  * \file dart_communication.h
  *
@@ -165,6 +167,60 @@ dart_ret_t dart_allgatherv(
   const size_t    * recvdispls,
   dart_team_t       teamid) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI_Alltoall.
+ * Unit \c i sends the \c j-th block of \c nelem elements in \c sendbuf
+ * to unit \c j, which stores it in the \c i-th block of \c recvbuf.
+ *
+ * \param sendbuf The buffer containing \c nelem elements for every unit.
+ * \param recvbuf The buffer to hold \c nelem elements from every unit.
+ * \param nelem   Number of elements sent to and received from every unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param teamid  The team to participate in the all-to-all exchange.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Alltoallv.
+ *
+ * \param sendbuf     The buffer containing the data to be sent to every unit.
+ * \param nsendelem   Array containing the number of values to send to
+ *                    each unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param teamid      The team to participate in the all-to-all exchange.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI allreduce.
  *
@@ -213,6 +269,112 @@ dart_ret_t dart_reduce(
   dart_team_unit_t    root,
   dart_team_t         team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI_Exscan.
+ * Unit \c i receives the element-wise reduction of the values in
+ * \c sendbuf of units \c 0 to \c i-1 in the team using \c op.
+ * The content of \c recvbuf at unit 0 is undefined.
+ *
+ * \param sendbuf Buffer containing \c nelem elements to reduce using \c op.
+ * \param recvbuf Buffer of size \c nelem to store the result of the element-wise operation \c op in.
+ * \param nelem   The number of elements of type \c dtype in \c sendbuf and \c recvbuf.
+ * \param dtype   The data type of values stored in \c sendbuf and \c recvbuf.
+ * \param op      The reduce operation to perform.
+ * \param team    The team to perform the prefix reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Reduce_scatter.
+ * Reduces the values in \c sendbuf of all units element-wise using \c op
+ * and scatters the result: unit \c i receives \c nrecvelem[i] elements
+ * following the elements received by units \c 0 to \c i-1.
+ *
+ * \param sendbuf   Buffer containing the sum of \c nrecvelem elements.
+ * \param recvbuf   Buffer to store the \c nrecvelem[myid] reduced elements
+ *                  of the calling unit in.
+ * \param nrecvelem Array containing the number of elements received by
+ *                  each unit.
+ * \param dtype     The data type of values stored in \c sendbuf and
+ *                  \c recvbuf.
+ * \param op        The reduce operation to perform.
+ * \param team      The team to perform the reduction on.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_reduce_scatter(
+  const void        * sendbuf,
+  void              * recvbuf,
+  const size_t      * nrecvelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team) DART_NOTHROW;
+
+/**
+ * Creates a user-defined reduction operation on elements of
+ * \c elem_size bytes that can be used in \c dart_allreduce,
+ * \c dart_iallreduce, \c dart_reduce and \c dart_exscan.
+ * Reductions using the operation expect data type \c DART_TYPE_BYTE and
+ * the number of bytes in \c nelem, which must be a multiple of
+ * \c elem_size. Elements are never split between invocations of \c op.
+ * User-defined operations cannot be used in \c dart_reduce_scatter and
+ * atomic operations.
+ * Creating an operation with the same arguments as an existing operation
+ * returns the existing operation without creating MPI objects, it is
+ * released once it has been destroyed as often as it has been created.
+ * Operations not destroyed are released in \c dart_exit.
+ *
+ * DART Equivalent to MPI_Op_create.
+ *
+ * \param op        The function combining elements.
+ * \param userdata  Pointer passed to \c op, must remain valid until the
+ *                  operation is destroyed.
+ * \param commute   Whether \c op is commutative.
+ * \param elem_size Size of a single element in bytes.
+ * \param new_op    The operation created.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_op_create(
+  dart_operator_t    op,
+  void             * userdata,
+  bool               commute,
+  size_t             elem_size,
+  dart_operation_t * new_op) DART_NOTHROW;
+
+/**
+ * Destroys a user-defined reduction operation created by
+ * \c dart_op_create and resets \c op to \c DART_OP_UNDEFINED.
+ * Operations shared by multiple calls of \c dart_op_create are released
+ * by the last call of \c dart_op_destroy.
+ *
+ * \param op The operation to destroy.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_op_destroy(
+  dart_operation_t * op) DART_NOTHROW;
+
 /** \} */
 
 /**
@@ -440,6 +602,168 @@ dart_ret_t dart_flush_local_all(
 
 /** \} */
 
+/**
+ * \name Non-blocking single-sided communication routines on
+ *       non-contiguous memory regions
+ * Transfer a non-contiguous region between local memory and the memory of
+ * a single target unit in a single operation.
+ * As with \c dart_get and \c dart_put, completion will be guaranteed after
+ * a flush operation.
+ */
+/** \{ */
+
+/**
+ * 'REGULAR' variant of dart_get for strided memory regions.
+ * Copy \c nblocks blocks of \c nelem_block elements each from the memory
+ * referenced by a global pointer into local memory.
+ * Consecutive blocks start \c src_stride elements apart in the source
+ * region and \c dest_stride elements apart in the destination buffer.
+ * When this functions returns, neither local nor remote completion
+ * is guaranteed. A later flush operation is needed to guarantee
+ * local and remote completion.
+ *
+ * \param dest         The local destination buffer to store the data to.
+ * \param gptr         A global pointer to the first block of the source
+ *                     region.
+ * \param nblocks      The number of blocks to transfer.
+ * \param nelem_block  The number of elements of type \c dtype in every
+ *                     block.
+ * \param src_stride   The number of elements between the first elements of
+ *                     two consecutive blocks in the source region.
+ * \param dest_stride  The number of elements between the first elements of
+ *                     two consecutive blocks in buffer \c dest.
+ * \param dtype        The data type of the values in buffer \c dest.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_strided(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            src_stride,
+  size_t            dest_stride,
+  dart_datatype_t   dtype) DART_NOTHROW;
+
+/**
+ * 'REGULAR' variant of dart_put for strided memory regions.
+ * Copy \c nblocks blocks of \c nelem_block elements each from local memory
+ * into the memory referenced by a global pointer.
+ * Consecutive blocks start \c dest_stride elements apart in the target
+ * region and \c src_stride elements apart in the source buffer.
+ * When this functions returns, neither local nor remote completion
+ * is guaranteed. A later flush operation is needed to guarantee
+ * local and remote completion.
+ *
+ * \param gptr         A global pointer to the first block of the target
+ *                     region.
+ * \param src          The local source buffer to load the data from.
+ * \param nblocks      The number of blocks to transfer.
+ * \param nelem_block  The number of elements of type \c dtype in every
+ *                     block.
+ * \param dest_stride  The number of elements between the first elements of
+ *                     two consecutive blocks in the target region.
+ * \param src_stride   The number of elements between the first elements of
+ *                     two consecutive blocks in buffer \c src.
+ * \param dtype        The data type of the values in buffer \c src.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_strided(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            dest_stride,
+  size_t            src_stride,
+  dart_datatype_t   dtype) DART_NOTHROW;
+
+/**
+ * 'REGULAR' variant of dart_get for indexed memory regions.
+ * Copy \c nblocks blocks of elements from the memory referenced by a
+ * global pointer into local memory.
+ * The i-th block consists of \c nelems[i] elements and starts
+ * \c src_displs[i] elements after \c gptr in the source region and
+ * \c dest_displs[i] elements after \c dest in the destination buffer.
+ * When this functions returns, neither local nor remote completion
+ * is guaranteed. A later flush operation is needed to guarantee
+ * local and remote completion.
+ *
+ * \param dest         The local destination buffer to store the data to.
+ * \param gptr         A global pointer to the base of the source region.
+ *                     All blocks must be located at the unit and in the
+ *                     segment referenced by \c gptr.
+ * \param nblocks      The number of blocks to transfer.
+ * \param nelems       The number of elements of type \c dtype in every
+ *                     block.
+ * \param src_displs   Displacement of every block in the source region,
+ *                     in number of elements relative to \c gptr.
+ * \param dest_displs  Displacement of every block in buffer \c dest, in
+ *                     number of elements. If \c NULL, blocks are stored
+ *                     consecutively in \c dest.
+ * \param dtype        The data type of the values in buffer \c dest.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_indexed(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  const size_t    * nelems,
+  const size_t    * src_displs,
+  const size_t    * dest_displs,
+  dart_datatype_t   dtype) DART_NOTHROW;
+
+/**
+ * 'REGULAR' variant of dart_put for indexed memory regions.
+ * Copy \c nblocks blocks of elements from local memory into the memory
+ * referenced by a global pointer.
+ * The i-th block consists of \c nelems[i] elements and starts
+ * \c dest_displs[i] elements after \c gptr in the target region and
+ * \c src_displs[i] elements after \c src in the source buffer.
+ * When this functions returns, neither local nor remote completion
+ * is guaranteed. A later flush operation is needed to guarantee
+ * local and remote completion.
+ *
+ * \param gptr         A global pointer to the base of the target region.
+ *                     All blocks must be located at the unit and in the
+ *                     segment referenced by \c gptr.
+ * \param src          The local source buffer to load the data from.
+ * \param nblocks      The number of blocks to transfer.
+ * \param nelems       The number of elements of type \c dtype in every
+ *                     block.
+ * \param dest_displs  Displacement of every block in the target region,
+ *                     in number of elements relative to \c gptr.
+ * \param src_displs   Displacement of every block in buffer \c src, in
+ *                     number of elements. If \c NULL, blocks are loaded
+ *                     consecutively from \c src.
+ * \param dtype        The data type of the values in buffer \c src.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_indexed(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  const size_t    * nelems,
+  const size_t    * dest_displs,
+  const size_t    * src_displs,
+  dart_datatype_t   dtype) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Non-blocking single-sided communication operations using handles
  * The handle can be used to wait for a specific operation to complete using \c wait functions.
@@ -572,6 +896,22 @@ dart_ret_t dart_test_local(
   dart_handle_t   handle,
   int32_t       * result) DART_NOTHROW;
 
+/**
+ * Test for the local and remote completion of an operation.
+ * The handle is released if the operation has completed.
+ *
+ * \param handle The handle of an operation to test for completion.
+ * \param[out] result \c True if the operation has completed.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_test(
+  dart_handle_t   handle,
+  int32_t       * result) DART_NOTHROW;
+
 /**
  * Test for the local completion of operations.
  *
@@ -591,6 +931,361 @@ dart_ret_t dart_testall_local(
 
 /** \} */
 
+/**
+ * \name Non-blocking collective operations
+ * Collective operations returning a handle to wait for their completion
+ * using \c dart_wait, \c dart_test and the like, allowing to overlap
+ * communication with local computation.
+ * Buffers passed to an operation must not be accessed before the
+ * operation has completed.
+ */
+
+/** \{ */
+
+/**
+ * Non-blocking variant of \c dart_barrier.
+ *
+ * \param team        The team to perform a barrier on.
+ * \param[out] handle Handle to wait for the completion of the barrier.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibarrier(
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_allreduce.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each unit.
+ * \param recvbuf     The buffer to hold the result of the reduction.
+ * \param nelem       Number of elements sent by each unit.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param op          The reduction operation to perform.
+ * \param team        The team to participate in the allreduce.
+ * \param[out] handle Handle to wait for the completion of the allreduce.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handle) DART_NOTHROW;
+
+/**
+ * Non-blocking variant of \c dart_allgather.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each unit,
+ *                    or \c NULL if the values are in place in \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nelem       Number of elements sent by each unit.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param team        The team to participate in the allgather.
+ * \param[out] handle Handle to wait for the completion of the allgather.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallgather(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_team_t        team,
+  dart_handle_t    * handle) DART_NOTHROW;
+
+/** \} */
+
+/**
+ * \name Non-blocking single-sided communication operations using a pool
+ *       of handles
+ * A handle pool stores the requests of up to a fixed number of pending
+ * operations in memory allocated once on creation of the pool.
+ * Issuing and completing operations in a pool does not allocate memory.
+ */
+
+/** \{ */
+
+/**
+ * Pool of handles of non-blocking operations, created with
+ * \c dart_handle_pool_create.
+ */
+typedef struct dart_handle_pool_struct * dart_handle_pool_t;
+
+/**
+ * Create a pool for up to \c capacity pending non-blocking operations.
+ *
+ * \param capacity   The maximum number of pending operations in the pool.
+ * \param[out] pool  The pool created.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_pool_create(
+  size_t               capacity,
+  dart_handle_pool_t * pool) DART_NOTHROW;
+
+/**
+ * Free a pool created with \c dart_handle_pool_create.
+ * Operations pending in the pool are completed before.
+ *
+ * \param pool  The pool to free, set to \c NULL on return.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_pool_destroy(
+  dart_handle_pool_t * pool) DART_NOTHROW;
+
+/**
+ * 'POOLED' variant of dart_get.
+ * The request of the operation is stored in \c pool.
+ * Neither local nor remote completion is guaranteed. A later
+ * \c dart_handle_pool_waitall*() call or a flush operation is needed to
+ * guarantee completion.
+ * If the pool is full, all operations pending in the pool are completed
+ * before the operation is issued.
+ *
+ * \param dest   Local target memory to store the data.
+ * \param gptr   Global pointer being the source of the data transfer.
+ * \param nelem  The number of elements of \c dtype in buffer \c dest.
+ * \param dtype  The data type of the values in buffer \c dest.
+ * \param pool   The pool to store the request of the operation in.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{pool}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_get_pooled(
+  void               * dest,
+  dart_gptr_t          gptr,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  dart_handle_pool_t   pool) DART_NOTHROW;
+
+/**
+ * 'POOLED' variant of dart_put.
+ * The request of the operation is stored in \c pool.
+ * Neither local nor remote completion is guaranteed. A later
+ * \c dart_handle_pool_waitall*() call or a flush operation is needed to
+ * guarantee completion.
+ * If the pool is full, all operations pending in the pool are completed
+ * before the operation is issued.
+ *
+ * \param gptr   Global pointer being the target of the data transfer.
+ * \param src    Local source memory to transfer data from.
+ * \param nelem  The number of elements of type \c dtype to transfer.
+ * \param dtype  The data type of the values in buffer \c src.
+ * \param pool   The pool to store the request of the operation in.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{pool}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_pooled(
+  dart_gptr_t          gptr,
+  const void         * src,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  dart_handle_pool_t   pool) DART_NOTHROW;
+
+/**
+ * Wait for the local and remote completion of all operations pending in
+ * a pool. The pool is empty on return.
+ *
+ * \param pool  The pool of operations to wait for.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{pool}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_pool_waitall(
+  dart_handle_pool_t pool) DART_NOTHROW;
+
+/**
+ * Wait for the local completion of all operations pending in a pool.
+ * The pool is empty on return.
+ *
+ * \param pool  The pool of operations to wait for.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{pool}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_pool_waitall_local(
+  dart_handle_pool_t pool) DART_NOTHROW;
+
+/**
+ * Query the number of operations pending in a pool.
+ *
+ * \param pool       The pool to query.
+ * \param[out] size  The number of pending operations in \c pool.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{pool}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_handle_pool_size(
+  dart_handle_pool_t   pool,
+  size_t             * size) DART_NOTHROW;
+
+/** \} */
+
+/**
+ * \name Aggregated single-sided communication operations
+ * An aggregation context buffers small put, get and accumulate operations
+ * per target unit and issues them in batches, merging operations on
+ * adjacent memory into a single transfer.
+ * Buffered operations of a target are issued once the number of bytes
+ * buffered for it exceeds a threshold, on \c dart_aggregation_flush and
+ * on any flush or barrier on the context's team called by the thread that
+ * created the context.
+ */
+
+/** \{ */
+
+/**
+ * Context of aggregated operations, created with
+ * \c dart_aggregation_create.
+ */
+typedef struct dart_aggregation_struct * dart_aggregation_t;
+
+/**
+ * Create a context aggregating operations on global memory of a team.
+ *
+ * \param team       The team owning the global memory accessed.
+ * \param threshold  Number of bytes buffered per target unit before its
+ *                   operations are issued, \c 0 for the default.
+ * \param[out] agg   The context created.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregation_create(
+  dart_team_t          team,
+  size_t               threshold,
+  dart_aggregation_t * agg) DART_NOTHROW;
+
+/**
+ * Complete all operations buffered in a context and free it.
+ *
+ * \param agg  The context to free, set to \c NULL on return.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{agg}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregation_destroy(
+  dart_aggregation_t * agg) DART_NOTHROW;
+
+/**
+ * Buffer a put of \c nelem elements to \c gptr.
+ * The values are copied, \c src may be reused on return.
+ *
+ * \param agg    The aggregation context.
+ * \param gptr   Global pointer to the target memory.
+ * \param src    The local source buffer.
+ * \param nelem  The number of elements of type \c dtype to transfer.
+ * \param dtype  The data type of the values in buffer \c src.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{agg}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregation_put(
+  dart_aggregation_t   agg,
+  dart_gptr_t          gptr,
+  const void         * src,
+  size_t               nelem,
+  dart_datatype_t      dtype) DART_NOTHROW;
+
+/**
+ * Buffer a get of \c nelem elements from \c gptr.
+ * The values are available in \c dest after the context has been flushed.
+ *
+ * \param agg    The aggregation context.
+ * \param dest   The local destination buffer.
+ * \param gptr   Global pointer to the source memory.
+ * \param nelem  The number of elements of type \c dtype to transfer.
+ * \param dtype  The data type of the values in buffer \c dest.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{agg}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregation_get(
+  dart_aggregation_t   agg,
+  void               * dest,
+  dart_gptr_t          gptr,
+  size_t               nelem,
+  dart_datatype_t      dtype) DART_NOTHROW;
+
+/**
+ * Buffer an accumulate of \c nelem elements to \c gptr.
+ * The values are copied, \c values may be reused on return.
+ *
+ * \param agg     The aggregation context.
+ * \param gptr    Global pointer to the target memory.
+ * \param values  The local buffer of values to accumulate.
+ * \param nelem   The number of elements of type \c dtype in \c values.
+ * \param dtype   The data type of the values in buffer \c values.
+ * \param op      The reduction operation to apply.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{agg}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregation_accumulate(
+  dart_aggregation_t   agg,
+  dart_gptr_t          gptr,
+  const void         * values,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  dart_operation_t     op) DART_NOTHROW;
+
+/**
+ * Issue all operations buffered in a context and wait for their remote
+ * completion.
+ *
+ * \param agg  The aggregation context.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{agg}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_aggregation_flush(
+  dart_aggregation_t   agg) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Blocking single-sided communication operations
  * These operations will block until completion of put and get is guaranteed.
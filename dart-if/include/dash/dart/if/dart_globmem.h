@@ -159,6 +159,27 @@ dart_ret_t dart_gptr_getaddr(
   const dart_gptr_t    gptr,
         void        ** addr) DART_NOTHROW;
 
+/**
+ * Get the native memory address for the specified global pointer
+ * gptr if the referenced memory can be accessed directly by the calling
+ * unit, i.e. if it is located at the calling unit or in shared memory
+ * of a unit at the same node.
+ * The memory may then be accessed with plain loads and stores.
+ *
+ * \param      gptr Global pointer
+ * \param[out] addr Pointer to a pointer that will hold the native
+ *                  address if the \c gptr points to node-local memory,
+ *                  or \c NULL otherwise.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_gptr_getaddr_node(
+  const dart_gptr_t    gptr,
+        void        ** addr) DART_NOTHROW;
+
 /**
  * Set the local memory address for the specified global pointer such
  * the the specified address.
@@ -286,6 +307,46 @@ dart_ret_t dart_memalloc(
  */
 dart_ret_t dart_memfree(dart_gptr_t gptr) DART_NOTHROW;
 
+/**
+ * Usage statistics of the memory pool serving \ref dart_memalloc.
+ *
+ * The pool grows by chunks of memory allocated on demand. Small
+ * allocations are served from bins of equally sized blocks.
+ * The fragmentation of free memory is
+ * <tt>1 - largest_free_bytes / free_bytes</tt>.
+ *
+ * \ingroup DartGlobMem
+ */
+typedef struct {
+  /** Number of memory chunks in the pool. */
+  size_t num_chunks;
+  /** Size of all chunks in bytes. */
+  size_t total_bytes;
+  /** Bytes in allocated blocks, including padding to the block size. */
+  size_t used_bytes;
+  /** Bytes in bins of small blocks that are not allocated. */
+  size_t bin_free_bytes;
+  /** Bytes in chunks neither allocated nor reserved for bins. */
+  size_t free_bytes;
+  /** Size of the largest contiguous free block in any chunk in bytes. */
+  size_t largest_free_bytes;
+} dart_memalloc_stats_t;
+
+/**
+ * Query usage statistics of the memory pool serving \ref dart_memalloc
+ * at the calling unit.
+ * This is *not* a collective function.
+ *
+ * \param[out] stats Usage statistics of the calling unit's pool.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_memalloc_stats(
+  dart_memalloc_stats_t * stats) DART_NOTHROW;
+
 /**
  * Collective function on the specified team to allocate \c nelem elements
  * of type \c dtype of memory in each unit's global address space with a
@@ -29,6 +29,29 @@ extern "C" {
  */
 typedef struct dart_lock_struct *dart_lock_t;
 
+/**
+ * Implementation variants of \ref dart_lock_t.
+ * \ingroup DartSync
+ */
+typedef enum {
+  /**
+   * Queue lock handing over the lock to the next waiting unit using
+   * messages. Does not support shared mode, see
+   * \ref dart_lock_acquire_shared.
+   */
+  DART_LOCK_QUEUE = 0,
+  /**
+   * Hierarchical queue lock in which waiting units spin on their local
+   * memory only.
+   * Contention between units on the same node is resolved by atomic
+   * operations on memory of that node, the lock is passed between units
+   * of a node a bounded number of times before it is handed over to
+   * another node.
+   * Supports readers acquiring the lock in shared mode.
+   */
+  DART_LOCK_LOCAL_SPIN
+} dart_lock_variant_t;
+
 
 /**
  * Collective operation to initialize the \c lock object.
@@ -45,9 +68,27 @@ dart_ret_t dart_team_lock_init(
   dart_team_t   teamid,
   dart_lock_t * lock)   DART_NOTHROW;
 
+/**
+ * Collective operation to initialize the \c lock object using the given
+ * implementation variant.
+ *
+ * \param teamid  Team this lock is used for.
+ * \param variant Implementation of the lock, see \ref dart_lock_variant_t.
+ * \param lock    The lock to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_lock_init_variant(
+  dart_team_t           teamid,
+  dart_lock_variant_t   variant,
+  dart_lock_t         * lock)   DART_NOTHROW;
+
 /**
  * Collective operation to destroy a \c lock initialized using
- * \ref dart_team_lock_init.
+ * \ref dart_team_lock_init or \ref dart_team_lock_init_variant.
  *
  * \param lock   The \c lock to free.
  * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
@@ -75,6 +116,24 @@ dart_ret_t dart_team_lock_destroy(
 dart_ret_t dart_lock_acquire(
   dart_lock_t   lock)   DART_NOTHROW;
 
+/**
+ * Block until the \c lock was acquired in shared mode.
+ *
+ * Any number of units can hold the lock in shared mode at the same time
+ * while no unit holds it exclusively through \ref dart_lock_acquire or
+ * \ref dart_lock_try_acquire.
+ * Locks of variant \ref DART_LOCK_QUEUE do not support shared mode and
+ * are acquired exclusively.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_acquire_shared(
+  dart_lock_t   lock)   DART_NOTHROW;
+
 /**
  * Try to acquire the lock and return immediately.
  *
@@ -96,8 +155,8 @@ dart_ret_t dart_lock_try_acquire(
   int32_t     * result) DART_NOTHROW;
 
 /**
- * Release the lock acquired through \ref dart_lock_acquire or
- * \ref dart_lock_try_acquire.
+ * Release the lock acquired through \ref dart_lock_acquire,
+ * \ref dart_lock_acquire_shared or \ref dart_lock_try_acquire.
  *
  * \param lock The lock to release.
  * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
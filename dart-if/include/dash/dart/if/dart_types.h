@@ -91,6 +91,20 @@ typedef enum
   DART_OP_NO_OP
 } dart_operation_t;
 
+/**
+ * User-defined reduction function, combines the \c len elements in
+ * \c invec with the elements in \c inoutvec element-wise and stores the
+ * results in \c inoutvec.
+ *
+ * \see dart_op_create
+ * \ingroup DartTypes
+ */
+typedef void (*dart_operator_t)(
+  const void * invec,
+  void       * inoutvec,
+  size_t       len,
+  void       * userdata);
+
 /**
  * Raw data types supported by the DART interface.
  *
@@ -131,7 +145,7 @@ typedef enum
  */
 typedef struct {
     dart_datatype_t dtype;
-    int             nelem;
+    size_t          nelem;
 } dart_storage_t;
 /** \endcond */
 
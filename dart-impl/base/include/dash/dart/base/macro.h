@@ -41,4 +41,14 @@
 #define DART_INTERNAL
 #endif
 
+/**
+ * Storage class specifier of variables with a separate instance in every
+ * thread. Expands to nothing if DART is built without thread support.
+ */
+#if defined(DART_ENABLE_THREADSUPPORT)
+#define DART_THREAD_LOCAL __thread
+#else
+#define DART_THREAD_LOCAL
+#endif
+
 #endif /* DART__BASE__MACRO_H_ */
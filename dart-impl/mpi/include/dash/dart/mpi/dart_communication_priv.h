@@ -6,6 +6,7 @@
 #define DART_ADAPT_COMMUNICATION_PRIV_H_INCLUDED
 
 #include <stdio.h>
+#include <limits.h>
 #include <mpi.h>
 
 #include <dash/dart/base/macro.h>
@@ -23,11 +24,107 @@ struct dart_handle_struct
   MPI_Request request;
   MPI_Win     win;
   dart_unit_t dest;
+  /** Next handle in the free list of unused handles. */
+  struct dart_handle_struct * next;
 };
 
+/** Pool of requests of non-blocking one-sided operations. */
+struct dart_handle_pool_struct
+{
+  MPI_Request * requests;
+  MPI_Win     * wins;
+  dart_unit_t * dests;
+  size_t        capacity;
+  size_t        size;
+};
+
+/**
+ * Take a handle from the free list of the calling thread.
+ */
+struct dart_handle_struct *
+dart__mpi__handle_alloc() DART_INTERNAL;
+
+/**
+ * Return a handle to the free list of the calling thread.
+ */
+void
+dart__mpi__handle_free(struct dart_handle_struct * handle) DART_INTERNAL;
+
+/**
+ * Release all memory allocated for handles.
+ */
+dart_ret_t
+dart__mpi__handle_fini() DART_INTERNAL;
+
 dart_ret_t
 dart__mpi__datatype_init() DART_INTERNAL;
 
+/**
+ * Release derived MPI data types cached for non-contiguous transfers.
+ */
+dart_ret_t
+dart__mpi__datatype_fini() DART_INTERNAL;
+
+/**
+ * Maximum number of elements of a predefined MPI data type transferred in a
+ * single MPI operation. Contiguous transfers of more elements are described
+ * by a derived data type, see \c dart__mpi__contiguous_type.
+ */
+#ifndef DART_MPI_MAX_COUNT
+#define DART_MPI_MAX_COUNT INT_MAX
+#endif
+
+/**
+ * Creates the MPI data type and count describing \c nelem contiguous
+ * elements of \c dtype.
+ * MPI counts are of type \c int, so more than \c DART_MPI_MAX_COUNT
+ * elements are described by a single element of a derived data type
+ * consisting of chunks of \c DART_MPI_MAX_COUNT elements and the remainder.
+ * The data type has to be released by \c dart__mpi__contiguous_type_free
+ * once the operation using it has been issued.
+ */
+dart_ret_t
+dart__mpi__contiguous_type(
+  dart_datatype_t   dtype,
+  size_t            nelem,
+  MPI_Datatype    * mpi_type,
+  int             * count) DART_INTERNAL;
+
+/**
+ * Releases a data type created by \c dart__mpi__contiguous_type for
+ * \c nelem elements.
+ */
+static inline void
+dart__mpi__contiguous_type_free(
+  size_t         nelem,
+  MPI_Datatype * mpi_type)
+{
+  if (nelem > DART_MPI_MAX_COUNT) {
+    MPI_Type_free(mpi_type);
+  }
+}
+
+/**
+ * Resolves the MPI operation, data type and count of a reduction of
+ * \c nelem elements of type \c dtype using \c op.
+ * Reductions with user-defined operations created by \c dart_op_create
+ * pass the number of bytes in \c nelem, which is converted to the number
+ * of elements of the operation's data type.
+ */
+dart_ret_t
+dart__mpi__reduce_args(
+  dart_operation_t   op,
+  dart_datatype_t    dtype,
+  size_t           * nelem,
+  MPI_Op           * mpi_op,
+  MPI_Datatype     * mpi_dtype) DART_INTERNAL;
+
+/**
+ * Release user-defined reduction operations that have not been destroyed.
+ */
+dart_ret_t
+dart__mpi__op_fini() DART_INTERNAL;
+
 static inline MPI_Op dart__mpi__op(dart_operation_t dart_op) {
   switch (dart_op) {
     case DART_OP_MIN     : return MPI_MIN;
@@ -2,12 +2,76 @@
 #define DART__MPI__DART_GLOBMEM_PRIV_H__
 
 #include <dash/dart/base/macro.h>
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_segment.h>
 #include <mpi.h>
 
 /* Global object for one-sided communication on memory region allocated with 'local allocation'. */
 extern MPI_Win dart_win_local_alloc DART_INTERNAL;
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 extern MPI_Win dart_sharedmem_win_local_alloc DART_INTERNAL;
+
+/**
+ * Pointer to memory allocated non-collectively at the unit with the given
+ * rank at this node, or \c NULL if the memory is not located in the
+ * unit's shared allocation pool.
+ */
+static inline char * dart__mpi__sharedmem_localalloc_ptr(
+  int      node_rank,
+  uint64_t offset)
+{
+  uint64_t pool_offset = offset - (uint64_t)
+                           dart_sharedmem_local_baseaddr_set[node_rank];
+  if (pool_offset >= DART_LOCAL_ALLOC_SIZE) {
+    return NULL;
+  }
+  return dart_sharedmem_local_baseptr_set[node_rank] + pool_offset;
+}
+
+/**
+ * Whether the memory referenced by \c gptr can be accessed in the shared
+ * memory of this node.
+ */
+static inline int dart__mpi__is_sharedmem(
+  const dart_team_data_t * team_data,
+  dart_gptr_t              gptr)
+{
+  dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
+  if (gptr.segid < 0 || luid.id < 0) {
+    return 0;
+  }
+  return gptr.segid > 0 ||
+         dart__mpi__sharedmem_localalloc_ptr(
+           luid.id, gptr.addr_or_offs.offset) != NULL;
+}
+
+/**
+ * Native address of the memory referenced by \c gptr in the shared memory
+ * of this node, or \c NULL if the memory is not located in a shared window
+ * of a unit at this node.
+ * The base addresses of the units at this node are stored per segment, so
+ * the address is resolved without communication.
+ */
+static inline char * dart__mpi__sharedmem_ptr(
+  const dart_team_data_t * team_data,
+  dart_gptr_t              gptr)
+{
+  uint64_t         offset = gptr.addr_or_offs.offset;
+  dart_team_unit_t luid   = team_data->sharedmem_tab[gptr.unitid];
+  if (gptr.segid < 0 || luid.id < 0) {
+    return NULL;
+  }
+  if (gptr.segid == DART_SEGMENT_LOCAL) {
+    return dart__mpi__sharedmem_localalloc_ptr(luid.id, offset);
+  }
+  dart_segment_info_t * segment = dart_segment_lookup(
+                                    &team_data->segdata, gptr.segid);
+  if (segment == NULL || segment->baseptr == NULL) {
+    return NULL;
+  }
+  return segment->baseptr[luid.id] + offset;
+}
 #endif
 
 #endif /* DART__MPI__DART_GLOBMEM_PRIV_H__ */
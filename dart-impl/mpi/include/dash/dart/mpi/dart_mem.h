@@ -13,11 +13,18 @@
 #include <inttypes.h>
 
 #include <dash/dart/base/macro.h>
+#include <dash/dart/if/dart_globmem.h>
+
+#include <mpi.h>
+
+/* Size of the chunks of the local allocation pool in bytes */
+#define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
 
 // forward declaration
 struct dart_buddy;
+struct dart_mempool;
 extern char* dart_mempool_localalloc DART_INTERNAL;
-extern struct dart_buddy* dart_localpool DART_INTERNAL;
+extern struct dart_mempool* dart_localpool DART_INTERNAL;
 
 /**
  * Create a new buddy allocator instance.
@@ -57,4 +64,58 @@ int dart_buddy_free(struct dart_buddy *, uint64_t offset) DART_INTERNAL;
 int buddy_size(struct dart_buddy *, uint64_t offset) DART_INTERNAL;
 void buddy_dump(struct dart_buddy *) DART_INTERNAL;
 
+/**
+ * Number of bytes in blocks allocated from the given buddy allocator.
+ */
+size_t dart_buddy_used(struct dart_buddy *) DART_INTERNAL;
+
+/**
+ * Size of the largest free block of the given buddy allocator in bytes.
+ */
+size_t dart_buddy_largest_free(struct dart_buddy *) DART_INTERNAL;
+
+/**
+ * Create a memory pool for non-collective allocations.
+ *
+ * The pool consists of chunks of \c chunk_size bytes, each managed by a
+ * buddy allocator. Chunks are attached to the dynamic window \c win when
+ * the pool is exhausted. Allocations larger than \c chunk_size are served
+ * from dedicated chunks, allocations of up to 256 bytes from bins of blocks
+ * of the same size class.
+ *
+ * \param win        Dynamic window the chunks are attached to.
+ * \param chunk_size Size of chunks in bytes, must be a power of 2.
+ * \param base       Memory of the first chunk or \c NULL to let the pool
+ *                   allocate it. The memory is not released by the pool.
+ */
+struct dart_mempool *
+dart_mempool_new(MPI_Win win, size_t chunk_size, char * base) DART_INTERNAL;
+
+/**
+ * Detach all chunks of the pool from its window and release them.
+ */
+void dart_mempool_delete(struct dart_mempool *) DART_INTERNAL;
+
+/**
+ * Allocate \c nbytes from the pool.
+ *
+ * \return The address of the allocated memory or \c NULL if no chunk
+ *         could be allocated.
+ */
+char * dart_mempool_alloc(struct dart_mempool *, size_t nbytes) DART_INTERNAL;
+
+/**
+ * Return memory allocated from the pool.
+ *
+ * \return 0 on success or -1 if \c addr was not allocated from the pool.
+ */
+int dart_mempool_free(struct dart_mempool *, char * addr) DART_INTERNAL;
+
+/**
+ * Usage statistics of the pool.
+ */
+void dart_mempool_stats(
+  struct dart_mempool   *,
+  dart_memalloc_stats_t * stats) DART_INTERNAL;
+
 #endif
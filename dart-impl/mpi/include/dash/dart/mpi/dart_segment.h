@@ -14,7 +14,8 @@
 
 typedef int16_t dart_segid_t;
 
-#define DART_SEGMENT_HASH_SIZE 256
+/* Initial number of entries in the segment tables of a team */
+#define DART_SEGMENT_TABLE_INIT_SIZE 64
 
 typedef struct
 {
@@ -28,27 +29,61 @@ typedef struct
 } dart_segment_info_t;
 
 // forward declaration to make the compiler happy
-typedef struct dart_seghash_elem dart_seghash_elem_t;
+typedef struct dart_segment_elem dart_segment_elem_t;
 
 typedef struct {
-  dart_seghash_elem_t * hashtab[DART_SEGMENT_HASH_SIZE];
-  dart_team_t           team_id;
-  dart_seghash_elem_t * mem_freelist;
-  dart_seghash_elem_t * reg_freelist;
+  /**
+   * Segments are looked up directly by their ID: allocated segments
+   * (segid >= 0) in \c mem_segs at index \c segid, registered segments
+   * (segid < 0) in \c reg_segs at index \c -segid.
+   * Both tables are grown by doubling their capacity, unused entries are
+   * \c NULL.
+   */
+  dart_segment_elem_t ** mem_segs;
+  dart_segment_elem_t ** reg_segs;
+  int                    mem_capacity;
+  int                    reg_capacity;
+  dart_team_t            team_id;
+  dart_segment_elem_t  * mem_freelist;
+  dart_segment_elem_t  * reg_freelist;
 
   /**
    * For DART collective allocation/free: offset in the returned gptr
    * represents the displacement relative to the beginning of sub-memory
    * spanned by a DART collective allocation.
    * For DART local allocation/free: offset in the returned gptr represents
-   * the displacement relative to the base address of memory region reserved
-   * for the dart local allocation/free (see dart_buddy_allocator).
+   * the address of the allocation at the owning unit.
    * Local allocations are identified by Segment ID DART_SEGMENT_LOCAL.
    */
   int16_t memid;
   int16_t registermemid;
 } dart_segmentdata_t;
 
+struct dart_segment_elem {
+  dart_segment_elem_t * next;
+  dart_segment_info_t   data;
+};
+
+/**
+ * Look up the segment with ID \c segid in constant time.
+ *
+ * \return The segment or \c NULL if no segment with this ID exists.
+ */
+static inline dart_segment_info_t * dart_segment_lookup(
+  const dart_segmentdata_t * segdata,
+  dart_segid_t               segid)
+{
+  dart_segment_elem_t * elem = NULL;
+  if (segid >= 0) {
+    if (segid < segdata->mem_capacity) {
+      elem = segdata->mem_segs[segid];
+    }
+  } else if (-segid < segdata->reg_capacity) {
+    elem = segdata->reg_segs[-segid];
+  }
+  return (elem != NULL) ? &elem->data : NULL;
+}
+
 typedef enum {
   DART_SEGMENT_ALLOC,
   DART_SEGMENT_REGISTER
@@ -56,7 +91,7 @@ typedef enum {
 
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment tables.
  */
 dart_ret_t dart_segment_init(
   dart_segmentdata_t *segdata,
@@ -155,7 +190,7 @@ dart_ret_t dart_segment_free(
 
 
 /**
- * Clear the segment data hash table.
+ * Clear the segment tables.
  */
 dart_ret_t dart_segment_fini(dart_segmentdata_t *segdata) DART_INTERNAL;
 
@@ -153,8 +153,6 @@ extern MPI_Comm dart_comm_world DART_INTERNAL;
 
 typedef struct dart_team_data {
 
-  struct dart_team_data *next;
-
   /**
    * @brief The communicator corresponding to this team.
    */
@@ -186,6 +184,46 @@ typedef struct dart_team_data {
 
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+  /**
+   * @brief Communicator of the units in this team located at the same node.
+   */
+  MPI_Comm node_comm;
+
+  /**
+   * @brief Communicator of the first unit at every node in this team,
+   * \c MPI_COMM_NULL at all other units.
+   */
+  MPI_Comm node_leader_comm;
+
+  /**
+   * @brief Number of nodes spanned by this team.
+   */
+  int num_nodes;
+
+  /**
+   * @brief Whether collective operations on this team are implemented in
+   * an intra-node and an inter-node phase.
+   */
+  int hierarchical_coll;
+
+  /**
+   * @brief Index of the node and rank in the node's communicator of every
+   * unit in this team, only allocated if \c hierarchical_coll is set.
+   */
+  int *node_ids;
+  int *node_ranks;
+
+  /**
+   * @brief Index of the first unit of every node in the node-major order
+   * of units, only allocated if \c hierarchical_coll is set.
+   */
+  int *node_displs;
+
+  /**
+   * @brief Whether team-relative unit IDs follow node-major order.
+   */
+  int nodes_contiguous;
+
   dart_unit_t unitid;
 
   int         size;
@@ -198,6 +236,9 @@ typedef struct dart_team_data {
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
 extern char* *dart_sharedmem_local_baseptr_set DART_INTERNAL;
+/* Address of the shared local allocation pool of every unit at this node
+ * in the unit's own address space. */
+extern MPI_Aint *dart_sharedmem_local_baseaddr_set DART_INTERNAL;
 #endif
 /* @brief Initiate the free-team-list and allocated-team-list.
  *
@@ -230,11 +271,28 @@ dart_ret_t dart_adapt_teamlist_alloc(dart_team_t teamid) DART_INTERNAL;
 dart_ret_t
 dart_adapt_teamlist_dealloc(dart_team_t teamid) DART_INTERNAL;
 
+/**
+ * Table of the \c dart_team_data of all teams the calling unit is a member
+ * of, indexed by team ID. Grown by doubling its capacity in
+ * \c dart_adapt_teamlist_alloc.
+ */
+extern dart_team_data_t **dart_team_data_tab DART_INTERNAL;
+extern int                dart_team_data_capacity DART_INTERNAL;
+
 /**
  * Retrieve the \c dart_team_data for \c teamid.
+ *
+ * \return The team data or \c NULL if the calling unit is not a member of
+ *         the team \c teamid.
  */
-dart_team_data_t *
-dart_adapt_teamlist_get(dart_team_t teamid) DART_INTERNAL;
+static inline dart_team_data_t *
+dart_adapt_teamlist_get(dart_team_t teamid)
+{
+  if (teamid < 0 || teamid >= dart_team_data_capacity) {
+    return NULL;
+  }
+  return dart_team_data_tab[teamid];
+}
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 /*
@@ -245,5 +303,19 @@ dart_ret_t dart_allocate_shared_comm(
   dart_team_data_t *team_data) DART_INTERNAL;
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+/**
+ * Allocate the communicators and unit tables used by hierarchical
+ * collective operations on the team of the given \c team_data.
+ * Shared between \c dart_initialize and \c dart_team_create.
+ */
+dart_ret_t dart_allocate_node_comms(
+  dart_team_data_t *team_data) DART_INTERNAL;
+
+/**
+ * Free the resources allocated in \c dart_allocate_node_comms.
+ */
+dart_ret_t dart_free_node_comms(
+  dart_team_data_t *team_data) DART_INTERNAL;
+
 #endif /*DART_ADAPT_TEAMNODE_H_INCLUDED*/
 
@@ -22,8 +22,10 @@
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/math.h>
+#include <dash/dart/base/mutex.h>
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <mpi.h>
 #include <string.h>
 #include <limits.h>
@@ -46,6 +48,56 @@ dart__mpi__datatype_init()
   return DART_OK;
 }
 
+dart_ret_t
+dart__mpi__contiguous_type(
+  dart_datatype_t   dtype,
+  size_t            nelem,
+  MPI_Datatype    * mpi_type,
+  int             * count)
+{
+  MPI_Datatype base_type = dart__mpi__datatype(dtype);
+
+  if (nelem <= DART_MPI_MAX_COUNT) {
+    *mpi_type = base_type;
+    *count    = (int)nelem;
+    return DART_OK;
+  }
+
+  size_t nchunks   = nelem / DART_MPI_MAX_COUNT;
+  size_t nelem_rem = nelem % DART_MPI_MAX_COUNT;
+  if (nchunks > INT_MAX) {
+    DART_LOG_ERROR("dart__mpi__contiguous_type ! too many elements: %zu",
+                   nelem);
+    return DART_ERR_INVAL;
+  }
+
+  DART_LOG_DEBUG("dart__mpi__contiguous_type: nelem:%zu chunks:%zu rem:%zu",
+                 nelem, nchunks, nelem_rem);
+
+  MPI_Aint     lb, extent;
+  MPI_Datatype chunks_type, rem_type;
+  MPI_Type_get_extent(base_type, &lb, &extent);
+  MPI_Type_vector(
+    (int)nchunks, DART_MPI_MAX_COUNT, DART_MPI_MAX_COUNT,
+    base_type, &chunks_type);
+  MPI_Type_contiguous((int)nelem_rem, base_type, &rem_type);
+
+  int          blocklens[2] = { 1, 1 };
+  MPI_Aint     displs[2]    = { 0, (MPI_Aint)(nchunks * DART_MPI_MAX_COUNT)
+                                   * extent };
+  MPI_Datatype types[2]     = { chunks_type, rem_type };
+  int ret = MPI_Type_create_struct(2, blocklens, displs, types, mpi_type);
+  MPI_Type_free(&chunks_type);
+  MPI_Type_free(&rem_type);
+  if (ret != MPI_SUCCESS || MPI_Type_commit(mpi_type) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__contiguous_type ! "
+                   "failed to create data type for %zu elements", nelem);
+    return DART_ERR_OTHER;
+  }
+  *count = 1;
+  return DART_OK;
+}
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 static dart_ret_t get_shared_mem(
   dart_team_data_t * team_data,
@@ -57,7 +109,7 @@ static dart_ret_t get_shared_mem(
   int16_t      seg_id            = gptr.segid;
   uint64_t     offset            = gptr.addr_or_offs.offset;
   DART_LOG_DEBUG("dart_get: shared windows enabled");
-  dart_team_unit_t luid = DART_TEAM_UNIT_ID(gptr.unitid);
+  dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
   char * baseptr;
   /*
    * Use memcpy if the target is in the same node as the calling unit:
@@ -70,10 +122,10 @@ static dart_ret_t get_shared_mem(
                      "dart_adapt_transtable_get_baseptr failed");
       return DART_ERR_INVAL;
     }
+    baseptr += offset;
   } else {
-    baseptr = dart_sharedmem_local_baseptr_set[luid.id];
+    baseptr = dart__mpi__sharedmem_localalloc_ptr(luid.id, offset);
   }
-  baseptr += offset;
   DART_LOG_DEBUG("dart_get: memcpy %zu bytes", nelem * dart__mpi__datatype_sizeof(dtype));
   memcpy((char*)dest, baseptr, nelem * dart__mpi__datatype_sizeof(dtype));
   return DART_OK;
@@ -97,14 +149,6 @@ dart_ret_t dart_get(
     return DART_ERR_INVAL;
   }
 
-  /*
-   * MPI uses offset type int, do not copy more than INT_MAX elements:
-   */
-  if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_get ! failed: nelem > INT_MAX");
-    return DART_ERR_INVAL;
-  }
-
   dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
   if (team_data == NULL) {
     DART_LOG_ERROR("dart_get ! failed: Unknown team %i!", gptr.teamid);
@@ -116,7 +160,7 @@ dart_ret_t dart_get(
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   DART_LOG_DEBUG("dart_get: shared windows enabled");
-  if (seg_id >= 0 && team_data->sharedmem_tab[gptr.unitid].id >= 0) {
+  if (dart__mpi__is_sharedmem(team_data, gptr)) {
     return get_shared_mem(team_data, dest, gptr, nelem, dtype);
   }
 #else
@@ -158,7 +202,7 @@ dart_ret_t dart_get(
 
     if (team_data->unitid == team_unit_id.id) {
       // use direct memcpy if we are on the same unit
-      memcpy(dest, dart_mempool_localalloc + offset,
+      memcpy(dest, (char *)(uintptr_t)offset,
           nelem * dart__mpi__datatype_sizeof(dtype));
       DART_LOG_TRACE("dart_get: memcpy nelem:%zu "
                      "source (local): disp:%"PRId64" -> dest:%p",
@@ -174,16 +218,22 @@ dart_ret_t dart_get(
   }
 
 
+  int count;
+  if (dart__mpi__contiguous_type(dtype, nelem, &mpi_dtype, &count)
+      != DART_OK) {
+    return DART_ERR_INVAL;
+  }
   DART_LOG_TRACE("dart_get:  MPI_Get");
-  if (MPI_Get(dest,
-              nelem,
-              mpi_dtype,
-              team_unit_id.id,
-              offset,
-              nelem,
-              mpi_dtype,
-              win)
-      != MPI_SUCCESS) {
+  int mpi_ret = MPI_Get(dest,
+                        count,
+                        mpi_dtype,
+                        team_unit_id.id,
+                        offset,
+                        count,
+                        mpi_dtype,
+                        win);
+  dart__mpi__contiguous_type_free(nelem, &mpi_dtype);
+  if (mpi_ret != MPI_SUCCESS) {
     DART_LOG_ERROR("dart_get ! MPI_Rget failed");
     return DART_ERR_INVAL;
   }
@@ -209,14 +259,6 @@ dart_ret_t dart_put(
     return DART_ERR_INVAL;
   }
 
-  /*
-   * MPI uses offset type int, do not copy more than INT_MAX elements:
-   */
-  if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_put ! failed: nelem > INT_MAX");
-    return DART_ERR_INVAL;
-  }
-
   dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
   if (team_data == NULL) {
     DART_LOG_ERROR("dart_put ! failed: Unknown team %i!", gptr.teamid);
@@ -250,7 +292,7 @@ dart_ret_t dart_put(
 
     /* copy data directly if we are on the same unit */
     if (team_unit_id.id == team_data->unitid) {
-      memcpy(dart_mempool_localalloc + offset, src,
+      memcpy((char *)(uintptr_t)offset, src,
           nelem * dart__mpi__datatype_sizeof(dtype));
       DART_LOG_DEBUG("dart_put: memcpy nelem:%zu (from local allocation)"
                      "offset: %"PRIu64"", nelem, offset);
@@ -261,15 +303,21 @@ dart_ret_t dart_put(
   }
 
 
+  int count;
+  if (dart__mpi__contiguous_type(dtype, nelem, &mpi_dtype, &count)
+      != DART_OK) {
+    return DART_ERR_INVAL;
+  }
   MPI_Put(
     src,
-    nelem,
+    count,
     mpi_dtype,
     team_unit_id.id,
     offset,
-    nelem,
+    count,
     mpi_dtype,
     win);
+  dart__mpi__contiguous_type_free(nelem, &mpi_dtype);
 
   return DART_OK;
 }
@@ -298,14 +346,6 @@ dart_ret_t dart_accumulate(
   DART_LOG_DEBUG("dart_accumulate() nelem:%zu dtype:%d op:%d unit:%d",
                  nelem, dtype, op, team_unit_id.id);
 
-  /*
-   * MPI uses offset type int, do not copy more than INT_MAX elements:
-   */
-  if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_accumulate ! failed: nelem > INT_MAX");
-    return DART_ERR_INVAL;
-  }
-
   if (seg_id) {
     MPI_Aint disp_s;
     dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
@@ -335,17 +375,23 @@ dart_ret_t dart_accumulate(
                    nelem, team_unit_id.id, offset);
   }
 
+  int count;
+  if (dart__mpi__contiguous_type(dtype, nelem, &mpi_dtype, &count)
+      != DART_OK) {
+    return DART_ERR_INVAL;
+  }
   MPI_Accumulate(
     values,            // Origin address
-    nelem,             // Number of entries in buffer
+    count,             // Number of entries in buffer
     mpi_dtype,         // Data type of each buffer entry
     team_unit_id.id,   // Rank of target
     offset,            // Displacement from start of window to beginning
                        // of target buffer
-    nelem,             // Number of entries in target buffer
+    count,             // Number of entries in target buffer
     mpi_dtype,         // Data type of each entry in target buffer
     mpi_op,            // Reduce operation
     win);
+  dart__mpi__contiguous_type_free(nelem, &mpi_dtype);
 
   DART_LOG_DEBUG("dart_accumulate > finished");
   return DART_OK;
@@ -485,14 +531,93 @@ dart_ret_t dart_compare_and_swap(
   return DART_OK;
 }
 
+/* -- Allocation of handles for non-blocking operations -- */
+
+/**
+ * Number of handles allocated at once when the free list of the calling
+ * thread is empty.
+ */
+#define DART__MPI__HANDLE_SLAB_SIZE 256
+
+typedef struct dart__mpi__handle_slab_s {
+  struct dart__mpi__handle_slab_s * next;
+  struct dart_handle_struct         handles[DART__MPI__HANDLE_SLAB_SIZE];
+} dart__mpi__handle_slab_t;
+
+/*
+ * Handles are taken from and returned to a free list of the calling thread
+ * so issuing and completing operations does not allocate memory once the
+ * free lists are populated.
+ * Slabs of handles are registered in a global list and released in
+ * dart_exit.
+ */
+static DART_THREAD_LOCAL struct dart_handle_struct *
+  dart__mpi__handle_freelist = NULL;
+static dart__mpi__handle_slab_t * dart__mpi__handle_slabs = NULL;
+static dart_mutex_t dart__mpi__handle_slabs_mutex = DART_MUTEX_INITIALIZER;
+
+struct dart_handle_struct * dart__mpi__handle_alloc()
+{
+  struct dart_handle_struct * handle = dart__mpi__handle_freelist;
+  if (dart__unlikely(handle == NULL)) {
+    dart__mpi__handle_slab_t * slab =
+      malloc(sizeof(dart__mpi__handle_slab_t));
+    if (slab == NULL) {
+      return NULL;
+    }
+    for (int i = 0; i < DART__MPI__HANDLE_SLAB_SIZE - 1; i++) {
+      slab->handles[i].next = &slab->handles[i + 1];
+    }
+    slab->handles[DART__MPI__HANDLE_SLAB_SIZE - 1].next = NULL;
+    dart__base__mutex_lock(&dart__mpi__handle_slabs_mutex);
+    slab->next              = dart__mpi__handle_slabs;
+    dart__mpi__handle_slabs = slab;
+    dart__base__mutex_unlock(&dart__mpi__handle_slabs_mutex);
+    handle = &slab->handles[0];
+  }
+  dart__mpi__handle_freelist = handle->next;
+  handle->next = NULL;
+  return handle;
+}
+
+void dart__mpi__handle_free(
+  struct dart_handle_struct * handle)
+{
+  if (handle != NULL) {
+    handle->next = dart__mpi__handle_freelist;
+    dart__mpi__handle_freelist = handle;
+  }
+}
+
+dart_ret_t dart__mpi__handle_fini()
+{
+  dart__base__mutex_lock(&dart__mpi__handle_slabs_mutex);
+  while (dart__mpi__handle_slabs != NULL) {
+    dart__mpi__handle_slab_t * slab = dart__mpi__handle_slabs;
+    dart__mpi__handle_slabs = slab->next;
+    free(slab);
+  }
+  dart__mpi__handle_freelist = NULL;
+  dart__base__mutex_unlock(&dart__mpi__handle_slabs_mutex);
+  return DART_OK;
+}
+
 /* -- Non-blocking dart one-sided operations -- */
 
-dart_ret_t dart_get_handle(
+/**
+ * Issues a request-based get operation, used by the handle and pool
+ * variants of dart_get.
+ * The request is set to \c MPI_REQUEST_NULL if the operation has
+ * completed already.
+ */
+static dart_ret_t dart__mpi__get_request(
   void          * dest,
   dart_gptr_t     gptr,
   size_t          nelem,
   dart_datatype_t dtype,
-  dart_handle_t * handle)
+  MPI_Request   * mpi_req,
+  MPI_Win       * mpi_win,
+  dart_unit_t   * target)
 {
   MPI_Datatype mpi_type = dart__mpi__datatype(dtype);
   MPI_Win      win;
@@ -500,21 +625,13 @@ dart_ret_t dart_get_handle(
   uint64_t     offset = gptr.addr_or_offs.offset;
   int16_t      seg_id = gptr.segid;
 
-  *handle = NULL;
+  *mpi_req = MPI_REQUEST_NULL;
 
   if (gptr.unitid < 0) {
     DART_LOG_ERROR("dart_get_handle ! failed: gptr.unitid < 0");
     return DART_ERR_INVAL;
   }
 
-  /*
-   * MPI uses offset type int, do not copy more than INT_MAX elements:
-   */
-  if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_get_handle ! failed: nelem > INT_MAX");
-    return DART_ERR_INVAL;
-  }
-
   dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
   if (team_data == NULL) {
     DART_LOG_ERROR("dart_get_handle ! failed: Unknown team %i!", gptr.teamid);
@@ -523,26 +640,18 @@ dart_ret_t dart_get_handle(
 
   DART_LOG_DEBUG("dart_get_handle() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
                  team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
-  DART_LOG_TRACE("dart_get_handle:  allocated handle:%p", (void *)(*handle));
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   DART_LOG_DEBUG("dart_get_handle: shared windows enabled");
 
-  if (seg_id >= 0 && team_data->sharedmem_tab[gptr.unitid].id >= 0) {
+  if (dart__mpi__is_sharedmem(team_data, gptr)) {
     dart_ret_t ret = get_shared_mem(team_data, dest, gptr, nelem, dtype);
 
     /*
-     * Mark request as completed:
+     * Request is completed already:
      */
-    *handle            = malloc(sizeof(struct dart_handle_struct));
-    (*handle)->request = MPI_REQUEST_NULL;
-    if (seg_id != 0) {
-      (*handle)->dest = team_unit_id.id;
-      (*handle)->win = team_data->window;
-    } else {
-      (*handle)->dest = team_unit_id.id;
-      (*handle)->win  = dart_win_local_alloc;
-    }
+    *target  = team_unit_id.id;
+    *mpi_win = (seg_id != 0) ? team_data->window : dart_win_local_alloc;
     return ret;
   }
 #else
@@ -583,24 +692,56 @@ dart_ret_t dart_get_handle(
                    nelem, team_unit_id.id, offset);
     win     = dart_win_local_alloc;
   }
+  int count;
+  if (dart__mpi__contiguous_type(dtype, nelem, &mpi_type, &count)
+      != DART_OK) {
+    return DART_ERR_INVAL;
+  }
   DART_LOG_DEBUG("dart_get_handle:  -- MPI_Rget");
-  MPI_Request mpi_req;
   int mpi_ret = MPI_Rget(
                   dest,              // origin address
-                  nelem,             // origin count
+                  count,             // origin count
                   mpi_type,          // origin data type
                   team_unit_id.id, // target rank
                   offset,            // target disp in window
-                  nelem,             // target count
+                  count,             // target count
                   mpi_type,          // target data type
                   win,               // window
-                  &mpi_req);
+                  mpi_req);
+  dart__mpi__contiguous_type_free(nelem, &mpi_type);
   if (mpi_ret != MPI_SUCCESS) {
     DART_LOG_ERROR("dart_get_handle ! MPI_Rget failed");
     return DART_ERR_INVAL;
   }
-  *handle            = malloc(sizeof(struct dart_handle_struct));
-  (*handle)->dest    = team_unit_id.id;
+  *target  = team_unit_id.id;
+  *mpi_win = win;
+  return DART_OK;
+}
+
+dart_ret_t dart_get_handle(
+  void          * dest,
+  dart_gptr_t     gptr,
+  size_t          nelem,
+  dart_datatype_t dtype,
+  dart_handle_t * handle)
+{
+  MPI_Request mpi_req;
+  MPI_Win     win;
+  dart_unit_t dest_unit;
+
+  *handle = NULL;
+
+  dart_ret_t ret = dart__mpi__get_request(
+                     dest, gptr, nelem, dtype, &mpi_req, &win, &dest_unit);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  *handle            = dart__mpi__handle_alloc();
+  if (*handle == NULL) {
+    DART_LOG_ERROR("dart_get_handle ! failed to allocate handle");
+    return DART_ERR_OTHER;
+  }
+  (*handle)->dest    = dest_unit;
   (*handle)->request = mpi_req;
   (*handle)->win     = win;
   DART_LOG_TRACE("dart_get_handle > handle(%p) dest:%d win:%"PRIu64" req:%ld",
@@ -609,35 +750,32 @@ dart_ret_t dart_get_handle(
   return DART_OK;
 }
 
-dart_ret_t dart_put_handle(
+/**
+ * Issues a request-based put operation, used by the handle and pool
+ * variants of dart_put.
+ */
+static dart_ret_t dart__mpi__put_request(
   dart_gptr_t       gptr,
   const void      * src,
   size_t            nelem,
   dart_datatype_t   dtype,
-  dart_handle_t   * handle)
+  MPI_Request     * mpi_req,
+  MPI_Win         * mpi_win,
+  dart_unit_t     * target)
 {
-  MPI_Request  mpi_req;
   MPI_Datatype mpi_type = dart__mpi__datatype(dtype);
   dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
   uint64_t     offset   = gptr.addr_or_offs.offset;
   int16_t      seg_id   = gptr.segid;
   MPI_Win      win;
 
-  *handle = NULL;
+  *mpi_req = MPI_REQUEST_NULL;
 
   if (gptr.unitid < 0) {
     DART_LOG_ERROR("dart_put_handle ! failed: gptr.unitid < 0");
     return DART_ERR_INVAL;
   }
 
-  /*
-   * MPI uses offset type int, do not copy more than INT_MAX elements:
-   */
-  if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_put_handle ! failed: nelem > INT_MAX");
-    return DART_ERR_INVAL;
-  }
-
 
   if (seg_id != 0) {
     dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
@@ -670,958 +808,2763 @@ dart_ret_t dart_put_handle(
                    nelem, dtype, team_unit_id.id, offset);
   }
 
+  int count;
+  if (dart__mpi__contiguous_type(dtype, nelem, &mpi_type, &count)
+      != DART_OK) {
+    return DART_ERR_INVAL;
+  }
   DART_LOG_DEBUG("dart_put_handle: MPI_RPut");
   int ret = MPI_Rput(
               src,
-              nelem,
+              count,
               mpi_type,
               team_unit_id.id,
               offset,
-              nelem,
+              count,
               mpi_type,
               win,
-              &mpi_req);
+              mpi_req);
+  dart__mpi__contiguous_type_free(nelem, &mpi_type);
 
   if (ret != MPI_SUCCESS) {
     DART_LOG_ERROR("dart_put_handle ! MPI_Rput failed");
     return DART_ERR_INVAL;
   }
-  *handle = malloc(sizeof(struct dart_handle_struct));
-  (*handle) -> dest    = team_unit_id.id;
+  *target  = team_unit_id.id;
+  *mpi_win = win;
+  return DART_OK;
+}
+
+dart_ret_t dart_put_handle(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_handle_t   * handle)
+{
+  MPI_Request mpi_req;
+  MPI_Win     win;
+  dart_unit_t dest_unit;
+
+  *handle = NULL;
+
+  dart_ret_t ret = dart__mpi__put_request(
+                     gptr, src, nelem, dtype, &mpi_req, &win, &dest_unit);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  *handle = dart__mpi__handle_alloc();
+  if (*handle == NULL) {
+    DART_LOG_ERROR("dart_put_handle ! failed to allocate handle");
+    return DART_ERR_OTHER;
+  }
+  (*handle) -> dest    = dest_unit;
   (*handle) -> request = mpi_req;
   (*handle) -> win     = win;
   return DART_OK;
 }
 
-/* -- Blocking dart one-sided operations -- */
+/* -- Non-contiguous dart one-sided operations -- */
 
 /**
- * \todo Check if MPI_Get_accumulate (MPI_NO_OP) yields better performance
+ * Number of entries in the cache of derived MPI data types describing
+ * strided memory regions.
  */
-dart_ret_t dart_put_blocking(
-  dart_gptr_t     gptr,
-  const void    * src,
-  size_t          nelem,
-  dart_datatype_t dtype)
+#define DART__MPI__STRIDED_TYPE_CACHE_SIZE 64
+
+typedef struct {
+  MPI_Datatype    mpi_type;
+  dart_datatype_t dtype;
+  size_t          nblocks;
+  size_t          nelem_block;
+  size_t          stride;
+} dart__mpi__strided_type_t;
+
+/*
+ * Derived vector types are cached per shape so repeated transfers of the
+ * same region (matrix columns, halo faces) do not create and commit a new
+ * MPI data type in every call.
+ * The mutex is held until the RMA operation using a cached type has been
+ * issued as a concurrent lookup might evict and free the type.
+ */
+static dart__mpi__strided_type_t
+  dart__mpi__strided_types[DART__MPI__STRIDED_TYPE_CACHE_SIZE];
+static dart_mutex_t dart__mpi__strided_types_mutex = DART_MUTEX_INITIALIZER;
+
+dart_ret_t
+dart__mpi__datatype_fini()
 {
-  MPI_Win           win;
-  MPI_Datatype      mpi_dtype    = dart__mpi__datatype(dtype);
-  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
-  uint64_t          offset       = gptr.addr_or_offs.offset;
-  int16_t           seg_id       = gptr.segid;
+  for (int i = 0; i < DART__MPI__STRIDED_TYPE_CACHE_SIZE; i++) {
+    dart__mpi__strided_type_t * entry = &dart__mpi__strided_types[i];
+    if (entry->nblocks > 0) {
+      MPI_Type_free(&entry->mpi_type);
+      entry->nblocks = 0;
+    }
+  }
+  return DART_OK;
+}
 
-  if (gptr.unitid < 0) {
-    DART_LOG_ERROR("dart_put_blocking ! failed: gptr.unitid < 0");
-    return DART_ERR_INVAL;
+/**
+ * Resolves the window and the displacement in the window of the memory
+ * referenced by a global pointer.
+ */
+static dart_ret_t dart__mpi__resolve_window(
+  dart_team_data_t * team_data,
+  dart_gptr_t        gptr,
+  MPI_Win          * win,
+  MPI_Aint         * disp)
+{
+  uint64_t         offset       = gptr.addr_or_offs.offset;
+  int16_t          seg_id       = gptr.segid;
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+
+  if (seg_id) {
+    MPI_Aint disp_s;
+    if (dart_segment_get_disp(
+          &team_data->segdata,
+          seg_id,
+          team_unit_id,
+          &disp_s) != DART_OK) {
+      DART_LOG_ERROR("dart__mpi__resolve_window ! "
+                     "dart_segment_get_disp failed");
+      return DART_ERR_INVAL;
+    }
+    *win  = team_data->window;
+    *disp = disp_s + offset;
+  } else {
+    *win  = dart_win_local_alloc;
+    *disp = offset;
   }
+  return DART_OK;
+}
 
-  /*
-   * MPI uses offset type int, do not copy more than INT_MAX elements:
-   */
-  if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_put_blocking ! failed: nelem > INT_MAX");
+/**
+ * Resolves the window and displacement of the target of a one-sided
+ * operation on \c gptr.
+ * If the target memory is directly accessible by the calling unit,
+ * \c localptr is set to its native address and to \c NULL otherwise.
+ */
+static dart_ret_t dart__mpi__resolve_target(
+  dart_gptr_t        gptr,
+  MPI_Win          * win,
+  MPI_Aint         * disp,
+  char            ** localptr)
+{
+  uint64_t         offset       = gptr.addr_or_offs.offset;
+  int16_t          seg_id       = gptr.segid;
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+
+  *localptr = NULL;
+
+  if (gptr.unitid < 0) {
+    DART_LOG_ERROR("dart__mpi__resolve_target ! failed: gptr.unitid < 0");
     return DART_ERR_INVAL;
   }
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
   if (team_data == NULL) {
-    DART_LOG_ERROR("dart_put_blocking ! failed: Unknown team %i!", gptr.teamid);
+    DART_LOG_ERROR("dart__mpi__resolve_target ! failed: Unknown team %i!",
+                   gptr.teamid);
     return DART_ERR_INVAL;
   }
 
-  DART_LOG_DEBUG("dart_put_blocking() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
-                 team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
-
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
-  DART_LOG_DEBUG("dart_put_blocking: shared windows enabled");
-  if (seg_id >= 0) {
-    /*
-     * Use memcpy if the target is in the same node as the calling unit:
-     * The value of i will be the target's relative ID in teamid.
-     */
+  if (dart__mpi__is_sharedmem(team_data, gptr)) {
     dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
-    if (luid.id >= 0) {
-      char * baseptr;
-      DART_LOG_DEBUG("dart_put_blocking: shared memory segment, seg_id:%d",
-                     seg_id);
-      if (seg_id) {
-        if (dart_segment_get_baseptr(
-                &team_data->segdata,
-                seg_id,
-                luid,
-                &baseptr) != DART_OK) {
-          DART_LOG_ERROR("dart_put_blocking ! "
-                         "dart_adapt_transtable_get_baseptr failed");
-          return DART_ERR_INVAL;
-        }
-      } else {
-        baseptr = dart_sharedmem_local_baseptr_set[luid.id];
+    char * baseptr;
+    if (seg_id) {
+      if (dart_segment_get_baseptr(
+            &team_data->segdata, seg_id, luid, &baseptr) != DART_OK) {
+        DART_LOG_ERROR("dart__mpi__resolve_target ! "
+                       "dart_segment_get_baseptr failed");
+        return DART_ERR_INVAL;
       }
-      baseptr += offset;
-      DART_LOG_DEBUG("dart_put_blocking: memcpy %zu bytes",
-                        nelem * dart__mpi__datatype_sizeof(dtype));
-      memcpy(baseptr, src, nelem * dart__mpi__datatype_sizeof(dtype));
-      return DART_OK;
+      *localptr = baseptr + offset;
+    } else {
+      *localptr = dart__mpi__sharedmem_localalloc_ptr(luid.id, offset);
     }
+    return DART_OK;
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
+  if (dart__mpi__resolve_window(team_data, gptr, win, disp) != DART_OK) {
+    return DART_ERR_INVAL;
+  }
+  if (team_data->unitid == team_unit_id.id) {
+    *localptr = (seg_id)
+                ? (char *)(*disp)
+                : (char *)(uintptr_t)offset;
+  }
+  return DART_OK;
+}
+
+/**
+ * Returns the derived MPI data type describing \c nblocks blocks of
+ * \c nelem_block elements each, with the given stride between consecutive
+ * blocks. The returned type is owned by the type cache.
+ * Must be called while holding \c dart__mpi__strided_types_mutex.
+ */
+static dart_ret_t dart__mpi__strided_type(
+  dart_datatype_t   dtype,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  MPI_Datatype    * mpi_type)
+{
+  size_t hash = ((size_t)dtype        * 31u +
+                 nblocks)             * 31u +
+                 nelem_block          * 17u +
+                 stride;
+  dart__mpi__strided_type_t * entry =
+    &dart__mpi__strided_types[hash % DART__MPI__STRIDED_TYPE_CACHE_SIZE];
+
+  if (entry->nblocks     == nblocks     &&
+      entry->nelem_block == nelem_block &&
+      entry->stride      == stride      &&
+      entry->dtype       == dtype) {
+    *mpi_type = entry->mpi_type;
+    return DART_OK;
+  }
+
+  MPI_Datatype new_type;
+  if (MPI_Type_create_hvector(
+        nblocks,
+        nelem_block,
+        (MPI_Aint)(stride * dart__mpi__datatype_sizeof(dtype)),
+        dart__mpi__datatype(dtype),
+        &new_type) != MPI_SUCCESS ||
+      MPI_Type_commit(&new_type) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__strided_type ! "
+                   "failed to create vector type");
+    return DART_ERR_INVAL;
   }
-#else
-  DART_LOG_DEBUG("dart_put_blocking: shared windows disabled");
-#endif /* !defined(DART_MPI_DISABLE_SHARED_WINDOWS) */
   /*
-   * MPI shared windows disabled or target and calling unit are on different
-   * nodes, use MPI_Rput:
+   * Pending operations using an evicted type complete normally after
+   * MPI_Type_free.
    */
-  if (seg_id) {
-    MPI_Aint disp_s;
-    if (dart_segment_get_disp(
-          &team_data->segdata,
-          seg_id,
-          team_unit_id,
-          &disp_s) != DART_OK) {
-      DART_LOG_ERROR("dart_put_blocking ! "
-                     "dart_adapt_transtable_get_disp failed");
-      return DART_ERR_INVAL;
-    }
-
-    /* copy data directly if we are on the same unit */
-    if (team_unit_id.id == team_data->unitid) {
-      memcpy(((void*)disp_s) + offset, src,
-          nelem*dart__mpi__datatype_sizeof(dtype));
-      DART_LOG_DEBUG("dart_put: memcpy nelem:%zu "
-                     "target unit: %d offset: %"PRIu64"",
-                     nelem, team_unit_id.id, offset);
-      return DART_OK;
-    }
-
-    win = team_data->window;
-    offset += disp_s;
-    DART_LOG_DEBUG("dart_put_blocking:  nelem:%zu "
-                   "target (coll.): win:%p unit:%d offset:%lu "
-                   "<- source: %p",
-                   nelem, win, team_unit_id.id,
-                   offset, src);
+  if (entry->nblocks > 0) {
+    MPI_Type_free(&entry->mpi_type);
+  }
+  entry->mpi_type    = new_type;
+  entry->dtype       = dtype;
+  entry->nblocks     = nblocks;
+  entry->nelem_block = nelem_block;
+  entry->stride      = stride;
 
-  } else {
+  *mpi_type = new_type;
+  return DART_OK;
+}
 
-    /* copy data directly if we are on the same unit */
-    if (team_unit_id.id == team_data->unitid) {
-      memcpy(dart_mempool_localalloc + offset, src,
-          nelem * dart__mpi__datatype_sizeof(dtype));
-      DART_LOG_DEBUG("dart_put: memcpy nelem:%zu offset: %"PRIu64"",
-                     nelem, offset);
-      return DART_OK;
-    }
+/**
+ * Resolves the MPI type and count describing one side of a strided
+ * transfer. Contiguous regions are described by the basic type.
+ */
+static dart_ret_t dart__mpi__strided_region(
+  dart_datatype_t   dtype,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride,
+  MPI_Datatype    * mpi_type,
+  int             * count)
+{
+  if (nblocks == 1 || stride == nelem_block) {
+    *mpi_type = dart__mpi__datatype(dtype);
+    *count    = (int)(nblocks * nelem_block);
+    return DART_OK;
+  }
+  *count = 1;
+  return dart__mpi__strided_type(
+           dtype, nblocks, nelem_block, stride, mpi_type);
+}
 
-    win      = dart_win_local_alloc;
-    DART_LOG_DEBUG("dart_put_blocking:  nelem:%zu "
-                   "target (local): win:%p unit:%d offset:%lu "
-                   "<- source: %p",
-                   nelem, win, team_unit_id.id,
-                   offset, src);
+static void dart__mpi__copy_strided(
+  char            * dest,
+  const char      * src,
+  size_t            nblocks,
+  size_t            nbytes_block,
+  size_t            dest_stride,
+  size_t            src_stride)
+{
+  for (size_t b = 0; b < nblocks; b++) {
+    memcpy(dest + (b * dest_stride), src + (b * src_stride), nbytes_block);
   }
+}
 
+static dart_ret_t dart__mpi__check_strided(
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            stride_a,
+  size_t            stride_b)
+{
   /*
-   * Using MPI_Put as MPI_Win_flush is required to ensure remote completion.
+   * MPI uses counts of type int, do not copy more than INT_MAX elements:
    */
-  DART_LOG_DEBUG("dart_put_blocking: MPI_Put");
-  if (MPI_Put(src,
-               nelem,
-               mpi_dtype,
-               team_unit_id.id,
-               offset,
-               nelem,
-               mpi_dtype,
-               win)
-      != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_put_blocking ! MPI_Put failed");
+  if (nblocks > INT_MAX || nelem_block > INT_MAX ||
+      nblocks * nelem_block > INT_MAX) {
+    DART_LOG_ERROR("dart_*_strided ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
-
-  DART_LOG_DEBUG("dart_put_blocking: MPI_Win_flush");
-  if (MPI_Win_flush(team_unit_id.id, win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_put_blocking ! MPI_Win_flush failed");
+  if (nblocks > 1 &&
+      (stride_a < nelem_block || stride_b < nelem_block)) {
+    DART_LOG_ERROR("dart_*_strided ! failed: stride < nelem_block");
     return DART_ERR_INVAL;
   }
-
-  DART_LOG_DEBUG("dart_put_blocking > finished");
   return DART_OK;
 }
 
-/**
- * \todo Check if MPI_Accumulate (REPLACE) yields better performance
- */
-dart_ret_t dart_get_blocking(
-  void          * dest,
-  dart_gptr_t     gptr,
-  size_t          nelem,
-  dart_datatype_t dtype)
+dart_ret_t dart_get_strided(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            src_stride,
+  size_t            dest_stride,
+  dart_datatype_t   dtype)
 {
-  MPI_Win           win;
-  MPI_Datatype      mpi_dtype    = dart__mpi__datatype(dtype);
-  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
-  uint64_t          offset       = gptr.addr_or_offs.offset;
-  int16_t           seg_id       = gptr.segid;
+  MPI_Win          win;
+  MPI_Aint         disp;
+  char           * localptr;
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
 
-  if (gptr.unitid < 0) {
-    DART_LOG_ERROR("dart_get_blocking ! failed: gptr.unitid < 0");
-    return DART_ERR_INVAL;
-  }
+  DART_LOG_DEBUG("dart_get_strided() uid:%d o:%"PRIu64" s:%d t:%d "
+                 "nblocks:%zu nelem_block:%zu src_stride:%zu "
+                 "dest_stride:%zu",
+                 team_unit_id.id, gptr.addr_or_offs.offset, gptr.segid,
+                 gptr.teamid, nblocks, nelem_block, src_stride, dest_stride);
 
-  /*
-   * MPI uses offset type int, do not copy more than INT_MAX elements:
-   */
-  if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_get_blocking ! failed: nelem > INT_MAX");
+  if (nblocks == 0 || nelem_block == 0) {
+    return DART_OK;
+  }
+  if (dart__mpi__check_strided(
+        nblocks, nelem_block, src_stride, dest_stride) != DART_OK) {
     return DART_ERR_INVAL;
   }
-
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
-  if (team_data == NULL) {
-    DART_LOG_ERROR("dart_get_blocking ! failed: Unknown team %i!", gptr.teamid);
+  if (dart__mpi__resolve_target(gptr, &win, &disp, &localptr) != DART_OK) {
     return DART_ERR_INVAL;
   }
 
-  DART_LOG_DEBUG("dart_get_blocking() uid:%d "
-                 "o:%"PRIu64" s:%d t:%u, nelem:%zu",
-                 team_unit_id.id,
-                 offset, seg_id, gptr.teamid, nelem);
-
-#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
-  DART_LOG_DEBUG("dart_get_blocking: shared windows enabled");
-  if (seg_id >= 0 && team_data->sharedmem_tab[gptr.unitid].id >= 0) {
-    return get_shared_mem(team_data, dest, gptr, nelem, dtype);
+  if (localptr != NULL) {
+    size_t dtype_size = dart__mpi__datatype_sizeof(dtype);
+    DART_LOG_TRACE("dart_get_strided: memcpy %zu blocks", nblocks);
+    dart__mpi__copy_strided(
+      dest, localptr, nblocks, nelem_block * dtype_size,
+      dest_stride * dtype_size, src_stride * dtype_size);
+    return DART_OK;
   }
-#else
-  DART_LOG_DEBUG("dart_get_blocking: shared windows disabled");
-#endif /* !defined(DART_MPI_DISABLE_SHARED_WINDOWS) */
-  /*
-   * MPI shared windows disabled or target and calling unit are on different
-   * nodes, use MPI_Rget:
-   */
-  if (seg_id) {
-    MPI_Aint disp_s;
-    if (dart_segment_get_disp(
-          &team_data->segdata,
-          seg_id,
-          team_unit_id,
-          &disp_s) != DART_OK) {
-      DART_LOG_ERROR("dart_get_blocking ! "
-                     "dart_adapt_transtable_get_disp failed");
-      return DART_ERR_INVAL;
-    }
 
-    if (team_data->unitid == team_unit_id.id) {
-      // use direct memcpy if we are on the same unit
-      memcpy(dest, ((void*)disp_s) + offset,
-          nelem * dart__mpi__datatype_sizeof(dtype));
-      DART_LOG_DEBUG("dart_get_blocking: memcpy nelem:%zu "
-                     "source (coll.): offset:%lu -> dest: %p",
-                     nelem, offset, dest);
-      return DART_OK;
+  dart_ret_t   ret = DART_OK;
+  MPI_Datatype src_type, dest_type;
+  int          src_count, dest_count;
+  dart__base__mutex_lock(&dart__mpi__strided_types_mutex);
+  if (dart__mpi__strided_region(
+        dtype, nblocks, nelem_block, src_stride,
+        &src_type, &src_count) != DART_OK ||
+      dart__mpi__strided_region(
+        dtype, nblocks, nelem_block, dest_stride,
+        &dest_type, &dest_count) != DART_OK) {
+    ret = DART_ERR_INVAL;
+  } else {
+    DART_LOG_TRACE("dart_get_strided:  MPI_Get");
+    if (MPI_Get(dest,
+                dest_count,
+                dest_type,
+                team_unit_id.id,
+                disp,
+                src_count,
+                src_type,
+                win) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_get_strided ! MPI_Get failed");
+      ret = DART_ERR_INVAL;
     }
+  }
+  dart__base__mutex_unlock(&dart__mpi__strided_types_mutex);
 
-    win     = team_data->window;
-    offset += disp_s;
-    DART_LOG_DEBUG("dart_get_blocking:  nelem:%zu "
-                   "source (coll.): win:%p unit:%d offset:%lu "
-                   "-> dest: %p",
-                   nelem, win, team_unit_id.id,
-                   offset, dest);
+  DART_LOG_DEBUG("dart_get_strided > finished");
+  return ret;
+}
 
-  } else {
+dart_ret_t dart_put_strided(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  size_t            nelem_block,
+  size_t            dest_stride,
+  size_t            src_stride,
+  dart_datatype_t   dtype)
+{
+  MPI_Win          win;
+  MPI_Aint         disp;
+  char           * localptr;
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
 
-    if (team_data->unitid == team_unit_id.id) {
-      /* use direct memcpy if we are on the same unit */
-      memcpy(dest, dart_mempool_localalloc + offset,
-          nelem * dart__mpi__datatype_sizeof(dtype));
-      DART_LOG_DEBUG("dart_get_blocking: memcpy nelem:%zu "
-                     "source (coll.): offset:%lu -> dest: %p",
-                     nelem, offset, dest);
-      return DART_OK;
-    }
+  DART_LOG_DEBUG("dart_put_strided() uid:%d o:%"PRIu64" s:%d t:%d "
+                 "nblocks:%zu nelem_block:%zu dest_stride:%zu "
+                 "src_stride:%zu",
+                 team_unit_id.id, gptr.addr_or_offs.offset, gptr.segid,
+                 gptr.teamid, nblocks, nelem_block, dest_stride, src_stride);
 
-    win = dart_win_local_alloc;
-    DART_LOG_DEBUG("dart_get_blocking:  nelem:%zu "
-                   "source (local): win:%p unit:%d offset:%lu "
-                   "-> dest: %p",
-                   nelem, win, team_unit_id.id,
-                   offset, dest);
+  if (nblocks == 0 || nelem_block == 0) {
+    return DART_OK;
   }
-
-  /*
-   * Using MPI_Get as MPI_Win_flush is required to ensure remote completion.
-   */
-  DART_LOG_DEBUG("dart_get_blocking: MPI_Rget");
-  MPI_Request req;
-  if (MPI_Rget(dest,
-              nelem,
-              mpi_dtype,
-              team_unit_id.id,
-              offset,
-              nelem,
-              mpi_dtype,
-              win,
-              &req)
-      != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_get_blocking ! MPI_Rget failed");
+  if (dart__mpi__check_strided(
+        nblocks, nelem_block, dest_stride, src_stride) != DART_OK) {
     return DART_ERR_INVAL;
   }
-  DART_LOG_DEBUG("dart_get_blocking: MPI_Wait");
-  if (MPI_Wait(&req, MPI_STATUS_IGNORE) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_get_blocking ! MPI_Wait failed");
+  if (dart__mpi__resolve_target(gptr, &win, &disp, &localptr) != DART_OK) {
     return DART_ERR_INVAL;
   }
 
-  DART_LOG_DEBUG("dart_get_blocking > finished");
-  return DART_OK;
-}
+  if (localptr != NULL) {
+    size_t dtype_size = dart__mpi__datatype_sizeof(dtype);
+    DART_LOG_TRACE("dart_put_strided: memcpy %zu blocks", nblocks);
+    dart__mpi__copy_strided(
+      localptr, src, nblocks, nelem_block * dtype_size,
+      dest_stride * dtype_size, src_stride * dtype_size);
+    return DART_OK;
+  }
 
-/* -- Dart RMA Synchronization Operations -- */
+  dart_ret_t   ret = DART_OK;
+  MPI_Datatype src_type, dest_type;
+  int          src_count, dest_count;
+  dart__base__mutex_lock(&dart__mpi__strided_types_mutex);
+  if (dart__mpi__strided_region(
+        dtype, nblocks, nelem_block, src_stride,
+        &src_type, &src_count) != DART_OK ||
+      dart__mpi__strided_region(
+        dtype, nblocks, nelem_block, dest_stride,
+        &dest_type, &dest_count) != DART_OK) {
+    ret = DART_ERR_INVAL;
+  } else {
+    DART_LOG_TRACE("dart_put_strided:  MPI_Put");
+    if (MPI_Put(src,
+                src_count,
+                src_type,
+                team_unit_id.id,
+                disp,
+                dest_count,
+                dest_type,
+                win) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_put_strided ! MPI_Put failed");
+      ret = DART_ERR_INVAL;
+    }
+  }
+  dart__base__mutex_unlock(&dart__mpi__strided_types_mutex);
 
-dart_ret_t dart_flush(
-  dart_gptr_t gptr)
-{
-  MPI_Win          win;
-  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
-  int16_t          seg_id       = gptr.segid;
-  DART_LOG_DEBUG("dart_flush() gptr: "
-                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
-                 gptr.unitid, gptr.addr_or_offs.offset,
-                 gptr.segid,  gptr.teamid);
+  DART_LOG_DEBUG("dart_put_strided > finished");
+  return ret;
+}
 
-  if (gptr.unitid < 0) {
-    DART_LOG_ERROR("dart_flush ! failed: gptr.unitid < 0");
+/**
+ * Creates an MPI data type describing the indexed region given by
+ * block lengths and displacements in number of elements.
+ * If \c displs is \c NULL, the blocks are contiguous and the basic type
+ * is returned.
+ * Types returned in \c mpi_type must be released using
+ * \c dart__mpi__indexed_type_free.
+ */
+static dart_ret_t dart__mpi__indexed_type(
+  dart_datatype_t   dtype,
+  size_t            nblocks,
+  const size_t    * nelems,
+  const size_t    * displs,
+  MPI_Datatype    * mpi_type,
+  int             * count)
+{
+  if (nblocks > INT_MAX) {
+    DART_LOG_ERROR("dart_*_indexed ! failed: nblocks > INT_MAX");
     return DART_ERR_INVAL;
   }
-
-  if (seg_id) {
-    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
-    if (team_data == NULL) {
-      DART_LOG_ERROR("dart_flush ! failed: Unknown team %i!", gptr.teamid);
-      return DART_ERR_INVAL;
-    }
-    win = team_data->window;
-  } else {
-    win = dart_win_local_alloc;
+  size_t nelem_total = 0;
+  for (size_t b = 0; b < nblocks; b++) {
+    nelem_total += nelems[b];
+  }
+  if (nelem_total > INT_MAX) {
+    DART_LOG_ERROR("dart_*_indexed ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  if (displs == NULL) {
+    *mpi_type = dart__mpi__datatype(dtype);
+    *count    = (int)nelem_total;
+    return DART_OK;
   }
 
-  DART_LOG_TRACE("dart_flush: MPI_Win_flush");
-  if (MPI_Win_flush(team_unit_id.id, win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush ! MPI_Win_flush failed!");
+  int      * blocklens  = malloc(sizeof(int) * nblocks);
+  MPI_Aint * bytedispls = malloc(sizeof(MPI_Aint) * nblocks);
+  if (blocklens == NULL || bytedispls == NULL) {
+    DART_LOG_ERROR("dart_*_indexed ! failed to allocate block descriptors");
+    free(blocklens);
+    free(bytedispls);
     return DART_ERR_OTHER;
   }
-  DART_LOG_TRACE("dart_flush: MPI_Win_sync");
-  if (MPI_Win_sync(win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush ! MPI_Win_sync failed!");
-    return DART_ERR_OTHER;
+  size_t     dtype_size = dart__mpi__datatype_sizeof(dtype);
+  for (size_t b = 0; b < nblocks; b++) {
+    blocklens[b]  = (int)nelems[b];
+    bytedispls[b] = (MPI_Aint)(displs[b] * dtype_size);
   }
-  DART_LOG_DEBUG("dart_flush > finished");
+  int mpi_ret = MPI_Type_create_hindexed(
+                  (int)nblocks,
+                  blocklens,
+                  bytedispls,
+                  dart__mpi__datatype(dtype),
+                  mpi_type);
+  free(blocklens);
+  free(bytedispls);
+  if (mpi_ret != MPI_SUCCESS || MPI_Type_commit(mpi_type) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_*_indexed ! failed to create indexed type");
+    return DART_ERR_INVAL;
+  }
+  *count = 1;
   return DART_OK;
 }
 
-dart_ret_t dart_flush_all(
-  dart_gptr_t gptr)
+static void dart__mpi__indexed_type_free(
+  dart_datatype_t   dtype,
+  MPI_Datatype    * mpi_type)
 {
-  MPI_Win win;
-  int16_t seg_id = gptr.segid;
-  DART_LOG_DEBUG("dart_flush_all() gptr: "
-                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
-                 gptr.unitid, gptr.addr_or_offs.offset,
-                 gptr.segid,  gptr.teamid);
-  if (gptr.unitid < 0) {
-    DART_LOG_ERROR("dart_flush_all ! failed: gptr.unitid < 0");
-    return DART_ERR_INVAL;
+  if (*mpi_type != dart__mpi__datatype(dtype)) {
+    MPI_Type_free(mpi_type);
   }
+}
 
-  if (seg_id) {
-    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
-    if (team_data == NULL) {
-      DART_LOG_ERROR("dart_flush_all ! failed: Unknown team %i!", gptr.teamid);
-      return DART_ERR_INVAL;
+static void dart__mpi__copy_indexed(
+  char            * dest,
+  const char      * src,
+  size_t            nblocks,
+  const size_t    * nelems,
+  const size_t    * dest_displs,
+  const size_t    * src_displs,
+  size_t            dtype_size)
+{
+  size_t dest_offs = 0;
+  size_t src_offs  = 0;
+  for (size_t b = 0; b < nblocks; b++) {
+    if (dest_displs != NULL) {
+      dest_offs = dest_displs[b] * dtype_size;
+    }
+    if (src_displs != NULL) {
+      src_offs  = src_displs[b] * dtype_size;
+    }
+    memcpy(dest + dest_offs, src + src_offs, nelems[b] * dtype_size);
+    if (dest_displs == NULL) {
+      dest_offs += nelems[b] * dtype_size;
+    }
+    if (src_displs == NULL) {
+      src_offs  += nelems[b] * dtype_size;
     }
-
-    win = team_data->window;
-  } else {
-    win = dart_win_local_alloc;
   }
-  DART_LOG_TRACE("dart_flush_all: MPI_Win_flush_all");
-  if (MPI_Win_flush_all(win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_all failed!");
-    return DART_ERR_OTHER;
-  }
-  DART_LOG_TRACE("dart_flush_all: MPI_Win_sync");
-  if (MPI_Win_sync(win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush_all ! MPI_Win_sync failed!");
-    return DART_ERR_OTHER;
-  }
-  DART_LOG_DEBUG("dart_flush_all > finished");
-  return DART_OK;
 }
 
-dart_ret_t dart_flush_local(
-  dart_gptr_t gptr)
+dart_ret_t dart_get_indexed(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nblocks,
+  const size_t    * nelems,
+  const size_t    * src_displs,
+  const size_t    * dest_displs,
+  dart_datatype_t   dtype)
 {
-  MPI_Win win;
-  int16_t seg_id = gptr.segid;
+  MPI_Win          win;
+  MPI_Aint         disp;
+  char           * localptr;
   dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
 
-  DART_LOG_DEBUG("dart_flush_local() gptr: "
-                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
-                 gptr.unitid, gptr.addr_or_offs.offset,
-                 gptr.segid,  gptr.teamid);
+  DART_LOG_DEBUG("dart_get_indexed() uid:%d o:%"PRIu64" s:%d t:%d "
+                 "nblocks:%zu",
+                 team_unit_id.id, gptr.addr_or_offs.offset, gptr.segid,
+                 gptr.teamid, nblocks);
 
-  if (gptr.unitid < 0) {
-    DART_LOG_ERROR("dart_flush_local ! failed: gptr.unitid < 0");
+  if (nblocks == 0) {
+    return DART_OK;
+  }
+  if (nblocks > INT_MAX || src_displs == NULL) {
+    DART_LOG_ERROR("dart_get_indexed ! failed: invalid blocks");
+    return DART_ERR_INVAL;
+  }
+  if (dart__mpi__resolve_target(gptr, &win, &disp, &localptr) != DART_OK) {
     return DART_ERR_INVAL;
   }
 
-  if (seg_id) {
-    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
-    if (team_data == NULL) {
-      DART_LOG_ERROR("dart_flush_local ! failed: Unknown team %i!", gptr.segid);
-      return DART_ERR_INVAL;
-    }
+  if (localptr != NULL) {
+    DART_LOG_TRACE("dart_get_indexed: memcpy %zu blocks", nblocks);
+    dart__mpi__copy_indexed(
+      dest, localptr, nblocks, nelems, dest_displs, src_displs,
+      dart__mpi__datatype_sizeof(dtype));
+    return DART_OK;
+  }
 
-    win = team_data->window;
-    DART_LOG_DEBUG("dart_flush_local() win:%"PRIu64" seg:%d unit:%d",
-                   (unsigned long)win, seg_id, team_unit_id.id);
-  } else {
-    win = dart_win_local_alloc;
-    DART_LOG_DEBUG("dart_flush_local() lwin:%"PRIu64" seg:%d unit:%d",
-                   (unsigned long)win, seg_id, team_unit_id.id);
+  MPI_Datatype src_type, dest_type;
+  int          src_count, dest_count;
+  dart_ret_t   ret = dart__mpi__indexed_type(
+                       dtype, nblocks, nelems, src_displs,
+                       &src_type, &src_count);
+  if (ret != DART_OK) {
+    return ret;
   }
-  DART_LOG_TRACE("dart_flush_local: MPI_Win_flush_local");
-  if (MPI_Win_flush_local(team_unit_id.id, win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_local failed!");
-    return DART_ERR_OTHER;
+  ret = dart__mpi__indexed_type(
+          dtype, nblocks, nelems, dest_displs,
+          &dest_type, &dest_count);
+  if (ret != DART_OK) {
+    dart__mpi__indexed_type_free(dtype, &src_type);
+    return ret;
   }
-  DART_LOG_DEBUG("dart_flush_local > finished");
-  return DART_OK;
+
+  DART_LOG_TRACE("dart_get_indexed:  MPI_Get");
+  if (MPI_Get(dest,
+              dest_count,
+              dest_type,
+              team_unit_id.id,
+              disp,
+              src_count,
+              src_type,
+              win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_get_indexed ! MPI_Get failed");
+    ret = DART_ERR_INVAL;
+  }
+  /*
+   * The pending operation completes normally after the types are freed.
+   */
+  dart__mpi__indexed_type_free(dtype, &src_type);
+  dart__mpi__indexed_type_free(dtype, &dest_type);
+
+  DART_LOG_DEBUG("dart_get_indexed > finished");
+  return ret;
 }
 
-dart_ret_t dart_flush_local_all(
-  dart_gptr_t gptr)
+dart_ret_t dart_put_indexed(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nblocks,
+  const size_t    * nelems,
+  const size_t    * dest_displs,
+  const size_t    * src_displs,
+  dart_datatype_t   dtype)
 {
-  int16_t seg_id = gptr.segid;
-  MPI_Win win;
-  DART_LOG_DEBUG("dart_flush_local_all() gptr: "
-                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
-                 gptr.unitid, gptr.addr_or_offs.offset,
-                 gptr.segid,  gptr.teamid);
+  MPI_Win          win;
+  MPI_Aint         disp;
+  char           * localptr;
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
 
-  if (gptr.unitid < 0) {
-    DART_LOG_ERROR("dart_flush_local_all ! failed: gptr.unitid < 0");
+  DART_LOG_DEBUG("dart_put_indexed() uid:%d o:%"PRIu64" s:%d t:%d "
+                 "nblocks:%zu",
+                 team_unit_id.id, gptr.addr_or_offs.offset, gptr.segid,
+                 gptr.teamid, nblocks);
+
+  if (nblocks == 0) {
+    return DART_OK;
+  }
+  if (nblocks > INT_MAX || dest_displs == NULL) {
+    DART_LOG_ERROR("dart_put_indexed ! failed: invalid blocks");
+    return DART_ERR_INVAL;
+  }
+  if (dart__mpi__resolve_target(gptr, &win, &disp, &localptr) != DART_OK) {
     return DART_ERR_INVAL;
   }
 
+  if (localptr != NULL) {
+    DART_LOG_TRACE("dart_put_indexed: memcpy %zu blocks", nblocks);
+    dart__mpi__copy_indexed(
+      localptr, src, nblocks, nelems, dest_displs, src_displs,
+      dart__mpi__datatype_sizeof(dtype));
+    return DART_OK;
+  }
 
-  if (seg_id) {
-    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
-    if (team_data == NULL) {
-      DART_LOG_ERROR("dart_flush_local_all ! failed: Unknown team %i!",
-                          gptr.teamid);
-      return DART_ERR_INVAL;
-    }
-    win = team_data->window;
-  } else {
-    win = dart_win_local_alloc;
+  MPI_Datatype src_type, dest_type;
+  int          src_count, dest_count;
+  dart_ret_t   ret = dart__mpi__indexed_type(
+                       dtype, nblocks, nelems, src_displs,
+                       &src_type, &src_count);
+  if (ret != DART_OK) {
+    return ret;
   }
-  if (MPI_Win_flush_local_all(win) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_local_all failed!");
-    return DART_ERR_OTHER;
+  ret = dart__mpi__indexed_type(
+          dtype, nblocks, nelems, dest_displs,
+          &dest_type, &dest_count);
+  if (ret != DART_OK) {
+    dart__mpi__indexed_type_free(dtype, &src_type);
+    return ret;
   }
-  DART_LOG_DEBUG("dart_flush_local_all > finished");
-  return DART_OK;
+
+  DART_LOG_TRACE("dart_put_indexed:  MPI_Put");
+  if (MPI_Put(src,
+              src_count,
+              src_type,
+              team_unit_id.id,
+              disp,
+              dest_count,
+              dest_type,
+              win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_put_indexed ! MPI_Put failed");
+    ret = DART_ERR_INVAL;
+  }
+  dart__mpi__indexed_type_free(dtype, &src_type);
+  dart__mpi__indexed_type_free(dtype, &dest_type);
+
+  DART_LOG_DEBUG("dart_put_indexed > finished");
+  return ret;
 }
 
-dart_ret_t dart_wait_local(
-  dart_handle_t handle)
+/* -- Aggregated dart one-sided operations -- */
+
+/**
+ * Default number of bytes buffered for a single target unit in an
+ * aggregation context before the buffered operations are issued.
+ */
+#define DART__MPI__AGGREGATION_THRESHOLD 16384
+
+typedef enum {
+  DART__MPI__AGG_PUT,
+  DART__MPI__AGG_GET,
+  DART__MPI__AGG_ACC
+} dart__mpi__agg_kind_t;
+
+/** Buffered operation, possibly merged from several adjacent ones. */
+typedef struct {
+  dart__mpi__agg_kind_t kind;
+  dart_operation_t      op;
+  dart_datatype_t       dtype;
+  MPI_Win               win;
+  /** Displacement of the first element in the target window. */
+  MPI_Aint              disp;
+  size_t                nelem;
+  /** Offset of the values in the target's data buffer for puts and
+   *  accumulates, local destination address for gets. */
+  union {
+    size_t              data_offset;
+    char              * dest;
+  } origin;
+} dart__mpi__agg_op_t;
+
+/** Operations buffered for a single target unit. */
+typedef struct {
+  dart__mpi__agg_op_t * ops;
+  size_t                num_ops;
+  size_t                ops_capacity;
+  char                * data;
+  size_t                data_size;
+  size_t                data_capacity;
+  /** Number of bytes transferred by the buffered operations. */
+  size_t                nbytes;
+  /** Whether the unit is in the context's list of pending units. */
+  int                   pending;
+} dart__mpi__agg_target_t;
+
+struct dart_aggregation_struct
 {
-  int mpi_ret;
-  DART_LOG_DEBUG("dart_wait_local() handle:%p", (void*)(handle));
-  if (handle != NULL) {
-    DART_LOG_TRACE("dart_wait_local:     handle->dest: %d",
-                   handle->dest);
-    DART_LOG_TRACE("dart_wait_local:     handle->win:  %p",
-                   (void*)(unsigned long)(handle->win));
-    DART_LOG_TRACE("dart_wait_local:     handle->req:  %ld",
-                   (long)handle->request);
-    if (handle->request != MPI_REQUEST_NULL) {
-      MPI_Status mpi_sta;
-      mpi_ret = MPI_Wait(&(handle->request), &mpi_sta);
-      DART_LOG_TRACE("dart_wait_local:        -- mpi_sta.MPI_SOURCE = %d",
-                     mpi_sta.MPI_SOURCE);
-      DART_LOG_TRACE("dart_wait_local:        -- mpi_sta.MPI_ERROR  = %d (%s)",
-                     mpi_sta.MPI_ERROR,
-                     DART__MPI__ERROR_STR(mpi_sta.MPI_ERROR));
-      if (mpi_ret != MPI_SUCCESS) {
-        DART_LOG_DEBUG("dart_wait_local ! MPI_Wait failed");
-        return DART_ERR_INVAL;
-      }
-    } else {
-      DART_LOG_TRACE("dart_wait_local:     handle->req == MPI_REQUEST_NULL");
+  dart_team_t               teamid;
+  size_t                    threshold;
+  dart__mpi__agg_target_t * targets;
+  size_t                    num_targets;
+  /** Units with buffered operations. */
+  dart_unit_t             * pending;
+  size_t                    num_pending;
+  /** Next context of the calling thread. */
+  struct dart_aggregation_struct * next;
+};
+
+/*
+ * Contexts created by the calling thread, flushed by the synchronization
+ * operations of this thread.
+ */
+static DART_THREAD_LOCAL struct dart_aggregation_struct *
+  dart__mpi__aggregations = NULL;
+
+static dart_ret_t dart__mpi__aggregation_flush_target(
+  struct dart_aggregation_struct * agg,
+  dart_unit_t                      unit)
+{
+  dart__mpi__agg_target_t * target = &agg->targets[unit];
+  MPI_Win last_win = MPI_WIN_NULL;
+  int     mpi_ret  = MPI_SUCCESS;
+  DART_LOG_TRACE("dart__mpi__aggregation_flush_target() unit:%d ops:%zu "
+                 "bytes:%zu", unit, target->num_ops, target->nbytes);
+  for (size_t i = 0; i < target->num_ops && mpi_ret == MPI_SUCCESS; i++) {
+    dart__mpi__agg_op_t * op       = &target->ops[i];
+    MPI_Datatype          mpi_type = dart__mpi__datatype(op->dtype);
+    switch (op->kind) {
+      case DART__MPI__AGG_PUT:
+        mpi_ret = MPI_Put(target->data + op->origin.data_offset,
+                          op->nelem, mpi_type, unit, op->disp,
+                          op->nelem, mpi_type, op->win);
+        break;
+      case DART__MPI__AGG_GET:
+        mpi_ret = MPI_Get(op->origin.dest,
+                          op->nelem, mpi_type, unit, op->disp,
+                          op->nelem, mpi_type, op->win);
+        break;
+      case DART__MPI__AGG_ACC:
+        mpi_ret = MPI_Accumulate(target->data + op->origin.data_offset,
+                                 op->nelem, mpi_type, unit, op->disp,
+                                 op->nelem, mpi_type,
+                                 dart__mpi__op(op->op), op->win);
+        break;
     }
-    /*
-     * Do not free handle resource, it could be needed for a following
-     * dart_wait() or dart_wait_all() to ensure remote completion.
-     */
   }
-  DART_LOG_DEBUG("dart_wait_local > finished");
+  /*
+   * Flush every window accessed, operations on the same window are
+   * usually buffered consecutively:
+   */
+  for (size_t i = 0; i < target->num_ops && mpi_ret == MPI_SUCCESS; i++) {
+    if (target->ops[i].win != last_win) {
+      last_win = target->ops[i].win;
+      mpi_ret  = MPI_Win_flush(unit, last_win);
+    }
+  }
+  target->num_ops   = 0;
+  target->data_size = 0;
+  target->nbytes    = 0;
+  if (mpi_ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__aggregation_flush_target ! "
+                   "MPI operation failed for unit %d", unit);
+    return DART_ERR_OTHER;
+  }
   return DART_OK;
 }
 
-dart_ret_t dart_wait(
-  dart_handle_t handle)
+static dart_ret_t dart__mpi__aggregation_flush_pending(
+  struct dart_aggregation_struct * agg)
 {
-  int mpi_ret;
-  DART_LOG_DEBUG("dart_wait() handle:%p", (void*)(handle));
-  if (handle != NULL) {
-    DART_LOG_TRACE("dart_wait_local:     handle->dest: %d",
-                   handle->dest);
-    DART_LOG_TRACE("dart_wait_local:     handle->win:  %"PRIu64"",
-                   (unsigned long)handle->win);
-    DART_LOG_TRACE("dart_wait_local:     handle->req:  %ld",
-                   (unsigned long)handle->request);
-    if (handle->request != MPI_REQUEST_NULL) {
-      MPI_Status mpi_sta;
-      DART_LOG_DEBUG("dart_wait:     -- MPI_Wait");
-      mpi_ret = MPI_Wait(&(handle->request), &mpi_sta);
-      DART_LOG_TRACE("dart_wait:        -- mpi_sta.MPI_SOURCE: %d",
-                     mpi_sta.MPI_SOURCE);
-      DART_LOG_TRACE("dart_wait:        -- mpi_sta.MPI_ERROR:  %d:%s",
-                     mpi_sta.MPI_ERROR,
-                     DART__MPI__ERROR_STR(mpi_sta.MPI_ERROR));
-      if (mpi_ret != MPI_SUCCESS) {
-        DART_LOG_DEBUG("dart_wait ! MPI_Wait failed");
-        return DART_ERR_INVAL;
-      }
-      DART_LOG_DEBUG("dart_wait:     -- MPI_Win_flush");
-      mpi_ret = MPI_Win_flush(handle->dest, handle->win);
-      if (mpi_ret != MPI_SUCCESS) {
-        DART_LOG_DEBUG("dart_wait ! MPI_Win_flush failed");
-        return DART_ERR_INVAL;
-      }
-    } else {
-      DART_LOG_TRACE("dart_wait:     handle->request: MPI_REQUEST_NULL");
+  dart_ret_t ret = DART_OK;
+  for (size_t p = 0; p < agg->num_pending; p++) {
+    agg->targets[agg->pending[p]].pending = 0;
+    if (dart__mpi__aggregation_flush_target(agg, agg->pending[p])
+        != DART_OK) {
+      ret = DART_ERR_OTHER;
     }
-    /* Free handle resource */
-    DART_LOG_DEBUG("dart_wait:   free handle %p", (void*)(handle));
-    free(handle);
-    handle = NULL;
   }
-  DART_LOG_DEBUG("dart_wait > finished");
-  return DART_OK;
+  agg->num_pending = 0;
+  return ret;
 }
 
-dart_ret_t dart_waitall_local(
-  dart_handle_t * handle,
-  size_t          num_handles)
+static dart_ret_t dart__mpi__aggregation_flush_team(
+  dart_team_t teamid)
 {
   dart_ret_t ret = DART_OK;
+  struct dart_aggregation_struct * agg;
+  for (agg = dart__mpi__aggregations; agg != NULL; agg = agg->next) {
+    if ((teamid == DART_UNDEFINED_TEAM_ID || agg->teamid == teamid) &&
+        dart__mpi__aggregation_flush_pending(agg) != DART_OK) {
+      ret = DART_ERR_OTHER;
+    }
+  }
+  return ret;
+}
 
-  DART_LOG_DEBUG("dart_waitall_local()");
-  if (num_handles == 0) {
-    DART_LOG_DEBUG("dart_waitall_local > number of handles = 0");
-    return DART_OK;
+/**
+ * Issues operations buffered in aggregation contexts of the calling thread
+ * for the given team before synchronization operations on the team.
+ */
+#define DART__MPI__AGGREGATION_SYNC(teamid) \
+  do { \
+    if (dart__mpi__aggregations != NULL) { \
+      dart__mpi__aggregation_flush_team(teamid); \
+    } \
+  } while (0)
+
+/**
+ * Appends an operation to the buffer of the target unit of \c gptr,
+ * merging it with the previous operation if both access adjacent memory.
+ * The values of puts and accumulates are copied to the buffer.
+ */
+static dart_ret_t dart__mpi__aggregation_add(
+  struct dart_aggregation_struct * agg,
+  dart__mpi__agg_kind_t            kind,
+  dart_gptr_t                      gptr,
+  void                           * buf,
+  size_t                           nelem,
+  dart_datatype_t                  dtype,
+  dart_operation_t                 op)
+{
+  MPI_Win  win;
+  MPI_Aint disp;
+  int      elem_size = dart__mpi__datatype_sizeof(dtype);
+  size_t   nbytes    = nelem * elem_size;
+  dart_unit_t unit   = gptr.unitid;
+
+  if (gptr.unitid < 0 || (size_t)gptr.unitid >= agg->num_targets) {
+    DART_LOG_ERROR("dart_aggregation ! invalid unit %d", gptr.unitid);
+    return DART_ERR_INVAL;
   }
-  if (num_handles > INT_MAX) {
-    DART_LOG_ERROR("dart_waitall_local ! number of handles > INT_MAX");
+  if (gptr.teamid != agg->teamid) {
+    DART_LOG_ERROR("dart_aggregation ! gptr of team %d in context of team %d",
+                   gptr.teamid, agg->teamid);
     return DART_ERR_INVAL;
   }
-  if (handle != NULL) {
-    size_t      i,
-                r_n = 0;
-    MPI_Status  *mpi_sta;
-    MPI_Request *mpi_req;
-    mpi_req = (MPI_Request *) malloc(num_handles * sizeof(MPI_Request));
-    mpi_sta = (MPI_Status  *) malloc(num_handles * sizeof(MPI_Status));
-    for (i = 0; i < num_handles; i++)  {
-      if (handle[i] != NULL && handle[i]->request != MPI_REQUEST_NULL) {
-        DART_LOG_TRACE("dart_waitall_local: -- handle[%"PRIu64"]: %p)",
-                       i, (void*)handle[i]);
-        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->dest: %d",
-                       i, handle[i]->dest);
-        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->win:  %p",
-                       i, (void*)((unsigned long)(handle[i]->win)));
-        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->req:  %p",
-                       i, (void*)((unsigned long)(handle[i]->request)));
-        mpi_req[r_n] = handle[i]->request;
-        r_n++;
-      }
+  if (elem_size <= 0 || nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_aggregation ! invalid data type or nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  dart_team_data_t * team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (team_data == NULL ||
+      dart__mpi__resolve_window(team_data, gptr, &win, &disp) != DART_OK) {
+    DART_LOG_ERROR("dart_aggregation ! failed to resolve gptr");
+    return DART_ERR_INVAL;
+  }
+
+  dart__mpi__agg_target_t * target = &agg->targets[unit];
+  if (target->nbytes + nbytes > agg->threshold && target->num_ops > 0) {
+    dart_ret_t ret = dart__mpi__aggregation_flush_target(agg, unit);
+    if (ret != DART_OK) {
+      return ret;
     }
-    /*
-     * Wait for local completion of MPI requests:
-     */
-    DART_LOG_DEBUG("dart_waitall_local: "
-                   "MPI_Waitall, %"PRIu64" requests from %"PRIu64" handles",
-                   r_n, num_handles);
-    if (r_n > 0) {
-      if (MPI_Waitall(r_n, mpi_req, mpi_sta) == MPI_SUCCESS) {
-        DART_LOG_DEBUG("dart_waitall_local: MPI_Waitall completed");
-      } else {
-        DART_LOG_ERROR("dart_waitall_local: MPI_Waitall failed");
-        DART_LOG_TRACE("dart_waitall_local: free MPI_Request temporaries");
-        free(mpi_req);
-        DART_LOG_TRACE("dart_waitall_local: free MPI_Status temporaries");
-        free(mpi_sta);
-        return DART_ERR_INVAL;
+  }
+
+  size_t data_offset = target->data_size;
+  if (kind != DART__MPI__AGG_GET) {
+    if (data_offset + nbytes > target->data_capacity) {
+      size_t capacity = target->data_capacity * 2;
+      if (capacity < data_offset + nbytes) {
+        capacity = data_offset + nbytes;
       }
-    } else {
-      DART_LOG_DEBUG("dart_waitall_local > number of requests = 0");
-      free(mpi_req);
-      free(mpi_sta);
+      char * data = realloc(target->data, capacity);
+      if (data == NULL) {
+        return DART_ERR_OTHER;
+      }
+      target->data          = data;
+      target->data_capacity = capacity;
+    }
+    memcpy(target->data + data_offset, buf, nbytes);
+    target->data_size += nbytes;
+  }
+  target->nbytes += nbytes;
+
+  if (target->num_ops > 0) {
+    dart__mpi__agg_op_t * last = &target->ops[target->num_ops - 1];
+    int adjacent = last->kind  == kind  &&
+                   last->dtype == dtype &&
+                   last->win   == win   &&
+                   last->op    == op    &&
+                   last->nelem + nelem <= INT_MAX &&
+                   last->disp + (MPI_Aint)(last->nelem * elem_size) == disp;
+    if (adjacent && kind == DART__MPI__AGG_GET) {
+      adjacent = (last->origin.dest + last->nelem * elem_size == buf);
+    }
+    if (adjacent) {
+      last->nelem += nelem;
       return DART_OK;
     }
-    /*
-     * copy MPI requests back to DART handles:
-     */
-    DART_LOG_TRACE("dart_waitall_local: "
-                   "copying MPI requests back to DART handles");
-    r_n = 0;
-    for (i = 0; i < num_handles; i++) {
-      if (handle[i]) {
-        DART_LOG_TRACE("dart_waitall_local: -- mpi_sta[%"PRIu64"].MPI_SOURCE:"
-                       " %d",
-                       r_n, mpi_sta[r_n].MPI_SOURCE);
-        DART_LOG_TRACE("dart_waitall_local: -- mpi_sta[%"PRIu64"].MPI_ERROR:"
-                       "  %d:%s",
-                       r_n,
-                       mpi_sta[r_n].MPI_ERROR,
-                       DART__MPI__ERROR_STR(mpi_sta[r_n].MPI_ERROR));
-        if (mpi_req[r_n] != MPI_REQUEST_NULL) {
-          if (mpi_sta[r_n].MPI_ERROR == MPI_SUCCESS) {
-            DART_LOG_TRACE("dart_waitall_local: -- MPI_Request_free");
-            if (MPI_Request_free(&mpi_req[r_n]) != MPI_SUCCESS) {
-              DART_LOG_TRACE("dart_waitall_local ! MPI_Request_free failed");
-              ret = DART_ERR_INVAL;
-              break;
-            }
-          } else {
-            DART_LOG_TRACE("dart_waitall_local: cannot free request %zu "
-                           "mpi_sta[%zu] = %d (%s)",
-                           r_n,
-                           r_n,
-                           mpi_sta[r_n].MPI_ERROR,
-                           DART__MPI__ERROR_STR(mpi_sta[r_n].MPI_ERROR));
-          }
-        }
-        DART_LOG_DEBUG("dart_waitall_local: free handle[%zu] %p",
-                       i, (void*)(handle[i]));
-        free(handle[i]);
-        handle[i] = NULL;
-        r_n++;
-      }
+  } else if (!target->pending) {
+    target->pending = 1;
+    agg->pending[agg->num_pending++] = unit;
+  }
+
+  if (target->num_ops == target->ops_capacity) {
+    size_t capacity = (target->ops_capacity > 0)
+                      ? target->ops_capacity * 2
+                      : 16;
+    dart__mpi__agg_op_t * ops = realloc(
+                                  target->ops,
+                                  capacity * sizeof(dart__mpi__agg_op_t));
+    if (ops == NULL) {
+      return DART_ERR_OTHER;
     }
-    DART_LOG_TRACE("dart_waitall_local: free MPI_Request temporaries");
-    free(mpi_req);
-    DART_LOG_TRACE("dart_waitall_local: free MPI_Status temporaries");
-    free(mpi_sta);
+    target->ops          = ops;
+    target->ops_capacity = capacity;
   }
-  DART_LOG_DEBUG("dart_waitall_local > %d", ret);
-  return ret;
+  dart__mpi__agg_op_t * new_op = &target->ops[target->num_ops++];
+  new_op->kind  = kind;
+  new_op->op    = op;
+  new_op->dtype = dtype;
+  new_op->win   = win;
+  new_op->disp  = disp;
+  new_op->nelem = nelem;
+  if (kind == DART__MPI__AGG_GET) {
+    new_op->origin.dest        = buf;
+  } else {
+    new_op->origin.data_offset = data_offset;
+  }
+  return DART_OK;
 }
 
-dart_ret_t dart_waitall(
-  dart_handle_t * handle,
-  size_t          n)
+dart_ret_t dart_aggregation_create(
+  dart_team_t          teamid,
+  size_t               threshold,
+  dart_aggregation_t * agg)
 {
-  size_t i, r_n;
-  DART_LOG_DEBUG("dart_waitall()");
-  if (n == 0) {
-    DART_LOG_ERROR("dart_waitall > number of handles = 0");
-    return DART_OK;
-  }
-  if (n > INT_MAX) {
-    DART_LOG_ERROR("dart_waitall ! number of handles > INT_MAX");
+  *agg = NULL;
+  dart_team_data_t * team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_aggregation_create ! failed: Unknown team %i!",
+                   teamid);
     return DART_ERR_INVAL;
   }
-  DART_LOG_DEBUG("dart_waitall: number of handles: %zu", n);
-  if (handle) {
-    MPI_Status  *mpi_sta;
-    MPI_Request *mpi_req;
-    mpi_req = (MPI_Request *) malloc(n * sizeof(MPI_Request));
-    mpi_sta = (MPI_Status *)  malloc(n * sizeof(MPI_Status));
-    /*
-     * copy requests from DART handles to MPI request array:
-     */
-    DART_LOG_TRACE("dart_waitall: copying DART handles to MPI request array");
-    r_n = 0;
-    for (i = 0; i < n; i++) {
-      if (handle[i] != NULL) {
-        DART_LOG_DEBUG("dart_waitall: -- handle[%zu](%p): "
-                       "dest:%d win:%"PRIu64" req:%"PRIu64"",
-                       i, (void*)handle[i],
-                       handle[i]->dest,
-                       (unsigned long)handle[i]->win,
-                       (unsigned long)handle[i]->request);
-        mpi_req[r_n] = handle[i]->request;
-        r_n++;
-      }
-    }
-    /*
-     * wait for communication of MPI requests:
-     */
-    DART_LOG_DEBUG("dart_waitall: MPI_Waitall, %zu requests from %zu handles",
-                   r_n, n);
-    /* From the MPI 3.1 standard:
-     *
-     * The i-th entry in array_of_statuses is set to the return
-     * status of the i-th operation. Active persistent requests
-     * are marked inactive.
-     * Requests of any other type are deallocated and the
-     * corresponding handles in the array are set to
-     * MPI_REQUEST_NULL.
-     * The list may contain null or inactive handles.
-     * The call sets to empty the status of each such entry.
-     */
-    if (r_n > 0) {
-      if (MPI_Waitall(r_n, mpi_req, mpi_sta) == MPI_SUCCESS) {
-        DART_LOG_DEBUG("dart_waitall: MPI_Waitall completed");
-      } else {
-        DART_LOG_ERROR("dart_waitall: MPI_Waitall failed");
-        DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
-        free(mpi_req);
-        DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
-        free(mpi_sta);
-        return DART_ERR_INVAL;
-      }
-    } else {
-      DART_LOG_DEBUG("dart_waitall > number of requests = 0");
-      free(mpi_req);
-      free(mpi_sta);
-      return DART_OK;
-    }
-    /*
-     * copy MPI requests back to DART handles:
-     */
-    DART_LOG_TRACE("dart_waitall: copying MPI requests back to DART handles");
-    r_n = 0;
-    for (i = 0; i < n; i++) {
-      if (handle[i]) {
-        if (mpi_req[r_n] == MPI_REQUEST_NULL) {
-          DART_LOG_TRACE("dart_waitall: -- mpi_req[%zu] = MPI_REQUEST_NULL",
-                         r_n);
-        } else {
-          DART_LOG_TRACE("dart_waitall: -- mpi_req[%zu]", r_n);
-        }
-        DART_LOG_TRACE("dart_waitall: -- mpi_sta[%zu].MPI_SOURCE: %d",
-                       r_n, mpi_sta[r_n].MPI_SOURCE);
-        DART_LOG_TRACE("dart_waitall: -- mpi_sta[%zu].MPI_ERROR:  %d:%s",
-                       r_n,
-                       mpi_sta[r_n].MPI_ERROR,
-                       DART__MPI__ERROR_STR(mpi_sta[r_n].MPI_ERROR));
-        handle[i]->request = mpi_req[r_n];
-        r_n++;
-      }
-    }
-    /*
-     * wait for completion of MPI requests at origins and targets:
-     */
-    DART_LOG_DEBUG("dart_waitall: waiting for remote completion");
-    for (i = 0; i < n; i++) {
-      if (handle[i]) {
-        if (handle[i]->request == MPI_REQUEST_NULL) {
-          DART_LOG_TRACE("dart_waitall: -- handle[%zu] done (MPI_REQUEST_NULL)",
-                         i);
-        } else {
-          DART_LOG_DEBUG("dart_waitall: -- MPI_Win_flush(handle[%zu]: %p))",
-                         i, (void*)handle[i]);
-          DART_LOG_TRACE("dart_waitall:      handle[%zu]->dest: %d",
-                         i, handle[i]->dest);
-          DART_LOG_TRACE("dart_waitall:      handle[%zu]->win:  %"PRIu64"",
-                         i, (unsigned long)handle[i]->win);
-          DART_LOG_TRACE("dart_waitall:      handle[%zu]->req:  %"PRIu64"",
-                         i, (unsigned long)handle[i]->request);
-          /*
-           * MPI_Win_flush to wait for remote completion:
-           */
-          if (MPI_Win_flush(handle[i]->dest, handle[i]->win) != MPI_SUCCESS) {
-            DART_LOG_ERROR("dart_waitall: MPI_Win_flush failed");
-            DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
-            free(mpi_req);
-            DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
-            free(mpi_sta);
-            return DART_ERR_INVAL;
-          }
-          DART_LOG_TRACE("dart_waitall: -- MPI_Request_free");
-          if (MPI_Request_free(&handle[i]->request) != MPI_SUCCESS) {
-            DART_LOG_ERROR("dart_waitall: MPI_Request_free failed");
-            DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
-            free(mpi_req);
-            DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
-            free(mpi_sta);
-            return DART_ERR_INVAL;
-          }
-        }
-      }
-    }
-    /*
-     * free memory:
-     */
-    DART_LOG_DEBUG("dart_waitall: free handles");
-    for (i = 0; i < n; i++) {
-      if (handle[i]) {
-        /* Free handle resource */
-        DART_LOG_TRACE("dart_waitall: -- free handle[%zu]: %p",
-                       i, (void*)(handle[i]));
-        free(handle[i]);
-        handle[i] = NULL;
-      }
-    }
-    DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
-    free(mpi_req);
-    DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
-    free(mpi_sta);
+  int nunits;
+  MPI_Comm_size(team_data->comm, &nunits);
+
+  struct dart_aggregation_struct * a =
+    malloc(sizeof(struct dart_aggregation_struct));
+  if (a == NULL) {
+    return DART_ERR_OTHER;
   }
-  DART_LOG_DEBUG("dart_waitall > finished");
+  a->teamid      = teamid;
+  a->threshold   = (threshold > 0)
+                   ? threshold
+                   : DART__MPI__AGGREGATION_THRESHOLD;
+  a->num_targets = nunits;
+  a->num_pending = 0;
+  a->targets     = calloc(nunits, sizeof(dart__mpi__agg_target_t));
+  a->pending     = malloc(nunits * sizeof(dart_unit_t));
+  if (a->targets == NULL || a->pending == NULL) {
+    free(a->targets);
+    free(a->pending);
+    free(a);
+    return DART_ERR_OTHER;
+  }
+  a->next = dart__mpi__aggregations;
+  dart__mpi__aggregations = a;
+  *agg = a;
+  DART_LOG_DEBUG("dart_aggregation_create > team:%d threshold:%zu ctx:%p",
+                 teamid, a->threshold, (void*)a);
   return DART_OK;
 }
 
-dart_ret_t dart_test_local(
-  dart_handle_t handle,
-  int32_t* is_finished)
+dart_ret_t dart_aggregation_destroy(
+  dart_aggregation_t * agg)
 {
-  DART_LOG_DEBUG("dart_test_local()");
-  if (!handle) {
-    *is_finished = 1;
+  struct dart_aggregation_struct * a = *agg;
+  if (a == NULL) {
     return DART_OK;
   }
-  MPI_Status mpi_sta;
-  MPI_Test (&(handle->request), is_finished, &mpi_sta);
-  DART_LOG_DEBUG("dart_test_local > finished");
-  return DART_OK;
+  dart_ret_t ret = dart__mpi__aggregation_flush_pending(a);
+  struct dart_aggregation_struct ** it = &dart__mpi__aggregations;
+  while (*it != NULL && *it != a) {
+    it = &(*it)->next;
+  }
+  if (*it == a) {
+    *it = a->next;
+  }
+  for (size_t u = 0; u < a->num_targets; u++) {
+    free(a->targets[u].ops);
+    free(a->targets[u].data);
+  }
+  free(a->targets);
+  free(a->pending);
+  free(a);
+  *agg = NULL;
+  return ret;
 }
 
-dart_ret_t dart_testall_local(
-  dart_handle_t * handle,
-  size_t          n,
-  int32_t       * is_finished)
+dart_ret_t dart_aggregation_put(
+  dart_aggregation_t   agg,
+  dart_gptr_t          gptr,
+  const void         * src,
+  size_t               nelem,
+  dart_datatype_t      dtype)
 {
-  size_t i, r_n;
-  DART_LOG_DEBUG("dart_testall_local()");
-  MPI_Status *mpi_sta;
-  MPI_Request *mpi_req;
-  mpi_req = (MPI_Request *)malloc(n * sizeof (MPI_Request));
-  mpi_sta = (MPI_Status *)malloc(n * sizeof (MPI_Status));
-  r_n = 0;
-  for (i = 0; i < n; i++) {
-    if (handle[i]){
-      mpi_req[r_n] = handle[i] -> request;
-      r_n++;
-    }
+  return dart__mpi__aggregation_add(
+           agg, DART__MPI__AGG_PUT, gptr, (void *)src, nelem, dtype,
+           DART_OP_REPLACE);
+}
+
+dart_ret_t dart_aggregation_get(
+  dart_aggregation_t   agg,
+  void               * dest,
+  dart_gptr_t          gptr,
+  size_t               nelem,
+  dart_datatype_t      dtype)
+{
+  return dart__mpi__aggregation_add(
+           agg, DART__MPI__AGG_GET, gptr, dest, nelem, dtype,
+           DART_OP_NO_OP);
+}
+
+dart_ret_t dart_aggregation_accumulate(
+  dart_aggregation_t   agg,
+  dart_gptr_t          gptr,
+  const void         * values,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  dart_operation_t     op)
+{
+  return dart__mpi__aggregation_add(
+           agg, DART__MPI__AGG_ACC, gptr, (void *)values, nelem, dtype, op);
+}
+
+dart_ret_t dart_aggregation_flush(
+  dart_aggregation_t   agg)
+{
+  DART_LOG_DEBUG("dart_aggregation_flush() ctx:%p pending units:%zu",
+                 (void*)agg, agg->num_pending);
+  return dart__mpi__aggregation_flush_pending(agg);
+}
+
+/* -- Blocking dart one-sided operations -- */
+
+/**
+ * \todo Check if MPI_Get_accumulate (MPI_NO_OP) yields better performance
+ */
+dart_ret_t dart_put_blocking(
+  dart_gptr_t     gptr,
+  const void    * src,
+  size_t          nelem,
+  dart_datatype_t dtype)
+{
+  MPI_Win           win;
+  MPI_Datatype      mpi_dtype    = dart__mpi__datatype(dtype);
+  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t          offset       = gptr.addr_or_offs.offset;
+  int16_t           seg_id       = gptr.segid;
+
+  if (gptr.unitid < 0) {
+    DART_LOG_ERROR("dart_put_blocking ! failed: gptr.unitid < 0");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_put_blocking ! failed: Unknown team %i!", gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  DART_LOG_DEBUG("dart_put_blocking() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
+                 team_unit_id.id, offset, seg_id, gptr.teamid, nelem);
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  DART_LOG_DEBUG("dart_put_blocking: shared windows enabled");
+  if (seg_id >= 0) {
+    /*
+     * Use memcpy if the target is in the same node as the calling unit:
+     * The value of i will be the target's relative ID in teamid.
+     */
+    dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
+    if (dart__mpi__is_sharedmem(team_data, gptr)) {
+      char * baseptr;
+      DART_LOG_DEBUG("dart_put_blocking: shared memory segment, seg_id:%d",
+                     seg_id);
+      if (seg_id) {
+        if (dart_segment_get_baseptr(
+                &team_data->segdata,
+                seg_id,
+                luid,
+                &baseptr) != DART_OK) {
+          DART_LOG_ERROR("dart_put_blocking ! "
+                         "dart_adapt_transtable_get_baseptr failed");
+          return DART_ERR_INVAL;
+        }
+        baseptr += offset;
+      } else {
+        baseptr = dart__mpi__sharedmem_localalloc_ptr(luid.id, offset);
+      }
+      DART_LOG_DEBUG("dart_put_blocking: memcpy %zu bytes",
+                        nelem * dart__mpi__datatype_sizeof(dtype));
+      memcpy(baseptr, src, nelem * dart__mpi__datatype_sizeof(dtype));
+      return DART_OK;
+    }
+  }
+#else
+  DART_LOG_DEBUG("dart_put_blocking: shared windows disabled");
+#endif /* !defined(DART_MPI_DISABLE_SHARED_WINDOWS) */
+  /*
+   * MPI shared windows disabled or target and calling unit are on different
+   * nodes, use MPI_Rput:
+   */
+  if (seg_id) {
+    MPI_Aint disp_s;
+    if (dart_segment_get_disp(
+          &team_data->segdata,
+          seg_id,
+          team_unit_id,
+          &disp_s) != DART_OK) {
+      DART_LOG_ERROR("dart_put_blocking ! "
+                     "dart_adapt_transtable_get_disp failed");
+      return DART_ERR_INVAL;
+    }
+
+    /* copy data directly if we are on the same unit */
+    if (team_unit_id.id == team_data->unitid) {
+      memcpy(((void*)disp_s) + offset, src,
+          nelem*dart__mpi__datatype_sizeof(dtype));
+      DART_LOG_DEBUG("dart_put: memcpy nelem:%zu "
+                     "target unit: %d offset: %"PRIu64"",
+                     nelem, team_unit_id.id, offset);
+      return DART_OK;
+    }
+
+    win = team_data->window;
+    offset += disp_s;
+    DART_LOG_DEBUG("dart_put_blocking:  nelem:%zu "
+                   "target (coll.): win:%p unit:%d offset:%lu "
+                   "<- source: %p",
+                   nelem, win, team_unit_id.id,
+                   offset, src);
+
+  } else {
+
+    /* copy data directly if we are on the same unit */
+    if (team_unit_id.id == team_data->unitid) {
+      memcpy((char *)(uintptr_t)offset, src,
+          nelem * dart__mpi__datatype_sizeof(dtype));
+      DART_LOG_DEBUG("dart_put: memcpy nelem:%zu offset: %"PRIu64"",
+                     nelem, offset);
+      return DART_OK;
+    }
+
+    win      = dart_win_local_alloc;
+    DART_LOG_DEBUG("dart_put_blocking:  nelem:%zu "
+                   "target (local): win:%p unit:%d offset:%lu "
+                   "<- source: %p",
+                   nelem, win, team_unit_id.id,
+                   offset, src);
+  }
+
+  /*
+   * Using MPI_Put as MPI_Win_flush is required to ensure remote completion.
+   */
+  int count;
+  if (dart__mpi__contiguous_type(dtype, nelem, &mpi_dtype, &count)
+      != DART_OK) {
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart_put_blocking: MPI_Put");
+  int mpi_ret = MPI_Put(src,
+                        count,
+                        mpi_dtype,
+                        team_unit_id.id,
+                        offset,
+                        count,
+                        mpi_dtype,
+                        win);
+  dart__mpi__contiguous_type_free(nelem, &mpi_dtype);
+  if (mpi_ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_put_blocking ! MPI_Put failed");
+    return DART_ERR_INVAL;
+  }
+
+  DART_LOG_DEBUG("dart_put_blocking: MPI_Win_flush");
+  if (MPI_Win_flush(team_unit_id.id, win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_put_blocking ! MPI_Win_flush failed");
+    return DART_ERR_INVAL;
+  }
+
+  DART_LOG_DEBUG("dart_put_blocking > finished");
+  return DART_OK;
+}
+
+/**
+ * \todo Check if MPI_Accumulate (REPLACE) yields better performance
+ */
+dart_ret_t dart_get_blocking(
+  void          * dest,
+  dart_gptr_t     gptr,
+  size_t          nelem,
+  dart_datatype_t dtype)
+{
+  MPI_Win           win;
+  MPI_Datatype      mpi_dtype    = dart__mpi__datatype(dtype);
+  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t          offset       = gptr.addr_or_offs.offset;
+  int16_t           seg_id       = gptr.segid;
+
+  if (gptr.unitid < 0) {
+    DART_LOG_ERROR("dart_get_blocking ! failed: gptr.unitid < 0");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_get_blocking ! failed: Unknown team %i!", gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  DART_LOG_DEBUG("dart_get_blocking() uid:%d "
+                 "o:%"PRIu64" s:%d t:%u, nelem:%zu",
+                 team_unit_id.id,
+                 offset, seg_id, gptr.teamid, nelem);
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  DART_LOG_DEBUG("dart_get_blocking: shared windows enabled");
+  if (dart__mpi__is_sharedmem(team_data, gptr)) {
+    return get_shared_mem(team_data, dest, gptr, nelem, dtype);
+  }
+#else
+  DART_LOG_DEBUG("dart_get_blocking: shared windows disabled");
+#endif /* !defined(DART_MPI_DISABLE_SHARED_WINDOWS) */
+  /*
+   * MPI shared windows disabled or target and calling unit are on different
+   * nodes, use MPI_Rget:
+   */
+  if (seg_id) {
+    MPI_Aint disp_s;
+    if (dart_segment_get_disp(
+          &team_data->segdata,
+          seg_id,
+          team_unit_id,
+          &disp_s) != DART_OK) {
+      DART_LOG_ERROR("dart_get_blocking ! "
+                     "dart_adapt_transtable_get_disp failed");
+      return DART_ERR_INVAL;
+    }
+
+    if (team_data->unitid == team_unit_id.id) {
+      // use direct memcpy if we are on the same unit
+      memcpy(dest, ((void*)disp_s) + offset,
+          nelem * dart__mpi__datatype_sizeof(dtype));
+      DART_LOG_DEBUG("dart_get_blocking: memcpy nelem:%zu "
+                     "source (coll.): offset:%lu -> dest: %p",
+                     nelem, offset, dest);
+      return DART_OK;
+    }
+
+    win     = team_data->window;
+    offset += disp_s;
+    DART_LOG_DEBUG("dart_get_blocking:  nelem:%zu "
+                   "source (coll.): win:%p unit:%d offset:%lu "
+                   "-> dest: %p",
+                   nelem, win, team_unit_id.id,
+                   offset, dest);
+
+  } else {
+
+    if (team_data->unitid == team_unit_id.id) {
+      /* use direct memcpy if we are on the same unit */
+      memcpy(dest, (char *)(uintptr_t)offset,
+          nelem * dart__mpi__datatype_sizeof(dtype));
+      DART_LOG_DEBUG("dart_get_blocking: memcpy nelem:%zu "
+                     "source (coll.): offset:%lu -> dest: %p",
+                     nelem, offset, dest);
+      return DART_OK;
+    }
+
+    win = dart_win_local_alloc;
+    DART_LOG_DEBUG("dart_get_blocking:  nelem:%zu "
+                   "source (local): win:%p unit:%d offset:%lu "
+                   "-> dest: %p",
+                   nelem, win, team_unit_id.id,
+                   offset, dest);
+  }
+
+  /*
+   * Using MPI_Get as MPI_Win_flush is required to ensure remote completion.
+   */
+  int count;
+  if (dart__mpi__contiguous_type(dtype, nelem, &mpi_dtype, &count)
+      != DART_OK) {
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart_get_blocking: MPI_Rget");
+  MPI_Request req;
+  int mpi_ret = MPI_Rget(dest,
+                         count,
+                         mpi_dtype,
+                         team_unit_id.id,
+                         offset,
+                         count,
+                         mpi_dtype,
+                         win,
+                         &req);
+  dart__mpi__contiguous_type_free(nelem, &mpi_dtype);
+  if (mpi_ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_get_blocking ! MPI_Rget failed");
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart_get_blocking: MPI_Wait");
+  if (MPI_Wait(&req, MPI_STATUS_IGNORE) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_get_blocking ! MPI_Wait failed");
+    return DART_ERR_INVAL;
+  }
+
+  DART_LOG_DEBUG("dart_get_blocking > finished");
+  return DART_OK;
+}
+
+/* -- Dart RMA Synchronization Operations -- */
+
+dart_ret_t dart_flush(
+  dart_gptr_t gptr)
+{
+  MPI_Win          win;
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  int16_t          seg_id       = gptr.segid;
+  DART_LOG_DEBUG("dart_flush() gptr: "
+                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
+                 gptr.unitid, gptr.addr_or_offs.offset,
+                 gptr.segid,  gptr.teamid);
+
+  DART__MPI__AGGREGATION_SYNC(gptr.teamid);
+
+  if (gptr.unitid < 0) {
+    DART_LOG_ERROR("dart_flush ! failed: gptr.unitid < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (seg_id) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+    if (team_data == NULL) {
+      DART_LOG_ERROR("dart_flush ! failed: Unknown team %i!", gptr.teamid);
+      return DART_ERR_INVAL;
+    }
+    win = team_data->window;
+  } else {
+    win = dart_win_local_alloc;
+  }
+
+  DART_LOG_TRACE("dart_flush: MPI_Win_flush");
+  if (MPI_Win_flush(team_unit_id.id, win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush ! MPI_Win_flush failed!");
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_TRACE("dart_flush: MPI_Win_sync");
+  if (MPI_Win_sync(win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush ! MPI_Win_sync failed!");
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_DEBUG("dart_flush > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_flush_all(
+  dart_gptr_t gptr)
+{
+  MPI_Win win;
+  int16_t seg_id = gptr.segid;
+  DART_LOG_DEBUG("dart_flush_all() gptr: "
+                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
+                 gptr.unitid, gptr.addr_or_offs.offset,
+                 gptr.segid,  gptr.teamid);
+  DART__MPI__AGGREGATION_SYNC(gptr.teamid);
+
+  if (gptr.unitid < 0) {
+    DART_LOG_ERROR("dart_flush_all ! failed: gptr.unitid < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (seg_id) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+    if (team_data == NULL) {
+      DART_LOG_ERROR("dart_flush_all ! failed: Unknown team %i!", gptr.teamid);
+      return DART_ERR_INVAL;
+    }
+
+    win = team_data->window;
+  } else {
+    win = dart_win_local_alloc;
+  }
+  DART_LOG_TRACE("dart_flush_all: MPI_Win_flush_all");
+  if (MPI_Win_flush_all(win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_all failed!");
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_TRACE("dart_flush_all: MPI_Win_sync");
+  if (MPI_Win_sync(win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush_all ! MPI_Win_sync failed!");
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_DEBUG("dart_flush_all > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_flush_local(
+  dart_gptr_t gptr)
+{
+  MPI_Win win;
+  int16_t seg_id = gptr.segid;
+  dart_team_unit_t team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+
+  DART_LOG_DEBUG("dart_flush_local() gptr: "
+                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
+                 gptr.unitid, gptr.addr_or_offs.offset,
+                 gptr.segid,  gptr.teamid);
+
+  DART__MPI__AGGREGATION_SYNC(gptr.teamid);
+
+  if (gptr.unitid < 0) {
+    DART_LOG_ERROR("dart_flush_local ! failed: gptr.unitid < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (seg_id) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+    if (team_data == NULL) {
+      DART_LOG_ERROR("dart_flush_local ! failed: Unknown team %i!", gptr.segid);
+      return DART_ERR_INVAL;
+    }
+
+    win = team_data->window;
+    DART_LOG_DEBUG("dart_flush_local() win:%"PRIu64" seg:%d unit:%d",
+                   (unsigned long)win, seg_id, team_unit_id.id);
+  } else {
+    win = dart_win_local_alloc;
+    DART_LOG_DEBUG("dart_flush_local() lwin:%"PRIu64" seg:%d unit:%d",
+                   (unsigned long)win, seg_id, team_unit_id.id);
+  }
+  DART_LOG_TRACE("dart_flush_local: MPI_Win_flush_local");
+  if (MPI_Win_flush_local(team_unit_id.id, win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_local failed!");
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_DEBUG("dart_flush_local > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_flush_local_all(
+  dart_gptr_t gptr)
+{
+  int16_t seg_id = gptr.segid;
+  MPI_Win win;
+  DART_LOG_DEBUG("dart_flush_local_all() gptr: "
+                 "unitid:%d offset:%"PRIu64" segid:%d teamid:%d",
+                 gptr.unitid, gptr.addr_or_offs.offset,
+                 gptr.segid,  gptr.teamid);
+
+  DART__MPI__AGGREGATION_SYNC(gptr.teamid);
+
+  if (gptr.unitid < 0) {
+    DART_LOG_ERROR("dart_flush_local_all ! failed: gptr.unitid < 0");
+    return DART_ERR_INVAL;
+  }
+
+
+  if (seg_id) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+    if (team_data == NULL) {
+      DART_LOG_ERROR("dart_flush_local_all ! failed: Unknown team %i!",
+                          gptr.teamid);
+      return DART_ERR_INVAL;
+    }
+    win = team_data->window;
+  } else {
+    win = dart_win_local_alloc;
+  }
+  if (MPI_Win_flush_local_all(win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_local_all failed!");
+    return DART_ERR_OTHER;
+  }
+  DART_LOG_DEBUG("dart_flush_local_all > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_wait_local(
+  dart_handle_t handle)
+{
+  int mpi_ret;
+  DART_LOG_DEBUG("dart_wait_local() handle:%p", (void*)(handle));
+  if (handle != NULL) {
+    DART_LOG_TRACE("dart_wait_local:     handle->dest: %d",
+                   handle->dest);
+    DART_LOG_TRACE("dart_wait_local:     handle->win:  %p",
+                   (void*)(unsigned long)(handle->win));
+    DART_LOG_TRACE("dart_wait_local:     handle->req:  %ld",
+                   (long)handle->request);
+    if (handle->request != MPI_REQUEST_NULL) {
+      MPI_Status mpi_sta;
+      mpi_ret = MPI_Wait(&(handle->request), &mpi_sta);
+      DART_LOG_TRACE("dart_wait_local:        -- mpi_sta.MPI_SOURCE = %d",
+                     mpi_sta.MPI_SOURCE);
+      DART_LOG_TRACE("dart_wait_local:        -- mpi_sta.MPI_ERROR  = %d (%s)",
+                     mpi_sta.MPI_ERROR,
+                     DART__MPI__ERROR_STR(mpi_sta.MPI_ERROR));
+      if (mpi_ret != MPI_SUCCESS) {
+        DART_LOG_DEBUG("dart_wait_local ! MPI_Wait failed");
+        return DART_ERR_INVAL;
+      }
+    } else {
+      DART_LOG_TRACE("dart_wait_local:     handle->req == MPI_REQUEST_NULL");
+    }
+    /*
+     * Do not free handle resource, it could be needed for a following
+     * dart_wait() or dart_wait_all() to ensure remote completion.
+     */
+  }
+  DART_LOG_DEBUG("dart_wait_local > finished");
+  return DART_OK;
+}
+
+/*
+ * Number of requests in wait and test operations on arrays of handles up to
+ * which temporary request and status arrays are placed on the stack.
+ */
+#define DART__MPI__REQUEST_STACK_SIZE 64
+
+static inline void * dart__mpi__tmp_alloc(
+  void   * stack_buf,
+  size_t   nelem,
+  size_t   elem_size)
+{
+  return (nelem <= DART__MPI__REQUEST_STACK_SIZE)
+         ? stack_buf
+         : malloc(nelem * elem_size);
+}
+
+static inline void dart__mpi__tmp_free(
+  void * buf,
+  void * stack_buf)
+{
+  if (buf != stack_buf) {
+    free(buf);
+  }
+}
+
+dart_ret_t dart_wait(
+  dart_handle_t handle)
+{
+  int mpi_ret;
+  DART_LOG_DEBUG("dart_wait() handle:%p", (void*)(handle));
+  if (handle != NULL) {
+    DART_LOG_TRACE("dart_wait_local:     handle->dest: %d",
+                   handle->dest);
+    DART_LOG_TRACE("dart_wait_local:     handle->win:  %"PRIu64"",
+                   (unsigned long)handle->win);
+    DART_LOG_TRACE("dart_wait_local:     handle->req:  %ld",
+                   (unsigned long)handle->request);
+    if (handle->request != MPI_REQUEST_NULL) {
+      MPI_Status mpi_sta;
+      DART_LOG_DEBUG("dart_wait:     -- MPI_Wait");
+      mpi_ret = MPI_Wait(&(handle->request), &mpi_sta);
+      DART_LOG_TRACE("dart_wait:        -- mpi_sta.MPI_SOURCE: %d",
+                     mpi_sta.MPI_SOURCE);
+      DART_LOG_TRACE("dart_wait:        -- mpi_sta.MPI_ERROR:  %d:%s",
+                     mpi_sta.MPI_ERROR,
+                     DART__MPI__ERROR_STR(mpi_sta.MPI_ERROR));
+      if (mpi_ret != MPI_SUCCESS) {
+        DART_LOG_DEBUG("dart_wait ! MPI_Wait failed");
+        return DART_ERR_INVAL;
+      }
+      /* Handles of collective operations are not associated to a window: */
+      if (handle->win != MPI_WIN_NULL) {
+        DART_LOG_DEBUG("dart_wait:     -- MPI_Win_flush");
+        mpi_ret = MPI_Win_flush(handle->dest, handle->win);
+        if (mpi_ret != MPI_SUCCESS) {
+          DART_LOG_DEBUG("dart_wait ! MPI_Win_flush failed");
+          return DART_ERR_INVAL;
+        }
+      }
+    } else {
+      DART_LOG_TRACE("dart_wait:     handle->request: MPI_REQUEST_NULL");
+    }
+    /* Free handle resource */
+    DART_LOG_DEBUG("dart_wait:   free handle %p", (void*)(handle));
+    dart__mpi__handle_free(handle);
+    handle = NULL;
+  }
+  DART_LOG_DEBUG("dart_wait > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_waitall_local(
+  dart_handle_t * handle,
+  size_t          num_handles)
+{
+  dart_ret_t ret = DART_OK;
+
+  DART_LOG_DEBUG("dart_waitall_local()");
+  if (num_handles == 0) {
+    DART_LOG_DEBUG("dart_waitall_local > number of handles = 0");
+    return DART_OK;
+  }
+  if (num_handles > INT_MAX) {
+    DART_LOG_ERROR("dart_waitall_local ! number of handles > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  if (handle != NULL) {
+    size_t      i,
+                r_n = 0;
+    MPI_Status  *mpi_sta;
+    MPI_Request *mpi_req;
+    MPI_Status   mpi_sta_buf[DART__MPI__REQUEST_STACK_SIZE];
+    MPI_Request  mpi_req_buf[DART__MPI__REQUEST_STACK_SIZE];
+    mpi_req = dart__mpi__tmp_alloc(
+                mpi_req_buf, num_handles, sizeof(MPI_Request));
+    mpi_sta = dart__mpi__tmp_alloc(
+                mpi_sta_buf, num_handles, sizeof(MPI_Status));
+    for (i = 0; i < num_handles; i++)  {
+      if (handle[i] != NULL && handle[i]->request != MPI_REQUEST_NULL) {
+        DART_LOG_TRACE("dart_waitall_local: -- handle[%"PRIu64"]: %p)",
+                       i, (void*)handle[i]);
+        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->dest: %d",
+                       i, handle[i]->dest);
+        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->win:  %p",
+                       i, (void*)((unsigned long)(handle[i]->win)));
+        DART_LOG_TRACE("dart_waitall_local:    handle[%"PRIu64"]->req:  %p",
+                       i, (void*)((unsigned long)(handle[i]->request)));
+        mpi_req[r_n] = handle[i]->request;
+        r_n++;
+      }
+    }
+    /*
+     * Wait for local completion of MPI requests:
+     */
+    DART_LOG_DEBUG("dart_waitall_local: "
+                   "MPI_Waitall, %"PRIu64" requests from %"PRIu64" handles",
+                   r_n, num_handles);
+    if (r_n > 0) {
+      if (MPI_Waitall(r_n, mpi_req, mpi_sta) == MPI_SUCCESS) {
+        DART_LOG_DEBUG("dart_waitall_local: MPI_Waitall completed");
+      } else {
+        DART_LOG_ERROR("dart_waitall_local: MPI_Waitall failed");
+        DART_LOG_TRACE("dart_waitall_local: free MPI_Request temporaries");
+        dart__mpi__tmp_free(mpi_req, mpi_req_buf);
+        DART_LOG_TRACE("dart_waitall_local: free MPI_Status temporaries");
+        dart__mpi__tmp_free(mpi_sta, mpi_sta_buf);
+        return DART_ERR_INVAL;
+      }
+    } else {
+      DART_LOG_DEBUG("dart_waitall_local > number of requests = 0");
+      dart__mpi__tmp_free(mpi_req, mpi_req_buf);
+      dart__mpi__tmp_free(mpi_sta, mpi_sta_buf);
+      return DART_OK;
+    }
+    /*
+     * copy MPI requests back to DART handles:
+     */
+    DART_LOG_TRACE("dart_waitall_local: "
+                   "copying MPI requests back to DART handles");
+    r_n = 0;
+    for (i = 0; i < num_handles; i++) {
+      if (handle[i]) {
+        DART_LOG_TRACE("dart_waitall_local: -- mpi_sta[%"PRIu64"].MPI_SOURCE:"
+                       " %d",
+                       r_n, mpi_sta[r_n].MPI_SOURCE);
+        DART_LOG_TRACE("dart_waitall_local: -- mpi_sta[%"PRIu64"].MPI_ERROR:"
+                       "  %d:%s",
+                       r_n,
+                       mpi_sta[r_n].MPI_ERROR,
+                       DART__MPI__ERROR_STR(mpi_sta[r_n].MPI_ERROR));
+        if (mpi_req[r_n] != MPI_REQUEST_NULL) {
+          if (mpi_sta[r_n].MPI_ERROR == MPI_SUCCESS) {
+            DART_LOG_TRACE("dart_waitall_local: -- MPI_Request_free");
+            if (MPI_Request_free(&mpi_req[r_n]) != MPI_SUCCESS) {
+              DART_LOG_TRACE("dart_waitall_local ! MPI_Request_free failed");
+              ret = DART_ERR_INVAL;
+              break;
+            }
+          } else {
+            DART_LOG_TRACE("dart_waitall_local: cannot free request %zu "
+                           "mpi_sta[%zu] = %d (%s)",
+                           r_n,
+                           r_n,
+                           mpi_sta[r_n].MPI_ERROR,
+                           DART__MPI__ERROR_STR(mpi_sta[r_n].MPI_ERROR));
+          }
+        }
+        DART_LOG_DEBUG("dart_waitall_local: free handle[%zu] %p",
+                       i, (void*)(handle[i]));
+        dart__mpi__handle_free(handle[i]);
+        handle[i] = NULL;
+        r_n++;
+      }
+    }
+    DART_LOG_TRACE("dart_waitall_local: free MPI_Request temporaries");
+    dart__mpi__tmp_free(mpi_req, mpi_req_buf);
+    DART_LOG_TRACE("dart_waitall_local: free MPI_Status temporaries");
+    dart__mpi__tmp_free(mpi_sta, mpi_sta_buf);
+  }
+  DART_LOG_DEBUG("dart_waitall_local > %d", ret);
+  return ret;
+}
+
+dart_ret_t dart_waitall(
+  dart_handle_t * handle,
+  size_t          n)
+{
+  size_t i, r_n;
+  DART_LOG_DEBUG("dart_waitall()");
+  if (n == 0) {
+    DART_LOG_ERROR("dart_waitall > number of handles = 0");
+    return DART_OK;
+  }
+  if (n > INT_MAX) {
+    DART_LOG_ERROR("dart_waitall ! number of handles > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_DEBUG("dart_waitall: number of handles: %zu", n);
+  if (handle) {
+    MPI_Status  *mpi_sta;
+    MPI_Request *mpi_req;
+    MPI_Status   mpi_sta_buf[DART__MPI__REQUEST_STACK_SIZE];
+    MPI_Request  mpi_req_buf[DART__MPI__REQUEST_STACK_SIZE];
+    mpi_req = dart__mpi__tmp_alloc(mpi_req_buf, n, sizeof(MPI_Request));
+    mpi_sta = dart__mpi__tmp_alloc(mpi_sta_buf, n, sizeof(MPI_Status));
+    /*
+     * copy requests from DART handles to MPI request array:
+     */
+    DART_LOG_TRACE("dart_waitall: copying DART handles to MPI request array");
+    r_n = 0;
+    for (i = 0; i < n; i++) {
+      if (handle[i] != NULL) {
+        DART_LOG_DEBUG("dart_waitall: -- handle[%zu](%p): "
+                       "dest:%d win:%"PRIu64" req:%"PRIu64"",
+                       i, (void*)handle[i],
+                       handle[i]->dest,
+                       (unsigned long)handle[i]->win,
+                       (unsigned long)handle[i]->request);
+        mpi_req[r_n] = handle[i]->request;
+        r_n++;
+      }
+    }
+    /*
+     * wait for communication of MPI requests:
+     */
+    DART_LOG_DEBUG("dart_waitall: MPI_Waitall, %zu requests from %zu handles",
+                   r_n, n);
+    /* From the MPI 3.1 standard:
+     *
+     * The i-th entry in array_of_statuses is set to the return
+     * status of the i-th operation. Active persistent requests
+     * are marked inactive.
+     * Requests of any other type are deallocated and the
+     * corresponding handles in the array are set to
+     * MPI_REQUEST_NULL.
+     * The list may contain null or inactive handles.
+     * The call sets to empty the status of each such entry.
+     */
+    if (r_n > 0) {
+      if (MPI_Waitall(r_n, mpi_req, mpi_sta) == MPI_SUCCESS) {
+        DART_LOG_DEBUG("dart_waitall: MPI_Waitall completed");
+      } else {
+        DART_LOG_ERROR("dart_waitall: MPI_Waitall failed");
+        DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
+        dart__mpi__tmp_free(mpi_req, mpi_req_buf);
+        DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
+        dart__mpi__tmp_free(mpi_sta, mpi_sta_buf);
+        return DART_ERR_INVAL;
+      }
+    } else {
+      DART_LOG_DEBUG("dart_waitall > number of requests = 0");
+      dart__mpi__tmp_free(mpi_req, mpi_req_buf);
+      dart__mpi__tmp_free(mpi_sta, mpi_sta_buf);
+      return DART_OK;
+    }
+    /*
+     * copy MPI requests back to DART handles:
+     */
+    DART_LOG_TRACE("dart_waitall: copying MPI requests back to DART handles");
+    r_n = 0;
+    for (i = 0; i < n; i++) {
+      if (handle[i]) {
+        if (mpi_req[r_n] == MPI_REQUEST_NULL) {
+          DART_LOG_TRACE("dart_waitall: -- mpi_req[%zu] = MPI_REQUEST_NULL",
+                         r_n);
+        } else {
+          DART_LOG_TRACE("dart_waitall: -- mpi_req[%zu]", r_n);
+        }
+        DART_LOG_TRACE("dart_waitall: -- mpi_sta[%zu].MPI_SOURCE: %d",
+                       r_n, mpi_sta[r_n].MPI_SOURCE);
+        DART_LOG_TRACE("dart_waitall: -- mpi_sta[%zu].MPI_ERROR:  %d:%s",
+                       r_n,
+                       mpi_sta[r_n].MPI_ERROR,
+                       DART__MPI__ERROR_STR(mpi_sta[r_n].MPI_ERROR));
+        handle[i]->request = mpi_req[r_n];
+        r_n++;
+      }
+    }
+    /*
+     * wait for completion of MPI requests at origins and targets:
+     */
+    DART_LOG_DEBUG("dart_waitall: waiting for remote completion");
+    for (i = 0; i < n; i++) {
+      if (handle[i]) {
+        if (handle[i]->request == MPI_REQUEST_NULL ||
+            handle[i]->win     == MPI_WIN_NULL) {
+          DART_LOG_TRACE("dart_waitall: -- handle[%zu] done (MPI_REQUEST_NULL)",
+                         i);
+        } else {
+          DART_LOG_DEBUG("dart_waitall: -- MPI_Win_flush(handle[%zu]: %p))",
+                         i, (void*)handle[i]);
+          DART_LOG_TRACE("dart_waitall:      handle[%zu]->dest: %d",
+                         i, handle[i]->dest);
+          DART_LOG_TRACE("dart_waitall:      handle[%zu]->win:  %"PRIu64"",
+                         i, (unsigned long)handle[i]->win);
+          DART_LOG_TRACE("dart_waitall:      handle[%zu]->req:  %"PRIu64"",
+                         i, (unsigned long)handle[i]->request);
+          /*
+           * MPI_Win_flush to wait for remote completion:
+           */
+          if (MPI_Win_flush(handle[i]->dest, handle[i]->win) != MPI_SUCCESS) {
+            DART_LOG_ERROR("dart_waitall: MPI_Win_flush failed");
+            DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
+            dart__mpi__tmp_free(mpi_req, mpi_req_buf);
+            DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
+            dart__mpi__tmp_free(mpi_sta, mpi_sta_buf);
+            return DART_ERR_INVAL;
+          }
+          DART_LOG_TRACE("dart_waitall: -- MPI_Request_free");
+          if (MPI_Request_free(&handle[i]->request) != MPI_SUCCESS) {
+            DART_LOG_ERROR("dart_waitall: MPI_Request_free failed");
+            DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
+            dart__mpi__tmp_free(mpi_req, mpi_req_buf);
+            DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
+            dart__mpi__tmp_free(mpi_sta, mpi_sta_buf);
+            return DART_ERR_INVAL;
+          }
+        }
+      }
+    }
+    /*
+     * free memory:
+     */
+    DART_LOG_DEBUG("dart_waitall: free handles");
+    for (i = 0; i < n; i++) {
+      if (handle[i]) {
+        /* Free handle resource */
+        DART_LOG_TRACE("dart_waitall: -- free handle[%zu]: %p",
+                       i, (void*)(handle[i]));
+        dart__mpi__handle_free(handle[i]);
+        handle[i] = NULL;
+      }
+    }
+    DART_LOG_TRACE("dart_waitall: free MPI_Request temporaries");
+    dart__mpi__tmp_free(mpi_req, mpi_req_buf);
+    DART_LOG_TRACE("dart_waitall: free MPI_Status temporaries");
+    dart__mpi__tmp_free(mpi_sta, mpi_sta_buf);
+  }
+  DART_LOG_DEBUG("dart_waitall > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_test_local(
+  dart_handle_t handle,
+  int32_t* is_finished)
+{
+  DART_LOG_DEBUG("dart_test_local()");
+  if (!handle) {
+    *is_finished = 1;
+    return DART_OK;
+  }
+  MPI_Status mpi_sta;
+  MPI_Test (&(handle->request), is_finished, &mpi_sta);
+  DART_LOG_DEBUG("dart_test_local > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_test(
+  dart_handle_t   handle,
+  int32_t       * is_finished)
+{
+  int        flag;
+  MPI_Status mpi_sta;
+  DART_LOG_DEBUG("dart_test() handle:%p", (void*)(handle));
+  if (!handle) {
+    *is_finished = 1;
+    return DART_OK;
+  }
+  if (MPI_Test(&(handle->request), &flag, &mpi_sta) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_test ! MPI_Test failed");
+    return DART_ERR_INVAL;
+  }
+  *is_finished = flag;
+  if (flag) {
+    if (handle->win != MPI_WIN_NULL &&
+        MPI_Win_flush(handle->dest, handle->win) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_test ! MPI_Win_flush failed");
+      return DART_ERR_INVAL;
+    }
+    dart__mpi__handle_free(handle);
+  }
+  DART_LOG_DEBUG("dart_test > finished:%d", flag);
+  return DART_OK;
+}
+
+dart_ret_t dart_testall_local(
+  dart_handle_t * handle,
+  size_t          n,
+  int32_t       * is_finished)
+{
+  size_t i, r_n;
+  DART_LOG_DEBUG("dart_testall_local()");
+  MPI_Status *mpi_sta;
+  MPI_Request *mpi_req;
+  MPI_Status   mpi_sta_buf[DART__MPI__REQUEST_STACK_SIZE];
+  MPI_Request  mpi_req_buf[DART__MPI__REQUEST_STACK_SIZE];
+  mpi_req = dart__mpi__tmp_alloc(mpi_req_buf, n, sizeof(MPI_Request));
+  mpi_sta = dart__mpi__tmp_alloc(mpi_sta_buf, n, sizeof(MPI_Status));
+  r_n = 0;
+  for (i = 0; i < n; i++) {
+    if (handle[i]){
+      mpi_req[r_n] = handle[i] -> request;
+      r_n++;
+    }
+  }
+  MPI_Testall(r_n, mpi_req, is_finished, mpi_sta);
+  r_n = 0;
+  for (i = 0; i < n; i++) {
+    if (handle[i]) {
+      handle[i] -> request = mpi_req[r_n];
+      r_n++;
+    }
+  }
+  dart__mpi__tmp_free(mpi_req, mpi_req_buf);
+  dart__mpi__tmp_free(mpi_sta, mpi_sta_buf);
+  DART_LOG_DEBUG("dart_testall_local > finished");
+  return DART_OK;
+}
+
+/* -- Non-blocking dart one-sided operations using handle pools -- */
+
+dart_ret_t dart_handle_pool_create(
+  size_t               capacity,
+  dart_handle_pool_t * pool)
+{
+  DART_LOG_DEBUG("dart_handle_pool_create() capacity:%zu", capacity);
+  *pool = NULL;
+  if (capacity == 0 || capacity > INT_MAX) {
+    DART_LOG_ERROR("dart_handle_pool_create ! invalid capacity %zu",
+                   capacity);
+    return DART_ERR_INVAL;
+  }
+  /*
+   * Pool and its request arrays are allocated in a single block:
+   */
+  struct dart_handle_pool_struct * p = malloc(
+                                         sizeof(struct dart_handle_pool_struct)
+                                         + capacity * (sizeof(MPI_Request) +
+                                                       sizeof(MPI_Win)     +
+                                                       sizeof(dart_unit_t)));
+  if (p == NULL) {
+    DART_LOG_ERROR("dart_handle_pool_create ! failed to allocate pool");
+    return DART_ERR_OTHER;
+  }
+  p->requests = (MPI_Request *)(p + 1);
+  p->wins     = (MPI_Win *)(p->requests + capacity);
+  p->dests    = (dart_unit_t *)(p->wins + capacity);
+  p->capacity = capacity;
+  p->size     = 0;
+  *pool       = p;
+  DART_LOG_DEBUG("dart_handle_pool_create > pool:%p", (void*)p);
+  return DART_OK;
+}
+
+dart_ret_t dart_handle_pool_destroy(
+  dart_handle_pool_t * pool)
+{
+  DART_LOG_DEBUG("dart_handle_pool_destroy() pool:%p", (void*)(*pool));
+  dart_ret_t ret = DART_OK;
+  if (*pool != NULL) {
+    ret = dart_handle_pool_waitall(*pool);
+    free(*pool);
+    *pool = NULL;
+  }
+  return ret;
+}
+
+dart_ret_t dart_handle_pool_waitall_local(
+  dart_handle_pool_t pool)
+{
+  DART_LOG_DEBUG("dart_handle_pool_waitall_local() pool:%p size:%zu",
+                 (void*)pool, pool->size);
+  if (pool->size > 0 &&
+      MPI_Waitall(pool->size, pool->requests, MPI_STATUSES_IGNORE)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_handle_pool_waitall_local ! MPI_Waitall failed");
+    return DART_ERR_INVAL;
+  }
+  pool->size = 0;
+  DART_LOG_DEBUG("dart_handle_pool_waitall_local > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_handle_pool_waitall(
+  dart_handle_pool_t pool)
+{
+  DART_LOG_DEBUG("dart_handle_pool_waitall() pool:%p size:%zu",
+                 (void*)pool, pool->size);
+  size_t size = pool->size;
+  if (size == 0) {
+    return DART_OK;
+  }
+  if (MPI_Waitall(size, pool->requests, MPI_STATUSES_IGNORE)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_handle_pool_waitall ! MPI_Waitall failed");
+    return DART_ERR_INVAL;
+  }
+  pool->size = 0;
+  /*
+   * Wait for remote completion, flush every target once if operations to
+   * the same target have been issued consecutively:
+   */
+  for (size_t i = 0; i < size; i++) {
+    if (i > 0 &&
+        pool->dests[i] == pool->dests[i-1] &&
+        pool->wins[i]  == pool->wins[i-1]) {
+      continue;
+    }
+    if (MPI_Win_flush(pool->dests[i], pool->wins[i]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_handle_pool_waitall ! MPI_Win_flush failed");
+      return DART_ERR_INVAL;
+    }
+  }
+  DART_LOG_DEBUG("dart_handle_pool_waitall > finished");
+  return DART_OK;
+}
+
+dart_ret_t dart_handle_pool_size(
+  dart_handle_pool_t   pool,
+  size_t             * size)
+{
+  *size = pool->size;
+  return DART_OK;
+}
+
+dart_ret_t dart_get_pooled(
+  void               * dest,
+  dart_gptr_t          gptr,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  dart_handle_pool_t   pool)
+{
+  if (pool->size == pool->capacity) {
+    DART_LOG_DEBUG("dart_get_pooled: pool full, completing %zu operations",
+                   pool->size);
+    dart_ret_t ret = dart_handle_pool_waitall(pool);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+  size_t idx = pool->size;
+  dart_ret_t ret = dart__mpi__get_request(
+                     dest, gptr, nelem, dtype,
+                     &pool->requests[idx],
+                     &pool->wins[idx],
+                     &pool->dests[idx]);
+  if (ret == DART_OK && pool->requests[idx] != MPI_REQUEST_NULL) {
+    pool->size++;
+  }
+  return ret;
+}
+
+dart_ret_t dart_put_pooled(
+  dart_gptr_t          gptr,
+  const void         * src,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  dart_handle_pool_t   pool)
+{
+  if (pool->size == pool->capacity) {
+    DART_LOG_DEBUG("dart_put_pooled: pool full, completing %zu operations",
+                   pool->size);
+    dart_ret_t ret = dart_handle_pool_waitall(pool);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+  size_t idx = pool->size;
+  dart_ret_t ret = dart__mpi__put_request(
+                     gptr, src, nelem, dtype,
+                     &pool->requests[idx],
+                     &pool->wins[idx],
+                     &pool->dests[idx]);
+  if (ret == DART_OK && pool->requests[idx] != MPI_REQUEST_NULL) {
+    pool->size++;
+  }
+  return ret;
+}
+
+/* -- Dart collective operations -- */
+
+/*
+ * Hierarchical implementations of collective operations on teams spanning
+ * several nodes: the units at every node first synchronize with the first
+ * unit at the node using the node's communicator, only these node leaders
+ * communicate across nodes, and they finally release the units at their
+ * node.
+ */
+
+static int dart__mpi__barrier_hierarchical(
+  dart_team_data_t * team_data)
+{
+  int ret = MPI_Barrier(team_data->node_comm);
+  if (ret == MPI_SUCCESS && team_data->node_leader_comm != MPI_COMM_NULL) {
+    ret = MPI_Barrier(team_data->node_leader_comm);
+  }
+  if (ret == MPI_SUCCESS) {
+    ret = MPI_Barrier(team_data->node_comm);
+  }
+  return ret;
+}
+
+static int dart__mpi__bcast_hierarchical(
+  void             * buf,
+  int                nelem,
+  MPI_Datatype       mpi_dtype,
+  dart_team_unit_t   root,
+  dart_team_data_t * team_data)
+{
+  int ret;
+  int root_node = team_data->node_ids[root.id];
+  int my_node   = team_data->node_ids[team_data->unitid];
+  if (my_node == root_node) {
+    /* Root passes the values to all units at its node including the
+     * node leader: */
+    ret = MPI_Bcast(buf, nelem, mpi_dtype,
+                    team_data->node_ranks[root.id], team_data->node_comm);
+    if (ret == MPI_SUCCESS &&
+        team_data->node_leader_comm != MPI_COMM_NULL) {
+      ret = MPI_Bcast(buf, nelem, mpi_dtype,
+                      root_node, team_data->node_leader_comm);
+    }
+  } else {
+    ret = MPI_SUCCESS;
+    if (team_data->node_leader_comm != MPI_COMM_NULL) {
+      ret = MPI_Bcast(buf, nelem, mpi_dtype,
+                      root_node, team_data->node_leader_comm);
+    }
+    if (ret == MPI_SUCCESS) {
+      ret = MPI_Bcast(buf, nelem, mpi_dtype, 0, team_data->node_comm);
+    }
+  }
+  return ret;
+}
+
+static int dart__mpi__allreduce_hierarchical(
+  const void       * sendbuf,
+  void             * recvbuf,
+  int                nelem,
+  MPI_Datatype       mpi_dtype,
+  MPI_Op             mpi_op,
+  dart_team_data_t * team_data)
+{
+  int ret;
+  int is_leader = (team_data->node_leader_comm != MPI_COMM_NULL);
+  if (is_leader && sendbuf == recvbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  ret = MPI_Reduce(sendbuf, recvbuf, nelem, mpi_dtype, mpi_op, 0,
+                   team_data->node_comm);
+  if (ret == MPI_SUCCESS && is_leader) {
+    ret = MPI_Allreduce(MPI_IN_PLACE, recvbuf, nelem, mpi_dtype, mpi_op,
+                        team_data->node_leader_comm);
+  }
+  if (ret == MPI_SUCCESS) {
+    ret = MPI_Bcast(recvbuf, nelem, mpi_dtype, 0, team_data->node_comm);
+  }
+  return ret;
+}
+
+static int dart__mpi__allgather_hierarchical(
+  const void       * sendbuf,
+  void             * recvbuf,
+  int                nelem,
+  MPI_Datatype       mpi_dtype,
+  size_t             elem_size,
+  dart_team_data_t * team_data)
+{
+  int     ret       = MPI_SUCCESS;
+  int     is_leader = (team_data->node_leader_comm != MPI_COMM_NULL);
+  int     my_node   = team_data->node_ids[team_data->unitid];
+  size_t  nbytes    = nelem * elem_size;
+  char  * gatherbuf = recvbuf;
+
+  if (sendbuf == MPI_IN_PLACE) {
+    sendbuf = (char *)recvbuf + team_data->unitid * nbytes;
+  }
+  /*
+   * Values are gathered in node-major order of units which has to be
+   * restored to team order if units are not numbered contiguously at nodes:
+   */
+  if (!team_data->nodes_contiguous) {
+    gatherbuf = malloc(team_data->size * nbytes);
+    if (gatherbuf == NULL) {
+      return MPI_ERR_NO_MEM;
+    }
+  }
+  char * node_first = gatherbuf + team_data->node_displs[my_node] * nbytes;
+  ret = MPI_Gather(
+          (is_leader && sendbuf == node_first) ? MPI_IN_PLACE : sendbuf,
+          nelem, mpi_dtype,
+          node_first, nelem, mpi_dtype,
+          0, team_data->node_comm);
+  if (ret == MPI_SUCCESS && is_leader) {
+    int * counts = malloc(2 * team_data->num_nodes * sizeof(int));
+    int * displs = counts + team_data->num_nodes;
+    for (int n = 0; n < team_data->num_nodes; n++) {
+      counts[n] = (team_data->node_displs[n + 1] -
+                   team_data->node_displs[n]) * nelem;
+      displs[n] = team_data->node_displs[n] * nelem;
+    }
+    ret = MPI_Allgatherv(MPI_IN_PLACE, 0, mpi_dtype,
+                         gatherbuf, counts, displs, mpi_dtype,
+                         team_data->node_leader_comm);
+    free(counts);
+  }
+  if (ret == MPI_SUCCESS) {
+    ret = MPI_Bcast(gatherbuf, team_data->size * nelem, mpi_dtype, 0,
+                    team_data->node_comm);
+  }
+  if (!team_data->nodes_contiguous) {
+    for (int u = 0; ret == MPI_SUCCESS && u < team_data->size; u++) {
+      int pos = team_data->node_displs[team_data->node_ids[u]] +
+                team_data->node_ranks[u];
+      memcpy((char *)recvbuf + u * nbytes, gatherbuf + pos * nbytes, nbytes);
+    }
+    free(gatherbuf);
+  }
+  return ret;
+}
+
+static int _dart_barrier_count = 0;
+
+dart_ret_t dart_barrier(
+  dart_team_t teamid)
+{
+  MPI_Comm comm;
+
+  DART_LOG_DEBUG("dart_barrier() barrier count: %d", _dart_barrier_count);
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_barrier ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  DART__MPI__AGGREGATION_SYNC(teamid);
+
+  _dart_barrier_count++;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  /* Fetch proper communicator from teams. */
+  if (team_data->hierarchical_coll) {
+    if (dart__mpi__barrier_hierarchical(team_data) == MPI_SUCCESS) {
+      DART_LOG_DEBUG("dart_barrier > finished");
+      return DART_OK;
+    }
+    DART_LOG_DEBUG("dart_barrier ! hierarchical barrier failed");
+    return DART_ERR_INVAL;
+  }
+  comm = team_data->comm;
+  if (MPI_Barrier(comm) == MPI_SUCCESS) {
+    DART_LOG_DEBUG("dart_barrier > finished");
+    return DART_OK;
+  }
+  DART_LOG_DEBUG("dart_barrier ! MPI_Barrier failed");
+  return DART_ERR_INVAL;
+}
+
+dart_ret_t dart_bcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid)
+{
+  MPI_Comm comm;
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+
+  DART_LOG_TRACE("dart_bcast() root:%d team:%d nelem:%"PRIu64"",
+                 root.id, teamid, nelem);
+
+  if (root.id < 0) {
+    DART_LOG_ERROR("dart_bcast ! failed: root < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_bcast ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_bcast ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_bcast ! root:%d -> team:%d "
+                   "dart_adapt_teamlist_convert failed", root.id, teamid);
+    return DART_ERR_INVAL;
+  }
+  if (team_data->hierarchical_coll) {
+    if (dart__mpi__bcast_hierarchical(
+          buf, nelem, mpi_dtype, root, team_data) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_bcast ! root:%d -> team:%d "
+                     "hierarchical broadcast failed", root.id, teamid);
+      return DART_ERR_INVAL;
+    }
+    DART_LOG_TRACE("dart_bcast > root:%d team:%d nelem:%zu finished",
+                   root.id, teamid, nelem);
+    return DART_OK;
+  }
+  comm = team_data->comm;
+  if (MPI_Bcast(buf, nelem, mpi_dtype, root.id, comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_bcast ! root:%d -> team:%d "
+                   "MPI_Bcast failed", root.id, teamid);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_TRACE("dart_bcast > root:%d team:%d nelem:%zu finished",
+                 root.id, teamid, nelem);
+  return DART_OK;
+}
+
+dart_ret_t dart_scatter(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid)
+{
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  MPI_Comm     comm;
+
+  if (root.id < 0) {
+    DART_LOG_ERROR("dart_scatter ! failed: root < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_scatter ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_scatter ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  comm = team_data->comm;
+  if (MPI_Scatter(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           root.id,
+           comm) != MPI_SUCCESS) {
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_gather(
+  const void         * sendbuf,
+  void               * recvbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  dart_team_unit_t     root,
+  dart_team_t          teamid)
+{
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  MPI_Comm     comm;
+
+  if (root.id < 0) {
+    DART_LOG_ERROR("dart_gather ! failed: root < 0");
+    return DART_ERR_INVAL;
+  }
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_gather ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_gather ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  comm = team_data->comm;
+  if (MPI_Gather(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           root.id,
+           comm) != MPI_SUCCESS) {
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_allgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
+{
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  MPI_Comm     comm;
+  DART_LOG_TRACE("dart_allgather() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_accumulate ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nelem > INT_MAX) {
+    DART_LOG_ERROR("dart_allgather ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
   }
-  MPI_Testall(r_n, mpi_req, is_finished, mpi_sta);
-  r_n = 0;
-  for (i = 0; i < n; i++) {
-    if (handle[i]) {
-      handle[i] -> request = mpi_req[r_n];
-      r_n++;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_allgather ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  /*
+   * The gathered values are broadcast within nodes as a single message
+   * counted in int:
+   */
+  if (team_data->hierarchical_coll &&
+      nelem * team_data->size <= INT_MAX) {
+    if (dart__mpi__allgather_hierarchical(
+          sendbuf, recvbuf, nelem, mpi_dtype,
+          dart__mpi__datatype_sizeof(dtype), team_data) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_allgather ! team:%d nelem:%"PRIu64" failed",
+                     teamid, nelem);
+      return DART_ERR_INVAL;
     }
+    DART_LOG_TRACE("dart_allgather > team:%d nelem:%"PRIu64"",
+                   teamid, nelem);
+    return DART_OK;
   }
-  free(mpi_req);
-  free(mpi_sta);
-  DART_LOG_DEBUG("dart_testall_local > finished");
+  comm = team_data->comm;
+  if (MPI_Allgather(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_allgather ! team:%d nelem:%"PRIu64" failed",
+                   teamid, nelem);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_TRACE("dart_allgather > team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
   return DART_OK;
 }
 
-/* -- Dart collective operations -- */
-
-static int _dart_barrier_count = 0;
-
-dart_ret_t dart_barrier(
-  dart_team_t teamid)
+dart_ret_t dart_allgatherv(
+  const void      * sendbuf,
+  size_t            nsendelem,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
 {
-  MPI_Comm comm;
-
-  DART_LOG_DEBUG("dart_barrier() barrier count: %d", _dart_barrier_count);
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  MPI_Comm     comm;
+  int          comm_size;
+  DART_LOG_TRACE("dart_allgatherv() team:%d nsendelem:%"PRIu64"",
+                 teamid, nsendelem);
 
   if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_barrier ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    DART_LOG_ERROR("dart_allgatherv ! failed: team may not be DART_UNDEFINED_TEAM_ID");
     return DART_ERR_INVAL;
   }
 
-  _dart_barrier_count++;
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (nsendelem > INT_MAX) {
+    DART_LOG_ERROR("dart_allgather ! failed: nelem > INT_MAX");
+    return DART_ERR_INVAL;
+  }
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (team_data == NULL) {
+    DART_LOG_ERROR("dart_allgatherv ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
     return DART_ERR_INVAL;
   }
-  /* Fetch proper communicator from teams. */
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
   comm = team_data->comm;
-  if (MPI_Barrier(comm) == MPI_SUCCESS) {
-    DART_LOG_DEBUG("dart_barrier > finished");
-    return DART_OK;
+
+  // convert nrecvcounts and recvdispls
+  MPI_Comm_size(comm, &comm_size);
+  int *inrecvcounts = malloc(sizeof(int) * comm_size);
+  int *irecvdispls  = malloc(sizeof(int) * comm_size);
+  for (int i = 0; i < comm_size; i++) {
+    if (nrecvcounts[i] > INT_MAX || recvdispls[i] > INT_MAX) {
+      DART_LOG_ERROR("dart_allgatherv ! failed: nrecvcounts[%i] > INT_MAX || recvdispls[%i] > INT_MAX", i, i);
+      free(inrecvcounts);
+      free(irecvdispls);
+      return DART_ERR_INVAL;
+    }
+    inrecvcounts[i] = nrecvcounts[i];
+    irecvdispls[i]  = recvdispls[i];
   }
-  DART_LOG_DEBUG("dart_barrier ! MPI_Barrier failed");
-  return DART_ERR_INVAL;
+
+  if (MPI_Allgatherv(
+           sendbuf,
+           nsendelem,
+           mpi_dtype,
+           recvbuf,
+           inrecvcounts,
+           irecvdispls,
+           mpi_dtype,
+           comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_allgatherv ! team:%d nsendelem:%"PRIu64" failed",
+                   teamid, nsendelem);
+    free(inrecvcounts);
+    free(irecvdispls);
+    return DART_ERR_INVAL;
+  }
+  free(inrecvcounts);
+  free(irecvdispls);
+  DART_LOG_TRACE("dart_allgatherv > team:%d nsendelem:%"PRIu64"",
+                 teamid, nsendelem);
+  return DART_OK;
 }
 
-dart_ret_t dart_bcast(
-  void              * buf,
-  size_t              nelem,
-  dart_datatype_t     dtype,
-  dart_team_unit_t    root,
-  dart_team_t         teamid)
+/*
+ * Converts the counts or displacements of all units in a team to MPI
+ * offset type int.
+ */
+static int * dart__mpi__int_counts(
+  const size_t * counts,
+  int            nunits)
 {
-  MPI_Comm comm;
-  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
-
-  DART_LOG_TRACE("dart_bcast() root:%d team:%d nelem:%"PRIu64"",
-                 root.id, teamid, nelem);
-
-  if (root.id < 0) {
-    DART_LOG_ERROR("dart_bcast ! failed: root < 0");
-    return DART_ERR_INVAL;
+  int * icounts = malloc(sizeof(int) * nunits);
+  for (int i = 0; i < nunits; i++) {
+    if (counts[i] > INT_MAX) {
+      DART_LOG_ERROR("dart__mpi__int_counts ! counts[%i] > INT_MAX", i);
+      free(icounts);
+      return NULL;
+    }
+    icounts[i] = counts[i];
   }
+  return icounts;
+}
+
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
+{
+  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  DART_LOG_TRACE("dart_alltoall() team:%d nelem:%"PRIu64"", teamid, nelem);
 
   if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_bcast ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    DART_LOG_ERROR("dart_alltoall ! failed: team may not be DART_UNDEFINED_TEAM_ID");
     return DART_ERR_INVAL;
   }
-
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_bcast ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_alltoall ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
-
   dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (team_data == NULL) {
-    DART_LOG_ERROR("dart_bcast ! root:%d -> team:%d "
-                   "dart_adapt_teamlist_convert failed", root.id, teamid);
+    DART_LOG_ERROR("dart_alltoall ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
     return DART_ERR_INVAL;
   }
-  comm = team_data->comm;
-  if (MPI_Bcast(buf, nelem, mpi_dtype, root.id, comm) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_bcast ! root:%d -> team:%d "
-                   "MPI_Bcast failed", root.id, teamid);
+  if (MPI_Alltoall(
+           sendbuf,
+           nelem,
+           mpi_dtype,
+           recvbuf,
+           nelem,
+           mpi_dtype,
+           team_data->comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoall ! team:%d nelem:%"PRIu64" failed",
+                   teamid, nelem);
     return DART_ERR_INVAL;
   }
-  DART_LOG_TRACE("dart_bcast > root:%d team:%d nelem:%zu finished",
-                 root.id, teamid, nelem);
+  DART_LOG_TRACE("dart_alltoall > team:%d nelem:%"PRIu64"", teamid, nelem);
   return DART_OK;
 }
 
-dart_ret_t dart_scatter(
-  const void        * sendbuf,
-  void              * recvbuf,
-  size_t              nelem,
-  dart_datatype_t     dtype,
-  dart_team_unit_t    root,
-  dart_team_t         teamid)
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
 {
   MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
-  MPI_Comm     comm;
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
 
-  if (root.id < 0) {
-    DART_LOG_ERROR("dart_scatter ! failed: root < 0");
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_alltoallv ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d "
+                   "dart_adapt_teamlist_convert failed", teamid);
+    return DART_ERR_INVAL;
+  }
+  int   nunits      = team_data->size;
+  int * isendcounts = dart__mpi__int_counts(nsendelem,  nunits);
+  int * isenddispls = dart__mpi__int_counts(senddispls, nunits);
+  int * irecvcounts = dart__mpi__int_counts(nrecvelem,  nunits);
+  int * irecvdispls = dart__mpi__int_counts(recvdispls, nunits);
+  int   ret         = MPI_ERR_COUNT;
+  if (isendcounts != NULL && isenddispls != NULL &&
+      irecvcounts != NULL && irecvdispls != NULL) {
+    ret = MPI_Alltoallv(
+            sendbuf,
+            isendcounts,
+            isenddispls,
+            mpi_dtype,
+            recvbuf,
+            irecvcounts,
+            irecvdispls,
+            mpi_dtype,
+            team_data->comm);
+  }
+  free(isendcounts);
+  free(isenddispls);
+  free(irecvcounts);
+  free(irecvdispls);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d failed", teamid);
+    return DART_ERR_INVAL;
+  }
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_allreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team)
+{
+  MPI_Comm     comm;
+  MPI_Op       mpi_op;
+  MPI_Datatype mpi_dtype;
+  if (dart__mpi__reduce_args(op, dtype, &nelem, &mpi_op, &mpi_dtype)
+      != DART_OK) {
+    DART_LOG_ERROR("dart_allreduce ! failed: invalid operation %d", op);
     return DART_ERR_INVAL;
   }
 
-  if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_scatter ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+  if (team == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_allreduce ! failed: team may not be DART_UNDEFINED_TEAM_ID");
     return DART_ERR_INVAL;
   }
 
@@ -1629,47 +3572,67 @@ dart_ret_t dart_scatter(
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_scatter ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_allreduce ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
   if (team_data == NULL) {
     return DART_ERR_INVAL;
   }
+  /*
+   * The hierarchical reduction combines values in node-major order of
+   * units, it is only used for commutative operations on teams with units
+   * numbered contiguously at nodes:
+   */
+  int commute = 0;
+  if (team_data->hierarchical_coll && team_data->nodes_contiguous &&
+      MPI_Op_commutative(mpi_op, &commute) == MPI_SUCCESS && commute) {
+    if (dart__mpi__allreduce_hierarchical(
+          sendbuf, recvbuf, nelem, mpi_dtype, mpi_op, team_data)
+        != MPI_SUCCESS) {
+      return DART_ERR_INVAL;
+    }
+    return DART_OK;
+  }
   comm = team_data->comm;
-  if (MPI_Scatter(
-           sendbuf,
-           nelem,
-           mpi_dtype,
-           recvbuf,
-           nelem,
-           mpi_dtype,
-           root.id,
+  if (MPI_Allreduce(
+           sendbuf,   // send buffer
+           recvbuf,   // receive buffer
+           nelem,     // buffer size
+           mpi_dtype, // datatype
+           mpi_op,    // reduce operation
            comm) != MPI_SUCCESS) {
     return DART_ERR_INVAL;
   }
   return DART_OK;
 }
 
-dart_ret_t dart_gather(
-  const void         * sendbuf,
-  void               * recvbuf,
-  size_t               nelem,
-  dart_datatype_t      dtype,
-  dart_team_unit_t     root,
-  dart_team_t          teamid)
+dart_ret_t dart_reduce(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_unit_t    root,
+  dart_team_t         team)
 {
-  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
   MPI_Comm     comm;
+  MPI_Op       mpi_op;
+  MPI_Datatype mpi_dtype;
+  if (dart__mpi__reduce_args(op, dtype, &nelem, &mpi_op, &mpi_dtype)
+      != DART_OK) {
+    DART_LOG_ERROR("dart_reduce ! failed: invalid operation %d", op);
+    return DART_ERR_INVAL;
+  }
 
   if (root.id < 0) {
-    DART_LOG_ERROR("dart_gather ! failed: root < 0");
+    DART_LOG_ERROR("dart_reduce ! failed: root < 0");
     return DART_ERR_INVAL;
   }
 
-  if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_gather ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+  if (team == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_reduce ! failed: team may not be DART_UNDEFINED_TEAM_ID");
     return DART_ERR_INVAL;
   }
 
@@ -1677,22 +3640,21 @@ dart_ret_t dart_gather(
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_gather ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_allreduce ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
   if (team_data == NULL) {
     return DART_ERR_INVAL;
   }
   comm = team_data->comm;
-  if (MPI_Gather(
+  if (MPI_Reduce(
            sendbuf,
-           nelem,
-           mpi_dtype,
            recvbuf,
            nelem,
            mpi_dtype,
+           mpi_op,
            root.id,
            comm) != MPI_SUCCESS) {
     return DART_ERR_INVAL;
@@ -1700,20 +3662,25 @@ dart_ret_t dart_gather(
   return DART_OK;
 }
 
-dart_ret_t dart_allgather(
-  const void      * sendbuf,
-  void            * recvbuf,
-  size_t            nelem,
-  dart_datatype_t   dtype,
-  dart_team_t       teamid)
+dart_ret_t dart_exscan(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team)
 {
-  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
   MPI_Comm     comm;
-  DART_LOG_TRACE("dart_allgather() team:%d nelem:%"PRIu64"",
-                 teamid, nelem);
+  MPI_Op       mpi_op;
+  MPI_Datatype mpi_dtype;
+  if (dart__mpi__reduce_args(op, dtype, &nelem, &mpi_op, &mpi_dtype)
+      != DART_OK) {
+    DART_LOG_ERROR("dart_exscan ! failed: invalid operation %d", op);
+    return DART_ERR_INVAL;
+  }
 
-  if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_accumulate ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+  if (team == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_exscan ! failed: team may not be DART_UNDEFINED_TEAM_ID");
     return DART_ERR_INVAL;
   }
 
@@ -1721,201 +3688,377 @@ dart_ret_t dart_allgather(
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_allgather ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_exscan ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
   if (team_data == NULL) {
-    DART_LOG_ERROR("dart_allgather ! team:%d "
-                   "dart_adapt_teamlist_convert failed", teamid);
     return DART_ERR_INVAL;
   }
-  if (sendbuf == recvbuf || NULL == sendbuf) {
-    sendbuf = MPI_IN_PLACE;
-  }
   comm = team_data->comm;
-  if (MPI_Allgather(
+  if (MPI_Exscan(
            sendbuf,
-           nelem,
-           mpi_dtype,
            recvbuf,
            nelem,
            mpi_dtype,
+           mpi_op,
            comm) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_allgather ! team:%d nelem:%"PRIu64" failed",
-                   teamid, nelem);
     return DART_ERR_INVAL;
   }
-  DART_LOG_TRACE("dart_allgather > team:%d nelem:%"PRIu64"",
-                 teamid, nelem);
   return DART_OK;
 }
 
-dart_ret_t dart_allgatherv(
-  const void      * sendbuf,
-  size_t            nsendelem,
-  dart_datatype_t   dtype,
-  void            * recvbuf,
-  const size_t    * nrecvcounts,
-  const size_t    * recvdispls,
-  dart_team_t       teamid)
+dart_ret_t dart_reduce_scatter(
+  const void        * sendbuf,
+  void              * recvbuf,
+  const size_t      * nrecvelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_t         team)
 {
+  MPI_Op       mpi_op    = dart__mpi__op(op);
   MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
-  MPI_Comm     comm;
-  int          comm_size;
-  DART_LOG_TRACE("dart_allgatherv() team:%d nsendelem:%"PRIu64"",
-                 teamid, nsendelem);
 
-  if (teamid == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_allgatherv ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+  if (team == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_reduce_scatter ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+  if (op > DART_OP_NO_OP) {
+    DART_LOG_ERROR("dart_reduce_scatter ! failed: user-defined operation");
+    return DART_ERR_INVAL;
+  }
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+  int * irecvcounts = dart__mpi__int_counts(nrecvelem, team_data->size);
+  if (irecvcounts == NULL) {
     return DART_ERR_INVAL;
   }
+  int ret = MPI_Reduce_scatter(
+              sendbuf,
+              recvbuf,
+              irecvcounts,
+              mpi_dtype,
+              mpi_op,
+              team_data->comm);
+  free(irecvcounts);
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_reduce_scatter ! MPI_Reduce_scatter failed");
+    return DART_ERR_INVAL;
+  }
+  return DART_OK;
+}
 
-  /*
-   * MPI uses offset type int, do not copy more than INT_MAX elements:
-   */
-  if (nsendelem > INT_MAX) {
-    DART_LOG_ERROR("dart_allgather ! failed: nelem > INT_MAX");
+/*
+ * User-defined reduction operations are stored in a fixed table, the
+ * DART operation of an entry is DART_OP_NO_OP + 1 + its index.
+ * Every operation has its own contiguous MPI data type of the element
+ * size, so MPI never splits elements and the entry of an invocation can
+ * be resolved from the data type.
+ * Operations created repeatedly with identical arguments share a single
+ * entry that is released when its last reference is destroyed.
+ */
+#ifndef DART__MPI__USER_OP_MAX
+#define DART__MPI__USER_OP_MAX 64
+#endif
+
+typedef struct {
+  dart_operator_t op;
+  void          * userdata;
+  size_t          elem_size;
+  bool            commute;
+  size_t          refcount;
+  MPI_Op          mpi_op;
+  MPI_Datatype    mpi_type;
+} dart__mpi__user_op_t;
+
+static dart__mpi__user_op_t dart__mpi__user_ops[DART__MPI__USER_OP_MAX];
+static dart_mutex_t dart__mpi__user_ops_mutex = DART_MUTEX_INITIALIZER;
+
+static inline dart__mpi__user_op_t * dart__mpi__user_op(
+  dart_operation_t op)
+{
+  int idx = (int)op - (DART_OP_NO_OP + 1);
+  if (idx < 0 || idx >= DART__MPI__USER_OP_MAX ||
+      dart__mpi__user_ops[idx].op == NULL) {
+    return NULL;
+  }
+  return &dart__mpi__user_ops[idx];
+}
+
+static void dart__mpi__user_op_apply(
+  void         * invec,
+  void         * inoutvec,
+  int          * len,
+  MPI_Datatype * datatype)
+{
+  for (int i = 0; i < DART__MPI__USER_OP_MAX; i++) {
+    dart__mpi__user_op_t * entry = &dart__mpi__user_ops[i];
+    if (entry->op != NULL && entry->mpi_type == *datatype) {
+      entry->op(invec, inoutvec, *len, entry->userdata);
+      return;
+    }
+  }
+  DART_LOG_ERROR("dart__mpi__user_op_apply ! unknown data type");
+}
+
+dart_ret_t dart_op_create(
+  dart_operator_t    op,
+  void             * userdata,
+  bool               commute,
+  size_t             elem_size,
+  dart_operation_t * new_op)
+{
+  *new_op = DART_OP_UNDEFINED;
+  if (op == NULL || elem_size == 0 || elem_size > INT_MAX) {
+    DART_LOG_ERROR("dart_op_create ! invalid arguments");
     return DART_ERR_INVAL;
   }
+  dart__base__mutex_lock(&dart__mpi__user_ops_mutex);
+  for (int i = 0; i < DART__MPI__USER_OP_MAX; i++) {
+    dart__mpi__user_op_t * entry = &dart__mpi__user_ops[i];
+    if (entry->op        == op        &&
+        entry->userdata  == userdata  &&
+        entry->elem_size == elem_size &&
+        entry->commute   == commute) {
+      // Share the existing operation:
+      entry->refcount++;
+      dart__base__mutex_unlock(&dart__mpi__user_ops_mutex);
+      *new_op = (dart_operation_t)(DART_OP_NO_OP + 1 + i);
+      DART_LOG_DEBUG("dart_op_create > op:%d refcount:%zu",
+                     *new_op, entry->refcount);
+      return DART_OK;
+    }
+  }
+  int idx = 0;
+  while (idx < DART__MPI__USER_OP_MAX && dart__mpi__user_ops[idx].op != NULL) {
+    idx++;
+  }
+  if (idx == DART__MPI__USER_OP_MAX) {
+    dart__base__mutex_unlock(&dart__mpi__user_ops_mutex);
+    DART_LOG_ERROR("dart_op_create ! more than %d operations",
+                   DART__MPI__USER_OP_MAX);
+    return DART_ERR_OTHER;
+  }
+  dart__mpi__user_op_t * entry = &dart__mpi__user_ops[idx];
+  if (MPI_Type_contiguous((int)elem_size, MPI_BYTE, &entry->mpi_type)
+      != MPI_SUCCESS ||
+      MPI_Type_commit(&entry->mpi_type) != MPI_SUCCESS) {
+    dart__base__mutex_unlock(&dart__mpi__user_ops_mutex);
+    DART_LOG_ERROR("dart_op_create ! failed to create data type");
+    return DART_ERR_OTHER;
+  }
+  if (MPI_Op_create(&dart__mpi__user_op_apply, commute, &entry->mpi_op)
+      != MPI_SUCCESS) {
+    MPI_Type_free(&entry->mpi_type);
+    dart__base__mutex_unlock(&dart__mpi__user_ops_mutex);
+    DART_LOG_ERROR("dart_op_create ! MPI_Op_create failed");
+    return DART_ERR_OTHER;
+  }
+  entry->userdata  = userdata;
+  entry->elem_size = elem_size;
+  entry->commute   = commute;
+  entry->refcount  = 1;
+  entry->op        = op;
+  dart__base__mutex_unlock(&dart__mpi__user_ops_mutex);
+
+  *new_op = (dart_operation_t)(DART_OP_NO_OP + 1 + idx);
+  DART_LOG_DEBUG("dart_op_create > op:%d elem_size:%zu", *new_op, elem_size);
+  return DART_OK;
+}
 
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
-  if (team_data == NULL) {
-    DART_LOG_ERROR("dart_allgatherv ! team:%d "
-                   "dart_adapt_teamlist_convert failed", teamid);
+dart_ret_t dart_op_destroy(
+  dart_operation_t * op)
+{
+  dart__base__mutex_lock(&dart__mpi__user_ops_mutex);
+  dart__mpi__user_op_t * entry = dart__mpi__user_op(*op);
+  if (entry == NULL) {
+    dart__base__mutex_unlock(&dart__mpi__user_ops_mutex);
+    DART_LOG_ERROR("dart_op_destroy ! unknown operation %d", *op);
     return DART_ERR_INVAL;
   }
-  if (sendbuf == recvbuf || NULL == sendbuf) {
-    sendbuf = MPI_IN_PLACE;
+  if (--entry->refcount == 0) {
+    MPI_Op_free(&entry->mpi_op);
+    MPI_Type_free(&entry->mpi_type);
+    entry->op = NULL;
   }
-  comm = team_data->comm;
+  dart__base__mutex_unlock(&dart__mpi__user_ops_mutex);
+  *op = DART_OP_UNDEFINED;
+  return DART_OK;
+}
 
-  // convert nrecvcounts and recvdispls
-  MPI_Comm_size(comm, &comm_size);
-  int *inrecvcounts = malloc(sizeof(int) * comm_size);
-  int *irecvdispls  = malloc(sizeof(int) * comm_size);
-  for (int i = 0; i < comm_size; i++) {
-    if (nrecvcounts[i] > INT_MAX || recvdispls[i] > INT_MAX) {
-      DART_LOG_ERROR("dart_allgatherv ! failed: nrecvcounts[%i] > INT_MAX || recvdispls[%i] > INT_MAX", i, i);
-      free(inrecvcounts);
-      free(irecvdispls);
-      return DART_ERR_INVAL;
+dart_ret_t
+dart__mpi__reduce_args(
+  dart_operation_t   op,
+  dart_datatype_t    dtype,
+  size_t           * nelem,
+  MPI_Op           * mpi_op,
+  MPI_Datatype     * mpi_dtype)
+{
+  if (op <= DART_OP_NO_OP) {
+    *mpi_op    = dart__mpi__op(op);
+    *mpi_dtype = dart__mpi__datatype(dtype);
+    return DART_OK;
+  }
+  dart__mpi__user_op_t * entry = dart__mpi__user_op(op);
+  if (entry == NULL || dtype != DART_TYPE_BYTE ||
+      *nelem % entry->elem_size != 0) {
+    return DART_ERR_INVAL;
+  }
+  *mpi_op    = entry->mpi_op;
+  *mpi_dtype = entry->mpi_type;
+  *nelem    /= entry->elem_size;
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__op_fini()
+{
+  for (int i = 0; i < DART__MPI__USER_OP_MAX; i++) {
+    dart__mpi__user_op_t * entry = &dart__mpi__user_ops[i];
+    if (entry->op != NULL) {
+      MPI_Op_free(&entry->mpi_op);
+      MPI_Type_free(&entry->mpi_type);
+      entry->op = NULL;
     }
-    inrecvcounts[i] = nrecvcounts[i];
-    irecvdispls[i]  = recvdispls[i];
   }
+  return DART_OK;
+}
 
-  if (MPI_Allgatherv(
-           sendbuf,
-           nsendelem,
-           mpi_dtype,
-           recvbuf,
-           inrecvcounts,
-           irecvdispls,
-           mpi_dtype,
-           comm) != MPI_SUCCESS) {
-    DART_LOG_ERROR("dart_allgatherv ! team:%d nsendelem:%"PRIu64" failed",
-                   teamid, nsendelem);
-    free(inrecvcounts);
-    free(irecvdispls);
+/*
+ * Allocate a handle for the request of a non-blocking collective
+ * operation, not associated with a window.
+ */
+static dart_handle_t dart__mpi__coll_handle(
+  MPI_Request request)
+{
+  dart_handle_t handle = dart__mpi__handle_alloc();
+  if (handle != NULL) {
+    handle->request = request;
+    handle->win     = MPI_WIN_NULL;
+    handle->dest    = DART_UNDEFINED_UNIT_ID;
+  }
+  return handle;
+}
+
+dart_ret_t dart_ibarrier(
+  dart_team_t       teamid,
+  dart_handle_t   * handle)
+{
+  MPI_Request req;
+  DART_LOG_DEBUG("dart_ibarrier() team:%d", teamid);
+  *handle = NULL;
+
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: team may not be DART_UNDEFINED_TEAM_ID");
     return DART_ERR_INVAL;
   }
-  free(inrecvcounts);
-  free(irecvdispls);
-  DART_LOG_TRACE("dart_allgatherv > team:%d nsendelem:%"PRIu64"",
-                 teamid, nsendelem);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: Unknown team %i!", teamid);
+    return DART_ERR_INVAL;
+  }
+  DART__MPI__AGGREGATION_SYNC(teamid);
+  if (MPI_Ibarrier(team_data->comm, &req) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ibarrier ! MPI_Ibarrier failed");
+    return DART_ERR_INVAL;
+  }
+  *handle = dart__mpi__coll_handle(req);
+  DART_LOG_DEBUG("dart_ibarrier > handle:%p", (void*)(*handle));
   return DART_OK;
 }
 
-dart_ret_t dart_allreduce(
+dart_ret_t dart_iallreduce(
   const void       * sendbuf,
   void             * recvbuf,
   size_t             nelem,
   dart_datatype_t    dtype,
   dart_operation_t   op,
-  dart_team_t        team)
+  dart_team_t        teamid,
+  dart_handle_t    * handle)
 {
-  MPI_Comm     comm;
-  MPI_Op       mpi_op    = dart__mpi__op(op);
-  MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
-
-  if (team == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_allreduce ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+  MPI_Request  req;
+  MPI_Op       mpi_op;
+  MPI_Datatype mpi_dtype;
+  if (dart__mpi__reduce_args(op, dtype, &nelem, &mpi_op, &mpi_dtype)
+      != DART_OK) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: invalid operation %d", op);
     return DART_ERR_INVAL;
   }
+  DART_LOG_DEBUG("dart_iallreduce() team:%d nelem:%zu", teamid, nelem);
+  *handle = NULL;
 
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_allreduce ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_iallreduce ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
-
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (team_data == NULL) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: Unknown team %i!", teamid);
     return DART_ERR_INVAL;
   }
-  comm = team_data->comm;
-  if (MPI_Allreduce(
-           sendbuf,   // send buffer
-           recvbuf,   // receive buffer
-           nelem,     // buffer size
-           mpi_dtype, // datatype
-           mpi_op,    // reduce operation
-           comm) != MPI_SUCCESS) {
+  if (sendbuf == recvbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  if (MPI_Iallreduce(sendbuf, recvbuf, nelem, mpi_dtype, mpi_op,
+                     team_data->comm, &req) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallreduce ! MPI_Iallreduce failed");
     return DART_ERR_INVAL;
   }
+  *handle = dart__mpi__coll_handle(req);
+  DART_LOG_DEBUG("dart_iallreduce > handle:%p", (void*)(*handle));
   return DART_OK;
 }
 
-dart_ret_t dart_reduce(
-  const void        * sendbuf,
-  void              * recvbuf,
-  size_t              nelem,
-  dart_datatype_t     dtype,
-  dart_operation_t    op,
-  dart_team_unit_t    root,
-  dart_team_t         team)
+dart_ret_t dart_iallgather(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_team_t        teamid,
+  dart_handle_t    * handle)
 {
-  MPI_Comm     comm;
-  MPI_Op       mpi_op    = dart__mpi__op(op);
+  MPI_Request  req;
   MPI_Datatype mpi_dtype = dart__mpi__datatype(dtype);
+  DART_LOG_DEBUG("dart_iallgather() team:%d nelem:%zu", teamid, nelem);
+  *handle = NULL;
 
-  if (root.id < 0) {
-    DART_LOG_ERROR("dart_reduce ! failed: root < 0");
-    return DART_ERR_INVAL;
-  }
-
-  if (team == DART_UNDEFINED_TEAM_ID) {
-    DART_LOG_ERROR("dart_reduce ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+  if (teamid == DART_UNDEFINED_TEAM_ID) {
+    DART_LOG_ERROR("dart_iallgather ! failed: team may not be DART_UNDEFINED_TEAM_ID");
     return DART_ERR_INVAL;
   }
-
   /*
    * MPI uses offset type int, do not copy more than INT_MAX elements:
    */
   if (nelem > INT_MAX) {
-    DART_LOG_ERROR("dart_allreduce ! failed: nelem > INT_MAX");
+    DART_LOG_ERROR("dart_iallgather ! failed: nelem > INT_MAX");
     return DART_ERR_INVAL;
   }
-
-  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
   if (team_data == NULL) {
+    DART_LOG_ERROR("dart_iallgather ! failed: Unknown team %i!", teamid);
     return DART_ERR_INVAL;
   }
-  comm = team_data->comm;
-  if (MPI_Reduce(
-           sendbuf,
-           recvbuf,
-           nelem,
-           mpi_dtype,
-           mpi_op,
-           root.id,
-           comm) != MPI_SUCCESS) {
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  if (MPI_Iallgather(sendbuf, nelem, mpi_dtype,
+                     recvbuf, nelem, mpi_dtype,
+                     team_data->comm, &req) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallgather ! MPI_Iallgather failed");
     return DART_ERR_INVAL;
   }
+  *handle = dart__mpi__coll_handle(req);
+  DART_LOG_DEBUG("dart_iallgather > handle:%p", (void*)(*handle));
   return DART_OK;
 }
 
@@ -35,14 +35,13 @@ MPI_Win dart_win_local_alloc;
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 MPI_Win dart_sharedmem_win_local_alloc;
 char** dart_sharedmem_local_baseptr_set;
+MPI_Aint* dart_sharedmem_local_baseaddr_set;
 #endif
 
 dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
 {
   int16_t segid = gptr.segid;
   uint64_t offset = gptr.addr_or_offs.offset;
-  dart_team_unit_t myid;
-  dart_team_myid(gptr.teamid, &myid);
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
   if (team_data == NULL) {
@@ -50,7 +49,7 @@ dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
     return DART_ERR_INVAL;
   }
 
-  if (myid.id == gptr.unitid) {
+  if (team_data->unitid == gptr.unitid) {
     if (segid != DART_SEGMENT_LOCAL) {
       if (dart_segment_get_selfbaseptr(&team_data->segdata, segid, (char **)addr) != DART_OK) {
         DART_LOG_ERROR("dart_gptr_getaddr ! Unknown segment %i", segid);
@@ -59,7 +58,8 @@ dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
 
       *addr = offset + (char *)(*addr);
     } else {
-      *addr = offset + dart_mempool_localalloc;
+      /* Local allocations are addressed by their absolute address */
+      *addr = (void *)(uintptr_t)offset;
     }
   } else {
     *addr = NULL;
@@ -67,6 +67,28 @@ dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
   return DART_OK;
 }
 
+dart_ret_t dart_gptr_getaddr_node(const dart_gptr_t gptr, void **addr)
+{
+  *addr = NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_gptr_getaddr_node ! Unknown team %i", gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (team_data->unitid == gptr.unitid) {
+    return dart_gptr_getaddr(gptr, addr);
+  }
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (gptr.unitid >= 0 && gptr.unitid < team_data->size) {
+    *addr = dart__mpi__sharedmem_ptr(team_data, gptr);
+  }
+#endif
+  return DART_OK;
+}
+
 dart_ret_t dart_gptr_setaddr(dart_gptr_t* gptr, void* addr)
 {
   int16_t segid = gptr->segid;
@@ -88,7 +110,7 @@ dart_ret_t dart_gptr_setaddr(dart_gptr_t* gptr, void* addr)
     }
     gptr->addr_or_offs.offset = (char *)addr - addr_base;
   } else {
-    gptr->addr_or_offs.offset = (char *)addr - dart_mempool_localalloc;
+    gptr->addr_or_offs.offset = (uint64_t)(uintptr_t)addr;
   }
   return DART_OK;
 }
@@ -137,14 +159,17 @@ dart_ret_t dart_memalloc(
   gptr->flags   = 0;
   gptr->segid   = DART_SEGMENT_LOCAL; /* For local allocation, the segid is marked as '0'. */
   gptr->teamid  = DART_TEAM_ALL;      /* Locally allocated gptr belong to the global team. */
-  gptr->addr_or_offs.offset = dart_buddy_alloc(dart_localpool, nbytes);
-  if (gptr->addr_or_offs.offset == (uint64_t)(-1)) {
+  /* Local allocations are addressed by their absolute address in the
+   * dynamic window dart_win_local_alloc. */
+  char * addr = dart_mempool_alloc(dart_localpool, nbytes);
+  if (addr == NULL) {
     DART_LOG_ERROR("dart_memalloc: Out of bounds "
-                   "(dart_buddy_alloc %zu bytes): global memory exhausted",
+                   "(dart_mempool_alloc %zu bytes): global memory exhausted",
                    nbytes);
     *gptr = DART_GPTR_NULL;
     return DART_ERR_OTHER;
   }
+  gptr->addr_or_offs.offset = (uint64_t)(uintptr_t)addr;
   DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu offset:%"PRIu64"",
                  nbytes, gptr->addr_or_offs.offset);
   return DART_OK;
@@ -158,7 +183,8 @@ dart_ret_t dart_memfree (dart_gptr_t gptr)
     return DART_ERR_INVAL;
   }
 
-  if (dart_buddy_free(dart_localpool, gptr.addr_or_offs.offset) == -1) {
+  if (dart_mempool_free(
+        dart_localpool, (char *)(uintptr_t)gptr.addr_or_offs.offset) == -1) {
     DART_LOG_ERROR("dart_memfree: invalid local global pointer: "
                    "invalid offset: %"PRIu64"",
                    gptr.addr_or_offs.offset);
@@ -169,6 +195,16 @@ dart_ret_t dart_memfree (dart_gptr_t gptr)
   return DART_OK;
 }
 
+dart_ret_t dart_memalloc_stats(dart_memalloc_stats_t * stats)
+{
+  if (stats == NULL) {
+    DART_LOG_ERROR("dart_memalloc_stats ! stats must not be NULL");
+    return DART_ERR_INVAL;
+  }
+  dart_mempool_stats(dart_localpool, stats);
+  return DART_OK;
+}
+
 dart_ret_t
 dart_team_memalloc_aligned(
   dart_team_t       teamid,
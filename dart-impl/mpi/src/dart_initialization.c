@@ -20,8 +20,6 @@
 #include <dash/dart/mpi/dart_locality_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
 
-#define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
-
 /* Point to the base address of memory region for local allocation. */
 static int _init_by_dart = 0;
 static int _dart_initialized = 0;
@@ -62,7 +60,14 @@ dart_ret_t do_init()
   MPI_Comm_rank(team_data->comm, &team_data->unitid);
   MPI_Comm_size(team_data->comm, &team_data->size);
 
-  dart_localpool = dart_buddy_new(DART_LOCAL_ALLOC_SIZE);
+  /* Create a dynamic win object for dart local allocation, chunks of
+   * the local allocation pool are attached on demand.
+   *
+   * Return in dart_win_local_alloc. */
+  MPI_Win_create_dynamic(
+    MPI_INFO_NULL, DART_COMM_WORLD, &dart_win_local_alloc);
+
+  dart_mempool_localalloc = NULL;
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
@@ -120,24 +125,31 @@ dart_ret_t do_init()
         dart_sharedmem_local_baseptr_set[i] = dart_mempool_localalloc;
       }
     }
+
+    /* Local allocations are addressed by their absolute address at the
+     * allocating unit, collect the address of every unit's shared pool. */
+    MPI_Aint baseaddr = (MPI_Aint)dart_mempool_localalloc;
+    dart_sharedmem_local_baseaddr_set = malloc(
+        sizeof(MPI_Aint) * team_data->sharedmem_nodesize);
+    MPI_Allgather(
+      &baseaddr, 1, MPI_AINT,
+      dart_sharedmem_local_baseaddr_set, 1, MPI_AINT,
+      sharedmem_comm);
   }
-#else
-  MPI_Alloc_mem(
-    DART_LOCAL_ALLOC_SIZE,
-    MPI_INFO_NULL,
-    &dart_mempool_localalloc);
 #endif
-  /* Create a single global win object for dart local
-   * allocation based on the above allocated shared memory.
-   *
-   * Return in dart_win_local_alloc. */
-  MPI_Win_create(
-    dart_mempool_localalloc,
-    DART_LOCAL_ALLOC_SIZE,
-    sizeof(char),
-    MPI_INFO_NULL,
-    DART_COMM_WORLD,
-    &dart_win_local_alloc);
+
+  /* The first chunk of the local allocation pool is the shared memory
+   * allocated above if available. */
+  dart_localpool = dart_mempool_new(
+                     dart_win_local_alloc,
+                     DART_LOCAL_ALLOC_SIZE,
+                     dart_mempool_localalloc);
+  if (dart_localpool == NULL) {
+    DART_LOG_ERROR("dart_init: Failed to create local allocation pool");
+    return DART_ERR_OTHER;
+  }
+
+  dart_allocate_node_comms(team_data);
 
   /* Create a dynamic win object for all the dart collective
    * allocation based on MPI_COMM_WORLD. Return in win. */
@@ -262,6 +274,10 @@ dart_ret_t dart_exit()
 
   dart_segment_fini(&team_data->segdata);
 
+  dart__mpi__datatype_fini();
+  dart__mpi__op_fini();
+  dart__mpi__handle_fini();
+
   if (MPI_Win_unlock_all(team_data->window) != MPI_SUCCESS) {
     DART_LOG_ERROR("%2d: dart_exit: MPI_Win_unlock_all failed", unitid.id);
     return DART_ERR_OTHER;
@@ -273,23 +289,20 @@ dart_ret_t dart_exit()
   }
 
   /* -- Free up all the resources for dart programme -- */
+  dart_mempool_delete(dart_localpool);
   MPI_Win_free(&dart_win_local_alloc);
+  dart_free_node_comms(team_data);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   /* Has MPI shared windows: */
   MPI_Win_free(&dart_sharedmem_win_local_alloc);
   MPI_Comm_free(&(team_data->sharedmem_comm));
-#else
-  /* No MPI shared windows: */
-  if (dart_mempool_localalloc) {
-    MPI_Free_mem(dart_mempool_localalloc);
-  }
 #endif
   MPI_Win_free(&team_data->window);
 
-  dart_buddy_delete(dart_localpool);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   free(team_data->sharedmem_tab);
   free(dart_sharedmem_local_baseptr_set);
+  free(dart_sharedmem_local_baseaddr_set);
 #endif
 
   dart_adapt_teamlist_destroy();
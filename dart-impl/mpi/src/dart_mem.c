@@ -1,9 +1,10 @@
 /*
  * Buddy allocator to be used with externally allocated blocks.
  *
- * The main use for this allocator is \c dart_memalloc where a
- * fixed-size pre-allocated shared window is used to facilitate
- * shared-memory optimizations.
+ * The main use for this allocator is \c dart_memalloc where every
+ * chunk of the local allocation pool is managed by a buddy allocator.
+ * The first chunk is a pre-allocated shared window if available to
+ * facilitate shared-memory optimizations.
  *
  * The code was taken from https://github.com/cloudwu/buddy and
  * the right to use it has been kindly granted by the author.
@@ -32,12 +33,13 @@ enum {
 struct dart_buddy {
   dart_mutex_t mutex;
   int level;
+  size_t used;
   uint8_t tree[1];
 };
 
 /* Help to do memory management work for local allocation/free */
 char* dart_mempool_localalloc;
-struct dart_buddy  *  dart_localpool;
+struct dart_mempool  *  dart_localpool;
 
 static inline int
 num_level(size_t size)
@@ -68,6 +70,7 @@ dart_buddy_new(size_t size)
 	struct dart_buddy * self =
     malloc(sizeof(struct dart_buddy) + sizeof(uint8_t) * (lsize * 2 - 2));
 	self->level = level;
+	self->used  = 0;
 	memset(self->tree, NODE_UNUSED, lsize * 2 - 1);
 	dart__base__mutex_init(&self->mutex);
 	return self;
@@ -119,8 +122,8 @@ _mark_parent(struct dart_buddy * self, int index) {
 size_t
 dart_buddy_alloc(struct dart_buddy * self, size_t s) {
   int size;
-  // honor the alignment
-  s >>= DART_MEM_ALIGN_BITS;
+  // honor the alignment, rounding up to full alignment units
+  s = (s + DART_MEM_ALIGN_BYTES - 1) >> DART_MEM_ALIGN_BITS;
 	if (s == 0) {
 		size = 1;
 	}
@@ -142,6 +145,7 @@ dart_buddy_alloc(struct dart_buddy * self, size_t s) {
 			if (self->tree[index] == NODE_UNUSED) {
 				self->tree[index] = NODE_USED;
 				_mark_parent(self, index);
+				self->used += (size_t)size * DART_MEM_ALIGN_BYTES;
 			  dart__base__mutex_unlock(&self->mutex);
 				return _index_offset(index, level, self->level);
 			}
@@ -227,6 +231,7 @@ int dart_buddy_free(struct dart_buddy * self, uint64_t offset)
 				return -1;
 			}
 			_combine(self, index);
+			self->used -= (size_t)length * DART_MEM_ALIGN_BYTES;
 		  dart__base__mutex_unlock(&self->mutex);
 			return 0;
 		case NODE_UNUSED:
@@ -316,3 +321,333 @@ void buddy_dump(struct dart_buddy * self) {
 	_dump(self, 0, 0);
 	printf("\n");
 }
+
+size_t dart_buddy_used(struct dart_buddy * self)
+{
+  dart__base__mutex_lock(&self->mutex);
+  size_t used = self->used;
+  dart__base__mutex_unlock(&self->mutex);
+  return used;
+}
+
+static size_t
+_largest_free(struct dart_buddy * self, int index, int level) {
+  size_t left, right;
+  switch (self->tree[index]) {
+  case NODE_UNUSED:
+    return ((size_t)1) << (self->level - level);
+  case NODE_USED:
+  case NODE_FULL:
+    return 0;
+  default:
+    left  = _largest_free(self, index * 2 + 1, level + 1);
+    right = _largest_free(self, index * 2 + 2, level + 1);
+    return (left > right) ? left : right;
+  }
+}
+
+size_t dart_buddy_largest_free(struct dart_buddy * self)
+{
+  dart__base__mutex_lock(&self->mutex);
+  size_t largest = _largest_free(self, 0, 0) * DART_MEM_ALIGN_BYTES;
+  dart__base__mutex_unlock(&self->mutex);
+  return largest;
+}
+
+/*
+ * Pool of chunks for non-collective allocations.
+ *
+ * Every chunk is attached to the dynamic window of the pool, allocated
+ * memory is therefore addressed by its absolute address in the window.
+ * Small allocations are served from slabs of DART_MEMPOOL_SLAB_SIZE bytes
+ * allocated from the buddy allocator of a chunk. A slab is split into
+ * blocks of a single size class, free blocks are kept in a stack per size
+ * class. The stacks are stored outside of the blocks as freed memory may
+ * still be read by other units. Slabs are not returned to the buddy
+ * allocators.
+ */
+
+/* Number of size classes of small allocations, 8 to 256 bytes */
+#define DART_MEMPOOL_NUM_BINS   6
+#define DART_MEMPOOL_BIN_MAX    (DART_MEM_ALIGN_BYTES << (DART_MEMPOOL_NUM_BINS - 1))
+#define DART_MEMPOOL_SLAB_SIZE  4096
+
+struct dart_mempool_chunk {
+  char              * base;
+  size_t              size;
+  /* Buddy allocator of the chunk, NULL for dedicated chunks */
+  struct dart_buddy * buddy;
+  /* Size class + 1 of every slab-sized block, 0 if not used as slab */
+  uint8_t           * slabs;
+  /* Whether the chunk has been allocated by the pool */
+  int                 owned;
+};
+
+struct dart_mempool_bin {
+  char   ** blocks;
+  size_t    num_blocks;
+  size_t    max_blocks;
+};
+
+struct dart_mempool {
+  dart_mutex_t                mutex;
+  MPI_Win                     win;
+  size_t                      chunk_size;
+  struct dart_mempool_chunk * chunks;
+  int                         num_chunks;
+  int                         max_chunks;
+  /* Free blocks of every size class */
+  struct dart_mempool_bin     bins[DART_MEMPOOL_NUM_BINS];
+  size_t                      bin_free_bytes;
+};
+
+static int
+_bin_push(struct dart_mempool_bin * bin, char * block)
+{
+  if (bin->num_blocks == bin->max_blocks) {
+    size_t max_blocks = (bin->max_blocks > 0) ? 2 * bin->max_blocks : 64;
+    char ** blocks    = realloc(bin->blocks, max_blocks * sizeof(char *));
+    if (blocks == NULL) {
+      return -1;
+    }
+    bin->blocks     = blocks;
+    bin->max_blocks = max_blocks;
+  }
+  bin->blocks[bin->num_blocks++] = block;
+  return 0;
+}
+
+static inline int
+_bin_index(size_t nbytes) {
+  int    bin  = 0;
+  size_t size = DART_MEM_ALIGN_BYTES;
+  while (size < nbytes) {
+    size <<= 1;
+    bin++;
+  }
+  return bin;
+}
+
+static struct dart_mempool_chunk *
+_mempool_add_chunk(
+  struct dart_mempool * pool,
+  size_t                size,
+  char                * base,
+  int                   dedicated)
+{
+  if (pool->num_chunks == pool->max_chunks) {
+    int max_chunks = (pool->max_chunks > 0) ? 2 * pool->max_chunks : 4;
+    struct dart_mempool_chunk * chunks =
+      realloc(pool->chunks, max_chunks * sizeof(struct dart_mempool_chunk));
+    if (chunks == NULL) {
+      return NULL;
+    }
+    pool->chunks     = chunks;
+    pool->max_chunks = max_chunks;
+  }
+  struct dart_mempool_chunk * chunk = &pool->chunks[pool->num_chunks];
+  chunk->owned = (base == NULL);
+  if (base == NULL &&
+      MPI_Alloc_mem(size, MPI_INFO_NULL, &base) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_mempool: MPI_Alloc_mem failed for %zu bytes", size);
+    return NULL;
+  }
+  if (MPI_Win_attach(pool->win, base, size) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_mempool: MPI_Win_attach failed for %zu bytes", size);
+    if (chunk->owned) {
+      MPI_Free_mem(base);
+    }
+    return NULL;
+  }
+  chunk->base  = base;
+  chunk->size  = size;
+  chunk->buddy = NULL;
+  chunk->slabs = NULL;
+  if (!dedicated) {
+    chunk->buddy = dart_buddy_new(size);
+    chunk->slabs = calloc(size / DART_MEMPOOL_SLAB_SIZE, sizeof(uint8_t));
+  }
+  pool->num_chunks++;
+  DART_LOG_DEBUG("dart_mempool: attached chunk %d of %zu bytes at %p",
+                 pool->num_chunks - 1, size, base);
+  return chunk;
+}
+
+static void
+_mempool_release_chunk(
+  struct dart_mempool       * pool,
+  struct dart_mempool_chunk * chunk)
+{
+  MPI_Win_detach(pool->win, chunk->base);
+  if (chunk->owned) {
+    MPI_Free_mem(chunk->base);
+  }
+  if (chunk->buddy != NULL) {
+    dart_buddy_delete(chunk->buddy);
+  }
+  free(chunk->slabs);
+}
+
+/* Allocate from the buddy allocators, adding a chunk if all are full. */
+static char *
+_mempool_alloc_block(
+  struct dart_mempool        * pool,
+  size_t                       nbytes,
+  struct dart_mempool_chunk ** chunk_out)
+{
+  struct dart_mempool_chunk * chunk;
+  for (int i = 0; i < pool->num_chunks; ++i) {
+    chunk = &pool->chunks[i];
+    if (chunk->buddy == NULL) {
+      continue;
+    }
+    size_t offset = dart_buddy_alloc(chunk->buddy, nbytes);
+    if (offset != (size_t)(-1)) {
+      *chunk_out = chunk;
+      return chunk->base + offset;
+    }
+  }
+  chunk = _mempool_add_chunk(pool, pool->chunk_size, NULL, 0);
+  if (chunk == NULL) {
+    return NULL;
+  }
+  size_t offset = dart_buddy_alloc(chunk->buddy, nbytes);
+  if (offset == (size_t)(-1)) {
+    return NULL;
+  }
+  *chunk_out = chunk;
+  return chunk->base + offset;
+}
+
+struct dart_mempool *
+dart_mempool_new(MPI_Win win, size_t chunk_size, char * base)
+{
+  DART_ASSERT(is_pow_of_2(chunk_size));
+  struct dart_mempool * pool = calloc(1, sizeof(struct dart_mempool));
+  pool->win        = win;
+  pool->chunk_size = chunk_size;
+  dart__base__mutex_init(&pool->mutex);
+  if (_mempool_add_chunk(pool, chunk_size, base, 0) == NULL) {
+    dart_mempool_delete(pool);
+    return NULL;
+  }
+  return pool;
+}
+
+void
+dart_mempool_delete(struct dart_mempool * pool)
+{
+  for (int i = 0; i < pool->num_chunks; ++i) {
+    _mempool_release_chunk(pool, &pool->chunks[i]);
+  }
+  for (int bin = 0; bin < DART_MEMPOOL_NUM_BINS; ++bin) {
+    free(pool->bins[bin].blocks);
+  }
+  free(pool->chunks);
+  dart__base__mutex_destroy(&pool->mutex);
+  free(pool);
+}
+
+char *
+dart_mempool_alloc(struct dart_mempool * pool, size_t nbytes)
+{
+  struct dart_mempool_chunk * chunk;
+  char                      * addr = NULL;
+
+  dart__base__mutex_lock(&pool->mutex);
+  if (nbytes <= DART_MEMPOOL_BIN_MAX) {
+    int                       bin_idx = _bin_index(nbytes);
+    struct dart_mempool_bin * bin     = &pool->bins[bin_idx];
+    size_t                    bsize   = DART_MEM_ALIGN_BYTES << bin_idx;
+    if (bin->num_blocks == 0) {
+      /* Split a new slab into blocks of the size class */
+      char * slab = _mempool_alloc_block(pool, DART_MEMPOOL_SLAB_SIZE, &chunk);
+      if (slab != NULL) {
+        chunk->slabs[(slab - chunk->base) / DART_MEMPOOL_SLAB_SIZE] =
+          bin_idx + 1;
+        for (size_t offs = DART_MEMPOOL_SLAB_SIZE; offs > 0; offs -= bsize) {
+          if (_bin_push(bin, slab + offs - bsize) != 0) {
+            break;
+          }
+          pool->bin_free_bytes += bsize;
+        }
+      }
+    }
+    if (bin->num_blocks > 0) {
+      addr = bin->blocks[--bin->num_blocks];
+      pool->bin_free_bytes -= bsize;
+    }
+  } else if (nbytes > pool->chunk_size) {
+    chunk = _mempool_add_chunk(pool, nbytes, NULL, 1);
+    if (chunk != NULL) {
+      addr = chunk->base;
+    }
+  } else {
+    addr = _mempool_alloc_block(pool, nbytes, &chunk);
+  }
+  dart__base__mutex_unlock(&pool->mutex);
+  return addr;
+}
+
+int
+dart_mempool_free(struct dart_mempool * pool, char * addr)
+{
+  int ret = -1;
+  dart__base__mutex_lock(&pool->mutex);
+  for (int i = 0; i < pool->num_chunks; ++i) {
+    struct dart_mempool_chunk * chunk = &pool->chunks[i];
+    if (addr < chunk->base || addr >= chunk->base + chunk->size) {
+      continue;
+    }
+    if (chunk->buddy == NULL) {
+      /* Dedicated chunk of a single allocation */
+      if (addr == chunk->base) {
+        _mempool_release_chunk(pool, chunk);
+        pool->chunks[i] = pool->chunks[--pool->num_chunks];
+        ret = 0;
+      }
+      break;
+    }
+    size_t offset  = addr - chunk->base;
+    int    bin_idx = chunk->slabs[offset / DART_MEMPOOL_SLAB_SIZE] - 1;
+    if (bin_idx >= 0) {
+      ret = _bin_push(&pool->bins[bin_idx], addr);
+      if (ret == 0) {
+        pool->bin_free_bytes += DART_MEM_ALIGN_BYTES << bin_idx;
+      }
+    } else {
+      ret = dart_buddy_free(chunk->buddy, offset);
+    }
+    break;
+  }
+  dart__base__mutex_unlock(&pool->mutex);
+  return ret;
+}
+
+void
+dart_mempool_stats(
+  struct dart_mempool   * pool,
+  dart_memalloc_stats_t * stats)
+{
+  size_t buddy_used = 0;
+  memset(stats, 0, sizeof(dart_memalloc_stats_t));
+  dart__base__mutex_lock(&pool->mutex);
+  for (int i = 0; i < pool->num_chunks; ++i) {
+    struct dart_mempool_chunk * chunk = &pool->chunks[i];
+    stats->total_bytes += chunk->size;
+    if (chunk->buddy == NULL) {
+      buddy_used += chunk->size;
+      continue;
+    }
+    size_t largest = dart_buddy_largest_free(chunk->buddy);
+    buddy_used += dart_buddy_used(chunk->buddy);
+    if (largest > stats->largest_free_bytes) {
+      stats->largest_free_bytes = largest;
+    }
+  }
+  stats->num_chunks     = pool->num_chunks;
+  stats->bin_free_bytes = pool->bin_free_bytes;
+  stats->used_bytes     = buddy_used - pool->bin_free_bytes;
+  stats->free_bytes     = stats->total_bytes - buddy_used;
+  dart__base__mutex_unlock(&pool->mutex);
+}
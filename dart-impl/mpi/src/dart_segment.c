@@ -10,75 +10,96 @@
 
 #define DART_SEGMENT_INVALID   (INT32_MAX)
 
-struct dart_seghash_elem {
-  dart_seghash_elem_t *next;
-  dart_segment_info_t  data;
-};
-
-
-static inline int hash_segid(dart_segid_t segid)
+/**
+ * Make sure \c (*table)[index] is a valid entry, doubling the capacity of
+ * the table as required.
+ */
+static int grow_table(
+  dart_segment_elem_t *** table,
+  int                   * capacity,
+  int                     index)
 {
-  /* Simply use the lower bits of the segment ID.
-   * Since segment IDs are allocated continuously, this is likely to cause
-   * collisions starting at (segment number == DART_SEGMENT_HASH_SIZE)
-   * TODO: come up with a random distribution to account for random free'd
-   * segments?
-   * */
-  return (abs(segid) % DART_SEGMENT_HASH_SIZE);
+  if (index < *capacity) {
+    return 0;
+  }
+  int new_capacity = (*capacity > 0) ? *capacity : DART_SEGMENT_TABLE_INIT_SIZE;
+  while (new_capacity <= index) {
+    new_capacity *= 2;
+  }
+  dart_segment_elem_t ** new_table = realloc(
+                                       *table,
+                                       new_capacity * sizeof(*new_table));
+  if (new_table == NULL) {
+    DART_LOG_ERROR("dart_segment: failed to grow segment table to %d entries",
+                   new_capacity);
+    return -1;
+  }
+  memset(new_table + *capacity, 0,
+         (new_capacity - *capacity) * sizeof(*new_table));
+  *table    = new_table;
+  *capacity = new_capacity;
+  return 0;
 }
 
-static inline void
-register_segment(dart_segmentdata_t *segdata, dart_seghash_elem_t *elem)
+static inline int
+register_segment(dart_segmentdata_t *segdata, dart_segment_elem_t *elem)
 {
-  int slot = hash_segid(elem->data.segid);
-  elem->next = segdata->hashtab[slot];
-  segdata->hashtab[slot] = elem;
+  dart_segid_t segid = elem->data.segid;
+  if (segid >= 0) {
+    if (grow_table(&segdata->mem_segs, &segdata->mem_capacity, segid) != 0) {
+      return -1;
+    }
+    segdata->mem_segs[segid] = elem;
+  } else {
+    if (grow_table(&segdata->reg_segs, &segdata->reg_capacity, -segid) != 0) {
+      return -1;
+    }
+    segdata->reg_segs[-segid] = elem;
+  }
+  return 0;
 }
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment tables.
  */
 dart_ret_t dart_segment_init(dart_segmentdata_t *segdata, dart_team_t teamid)
 {
-  memset(segdata->hashtab, 0,
-    sizeof(dart_seghash_elem_t*) * DART_SEGMENT_HASH_SIZE);
-
+  segdata->mem_segs     = NULL;
+  segdata->reg_segs     = NULL;
+  segdata->mem_capacity = 0;
+  segdata->reg_capacity = 0;
   segdata->team_id = teamid;
   segdata->mem_freelist = NULL;
   segdata->reg_freelist = NULL;
   segdata->memid = 1;
   segdata->registermemid = -1;
 
+  if (grow_table(&segdata->mem_segs, &segdata->mem_capacity, 0) != 0 ||
+      grow_table(&segdata->reg_segs, &segdata->reg_capacity, 0) != 0) {
+    return DART_ERR_OTHER;
+  }
+
   // register the segment for non-global allocations on DART_TEAM_ALL
   if (teamid == DART_TEAM_ALL) {
-    dart_seghash_elem_t *elem = calloc(1, sizeof(dart_seghash_elem_t));
+    dart_segment_elem_t *elem = calloc(1, sizeof(dart_segment_elem_t));
     register_segment(segdata, elem);
   }
   return DART_OK;
 }
 
-static dart_segment_info_t * get_segment(
+static inline dart_segment_info_t * get_segment(
     dart_segmentdata_t *segdata,
     dart_segid_t        segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  while (elem != NULL) {
-    if (elem->data.segid == segid) {
-      break;
-    }
-    elem = elem->next;
-  }
+  dart_segment_info_t *segment = dart_segment_lookup(segdata, segid);
 
-  if (elem == NULL) {
+  if (segment == NULL) {
     DART_LOG_ERROR("dart_segment__get_segment : "
                    "Invalid segment ID %i on team %i",
                    segid, segdata->team_id);
-    return NULL;
   }
 
-  return &(elem->data);
+  return segment;
 }
 
 /**
@@ -93,7 +114,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
                  segdata->team_id);
 
   int16_t segid;
-  dart_seghash_elem_t *elem = NULL;
+  dart_segment_elem_t *elem = NULL;
   if (type == DART_SEGMENT_ALLOC) {
     if (segdata->mem_freelist != NULL) {
       elem  = segdata->mem_freelist;
@@ -107,7 +128,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->memid++;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else if (type == DART_SEGMENT_REGISTER) {
@@ -124,7 +145,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->registermemid--;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else {
@@ -132,7 +153,10 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
     DART_ASSERT(type != DART_SEGMENT_REGISTER && type != DART_SEGMENT_ALLOC);
   }
 
-  register_segment(segdata, elem);
+  if (register_segment(segdata, elem) != 0) {
+    free(elem);
+    return NULL;
+  }
 
   DART_LOG_DEBUG("dart_segment_alloc > segid:%d team_id:%d",
                  segid, segdata->team_id);
@@ -292,50 +316,39 @@ dart_ret_t dart_segment_free(
   dart_segmentdata_t  * segdata,
   dart_segid_t          segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *pred = NULL;
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  // find the correct entry in this bucket
-  pred = NULL;
-  while (elem != NULL) {
-
-    if (elem->data.segid == segid) {
-      if (pred != NULL) {
-        pred->next = elem->next;
-      } else {
-        segdata->hashtab[slot] = elem->next;
-      }
-      // no need for locking since operations on the same segmentdata
-      // are not thread-safe
-      if (segid > 0) {
-        elem->next            = segdata->mem_freelist;
-        segdata->mem_freelist = elem;
-      } else if (segid < 0){
-        elem->next            = segdata->reg_freelist;
-        segdata->reg_freelist = elem;
-      } else {
-        // This should not happen!
-        DART_ASSERT(segid != 0);
-      }
-      // set the segment ID again
-      elem->data.segid = segid;
-      return DART_OK;
-    }
-
-    pred = elem;
-    elem = elem->next;
+  dart_segment_elem_t **slot = NULL;
+  if (segid > 0 && segid < segdata->mem_capacity) {
+    slot = &segdata->mem_segs[segid];
+  } else if (segid < 0 && -segid < segdata->reg_capacity) {
+    slot = &segdata->reg_segs[-segid];
   }
 
   // element not found
-  return DART_ERR_INVAL;
+  if (slot == NULL || *slot == NULL) {
+    return DART_ERR_INVAL;
+  }
+
+  dart_segment_elem_t *elem = *slot;
+  *slot = NULL;
+  // no need for locking since operations on the same segmentdata
+  // are not thread-safe
+  if (segid > 0) {
+    elem->next            = segdata->mem_freelist;
+    segdata->mem_freelist = elem;
+  } else {
+    elem->next            = segdata->reg_freelist;
+    segdata->reg_freelist = elem;
+  }
+  // set the segment ID again
+  elem->data.segid = segid;
+  return DART_OK;
 }
 
-static void clear_segdata_list(dart_seghash_elem_t *listhead)
+static void clear_segdata_list(dart_segment_elem_t *listhead)
 {
-  dart_seghash_elem_t *elem = listhead;
+  dart_segment_elem_t *elem = listhead;
   while (elem != NULL) {
-    dart_seghash_elem_t *tmp = elem;
+    dart_segment_elem_t *tmp = elem;
     elem = tmp->next;
     tmp->next = NULL;
     free_segment_info(&tmp->data);
@@ -343,17 +356,34 @@ static void clear_segdata_list(dart_seghash_elem_t *listhead)
   }
 }
 
+static void clear_segdata_table(dart_segment_elem_t **table, int capacity)
+{
+  for (int i = 0; i < capacity; i++) {
+    if (table[i] != NULL) {
+      free_segment_info(&table[i]->data);
+      free(table[i]);
+      table[i] = NULL;
+    }
+  }
+}
+
 /**
- * @brief Clear the segment data hash table.
+ * @brief Clear the segment tables.
  */
 dart_ret_t dart_segment_fini(
   dart_segmentdata_t  * segdata)
 {
-  // clear the hash table
-  for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
-    clear_segdata_list(segdata->hashtab[i]);
-    segdata->hashtab[i] = NULL;
-  }
+  // clear the segment tables
+  clear_segdata_table(segdata->mem_segs, segdata->mem_capacity);
+  free(segdata->mem_segs);
+  segdata->mem_segs     = NULL;
+  segdata->mem_capacity = 0;
+
+  clear_segdata_table(segdata->reg_segs, segdata->reg_capacity);
+  free(segdata->reg_segs);
+  segdata->reg_segs     = NULL;
+  segdata->reg_capacity = 0;
+
   clear_segdata_list(segdata->mem_freelist);
   segdata->mem_freelist = NULL;
 
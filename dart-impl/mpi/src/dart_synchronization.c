@@ -44,9 +44,360 @@ struct dart_lock_struct
   dart_team_t teamid;
   /** Whether this unit has acquired the lock. */
   int32_t is_acquired;
+  /** Implementation variant of the lock. */
+  dart_lock_variant_t variant;
+  /**
+   * Queue nodes and queue tails of the local-spin variant, see
+   * \c DART__MPI__LOCK_* for the layout of the segment of every unit.
+   */
+  dart_gptr_t  gptr_state;
+  /** Team-relative id of the first unit at the node of this unit. */
+  int32_t node_leader;
+  /**
+   * Number of times the lock has been passed between units of this
+   * unit's node since the node acquired it.
+   */
+  int32_t cohort_passes;
+  /** Whether this unit has acquired the lock in shared mode. */
+  int32_t is_shared;
 };
 
+/* -- Local-spin lock -- */
+
+/*
+ * The local-spin lock is a queue lock of nodes in which every node holds
+ * a queue lock of its units.
+ * The unit acquiring the lock of its node enqueues the node in the global
+ * queue unless the lock has been handed over from a unit at the same node.
+ * Waiting units only poll the memory at their own node: units waiting for
+ * the node lock poll their own queue node and the queue node of a node
+ * waiting for the global lock resides at the node's leader.
+ * Predecessors hand over the lock by writing to the queue node of their
+ * successors.
+ */
+
+/* Successor of the unit in the queue of its node. */
+#define DART__MPI__LOCK_NEXT        0
+/* Value handed over by the unit's predecessor in the queue of its node. */
+#define DART__MPI__LOCK_FLAG        1
+/* Tail of the queue of the node, used at node leaders. */
+#define DART__MPI__LOCK_NODE_TAIL   2
+/* Successor of the node in the global queue, used at node leaders. */
+#define DART__MPI__LOCK_NODE_NEXT   3
+/* Value handed over by the node's predecessor, used at node leaders. */
+#define DART__MPI__LOCK_NODE_FLAG   4
+/* Tail of the global queue, used at unit 0. */
+#define DART__MPI__LOCK_TAIL        5
+/* Number of units holding the lock in shared mode, used at unit 0. */
+#define DART__MPI__LOCK_READERS     6
+#define DART__MPI__LOCK_NUM_SLOTS   8
+
+/* Value of the handover slots while waiting for the predecessor. */
+#define DART__MPI__LOCK_WAITING    -1
+
+/*
+ * Maximum number of successive handovers between units of the same node
+ * before the lock is passed to the next node to prevent starvation.
+ */
+#define DART__MPI__LOCK_COHORT_MAX 64
+
+static int32_t
+dart__mpi__lock_fetch_op(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  int32_t                  unit,
+  int                      slot,
+  int32_t                  value,
+  MPI_Op                   op)
+{
+  int32_t  result;
+  MPI_Aint disp;
+  MPI_Win  win = team_data->window;
+  DART_ASSERT_RETURNS(
+    dart_segment_get_disp(
+      &team_data->segdata,
+      lock->gptr_state.segid,
+      DART_TEAM_UNIT_ID(unit),
+      &disp),
+    DART_OK);
+  disp += slot * sizeof(int32_t);
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(&value, &result, MPI_INT32_T, unit, disp, op, win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(unit, win),
+    MPI_SUCCESS);
+  return result;
+}
+
+static int32_t
+dart__mpi__lock_compare_and_swap(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  int32_t                  unit,
+  int                      slot,
+  int32_t                  compare,
+  int32_t                  value)
+{
+  int32_t  result;
+  MPI_Aint disp;
+  MPI_Win  win = team_data->window;
+  DART_ASSERT_RETURNS(
+    dart_segment_get_disp(
+      &team_data->segdata,
+      lock->gptr_state.segid,
+      DART_TEAM_UNIT_ID(unit),
+      &disp),
+    DART_OK);
+  disp += slot * sizeof(int32_t);
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &value, &compare, &result, MPI_INT32_T, unit, disp, win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(unit, win),
+    MPI_SUCCESS);
+  return result;
+}
+
+#define DART__MPI__LOCK_LOAD(lock, team_data, unit, slot)                  \
+  dart__mpi__lock_fetch_op(lock, team_data, unit, slot, 0, MPI_NO_OP)
+#define DART__MPI__LOCK_STORE(lock, team_data, unit, slot, value)          \
+  (void)dart__mpi__lock_fetch_op(lock, team_data, unit, slot, value,       \
+                                 MPI_REPLACE)
+
+/**
+ * Enqueue the calling unit in the queue of its node and wait for the
+ * handover from its predecessor.
+ * Returns 0 if the global lock has to be acquired or the number of
+ * handovers in the node if the global lock has been passed on with the
+ * lock of the node.
+ */
+static int32_t
+dart__mpi__lock_node_acquire(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  int32_t                  myid)
+{
+  int32_t value;
+  DART__MPI__LOCK_STORE(lock, team_data, myid, DART__MPI__LOCK_NEXT, -1);
+  DART__MPI__LOCK_STORE(lock, team_data, myid, DART__MPI__LOCK_FLAG,
+                        DART__MPI__LOCK_WAITING);
+  int32_t predecessor = dart__mpi__lock_fetch_op(
+                          lock, team_data, lock->node_leader,
+                          DART__MPI__LOCK_NODE_TAIL, myid, MPI_REPLACE);
+  if (predecessor == -1) {
+    return 0;
+  }
+  DART__MPI__LOCK_STORE(
+    lock, team_data, predecessor, DART__MPI__LOCK_NEXT, myid);
+  DART_LOG_DEBUG("dart_lock_acquire: waiting for handover from unit %d "
+                 "in team %d", predecessor, lock->teamid);
+  do {
+    value = DART__MPI__LOCK_LOAD(lock, team_data, myid, DART__MPI__LOCK_FLAG);
+  } while (value == DART__MPI__LOCK_WAITING);
+  return value;
+}
+
+/**
+ * Pass the lock of the node to the calling unit's successor or release it
+ * if there is no successor.
+ */
+static void
+dart__mpi__lock_node_release(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  int32_t                  myid,
+  int32_t                  handover)
+{
+  int32_t next = DART__MPI__LOCK_LOAD(
+                   lock, team_data, myid, DART__MPI__LOCK_NEXT);
+  if (next == -1) {
+    if (dart__mpi__lock_compare_and_swap(
+          lock, team_data, lock->node_leader, DART__MPI__LOCK_NODE_TAIL,
+          myid, -1) == myid) {
+      return;
+    }
+    /* A successor is about to register with this unit */
+    do {
+      next = DART__MPI__LOCK_LOAD(lock, team_data, myid, DART__MPI__LOCK_NEXT);
+    } while (next == -1);
+  }
+  DART_LOG_DEBUG("dart_lock_release: handing over to unit %d in team %d",
+                 next, lock->teamid);
+  DART__MPI__LOCK_STORE(lock, team_data, next, DART__MPI__LOCK_FLAG, handover);
+}
+
+/**
+ * Enqueue the calling unit's node in the global queue and wait for the
+ * handover from its predecessor.
+ */
+static void
+dart__mpi__lock_global_acquire(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  int32_t leader = lock->node_leader;
+  DART__MPI__LOCK_STORE(lock, team_data, leader, DART__MPI__LOCK_NODE_NEXT, -1);
+  DART__MPI__LOCK_STORE(lock, team_data, leader, DART__MPI__LOCK_NODE_FLAG,
+                        DART__MPI__LOCK_WAITING);
+  int32_t predecessor = dart__mpi__lock_fetch_op(
+                          lock, team_data, 0, DART__MPI__LOCK_TAIL,
+                          leader, MPI_REPLACE);
+  if (predecessor == -1) {
+    return;
+  }
+  DART__MPI__LOCK_STORE(
+    lock, team_data, predecessor, DART__MPI__LOCK_NODE_NEXT, leader);
+  DART_LOG_DEBUG("dart_lock_acquire: waiting for handover from node of "
+                 "unit %d in team %d", predecessor, lock->teamid);
+  while (DART__MPI__LOCK_LOAD(lock, team_data, leader,
+                              DART__MPI__LOCK_NODE_FLAG)
+         == DART__MPI__LOCK_WAITING) { }
+}
+
+/**
+ * Pass the global lock to the next node or release it if there is no
+ * node waiting.
+ */
+static void
+dart__mpi__lock_global_release(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  int32_t leader = lock->node_leader;
+  int32_t next   = DART__MPI__LOCK_LOAD(
+                     lock, team_data, leader, DART__MPI__LOCK_NODE_NEXT);
+  if (next == -1) {
+    if (dart__mpi__lock_compare_and_swap(
+          lock, team_data, 0, DART__MPI__LOCK_TAIL, leader, -1) == leader) {
+      return;
+    }
+    do {
+      next = DART__MPI__LOCK_LOAD(
+               lock, team_data, leader, DART__MPI__LOCK_NODE_NEXT);
+    } while (next == -1);
+  }
+  DART_LOG_DEBUG("dart_lock_release: handing over to node of unit %d "
+                 "in team %d", next, lock->teamid);
+  DART__MPI__LOCK_STORE(lock, team_data, next, DART__MPI__LOCK_NODE_FLAG, 1);
+}
+
+static void
+dart__mpi__lock_acquire_local_spin(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  int32_t                  myid)
+{
+  int32_t passes = dart__mpi__lock_node_acquire(lock, team_data, myid);
+  if (passes == 0) {
+    dart__mpi__lock_global_acquire(lock, team_data);
+  }
+  lock->cohort_passes = passes;
+}
+
+static void
+dart__mpi__lock_release_local_spin(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  int32_t                  myid)
+{
+  /* Keep the global lock if a unit at this node is waiting */
+  if (lock->cohort_passes < DART__MPI__LOCK_COHORT_MAX &&
+      (DART__MPI__LOCK_LOAD(lock, team_data, myid, DART__MPI__LOCK_NEXT)
+         != -1 ||
+       DART__MPI__LOCK_LOAD(lock, team_data, lock->node_leader,
+                            DART__MPI__LOCK_NODE_TAIL) != myid)) {
+    dart__mpi__lock_node_release(
+      lock, team_data, myid, lock->cohort_passes + 1);
+  } else {
+    dart__mpi__lock_global_release(lock, team_data);
+    dart__mpi__lock_node_release(lock, team_data, myid, 0);
+  }
+}
+
+static int32_t
+dart__mpi__lock_try_acquire_local_spin(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  int32_t                  myid)
+{
+  int32_t leader = lock->node_leader;
+  DART__MPI__LOCK_STORE(lock, team_data, myid, DART__MPI__LOCK_NEXT, -1);
+  if (dart__mpi__lock_compare_and_swap(
+        lock, team_data, leader, DART__MPI__LOCK_NODE_TAIL, -1, myid)
+      != -1) {
+    return 0;
+  }
+  DART__MPI__LOCK_STORE(lock, team_data, leader, DART__MPI__LOCK_NODE_NEXT, -1);
+  if (dart__mpi__lock_compare_and_swap(
+        lock, team_data, 0, DART__MPI__LOCK_TAIL, -1, leader) != -1) {
+    dart__mpi__lock_node_release(lock, team_data, myid, 0);
+    return 0;
+  }
+  if (DART__MPI__LOCK_LOAD(lock, team_data, 0, DART__MPI__LOCK_READERS)
+      != 0) {
+    dart__mpi__lock_global_release(lock, team_data);
+    dart__mpi__lock_node_release(lock, team_data, myid, 0);
+    return 0;
+  }
+  lock->cohort_passes = 0;
+  return 1;
+}
+
+static dart_ret_t
+dart__mpi__lock_init_local_spin(
+  dart_team_t              teamid,
+  dart_team_data_t       * team_data,
+  dart_lock_t              lock)
+{
+  int32_t        * slots;
+  dart_team_unit_t unitid;
+  dart_ret_t       ret;
+
+  dart_team_myid(teamid, &unitid);
+
+  ret = dart_team_memalloc_aligned(
+          teamid, DART__MPI__LOCK_NUM_SLOTS, DART_TYPE_INT,
+          &lock->gptr_state);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
+    return ret;
+  }
+  dart_gptr_setunit(&lock->gptr_state, unitid);
+  DART_ASSERT_RETURNS(
+    dart_gptr_getaddr(lock->gptr_state, (void*)&slots),
+    DART_OK);
+  for (int i = 0; i < DART__MPI__LOCK_NUM_SLOTS; ++i) {
+    slots[i] = -1;
+  }
+  slots[DART__MPI__LOCK_READERS] = 0;
+  MPI_Win_sync(team_data->window);
+
+  /* The first unit of every node is the leader of the node */
+  lock->node_leader = unitid.id;
+  if (MPI_Bcast(&lock->node_leader, 1, MPI_INT32_T, 0, team_data->node_comm)
+      != MPI_SUCCESS) {
+    DART_LOG_ERROR("%s: Failed to determine node leader!", __FUNCTION__);
+    return DART_ERR_OTHER;
+  }
+  lock->cohort_passes = 0;
+
+  /* Queues must be initialized before any unit enqueues */
+  return dart_barrier(teamid);
+}
+
+/* -- Lock interface -- */
+
 dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
+{
+  return dart_team_lock_init_variant(teamid, DART_LOCK_QUEUE, lock);
+}
+
+dart_ret_t dart_team_lock_init_variant(
+  dart_team_t           teamid,
+  dart_lock_variant_t   variant,
+  dart_lock_t         * lock)
 {
   int ret;
   dart_gptr_t gptr_tail;
@@ -61,6 +412,30 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
     return DART_ERR_INVAL;
   }
 
+  if (variant == DART_LOCK_LOCAL_SPIN) {
+    *lock = malloc(sizeof(struct dart_lock_struct));
+    (*lock)->gptr_tail   = DART_GPTR_NULL;
+    (*lock)->gptr_list   = DART_GPTR_NULL;
+    (*lock)->teamid      = teamid;
+    (*lock)->is_acquired = 0;
+    (*lock)->is_shared   = 0;
+    (*lock)->variant     = variant;
+    ret = dart__mpi__lock_init_local_spin(teamid, team_data, *lock);
+    if (ret != DART_OK) {
+      free(*lock);
+      *lock = NULL;
+      return ret;
+    }
+    DART_ASSERT_RETURNS(
+      dart__base__mutex_init_recursive(&(*lock)->mutex),
+      DART_OK);
+    DART_LOG_DEBUG("dart_team_lock_init: INIT local-spin lock - done");
+    return DART_OK;
+  } else if (variant != DART_LOCK_QUEUE) {
+    DART_LOG_ERROR("%s: Unknown lock variant %d", __FUNCTION__, variant);
+    return DART_ERR_INVAL;
+  }
+
   dart_team_myid(teamid, &unitid);
 
 
@@ -114,8 +489,11 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   *lock = malloc(sizeof(struct dart_lock_struct));
   (*lock)->gptr_tail   = gptr_tail;
   (*lock)->gptr_list   = gptr_list;
+  (*lock)->gptr_state  = DART_GPTR_NULL;
   (*lock)->teamid      = teamid;
   (*lock)->is_acquired = 0;
+  (*lock)->is_shared   = 0;
+  (*lock)->variant     = variant;
   DART_ASSERT_RETURNS(
     dart__base__mutex_init_recursive(&(*lock)->mutex),
     DART_OK);
@@ -145,15 +523,27 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
     return DART_ERR_INVAL;
   }
 
+  dart_team_unit_t unitid;
+  dart_team_myid(lock->teamid, &unitid);
+
+  if (lock->variant == DART_LOCK_LOCAL_SPIN) {
+    dart__mpi__lock_acquire_local_spin(lock, team_data, unitid.id);
+    /* Wait for units holding the lock in shared mode to release it */
+    while (DART__MPI__LOCK_LOAD(lock, team_data, 0, DART__MPI__LOCK_READERS)
+           != 0) { }
+    DART_LOG_DEBUG("dart_lock_acquire: lock acquired in team %d",
+                   lock->teamid);
+    lock->is_acquired = 1;
+    lock->is_shared   = 0;
+    return DART_OK;
+  }
+
   dart_gptr_t gptr_tail = lock->gptr_tail;
   dart_gptr_t gptr_list = lock->gptr_list;
 
   uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
   dart_unit_t tail_unit   = gptr_tail.unitid;
 
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
-
   int32_t predecessor;
 
   /* Fetch the current unit's tail and make this unit the new tail */
@@ -224,6 +614,48 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
 
   DART_LOG_DEBUG("dart_lock_acquire: lock acquired in team %d", lock->teamid);
   lock->is_acquired = 1;
+  lock->is_shared   = 0;
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_acquire_shared(dart_lock_t lock)
+{
+  if (lock->variant != DART_LOCK_LOCAL_SPIN) {
+    return dart_lock_acquire(lock);
+  }
+
+  DART_ASSERT_RETURNS(dart__base__mutex_lock(&lock->mutex), DART_OK);
+
+  if (lock->is_acquired == 1)
+  {
+    DART_LOG_ERROR("dart_lock_acquire_shared: LOCK has already been "
+                   "acquired\n");
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_lock_acquire_shared ! failed: Unknown team %i!",
+                   lock->teamid);
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_unit_t unitid;
+  dart_team_myid(lock->teamid, &unitid);
+
+  /* Register as reader while holding the lock exclusively so readers
+   * cannot enter while a writer waits for readers to leave. */
+  dart__mpi__lock_acquire_local_spin(lock, team_data, unitid.id);
+  (void)dart__mpi__lock_fetch_op(
+          lock, team_data, 0, DART__MPI__LOCK_READERS, 1, MPI_SUM);
+  dart__mpi__lock_release_local_spin(lock, team_data, unitid.id);
+
+  DART_LOG_DEBUG("dart_lock_acquire_shared: lock acquired in team %d",
+                 lock->teamid);
+  lock->is_acquired = 1;
+  lock->is_shared   = 1;
   return DART_OK;
 }
 
@@ -247,6 +679,23 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
   dart_team_unit_t unitid;
   dart_team_myid(lock->teamid, &unitid);
 
+  if (lock->variant == DART_LOCK_LOCAL_SPIN) {
+    dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+    DART_ASSERT(team_data != NULL);
+    *is_acquired = dart__mpi__lock_try_acquire_local_spin(
+                     lock, team_data, unitid.id);
+    if (*is_acquired) {
+      lock->is_acquired = 1;
+      lock->is_shared   = 0;
+    } else {
+      DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    }
+    DART_LOG_DEBUG("dart_lock_try_acquire: trylock %s in team %d",
+                   (*is_acquired) ? "succeeded" : "failed",
+                   lock->teamid);
+    return DART_OK;
+  }
+
   int32_t result;
   int32_t compare = -1;
 
@@ -275,6 +724,7 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
   if (result == -1)
   {
     lock->is_acquired = 1;
+    lock->is_shared   = 0;
     *is_acquired = 1;
   } else {
     *is_acquired = 0;
@@ -295,12 +745,29 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
     return DART_ERR_INVAL;
   }
 
-  dart_gptr_t gptr_tail = lock->gptr_tail;
-  dart_gptr_t gptr_list = lock->gptr_list;
-
   dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
   DART_ASSERT(team_data != NULL);
 
+  if (lock->variant == DART_LOCK_LOCAL_SPIN) {
+    dart_team_unit_t myid;
+    dart_team_myid(lock->teamid, &myid);
+    if (lock->is_shared) {
+      (void)dart__mpi__lock_fetch_op(
+              lock, team_data, 0, DART__MPI__LOCK_READERS, -1, MPI_SUM);
+    } else {
+      dart__mpi__lock_release_local_spin(lock, team_data, myid.id);
+    }
+    lock->is_acquired = 0;
+    lock->is_shared   = 0;
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    DART_LOG_DEBUG("dart_lock_release: release lock in team %d",
+                   lock->teamid);
+    return DART_OK;
+  }
+
+  dart_gptr_t gptr_tail = lock->gptr_tail;
+  dart_gptr_t gptr_list = lock->gptr_list;
+
   uint64_t      offset_tail = gptr_tail.addr_or_offs.offset;
   dart_unit_t   tail        = gptr_tail.unitid;
   int32_t     * addr;
@@ -386,6 +853,25 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
 
   dart_team_myid(teamid, &unitid);
 
+  if ((*lock)->variant == DART_LOCK_LOCAL_SPIN) {
+    /* Units may still access the queues until they released the lock */
+    ret = dart_barrier(teamid);
+    if (ret != DART_OK) {
+      return ret;
+    }
+    ret = dart_team_memfree((*lock)->gptr_state);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("Failed to free global mmeory");
+      return ret;
+    }
+    (*lock)->gptr_state = DART_GPTR_NULL;
+    (*lock)->teamid     = DART_TEAM_NULL;
+    dart__base__mutex_destroy(&(*lock)->mutex);
+    DART_LOG_DEBUG("dart_team_lock_free: done in team %d", teamid);
+    free(*lock);
+    *lock = NULL;
+    return DART_OK;
+  }
 
   /* Unit 0 is the process holding the gptr_tail by default. */
   if (unitid.id == 0) {
@@ -637,6 +637,7 @@ dart_ret_t dart_team_create(
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
     dart_allocate_shared_comm(team_data);
 #endif
+    dart_allocate_node_comms(team_data);
     MPI_Win_lock_all(0, win);
     DART_LOG_DEBUG("TEAMCREATE - create team %d from parent team %d",
                    *newteam, teamid);
@@ -669,6 +670,7 @@ dart_ret_t dart_team_destroy(
   // free(dart_unit_mapping[index]);
 
   // MPI_Win_free (&(sharedmem_win_list[index]));
+  dart_free_node_comms(team_data);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   free(team_data->sharedmem_tab);
 #endif
@@ -3,23 +3,21 @@
  *  @brief Implementations for the operations on teamlist.
  */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_team_group.h>
 #include <dash/dart/mpi/dart_team_private.h>
 
-#define DART_TEAM_HASH_SIZE (256)
+/* Initial number of entries in the team table */
+#define DART_TEAM_TABLE_INIT_SIZE (DART_MAX_TEAM_NUMBER)
 
 dart_team_t dart_next_availteamid = (DART_TEAM_ALL + 1);
 
 MPI_Comm dart_comm_world;
 
-static dart_team_data_t *dart_team_data[DART_TEAM_HASH_SIZE];
-
-static int
-dart_adapt_teamlist_hash(dart_team_t teamid)
-{
-  return (teamid % DART_TEAM_HASH_SIZE);
-}
+dart_team_data_t **dart_team_data_tab      = NULL;
+int                dart_team_data_capacity = 0;
 
 #if 0
 
@@ -181,47 +179,28 @@ int dart_adapt_teamlist_convert(
 dart_ret_t
 dart_adapt_teamlist_init()
 {
-  memset(dart_team_data, 0, sizeof(dart_team_data_t*) * DART_TEAM_HASH_SIZE);
-
-  return DART_OK;
-}
-
-dart_team_data_t *
-dart_adapt_teamlist_get(dart_team_t teamid)
-{
-  int slot = dart_adapt_teamlist_hash(teamid);
-  dart_team_data_t *res = dart_team_data[slot];
-  while (res != NULL && res->teamid != teamid) {
-    res = res->next;
+  dart_team_data_tab = calloc(DART_TEAM_TABLE_INIT_SIZE,
+                              sizeof(dart_team_data_t*));
+  if (dart_team_data_tab == NULL) {
+    return DART_ERR_OTHER;
   }
+  dart_team_data_capacity = DART_TEAM_TABLE_INIT_SIZE;
 
-  return res;
+  return DART_OK;
 }
 
 dart_ret_t
 dart_adapt_teamlist_dealloc(dart_team_t teamid)
 {
-  int slot = dart_adapt_teamlist_hash(teamid);
-  dart_team_data_t *res = dart_team_data[slot];
-  dart_team_data_t **prev = NULL;
-
-  while (res != NULL && res->teamid == teamid) {
-    prev = &res;
-    res = res->next;
-  }
+  dart_team_data_t *res = dart_adapt_teamlist_get(teamid);
 
   // not found!
   if (res == NULL) {
     return DART_ERR_INVAL;
   }
 
-  if (prev == NULL) {
-    dart_team_data[slot] = res->next;
-  } else {
-    (*prev)->next = res->next;
-  }
-
-  res->next = NULL;
+  dart_team_data_tab[teamid] = NULL;
+  dart_segment_fini(&(res->segdata));
   free(res);
   return DART_OK;
 }
@@ -229,12 +208,38 @@ dart_adapt_teamlist_dealloc(dart_team_t teamid)
 dart_ret_t
 dart_adapt_teamlist_alloc(dart_team_t teamid)
 {
-  int slot = dart_adapt_teamlist_hash(teamid);
+  if (teamid < 0) {
+    DART_LOG_ERROR("dart_adapt_teamlist_alloc ! Invalid team ID %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  if (teamid >= dart_team_data_capacity) {
+    // grow the team table by doubling its capacity
+    int new_capacity = dart_team_data_capacity;
+    while (new_capacity <= teamid) {
+      new_capacity *= 2;
+    }
+    dart_team_data_t **new_tab = realloc(
+                                   dart_team_data_tab,
+                                   new_capacity * sizeof(dart_team_data_t*));
+    if (new_tab == NULL) {
+      DART_LOG_ERROR("dart_adapt_teamlist_alloc ! "
+                     "Failed to grow team table to %d entries", new_capacity);
+      return DART_ERR_OTHER;
+    }
+    memset(new_tab + dart_team_data_capacity, 0,
+           (new_capacity - dart_team_data_capacity) * sizeof(dart_team_data_t*));
+    dart_team_data_tab      = new_tab;
+    dart_team_data_capacity = new_capacity;
+  }
+  if (dart_team_data_tab[teamid] != NULL) {
+    DART_LOG_ERROR("dart_adapt_teamlist_alloc ! Team %d already exists",
+                   teamid);
+    return DART_ERR_INVAL;
+  }
   dart_team_data_t *res = calloc(1, sizeof(dart_team_data_t));
   res->teamid = teamid;
   res->unitid = DART_UNDEFINED_UNIT_ID;
-  res->next = dart_team_data[slot];
-  dart_team_data[slot] = res;
+  dart_team_data_tab[teamid] = res;
   dart_segment_init(&(res->segdata), teamid);
   return DART_OK;
 }
@@ -242,16 +247,12 @@ dart_adapt_teamlist_alloc(dart_team_t teamid)
 
 dart_ret_t dart_adapt_teamlist_destroy()
 {
-  for (int i = 0; i < DART_TEAM_HASH_SIZE; i++) {
-    dart_team_data_t *elem = dart_team_data[i];
-    while (elem != NULL) {
-      dart_team_data_t *tmp = elem;
-      elem = tmp->next;
-      tmp->next = NULL;
-      free(tmp);
-    }
-    dart_team_data[i] = NULL;
+  for (int i = 0; i < dart_team_data_capacity; i++) {
+    free(dart_team_data_tab[i]);
   }
+  free(dart_team_data_tab);
+  dart_team_data_tab      = NULL;
+  dart_team_data_capacity = 0;
   return DART_OK;
 }
 
@@ -315,3 +316,113 @@ dart_ret_t dart_allocate_shared_comm(dart_team_data_t *team_data)
   return DART_OK;
 }
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
+dart_ret_t dart_allocate_node_comms(dart_team_data_t *team_data)
+{
+  int node_rank;
+  int node_info[2];
+  int rank = team_data->unitid;
+  int size = team_data->size;
+
+  team_data->node_leader_comm  = MPI_COMM_NULL;
+  team_data->num_nodes         = 1;
+  team_data->hierarchical_coll = 0;
+  team_data->nodes_contiguous  = 1;
+  team_data->node_ids          = NULL;
+  team_data->node_ranks        = NULL;
+  team_data->node_displs       = NULL;
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  /* Units sharing memory are located at the same node: */
+  team_data->node_comm = team_data->sharedmem_comm;
+#else
+  MPI_Comm_split_type(
+    team_data->comm,
+    MPI_COMM_TYPE_SHARED,
+    rank,
+    MPI_INFO_NULL,
+    &(team_data->node_comm));
+#endif
+  if (team_data->node_comm == MPI_COMM_NULL) {
+    return DART_ERR_OTHER;
+  }
+  MPI_Comm_rank(team_data->node_comm, &node_rank);
+
+  /* The first unit at every node takes part in the inter-node phase: */
+  MPI_Comm_split(
+    team_data->comm,
+    (node_rank == 0) ? 0 : MPI_UNDEFINED,
+    rank,
+    &(team_data->node_leader_comm));
+  if (node_rank == 0) {
+    MPI_Comm_rank(team_data->node_leader_comm, &node_info[0]);
+    MPI_Comm_size(team_data->node_leader_comm, &node_info[1]);
+  }
+  MPI_Bcast(node_info, 2, MPI_INT, 0, team_data->node_comm);
+  team_data->num_nodes = node_info[1];
+
+  /*
+   * Only teams spanning several nodes with more than one unit at some
+   * node benefit from the hierarchical implementation. The decision is
+   * consistent across the team as the number of nodes is known to all
+   * units.
+   */
+  if (team_data->num_nodes <= 1 || team_data->num_nodes >= size) {
+    DART_LOG_DEBUG("dart_allocate_node_comms: team:%d nodes:%d "
+                   "using flat collectives",
+                   team_data->teamid, team_data->num_nodes);
+    return DART_OK;
+  }
+
+  int * unit_info = malloc(2 * size * sizeof(int));
+  team_data->node_ids    = malloc(size * sizeof(int));
+  team_data->node_ranks  = malloc(size * sizeof(int));
+  team_data->node_displs = calloc(team_data->num_nodes + 1, sizeof(int));
+  node_info[1] = node_rank;
+  MPI_Allgather(node_info, 2, MPI_INT, unit_info, 2, MPI_INT,
+                team_data->comm);
+  for (int u = 0; u < size; u++) {
+    team_data->node_ids[u]   = unit_info[2 * u];
+    team_data->node_ranks[u] = unit_info[2 * u + 1];
+    team_data->node_displs[team_data->node_ids[u] + 1]++;
+  }
+  for (int n = 0; n < team_data->num_nodes; n++) {
+    team_data->node_displs[n + 1] += team_data->node_displs[n];
+  }
+  for (int u = 0; u < size; u++) {
+    if (team_data->node_displs[team_data->node_ids[u]] +
+        team_data->node_ranks[u] != u) {
+      team_data->nodes_contiguous = 0;
+      break;
+    }
+  }
+  free(unit_info);
+  team_data->hierarchical_coll = 1;
+
+  DART_LOG_DEBUG("dart_allocate_node_comms: team:%d nodes:%d "
+                 "using hierarchical collectives (contiguous:%d)",
+                 team_data->teamid, team_data->num_nodes,
+                 team_data->nodes_contiguous);
+  return DART_OK;
+}
+
+dart_ret_t dart_free_node_comms(dart_team_data_t *team_data)
+{
+  if (team_data->node_leader_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&(team_data->node_leader_comm));
+  }
+#if defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (team_data->node_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&(team_data->node_comm));
+  }
+#endif
+  team_data->node_comm         = MPI_COMM_NULL;
+  team_data->hierarchical_coll = 0;
+  free(team_data->node_ids);
+  free(team_data->node_ranks);
+  free(team_data->node_displs);
+  team_data->node_ids    = NULL;
+  team_data->node_ranks  = NULL;
+  team_data->node_displs = NULL;
+  return DART_OK;
+}
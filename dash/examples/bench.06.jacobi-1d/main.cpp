@@ -3,10 +3,20 @@
 #include <cstddef>
 
 #include <libdash.h>
+#include <dash/experimental/StencilOperator.h>
 #include "../bench.h"
 
+#include <algorithm>
+#include <ratio>
+
 using namespace std;
 
+typedef dash::experimental::StencilSpec<
+          dash::experimental::StencilPoint<std::ratio<1,4>, -1>,
+          dash::experimental::StencilPoint<std::ratio<1,2>,  0>,
+          dash::experimental::StencilPoint<std::ratio<1,4>,  1> >
+  jacobi_stencil_t;
+
 
 // initialize arrays
 template<typename T>
@@ -40,6 +50,12 @@ double test_global(dash::Array<T>& v1, dash::Array<T>& v2, size_t steps);
 template<typename T>
 double test_local(dash::Array<T>& v1, dash::Array<T>& v2, size_t steps);
 
+// jacobi iteration using dash::experimental::StencilOperator with halo
+// regions for 'halo_steps' iterations per halo update
+// read from 'v1', results are copied back to 'v1'
+template<typename T>
+double test_stencil(dash::Array<T>& v1, size_t steps, int halo_steps);
+
 void perform_test(size_t nelem, size_t steps);
 
 
@@ -113,6 +129,8 @@ void perform_test(size_t nelem, size_t steps)
     cout<<jacobi_residual(v1)<<endl;
     cout<<"Local: MUPS: "<<nelem*steps*1.0e-6/local<<endl;
   }
+  // residual is read by unit 0 before re-initialization
+  dash::barrier();
 
   jacobi_init(v1, v2);
   double global = test_global(v1, v2, steps);
@@ -120,6 +138,18 @@ void perform_test(size_t nelem, size_t steps)
     cout<<jacobi_residual(v1)<<endl;
     cout<<"Global: MUPS: "<<nelem*steps*1.0e-6/global<<endl;
   }
+  dash::barrier();
+
+  for( int halo_steps : { 1, 4 } ) {
+    jacobi_init(v1, v2);
+    double stencil = test_stencil(v1, steps, halo_steps);
+    if( myid==0 ) {
+      cout<<jacobi_residual(v1)<<endl;
+      cout<<"Stencil (halo steps: "<<halo_steps<<"): MUPS: "
+          <<nelem*steps*1.0e-6/stencil<<endl;
+    }
+    dash::barrier();
+  }
 
   dash::barrier();
 }
@@ -160,6 +190,35 @@ double test_global(dash::Array<T>& v1,
   return (tstop-tstart);
 }
 
+template<typename T>
+double test_stencil(dash::Array<T>& v1,
+		    size_t steps,
+		    int halo_steps)
+{
+  typedef dash::Matrix<T, 1> matrix_t;
+  double tstart, tstop;
+
+  // same distribution as v1
+  matrix_t m1(v1.size());
+  matrix_t m2(v1.size());
+  std::copy(v1.lbegin(), v1.lend(), m1.lbegin());
+  std::copy(v1.lbegin(), v1.lend(), m2.lbegin());
+  dash::barrier();
+
+  dash::experimental::StencilOperator<matrix_t, jacobi_stencil_t> op(
+    m1, m2, jacobi_stencil_t::halospec(halo_steps));
+
+  TIMESTAMP(tstart);
+  // two iterations per step as in test_local
+  op.apply(2 * steps);
+  TIMESTAMP(tstop);
+
+  std::copy(op.current().lbegin(), op.current().lend(), v1.lbegin());
+  dash::barrier();
+
+  return (tstop-tstart);
+}
+
 
 template<typename T>
 void jacobi_local(const dash::Array<T>& v1,
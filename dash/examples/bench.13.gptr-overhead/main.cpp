@@ -0,0 +1,227 @@
+/**
+ * Measures the per-operation overhead of resolving global pointers in
+ * DART, i.e. the time spent to find the team and segment of a global
+ * pointer before the data is accessed.
+ *
+ * A number of collective allocations are created so global pointers refer
+ * to segments with low and high segment IDs. Every operation accesses a
+ * single element, so the measured time is dominated by the resolution of
+ * the global pointer:
+ *
+ * - getaddr:    dart_gptr_getaddr on a local global pointer
+ * - getaddr.node: dart_gptr_getaddr_node on a global pointer to the
+ *               neighbor unit, resolves a native pointer if the neighbor
+ *               is located at the same node
+ * - get.local:  dart_get_blocking from the calling unit
+ * - get.remote: dart_get_blocking from the neighbor unit
+ *
+ * Every collective allocation is attached to the dynamic window of the
+ * team, MPI implementations may limit the number of attached regions
+ * (e.g. MCA parameter osc_rdma_max_attach in OpenMPI).
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+typedef struct benchmark_params_t {
+  int    num_segments;
+  long   num_repeats;
+} benchmark_params;
+
+typedef struct measurement_t {
+  std::string testcase;
+  int         segid;
+  double      time_op_ns;
+} measurement;
+
+void print_measurement_header();
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+measurement evaluate(
+              dart_gptr_t      gptr,
+              std::string      testcase,
+              benchmark_params params);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  // 0: real, 1: virt
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.13.gptr-overhead");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  auto bench_cfg = bench_params.config();
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  std::array<std::string, 4> testcases {{
+                            "getaddr",
+                            "getaddr.node",
+                            "get.local",
+                            "get.remote" }};
+
+  std::vector<dart_gptr_t> gptrs(params.num_segments);
+  for (auto & gptr : gptrs) {
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(
+        DART_TEAM_ALL, 1, DART_TYPE_LONG, &gptr),
+      DART_OK);
+  }
+
+  // Access the segments with the lowest and the highest segment ID
+  for (auto gptr : { gptrs.front(), gptrs.back() }) {
+    for (auto testcase : testcases) {
+      auto res = evaluate(gptr, testcase, params);
+      print_measurement_record(bench_cfg, res, params);
+    }
+  }
+
+  for (auto & gptr : gptrs) {
+    dart_team_memfree(gptr);
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+measurement evaluate(
+  dart_gptr_t      gptr,
+  std::string      testcase,
+  benchmark_params params)
+{
+  measurement mes;
+  long        value = 0;
+  void      * addr  = nullptr;
+
+  dart_team_unit_t myid;
+  dart_team_myid(DART_TEAM_ALL, &myid);
+  dart_gptr_setunit(&gptr, myid);
+  if (testcase == "get.remote" || testcase == "getaddr.node") {
+    dart_team_unit_t neighbor;
+    neighbor.id = (myid.id + 1) % dash::size();
+    dart_gptr_setunit(&gptr, neighbor);
+  }
+
+  dash::barrier();
+  auto ts_start = Timer::Now();
+
+  if (testcase == "getaddr") {
+    for (long r = 0; r < params.num_repeats; ++r) {
+      dart_gptr_getaddr(gptr, &addr);
+    }
+  } else if (testcase == "getaddr.node") {
+    for (long r = 0; r < params.num_repeats; ++r) {
+      dart_gptr_getaddr_node(gptr, &addr);
+    }
+  } else {
+    for (long r = 0; r < params.num_repeats; ++r) {
+      dart_get_blocking(&value, gptr, 1, DART_TYPE_LONG);
+    }
+  }
+
+  double time_us = Timer::ElapsedSince(ts_start);
+  dash::barrier();
+
+  mes.testcase   = testcase;
+  mes.segid      = gptr.segid;
+  mes.time_op_ns = (time_us * 1000) / params.num_repeats;
+  return mes;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(12) << "impl"       << ","
+         << std::setw( 7) << "segid"      << ","
+         << std::setw(12) << "repeats"    << ","
+         << std::setw(10) << "op.ns"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  measurement              measurement,
+  const benchmark_params & params)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(MPI_IMPL_ID);
+    auto mes = measurement;
+    cout << std::right
+         << std::setw(5)  << dash::size()       << ","
+         << std::setw(9)  << mpi_impl           << ","
+         << std::setw(12) << mes.testcase       << ","
+         << std::setw(7)  << mes.segid          << ","
+         << std::setw(12) << params.num_repeats << ","
+         << std::fixed << setprecision(2) << setw(10) << mes.time_op_ns
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.num_segments   = 1000;
+  params.num_repeats    = 1000000;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-s") {
+      params.num_segments = atoi(argv[i+1]);
+    }
+    if (flag == "-r") {
+      params.num_repeats  = atol(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-s", "number of segments", params.num_segments);
+  bench_cfg.print_param("-r", "operations per measurement", params.num_repeats);
+  bench_cfg.print_section_end();
+}
@@ -61,6 +61,16 @@ int main(int argc, char* argv[])
   }
   DASH_LOG_DEBUG("Array local size:   ", array.lsize());
 
+  // Global offsets of local elements from the exclusive prefix sum of
+  // element sizes:
+  dash::fill(array.begin(), array.end(), 1);
+  dash::exclusive_scan(array.begin(), array.end(), array.begin(),
+                       value_t(0));
+  if (array.lsize() > 0) {
+    DASH_LOG_DEBUG("Global offset of local elements:", array.local[0]);
+  }
+  array.barrier();
+
   dash::finalize();
 
   return 0;
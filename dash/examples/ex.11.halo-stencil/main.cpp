@@ -21,9 +21,10 @@
 #include <dash/algorithm/Copy.h>
 #include <dash/algorithm/Fill.h>
 
-#include <dash/experimental/HaloMatrix.h>
+#include <dash/experimental/StencilOperator.h>
 
 #include <fstream>
+#include <ratio>
 #include <string>
 #include <iostream>
 #include <vector>
@@ -37,8 +38,15 @@ using element_t = unsigned char;
 using Pattern_t = dash::Pattern<2>;
 using index_t   = typename Pattern_t::index_type;
 using Array_t   = dash::NArray<element_t, 2, index_t, Pattern_t>;
-using Halo_t    = HaloSpec<2>;
-using HArray_t  = HaloMatrix<Array_t, Halo_t>;
+// Blur filter weighting the center pixel by 0.40 and its four neighbors
+// by 0.15 each:
+using Stencil_t = StencilSpec<
+                    StencilPoint<std::ratio<15,100>, -1,  0>,
+                    StencilPoint<std::ratio<15,100>,  0, -1>,
+                    StencilPoint<std::ratio<40,100>,  0,  0>,
+                    StencilPoint<std::ratio<15,100>,  0,  1>,
+                    StencilPoint<std::ratio<15,100>,  1,  0> >;
+using StencilOp_t = StencilOperator<Array_t, Stencil_t>;
 
 void write_pgm(const std::string & filename, const Array_t & data){
   if(dash::myid() == 0){
@@ -119,52 +127,6 @@ void draw_circle(Array_t * dataptr, index_t x0, index_t y0, int r){
   }
 }
 
-void smooth(Array_t & data_old, Array_t & data_new){
-  // Add Halo Features
-  Halo_t halo_s({{{-1,1},{-1,1}}});
-  HArray_t hdata_old(data_old, halo_s);
-  HArray_t hdata_new(data_new, halo_s);
-
-  const auto & pattern = data_old.pattern();
-
-  auto lext_x = pattern.local_extent(0);
-  auto lext_y = pattern.local_extent(1);
-
-  auto olptr = data_old.lbegin();
-  auto nlptr = data_new.lbegin();
-
-  // Fetch Halo
-  hdata_old.updateHalosAsync();
-
-  // Inner cell
-  for( index_t x=1; x<lext_x-1; x++ ) {
-    for( index_t y=1; y<lext_y-1; y++ ) {
-      nlptr[x*lext_y+y] =
-        ( 0.40 * olptr[x*lext_y+y] +
-        0.15 * olptr[(x-1)*lext_y+y] +
-        0.15 * olptr[(x+1)*lext_y+y] +
-        0.15 * olptr[x*lext_y+y-1] +
-        0.15 * olptr[x*lext_y+y+1]);
-    }
-  }
-  // Boundary
-
-  // Wait until all Halo updates ready
-  hdata_old.waitHalosAsync();
-
-  // Calculation of boundary Halo elements
-  for(auto it = hdata_old.bbegin(); it != hdata_old.bend(); ++it) 
-  {
-    auto core = *it;
-    *(nlptr+it.lpos()) = (0.40 * core) +
-                       (0.15 * it.halo_value(-1,  0)) +
-                       (0.15 * it.halo_value( 1,  0)) +
-                       (0.15 * it.halo_value( 0, -1)) +
-                       (0.15 * it.halo_value( 0, +1));
-  }
-  data_new.barrier();
-}
-
 int main(int argc, char* argv[])
 {
   int sizex = 1000;
@@ -205,16 +167,11 @@ int main(int argc, char* argv[])
   write_pgm("testimg_input.pgm", data_old);
   dash::barrier();
 
-  for(int i=0; i<niter; ++i){
-    // switch references
-    auto & data_prev = i%2 ? data_new : data_old;
-    auto & data_next = i%2 ? data_old : data_new;
-
-    smooth(data_prev, data_next);
-    dash::barrier();
-  }
+  // Computes inner pixels while halo pixels are fetched, alternating
+  // between data_old and data_new in every iteration
+  StencilOp_t smooth(data_old, data_new);
+  smooth.apply(niter);
 
-  // Assume niter is even
-  write_pgm("testimg_output.pgm", data_new);
+  write_pgm("testimg_output.pgm", smooth.current());
   dash::finalize();
 }
@@ -13,9 +13,12 @@
 
 #include <dash/algorithm/Operation.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Sync.h>
 #include <dash/algorithm/ForEach.h>
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
+#include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/Scan.h>
 #include <dash/algorithm/Accumulate.h>
 #include <dash/algorithm/Copy.h>
 #include <dash/algorithm/Fill.h>
@@ -24,6 +27,13 @@
 #include <dash/algorithm/AnyOf.h>
 #include <dash/algorithm/Find.h>
 #include <dash/algorithm/Equal.h>
+#include <dash/algorithm/Count.h>
+#include <dash/algorithm/Remove.h>
+#include <dash/algorithm/Partition.h>
+#include <dash/algorithm/Unique.h>
+#include <dash/algorithm/SetIntersection.h>
+#include <dash/algorithm/Histogram.h>
+#include <dash/algorithm/Sort.h>
 
 #include <dash/algorithm/SUMMA.h>
 
@@ -18,12 +18,14 @@ class Future
 private:
   typedef Future<ResultT>               self_t;
   typedef std::function<ResultT (void)> func_t;
+  typedef std::function<bool (void)>    test_func_t;
 
 private:
-  func_t    _func;
-  ResultT   _value;
-  bool      _ready     = false;
-  bool      _has_func  = false;
+  func_t      _func;
+  test_func_t _test_func;
+  ResultT     _value;
+  bool        _ready     = false;
+  bool        _has_func  = false;
 
 public:
   // For ostream output
@@ -44,9 +46,24 @@ public:
     _has_func(true)
   { }
 
+  /**
+   * Future with a function \c test_func returning whether the result is
+   * available without blocking, \c func is called to obtain the result
+   * once \c test_func returned \c true or in \c wait().
+   */
+  Future(
+    const func_t      & func,
+    const test_func_t & test_func)
+  : _func(func),
+    _test_func(test_func),
+    _ready(false),
+    _has_func(true)
+  { }
+
   Future(
     const self_t & other)
   : _func(other._func),
+    _test_func(other._test_func),
     _value(other._value),
     _ready(other._ready),
     _has_func(other._has_func)
@@ -56,6 +73,7 @@ public:
   {
     if (this != &other) {
       _func      = other._func;
+      _test_func = other._test_func;
       _value     = other._value;
       _ready     = other._ready;
       _has_func  = other._has_func;
@@ -80,8 +98,11 @@ public:
     DASH_LOG_TRACE_VAR("Future.wait >", _ready);
   }
 
-  bool test() const
+  bool test()
   {
+    if (!_ready && _test_func && _test_func()) {
+      wait();
+    }
     return _ready;
   }
 
@@ -467,6 +467,22 @@ public:
     return nullptr;
   }
 
+  /**
+   * Conversion to native pointer to node-local memory.
+   *
+   * \returns  A native pointer to the element referenced by this
+   *           GlobPtr instance if it is located at the calling unit or
+   *           in shared memory of a unit at the same node, or \c nullptr
+   *           otherwise.
+   */
+  value_type * node_local() const {
+    void *addr = 0;
+    if (dart_gptr_getaddr_node(_rbegin_gptr, &addr) == DART_OK) {
+      return static_cast<value_type*>(addr);
+    }
+    return nullptr;
+  }
+
   /**
    * Set the global pointer's associated unit.
    */
@@ -642,6 +658,10 @@ class GlobConstPtr
     return base_t::local();
   }
 
+  const value_type * node_local() const {
+    return base_t::node_local();
+  }
+
   bool is_local() const {
     return base_t::is_local();
   }
@@ -853,6 +873,33 @@ dash::default_index_t distance(
   return gptr_last - gptr_first;
 }
 
+/**
+ * Whether the memory referenced by a DART global pointer can be accessed
+ * directly by the calling unit, i.e. it is located at the calling unit or
+ * in shared memory of a unit at the same node.
+ */
+inline bool is_node_local(dart_gptr_t gptr)
+{
+  void * addr = nullptr;
+  return !DART_GPTR_ISNULL(gptr) &&
+         dart_gptr_getaddr_node(gptr, &addr) == DART_OK &&
+         addr != nullptr;
+}
+
+/**
+ * Whether the element referenced by a global pointer, reference or
+ * iterator can be accessed directly by the calling unit, i.e. it is
+ * located at the calling unit or in shared memory of a unit at the
+ * same node.
+ *
+ * \concept{DashMemorySpaceConcept}
+ */
+template <class GlobPtrT>
+inline bool is_node_local(const GlobPtrT & gptr)
+{
+  return dash::is_node_local(gptr.dart_gptr());
+}
+
 } // namespace dash
 
 #endif // DASH__GLOB_PTR_H_
@@ -50,7 +50,10 @@ private:
     self_const_t;
 
 private:
-  dart_gptr_t _gptr;
+  dart_gptr_t           _gptr;
+  /// Native pointer to the referenced element if it is located at a unit
+  /// at the same node as the calling unit, \c nullptr otherwise.
+  nonconst_value_type * _lptr;
 
 public:
   /**
@@ -63,7 +66,7 @@ public:
    * memory.
    */
   template<class ElementT, class MemSpaceT>
-  explicit constexpr GlobRef(
+  explicit GlobRef(
     /// Pointer to referenced object in global memory
     GlobPtr<ElementT, MemSpaceT> & gptr)
   : GlobRef(gptr.dart_gptr())
@@ -74,7 +77,7 @@ public:
    * memory.
    */
   template<class ElementT>
-  explicit constexpr GlobRef(
+  explicit GlobRef(
     /// Pointer to referenced object in global memory
     GlobConstPtr<ElementT> & gptr)
   : GlobRef(gptr.dart_gptr())
@@ -85,7 +88,7 @@ public:
    * memory.
    */
   template<class ElementT, class MemSpaceT>
-  explicit constexpr GlobRef(
+  explicit GlobRef(
     /// Pointer to referenced object in global memory
     const GlobPtr<ElementT, MemSpaceT> & gptr)
   : GlobRef(gptr.dart_gptr())
@@ -96,7 +99,7 @@ public:
    * memory.
    */
   template<class ElementT>
-  explicit constexpr GlobRef(
+  explicit GlobRef(
     /// Pointer to referenced object in global memory
     const GlobConstPtr<ElementT> & gptr)
   : GlobRef(gptr.dart_gptr())
@@ -106,8 +109,9 @@ public:
    * Constructor, creates an GlobRef object referencing an element in global
    * memory.
    */
-  explicit constexpr GlobRef(dart_gptr_t dart_gptr)
+  explicit GlobRef(dart_gptr_t dart_gptr)
   : _gptr(dart_gptr)
+  , _lptr(node_local_ptr(dart_gptr))
   { }
 
   /**
@@ -153,6 +157,9 @@ public:
   operator nonconst_value_type() const {
     DASH_LOG_TRACE("GlobRef.T()", "conversion operator");
     DASH_LOG_TRACE_VAR("GlobRef.T()", _gptr);
+    if (_lptr != nullptr) {
+      return *_lptr;
+    }
     nonconst_value_type t;
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_get_blocking(static_cast<void *>(&t), _gptr, ds.nelem, ds.dtype);
@@ -191,8 +198,10 @@ public:
   void set(const T & val) {
     DASH_LOG_TRACE_VAR("GlobRef.set()", val);
     DASH_LOG_TRACE_VAR("GlobRef.set", _gptr);
-    // TODO: Clarify if dart-call can be avoided if
-    //       _gptr->is_local()
+    if (_lptr != nullptr) {
+      *_lptr = val;
+      return;
+    }
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_put_blocking(
         _gptr, static_cast<const void *>(&val), ds.nelem, ds.dtype);
@@ -202,6 +211,9 @@ public:
   nonconst_value_type get() const {
     DASH_LOG_TRACE("T GlobRef.get()", "explicit get");
     DASH_LOG_TRACE_VAR("GlobRef.T()", _gptr);
+    if (_lptr != nullptr) {
+      return *_lptr;
+    }
     nonconst_value_type t;
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_get_blocking(static_cast<void *>(&t), _gptr, ds.nelem, ds.dtype);
@@ -211,6 +223,10 @@ public:
   void get(nonconst_value_type *tptr) const {
     DASH_LOG_TRACE("GlobRef.get(T*)", "explicit get into provided ptr");
     DASH_LOG_TRACE_VAR("GlobRef.T()", _gptr);
+    if (_lptr != nullptr) {
+      *tptr = *_lptr;
+      return;
+    }
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_get_blocking(static_cast<void *>(tptr), _gptr, ds.nelem, ds.dtype);
   }
@@ -218,6 +234,10 @@ public:
   void get(nonconst_value_type& tref) const {
     DASH_LOG_TRACE("GlobRef.get(T&)", "explicit get into provided ref");
     DASH_LOG_TRACE_VAR("GlobRef.T()", _gptr);
+    if (_lptr != nullptr) {
+      tref = *_lptr;
+      return;
+    }
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_get_blocking(static_cast<void *>(&tref), _gptr, ds.nelem, ds.dtype);
   }
@@ -225,6 +245,10 @@ public:
   void put(nonconst_value_type& tref) const {
     DASH_LOG_TRACE("GlobRef.put(T&)", "explicit put of provided ref");
     DASH_LOG_TRACE_VAR("GlobRef.T()", _gptr);
+    if (_lptr != nullptr) {
+      *_lptr = tref;
+      return;
+    }
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_put_blocking(_gptr, static_cast<void *>(&tref), ds.nelem, ds.dtype);
   }
@@ -232,6 +256,10 @@ public:
   void put(nonconst_value_type* tptr) const {
     DASH_LOG_TRACE("GlobRef.put(T*)", "explicit put of provided ptr");
     DASH_LOG_TRACE_VAR("GlobRef.T()", _gptr);
+    if (_lptr != nullptr) {
+      *_lptr = *tptr;
+      return;
+    }
     dart_storage_t ds = dash::dart_storage<T>(1);
     dart_put_blocking(_gptr, static_cast<void *>(tptr), ds.nelem, ds.dtype);
   }
@@ -342,6 +370,15 @@ public:
     return _gptr.unitid == luid.id;
   }
 
+  /**
+   * Checks whether the globally referenced element is located at a unit
+   * at the same node as the calling unit and is accessed directly in
+   * shared memory.
+   */
+  constexpr bool is_node_local() const noexcept {
+    return _lptr != nullptr;
+  }
+
   /**
    * Get a global ref to a member of a certain type at the
    * specified offset
@@ -367,6 +404,19 @@ public:
     return member<MEMTYPE>(offs);
   }
 
+private:
+  /**
+   * Resolves the native address of the element referenced by \c gptr if
+   * it can be accessed directly by the calling unit.
+   */
+  static nonconst_value_type * node_local_ptr(dart_gptr_t gptr) {
+    void * addr = nullptr;
+    if (!DART_GPTR_ISNULL(gptr)) {
+      dart_gptr_getaddr_node(gptr, &addr);
+    }
+    return static_cast<nonconst_value_type *>(addr);
+  }
+
 };
 
 template<typename T>
@@ -2,6 +2,7 @@
 #define DASH__LAUNCH__H__INCLUDED
 
 #include <cstdint>
+#include <type_traits>
 
 namespace dash {
 
@@ -12,6 +13,61 @@ sync     = 0x1,
 async    = 0x2
 };
 
+namespace execution {
+
+/**
+ * Execution policy type, the local portion of an algorithm is executed
+ * sequentially in the calling thread.
+ */
+struct sequenced_policy { };
+
+/**
+ * Execution policy type, the local portion of an algorithm is executed
+ * by multiple threads. Functions passed to the algorithm must be safe to
+ * invoke concurrently on different elements.
+ */
+struct parallel_policy { };
+
+/**
+ * Execution policy type, the local portion of an algorithm is executed
+ * by multiple threads and may be vectorized. Functions passed to the
+ * algorithm must be safe to invoke concurrently and interleaved on
+ * different elements.
+ */
+struct parallel_unsequenced_policy { };
+
+/// Sequential execution of local portions of algorithms
+constexpr sequenced_policy            seq       { };
+/// Multithreaded execution of local portions of algorithms
+constexpr parallel_policy             par       { };
+/// Multithreaded and vectorized execution of local portions of algorithms
+constexpr parallel_unsequenced_policy par_unseq { };
+
+/**
+ * Type trait, whether \c T is an execution policy type.
+ */
+template <class T>
+struct is_execution_policy
+: public std::false_type
+{ };
+
+template <>
+struct is_execution_policy<sequenced_policy>
+: public std::true_type
+{ };
+
+template <>
+struct is_execution_policy<parallel_policy>
+: public std::true_type
+{ };
+
+template <>
+struct is_execution_policy<parallel_unsequenced_policy>
+: public std::true_type
+{ };
+
+} // namespace execution
+
 }
 
 
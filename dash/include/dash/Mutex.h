@@ -3,6 +3,8 @@
 
 #include <dash/Team.h>
 
+#include <dash/dart/if/dart_synchronization.h>
+
 #include <cstdint>
 
 #include "Team.h"
@@ -10,11 +12,24 @@
 
 namespace dash {
 
+/**
+ * Implementation variants of \c dash::Mutex.
+ */
+enum class mutex_variant : uint16_t {
+  /// Queue lock handing over the lock with messages.
+  queue      = DART_LOCK_QUEUE,
+  /// Queue lock in which waiting units spin on local memory and contention
+  /// within a node is resolved before contending with other nodes.
+  /// Supports shared ownership, see \c Mutex::lock_shared.
+  local_spin = DART_LOCK_LOCAL_SPIN
+};
+
 /**
  * Behaves similar to \c std::mutex and is used to ensure mutual exclusion
  * within a dash team.
  * 
- * \note This works properly with \c std::lock_guard
+ * \note This works properly with \c std::lock_guard and, for shared
+ *       ownership, with \c std::shared_lock
  * \note Mutex cannot be placed in DASH containers
  * 
  * \code
@@ -41,9 +56,12 @@ public:
    * is used.
    * 
    * This function is not thread-safe
-   * @param team team for mutual exclusive accesses
+   * @param team    team for mutual exclusive accesses
+   * @param variant implementation of the lock
    */
-  explicit Mutex(Team & team = dash::Team::All());
+  explicit Mutex(
+    Team          & team    = dash::Team::All(),
+    mutex_variant   variant = mutex_variant::queue);
   
   Mutex(const Mutex & other)               = delete;
   Mutex(Mutex && other)                    = default;
@@ -72,6 +90,18 @@ public:
    * Release the lock acquired through \c lock() or \c try_lock().
    */
   void unlock();
+
+  /**
+   * Block until the lock was acquired in shared mode, i.e. the lock may be
+   * held by other units in shared mode at the same time.
+   * Mutexes of variant \c mutex_variant::queue are acquired exclusively.
+   */
+  void lock_shared();
+
+  /**
+   * Release the lock acquired through \c lock_shared().
+   */
+  void unlock_shared();
   
 private:
   dart_lock_t   _mutex;
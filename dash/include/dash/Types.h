@@ -248,7 +248,7 @@ struct is_arithmetic
 { };
 
 template <typename T>
-inline dart_storage_t dart_storage(int nvalues) {
+inline dart_storage_t dart_storage(size_t nvalues) {
   dart_storage_t ds;
   ds.dtype = dart_datatype<T>::value;
   ds.nelem = nvalues;
@@ -87,6 +87,7 @@ namespace dash {
  * <tt>index_type</tt>             | A signed integgral type to represent positions in global index space
  * <tt>view_type</tt>              | Proxy type for views on map elements, implements \c DashUnorderedMapConcept
  * <tt>local_type</tt>             | Proxy type for views on map elements that are local to the calling unit
+ * <tt>concurrent_type</tt>        | Proxy type for concurrent insertion and lookup by threads of the calling unit
  *
  * \par Member functions
  *
@@ -109,6 +110,7 @@ namespace dash {
  * <tt>clear</tt>               | <tt>void</tt>       | Clear the map's content
  * <b>Views (DASH specific)</b> | &nbsp;              | &nbsp;
  * <tt>local</tt>               | <tt>local_type</tt> | View on map elements local to calling unit
+ * <tt>concurrent</tt>          | <tt>concurrent_type</tt> | Thread-safe view for insertion and lookup by threads of calling unit
  * \}
  *
  * Usage examples:
@@ -122,18 +124,32 @@ namespace dash {
  * map.insert(std::make_pair(myid, 12.3);
  *
  * map.local.insert(std::make_pair(100 * myid, 12.3);
+ *
+ * // insert values from multiple threads, committed in barrier:
+ * #pragma omp parallel for
+ * for (int i = 0; i < 1000; ++i) {
+ *   map.concurrent.insert(std::make_pair(i, 1.0), dash::plus<double>());
+ * }
+ * map.barrier();
  * \endcode
  */
 
 /**
  * A dynamic map container with support for workload balancing.
  *
+ * Elements are stored at the unit their key is mapped to by the hash
+ * function \c Hash, by default \c dash::HashPartition distributing keys
+ * evenly over all units. Every unit maintains an open-addressing hash
+ * table of its local elements' keys which is published to other units in
+ * \c barrier(), so keys are looked up at their owner unit only.
+ * Use \c dash::HashLocal to store all elements at the unit inserting them.
+ *
  * \concept{DashUnorderedMapConcept}
  */
 template<
   typename Key,
   typename Mapped,
-  typename Hash    = dash::HashLocal<Key>,
+  typename Hash    = dash::HashPartition<Key>,
   typename Pred    = std::equal_to<Key>,
   typename Alloc   = dash::allocator::EpochSynchronizedAllocator<
                        std::pair<const Key, Mapped> > >
@@ -154,6 +170,8 @@ public:
   typedef std::pair<const key_type, mapped_type>                  value_type;
 
   typedef typename dash::container_traits<self_type>::local_type  local_type;
+  typedef UnorderedMapConcurrentRef<Key, Mapped, Hash, Pred, Alloc>
+    concurrent_type;
 
   typedef dash::GlobHeapMem<value_type, allocator_type>     glob_mem_type;
 
@@ -221,6 +239,9 @@ public:
 public:
   /// Local proxy object, allows use in range-based for loops.
   local_type local;
+  /// Proxy object for concurrent insertion and lookup by multiple threads
+  /// of the local unit, see \c dash::UnorderedMapConcurrentRef.
+  concurrent_type concurrent;
 
   //////////////////////////////////////////////////////////////////////////
   // Distributed container
@@ -495,6 +516,11 @@ public:
    * The mapped value can also be accessed directly by using member functions
    * \c at or \c operator[].
    *
+   * Keys are looked up in the hash table of the calling unit and, if not
+   * found, in the hash table of the key's owner unit as of the last call of
+   * \c barrier(), usually in a single remote read.
+   * With \c dash::HashLocal, the hash tables of all units are searched.
+   *
    * \return  iterator to element with specified key if found, otherwise
    *          iterator to the element past the end of the container.
    *
@@ -519,6 +545,27 @@ public:
    */
   const_iterator find(const key_type & key) const;
 
+  /**
+   * Get iterators to the elements with the keys in the given range.
+   * Keys are sent to their owner units in a single all-to-all exchange
+   * instead of looking up every key separately.
+   *
+   * Collective operation. Elements inserted at other units since the last
+   * call of \c barrier() are not found.
+   *
+   * \return  iterators to the elements with the specified keys in the
+   *          order of the keys, iterators to the element past the end of
+   *          the container for keys not found.
+   *
+   * \see  find
+   */
+  template<class InputIterator>
+  std::vector<iterator> find_many(
+    /// Iterator at first key in the range to look up.
+    InputIterator first,
+    /// Iterator past the last key in the range to look up.
+    InputIterator last);
+
   //////////////////////////////////////////////////////////////////////////
   // Modifiers
   //////////////////////////////////////////////////////////////////////////
@@ -537,6 +584,10 @@ public:
    * - References to elements in the map container remain valid in all cases,
    *   even after a rehash.
    *
+   * Elements with keys mapped to a remote unit by the hash function are
+   * stored in local memory and moved to their owner unit in the next call
+   * of \c barrier(). References to these elements are valid until then.
+   *
    * \see     \c operator[]
    *
    * \return  pair, with its member pair::first set to an iterator pointing
@@ -552,17 +603,20 @@ public:
 
   /**
    * Insert elements in iterator range of key-value pairs, increasing the
-   * container size by the number of elements in the range.
+   * container size by the number of elements with new keys in the range.
+   *
+   * Values are buffered in local memory grouped by their owner unit and
+   * inserted in the next call of \c barrier(), in a single all-to-all
+   * exchange for all units. Owner units allocate storage for all received
+   * values at once.
+   * Until then, the values are not contained in the map.
+   * Values with keys that already exist are not inserted.
    *
    * Iterator validity:
    *
-   * - All iterators in the container remain valid after the insertion unless
-   *   it forces a rehash. In this case, all iterators in the container are
-   *   invalidated.
-   * - A rehash is forced if the new container size after the insertion
-   *   operation would increase above its capacity threshold.
-   * - References to elements in the map container remain valid in all cases,
-   *   even after a rehash.
+   * - All iterators in the container are invalidated in the next call of
+   *   \c barrier().
+   * - References to elements in the map container remain valid in all cases.
    */
   template<class InputIterator>
   void insert(
@@ -571,6 +625,58 @@ public:
     // Iterator past the last value in the range to insert.
     InputIterator last);
 
+  /**
+   * Insert elements in iterator range of key-value pairs like
+   * \c insert(first, last), merging the mapped values of values and
+   * elements with equivalent keys using a binary operation like
+   * \c dash::plus, \c dash::min or \c dash::second (replace).
+   *
+   * Values with equivalent keys are merged in local memory first and
+   * merged into existing elements at their owner unit in the next call of
+   * \c barrier(), in the order of the units that inserted them.
+   * As the merge operation is applied at owner units, all units must
+   * specify the same merge operation in their last range insertion before
+   * the next call of \c barrier(), possibly with an empty range.
+   * Otherwise, \c barrier() discards the staged values and throws
+   * \c dash::exception::InvalidArgument at all units.
+   *
+   * \code
+   *   std::vector<std::pair<int, int>> word_counts = ...;
+   *   map.insert(word_counts.begin(), word_counts.end(), dash::plus<int>());
+   *   map.barrier();
+   * \endcode
+   */
+  template<class InputIterator, class MergeOp>
+  void insert(
+    // Iterator at first value in the range to insert.
+    InputIterator first,
+    // Iterator past the last value in the range to insert.
+    InputIterator last,
+    // Binary operation merging mapped values with equivalent keys.
+    MergeOp       merge);
+
+  /**
+   * Insert elements in iterator range of key-value pairs at the units
+   * their keys are mapped to by the hash function.
+   * Values are sent to their owner units in a single all-to-all exchange,
+   * owners allocate storage for all new elements at once.
+   * Elements with keys that already exist are not inserted.
+   *
+   * Collective operation, commits all changes like \c barrier().
+   *
+   * \return  for every value in the range, pair of an iterator to the
+   *          element with the value's key and whether the value has been
+   *          inserted.
+   *
+   * \see     insert
+   */
+  template<class InputIterator>
+  std::vector< std::pair<iterator, bool> > insert_many(
+    /// Iterator at first value in the range to insert.
+    InputIterator first,
+    /// Iterator past the last value in the range to insert.
+    InputIterator last);
+
   /**
    * Removes and destroys single element referenced by given iterator from
    * the container, decreasing the container size by 1.
@@ -41,6 +41,7 @@
  * <tt>dash::difference</tt> | View from difference of two domains
  * <tt>dash::combine</tt>    | Composite view of two possibply unconnected domains
  * <tt>dash::local</tt>      | Local subspace of domain
+ * <tt>dash::node_local</tt> | Subspaces of domain directly accessible at the node
  * <tt>dash::global</tt>     | Maps subspace to elements in global domain
  * <tt>dash::apply</tt>      | Obtain image of domain view (inverse of \c domain)
  * <tt>dash::domain</tt>     | Obtain domain of view image (inverse of \c apply)
@@ -48,6 +49,8 @@
  * <tt>dash::blocks</tt>     | Decompose domain into blocks
  * <tt>dash::block</tt>      | Subspace of decomposed domain in a specific block
  * <tt>dash::index</tt>      | Returns a view's index set
+ * <tt>dash::views::transform</tt> | Lazy element-wise transformation of a view
+ * <tt>dash::views::filter</tt>    | Lazy selection of elements satisfying a predicate
  *
  * \par Examples
  *
@@ -78,6 +81,7 @@
 #include <dash/view/Origin.h>
 #include <dash/view/Global.h>
 #include <dash/view/Local.h>
+#include <dash/view/NodeLocal.h>
 #include <dash/view/Remote.h>
 #include <dash/view/Apply.h>
 #include <dash/view/Sub.h>
@@ -97,6 +101,8 @@
 #include <dash/view/ViewMod.h>
 #include <dash/view/ViewBlocksMod.h>
 
+#include <dash/view/Expression.h>
+
 #include <dash/Range.h>
 
 
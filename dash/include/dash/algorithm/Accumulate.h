@@ -1,11 +1,17 @@
 #ifndef DASH__ALGORITHM__ACCUMULATE_H__
 #define DASH__ALGORITHM__ACCUMULATE_H__
 
-#include <dash/Array.h>
+#include <dash/Future.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/internal/Collective.h>
+
+#include <memory>
+#include <numeric>
+#include <vector>
 
 
 namespace dash {
@@ -14,6 +20,8 @@ namespace dash {
  * Accumulate values in range \c [first, last) as the sum of all values
  * in the range.
  *
+ * Collective operation.
+ *
  * Note: For equivalent of semantics of \c MPI_Accumulate, see
  * \c dash::transform.
  *
@@ -21,6 +29,9 @@ namespace dash {
  *
  *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
  *
+ * \return  The accumulated value, available at all units.
+ *
+ * \see      dash::reduce
  * \see      dash::transform
  *
  * \ingroup  DashAlgorithms
@@ -33,32 +44,14 @@ ValueType accumulate(
   GlobInputIt     in_last,
   ValueType       init)
 {
-  typedef typename GlobInputIt::index_type index_t;
-
-  auto & team      = in_first.team();
-  auto myid        = team.myid();
-  auto index_range = dash::local_range(in_first, in_last);
-  auto l_first     = index_range.begin;
-  auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init);
-  auto result      = 0;
-
-  dash::Array<index_t> l_results(team.size(), team);
-  l_results.local[0] = l_result;
-
-  team.barrier();
-
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result += l_results[i];
-    }
-  }
-  return result;
+  return dash::reduce(in_first, in_last, init, dash::plus<ValueType>());
 }
 
 /**
  * Accumulate values in range \c [first, last) using the given binary
  * reduce function \c op.
+ * Local results are combined in order of unit ids, so \c binary_op is
+ * expected to be associative.
  *
  * Collective operation.
  *
@@ -69,6 +62,9 @@ ValueType accumulate(
  *
  *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
  *
+ * \return  The accumulated value, available at all units.
+ *
+ * \see      dash::reduce
  * \see      dash::transform
  *
  * \ingroup  DashAlgorithms
@@ -81,29 +77,84 @@ ValueType accumulate(
   GlobInputIt     in_first,
   GlobInputIt     in_last,
   ValueType       init,
-  BinaryOperation binary_op = dash::plus<ValueType>())
+  BinaryOperation binary_op)
+{
+  return dash::reduce(in_first, in_last, init, binary_op);
+}
+
+/**
+ * Asynchronous variant of \c dash::accumulate.
+ * Accumulates the local part of the range and starts a non-blocking
+ * exchange of the local results, allowing to overlap the exchange with
+ * local computation.
+ * Local results are combined in order of unit ids, so \c binary_op is
+ * expected to be associative and commutative.
+ *
+ * Collective operation, all units in the range's team must call
+ * \c get() or \c wait() on the returned future.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
+ *
+ * \return  A future of the accumulated value, available at all units.
+ *
+ * \see      dash::accumulate
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+dash::Future<ValueType> accumulate_async(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init,
+  BinaryOperation binary_op = BinaryOperation())
 {
-  typedef typename GlobInputIt::index_type index_t;
+  typedef internal::local_accumulate_t<ValueType>           local_result_t;
+  typedef internal::CollectiveRequest<
+            std::vector<local_result_t> >                   request_t;
 
   auto & team      = in_first.team();
-  auto myid        = team.myid();
   auto index_range = dash::local_range(in_first, in_last);
   auto l_first     = index_range.begin;
   auto l_last      = index_range.end;
-  auto l_result    = std::accumulate(l_first, l_last, init, binary_op);
-  auto result      = 0;
-
-  dash::Array<index_t> l_results(team.size(), team);
-  l_results.local[0] = l_result;
-
-  team.barrier();
-
-  if (myid == 0) {
-    for (int i = 0; i < team.size(); i++) {
-      result = binary_op(result, l_results[i]);
-    }
+  auto request     = std::make_shared<request_t>(
+                       std::vector<local_result_t>(team.size()));
+
+  local_result_t & l_result = request->buffer[team.myid()];
+  l_result.valid = (l_first != l_last);
+  if (l_result.valid) {
+    l_result.value = std::accumulate(
+                       l_first + 1, l_last, ValueType(*l_first), binary_op);
   }
-  return result;
+
+  DASH_ASSERT_RETURNS(
+    dart_iallgather(
+      nullptr,
+      request->buffer.data(),
+      sizeof(local_result_t),
+      DART_TYPE_BYTE,
+      team.dart_id(),
+      &request->handle),
+    DART_OK);
+
+  return dash::Future<ValueType>(
+    [=]() {
+      request->wait();
+      ValueType result = init;
+      for (const auto & l_res : request->buffer) {
+        if (l_res.valid) {
+          result = binary_op(result, l_res.value);
+        }
+      }
+      return result;
+    },
+    [=]() {
+      return request->test();
+    });
 }
 
 } // namespace dash
@@ -9,7 +9,9 @@
 #include <dash/dart/if/dart_communication.h>
 
 #include <algorithm>
+#include <limits>
 #include <vector>
+#include <map>
 #include <memory>
 #include <future>
 
@@ -103,6 +105,280 @@ namespace internal {
 // Global to Local
 // =========================================================================
 
+/**
+ * Number of elements in the run starting at global index \c g_pos that is
+ * contiguous in both the global index domain and the local memory of the
+ * unit owning the element at \c g_pos, at most \c max_elem.
+ */
+template <
+  class    PatternType,
+  typename SizeType >
+SizeType contiguous_run_length(
+  const PatternType                & pattern,
+  typename PatternType::index_type   g_pos,
+  SizeType                           max_elem)
+{
+  typedef typename PatternType::index_type             index_type;
+  typedef std::array<index_type, PatternType::ndim()>  coords_t;
+
+  auto     local_pos = pattern.local(g_pos);
+  // Elements remaining in the local memory of the unit:
+  SizeType nelem     = pattern.local_size(local_pos.unit) - local_pos.index;
+  if (nelem > max_elem) {
+    nelem = max_elem;
+  }
+  if (PatternType::ndim() == 1) {
+    // Local order of elements follows global order in one-dimensional
+    // patterns, so a run is contiguous in both index domains if its last
+    // element maps to the expected global index. Shrink the run to the
+    // longest such prefix, e.g. to the end of the block in a
+    // block-cyclic distribution:
+    auto is_contiguous = [&](SizeType n) {
+      return pattern.global_index(
+               local_pos.unit,
+               coords_t {{ static_cast<index_type>(
+                             local_pos.index + n - 1) }})
+             == static_cast<index_type>(g_pos + n - 1);
+    };
+    if (nelem > 0 && !is_contiguous(nelem)) {
+      SizeType lo = 1;
+      SizeType hi = nelem - 1;
+      while (lo < hi) {
+        SizeType mid = lo + (hi - lo + 1) / 2;
+        if (is_contiguous(mid)) { lo = mid;     }
+        else                    { hi = mid - 1; }
+      }
+      nelem = lo;
+    }
+  }
+  return nelem;
+}
+
+/**
+ * Contiguous runs of global memory copied to local memory in non-blocking
+ * get operations.
+ * All runs located at the same unit are transferred in a single indexed
+ * get operation, or in several if their total number of DART elements
+ * exceeds \c INT_MAX.
+ */
+template <typename ValueType>
+class indexed_get_runs
+{
+private:
+  // Runs located at a single unit transferred in a single operation:
+  struct unit_runs_t {
+    std::vector<dart_gptr_t> gptrs;
+    std::vector<size_t>      nelems;
+    std::vector<size_t>      dest_displs;
+    size_t                   nelem_total = 0;
+  };
+
+public:
+  /**
+   * \param  out_first  Begin of the local destination range, offsets of
+   *                    runs in local memory are relative to it.
+   */
+  explicit indexed_get_runs(ValueType * out_first)
+  : _out_first(out_first)
+  { }
+
+  /**
+   * Adds the run of \c nelem values starting at \c gptr that is copied to
+   * the local range starting at \c out_first + \c out_offset.
+   * The run must be contiguous in the memory of a single unit.
+   */
+  void add(
+    dart_gptr_t  gptr,
+    size_t       nelem,
+    size_t       out_offset)
+  {
+    // MPI uses int for element counts, do not get more than INT_MAX DART
+    // elements in a single operation:
+    size_t max_dart_elem = std::numeric_limits<int>::max();
+    size_t max_run_elem  = max_dart_elem / _dart_elem_size;
+    while (nelem > 0) {
+      size_t num_run_elem      = std::min(nelem, max_run_elem);
+      size_t num_run_dart_elem = num_run_elem * _dart_elem_size;
+      dart_unit_t unit         = gptr.unitid;
+      auto   unit_it           = _unit_runs_idx.find(unit);
+      if (unit_it == _unit_runs_idx.end()) {
+        unit_it = _unit_runs_idx.insert(
+                    std::make_pair(unit, _unit_runs.size())).first;
+        _unit_runs.push_back(unit_runs_t());
+      } else if (_unit_runs[unit_it->second].nelem_total >
+                 max_dart_elem - num_run_dart_elem) {
+        // Runs at unit exceed maximum element count of a single
+        // operation, continue in a separate operation:
+        unit_it->second = _unit_runs.size();
+        _unit_runs.push_back(unit_runs_t());
+      }
+      auto & runs = _unit_runs[unit_it->second];
+      runs.gptrs.push_back(gptr);
+      runs.nelems.push_back(num_run_dart_elem);
+      runs.dest_displs.push_back(out_offset * _dart_elem_size);
+      runs.nelem_total += num_run_dart_elem;
+
+      gptr.addr_or_offs.offset += num_run_elem * sizeof(ValueType);
+      out_offset               += num_run_elem;
+      nelem                    -= num_run_elem;
+    }
+  }
+
+  /**
+   * Issues the get operations of all runs.
+   *
+   * \returns  Global pointers of the source regions that have to be
+   *           flushed to complete the get operations.
+   */
+  std::vector<dart_gptr_t> get() const
+  {
+    std::vector<dart_gptr_t> req_gptrs;
+    dart_datatype_t dtype = dash::dart_storage<ValueType>(1).dtype;
+    for (auto & runs : _unit_runs) {
+      if (runs.gptrs.size() == 1) {
+        // Single contiguous run at unit:
+        DASH_ASSERT_RETURNS(
+          dart_get(
+            _out_first + (runs.dest_displs[0] / _dart_elem_size),
+            runs.gptrs[0],
+            runs.nelems[0],
+            dtype),
+          DART_OK);
+        req_gptrs.push_back(runs.gptrs[0]);
+        continue;
+      }
+      // Displacements of runs relative to the run at the lowest address:
+      dart_gptr_t base_gptr = runs.gptrs[0];
+      for (auto & gptr : runs.gptrs) {
+        if (gptr.addr_or_offs.offset < base_gptr.addr_or_offs.offset) {
+          base_gptr = gptr;
+        }
+      }
+      std::vector<size_t> src_displs;
+      src_displs.reserve(runs.gptrs.size());
+      for (auto & gptr : runs.gptrs) {
+        src_displs.push_back(
+          (gptr.addr_or_offs.offset - base_gptr.addr_or_offs.offset) /
+          sizeof(ValueType) * _dart_elem_size);
+      }
+      DASH_LOG_TRACE("dash::internal::indexed_get_runs.get",
+                     "indexed get of", runs.gptrs.size(), "blocks",
+                     "from unit:", base_gptr.unitid);
+      if (dart_get_indexed(
+            _out_first,
+            base_gptr,
+            runs.gptrs.size(),
+            runs.nelems.data(),
+            src_displs.data(),
+            runs.dest_displs.data(),
+            dtype)
+          != DART_OK) {
+        DASH_LOG_ERROR("dash::internal::indexed_get_runs.get",
+                       "dart_get_indexed failed");
+        DASH_THROW(
+          dash::exception::RuntimeError, "dart_get_indexed failed");
+      }
+      req_gptrs.push_back(base_gptr);
+    }
+    return req_gptrs;
+  }
+
+private:
+  ValueType                   * _out_first;
+  // Number of DART elements representing a single value:
+  size_t                        _dart_elem_size
+                                  = dash::dart_storage<ValueType>(1).nelem;
+  std::vector<unit_runs_t>      _unit_runs;
+  // Unit id to position of its last runs in _unit_runs, preserves order
+  // of first access:
+  std::map<dart_unit_t, size_t> _unit_runs_idx;
+};
+
+/**
+ * Issues non-blocking get operations copying segments of the global range
+ * starting at \c g_in_first to local memory starting at \c out_first.
+ * Segment \c s copies the elements in the global range
+ * \c [g_in_first + in_offsets[s], g_in_first + in_offsets[s] + nelems[s])
+ * to the local range starting at \c out_first + out_offsets[s].
+ * All contiguous runs of the segments located at the same unit are
+ * transferred in a single indexed get operation, see
+ * \c indexed_get_runs.
+ *
+ * \returns  Global pointers of the source regions that have to be flushed
+ *           to complete the get operations.
+ */
+template <
+  typename ValueType,
+  class GlobInputIt,
+  typename SizeType >
+std::vector<dart_gptr_t> get_indexed_by_unit(
+  GlobInputIt                   g_in_first,
+  const std::vector<SizeType> & in_offsets,
+  const std::vector<SizeType> & nelems,
+  const std::vector<SizeType> & out_offsets,
+  ValueType                   * out_first)
+{
+  auto pattern = g_in_first.pattern();
+  typedef decltype(pattern)                        pattern_t;
+  typedef typename pattern_t::index_type           index_type;
+  typedef typename pattern_t::size_type            size_type;
+
+  indexed_get_runs<ValueType> runs(out_first);
+  for (size_t seg = 0; seg < nelems.size(); ++seg) {
+    size_type num_elem_total  = nelems[seg];
+    size_type num_elem_copied = 0;
+    while (num_elem_copied < num_elem_total) {
+      auto cur_in_first    = g_in_first +
+                             (in_offsets[seg] + num_elem_copied);
+      auto g_pos           = static_cast<index_type>(cur_in_first.pos());
+      auto local_pos       = pattern.local(g_pos);
+      auto total_elem_left = num_elem_total - num_elem_copied;
+      size_type num_copy_elem = contiguous_run_length(
+                                  pattern, g_pos, total_elem_left);
+      DASH_ASSERT_GT(num_copy_elem, 0,
+                     "Number of element to copy is 0");
+      DASH_LOG_TRACE("dash::internal::get_indexed_by_unit",
+                     "start g_idx:",    g_pos,
+                     "->",
+                     "unit:",           local_pos.unit,
+                     "l_idx:",          local_pos.index,
+                     "get elements:",   num_copy_elem,
+                     "total:",          num_elem_total,
+                     "copied:",         num_elem_copied);
+      runs.add(cur_in_first.dart_gptr(),
+               num_copy_elem,
+               out_offsets[seg] + num_elem_copied);
+      num_elem_copied += num_copy_elem;
+    }
+  }
+  return runs.get();
+}
+
+/**
+ * Issues non-blocking get operations copying the elements in the global
+ * range \c [g_in_first, g_in_first + num_elem_total) to the local range
+ * starting at \c out_first.
+ *
+ * \returns  Global pointers of the source regions that have to be flushed
+ *           to complete the get operations.
+ */
+template <
+  typename ValueType,
+  class GlobInputIt,
+  typename SizeType >
+std::vector<dart_gptr_t> get_indexed_by_unit(
+  GlobInputIt   g_in_first,
+  SizeType      num_elem_total,
+  ValueType   * out_first)
+{
+  return get_indexed_by_unit(
+           g_in_first,
+           std::vector<SizeType> { 0 },
+           std::vector<SizeType> { num_elem_total },
+           std::vector<SizeType> { 0 },
+           out_first);
+}
+
 /**
  * Blocking implementation of \c dash::copy (global to local) without
  * optimization for local subrange.
@@ -143,104 +419,41 @@ ValueType * copy_impl(
   DASH_LOG_TRACE_VAR("dash::copy_impl", unit_first);
   auto unit_last       = pattern.unit_at(g_in_last.pos() - 1);
   DASH_LOG_TRACE_VAR("dash::copy_impl", unit_last);
+  // Input range is contiguous in the local memory of a single unit, for
+  // example not interleaved with blocks of other units:
+  bool single_unit     = (unit_first == unit_last &&
+                          pattern.local(g_in_last.pos() - 1).index -
+                          pattern.local(g_in_first.pos()).index
+                          == static_cast<index_type>(num_elem_total - 1));
 
-  // MPI uses offset type int, do not copy more than INT_MAX bytes:
-  size_type max_copy_elem   = (std::numeric_limits<int>::max() /
-                               sizeof(ValueType));
   size_type num_elem_copied = 0;
-  DASH_LOG_TRACE_VAR("dash::copy_impl", max_copy_elem);
-  if (num_elem_total > max_copy_elem) {
-    DASH_LOG_DEBUG("dash::copy_impl",
-                   "cannot copy", num_elem_total, "elements",
-                   "in a single dart_get operation");
-  }
-  if (unit_first == unit_last) {
-    // Input range is located at a single remote unit:
+  if (single_unit) {
+    // Input range is located at a single remote unit, transferred in a
+    // single operation as DART splits transfers exceeding the element
+    // count limit of MPI internally:
     DASH_LOG_TRACE("dash::copy_impl", "input range at single unit");
-    while (num_elem_copied < num_elem_total) {
-      // Number of elements left to copy:
-      auto total_elem_left = num_elem_total - num_elem_copied;
-      auto num_copy_elem   = (num_elem_total > max_copy_elem)
-                             ? max_copy_elem
-                             : num_elem_total;
-      if (num_copy_elem > total_elem_left) {
-        num_copy_elem = total_elem_left;
-      }
-      DASH_LOG_TRACE("dash::copy_impl",
-                     "copy max:",       max_copy_elem,
-                     "get elements:",   num_copy_elem,
-                     "total:",          num_elem_total,
-                     "copied:",         num_elem_copied,
-                     "left:",           total_elem_left);
-      auto cur_in_first  = g_in_first + num_elem_copied;
-      auto cur_out_first = out_first  + num_elem_copied;
-      dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
-      DASH_ASSERT_RETURNS(
-        dart_get_blocking(
-          cur_out_first,
-          cur_in_first.dart_gptr(),
-          ds.nelem,
-          ds.dtype),
-        DART_OK);
-      num_elem_copied += num_copy_elem;
-    }
+    dart_storage_t ds = dash::dart_storage<ValueType>(num_elem_total);
+    DASH_ASSERT_RETURNS(
+      dart_get_blocking(
+        out_first,
+        g_in_first.dart_gptr(),
+        ds.nelem,
+        ds.dtype),
+      DART_OK);
+    num_elem_copied = num_elem_total;
   } else {
     // Input range is spread over several remote units:
     DASH_LOG_TRACE("dash::copy_impl", "input range spans multiple units");
     //
-    // Copy elements from every unit:
+    // Copy elements from every unit in a single indexed transfer:
     //
-    while (num_elem_copied < num_elem_total) {
-      // Global iterator pointing at begin of current unit's input range:
-      auto cur_in_first    = g_in_first + num_elem_copied;
-      // unit and local index of first element in current range segment:
-      auto local_pos       = pattern.local(static_cast<index_type>(
-                                             cur_in_first.pos()));
-      // Number of elements located at current source unit:
-      size_type max_elem_per_unit = pattern.local_size(local_pos.unit);
-      // Local offset of first element in input range at current unit:
-      auto l_in_first_idx  = local_pos.index;
-      // Maximum number of elements to copy from current unit:
-      auto num_unit_elem   = max_elem_per_unit - l_in_first_idx;
-      // Number of elements left to copy:
-      auto total_elem_left = num_elem_total - num_elem_copied;
-      // Number of elements to copy in this iteration.
-      auto num_copy_elem   = (num_unit_elem < max_copy_elem)
-                             ? num_unit_elem
-                             : max_copy_elem;
-      if (num_copy_elem > total_elem_left) {
-        num_copy_elem = total_elem_left;
-      }
-      DASH_ASSERT_GT(num_copy_elem, 0,
-                     "Number of element to copy is 0");
-      DASH_LOG_TRACE("dash::copy_impl",
-                     "start g_idx:",    cur_in_first.pos(),
-                     "->",
-                     "unit:",           local_pos.unit,
-                     "l_idx:",          l_in_first_idx,
-                     "->",
-                     "unit elements:",  num_unit_elem,
-                     "max elem/unit:",  max_elem_per_unit,
-                     "copy max:",       max_copy_elem,
-                     "get elements:",   num_copy_elem,
-                     "total:",          num_elem_total,
-                     "copied:",         num_elem_copied,
-                     "left:",           total_elem_left);
-      auto dest_ptr = out_first + num_elem_copied;
-      auto src_gptr = cur_in_first.dart_gptr();
-      dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
-      if (dart_get_blocking(
-            dest_ptr,
-            src_gptr,
-            ds.nelem,
-            ds.dtype)
-          != DART_OK) {
-        DASH_LOG_ERROR("dash::copy_impl", "dart_get failed");
-        DASH_THROW(
-          dash::exception::RuntimeError, "dart_get failed");
-      }
-      num_elem_copied += num_copy_elem;
+    auto req_gptrs = get_indexed_by_unit(g_in_first,
+                                         num_elem_total,
+                                         out_first);
+    for (auto gptr : req_gptrs) {
+      dart_flush_local(gptr);
     }
+    num_elem_copied = num_elem_total;
   }
 
   ValueType * out_last = out_first + num_elem_copied;
@@ -288,6 +501,12 @@ dash::Future<ValueType *> copy_async_impl(
   DASH_LOG_TRACE_VAR("dash::copy_async_impl", unit_first);
   auto unit_last       = pattern.unit_at(g_in_last.pos() - 1);
   DASH_LOG_TRACE_VAR("dash::copy_async_impl", unit_last);
+  // Input range is contiguous in the local memory of a single unit, for
+  // example not interleaved with blocks of other units:
+  bool single_unit     = (unit_first == unit_last &&
+                          pattern.local(g_in_last.pos() - 1).index -
+                          pattern.local(g_in_first.pos()).index
+                          == static_cast<index_type>(num_elem_total - 1));
 
   // Accessed global pointers to be flushed:
 #ifdef DASH__ALGORITHM__COPY__USE_FLUSH
@@ -296,137 +515,54 @@ dash::Future<ValueType *> copy_async_impl(
   std::vector<dart_handle_t> req_handles;
 #endif
 
-  // MPI uses offset type int, do not copy more than INT_MAX bytes:
-  size_type max_copy_elem   = (std::numeric_limits<int>::max() /
-                               sizeof(ValueType));
   size_type num_elem_copied = 0;
-  DASH_LOG_TRACE_VAR("dash::copy_async_impl", max_copy_elem);
-  if (num_elem_total > max_copy_elem) {
-    DASH_LOG_DEBUG("dash::copy_async_impl",
-                   "cannot copy", num_elem_total, "elements",
-                   "in a single dart_get operation");
-  }
-  if (unit_first == unit_last) {
-    // Input range is located at a single remote unit:
+  if (single_unit) {
+    // Input range is located at a single remote unit, transferred in a
+    // single operation as DART splits transfers exceeding the element
+    // count limit of MPI internally:
     DASH_LOG_TRACE("dash::copy_async_impl", "input range at single unit");
-    while (num_elem_copied < num_elem_total) {
-      // Number of elements left to copy:
-      auto total_elem_left = num_elem_total - num_elem_copied;
-      auto num_copy_elem   = (num_elem_total > max_copy_elem)
-                             ? max_copy_elem
-                             : num_elem_total;
-      if (num_copy_elem > total_elem_left) {
-        num_copy_elem = total_elem_left;
-      }
-      DASH_LOG_TRACE("dash::copy_async_impl",
-                     "copy max:",       max_copy_elem,
-                     "get elements:",   num_copy_elem,
-                     "total:",          num_elem_total,
-                     "copied:",         num_elem_copied,
-                     "left:",           total_elem_left);
-      auto cur_in_first  = g_in_first + num_elem_copied;
-      auto cur_out_first = out_first  + num_elem_copied;
+    dart_storage_t ds = dash::dart_storage<ValueType>(num_elem_total);
 #ifdef DASH__ALGORITHM__COPY__USE_FLUSH
-      dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
-      DASH_ASSERT_RETURNS(
-        dart_get(
-          cur_out_first,
-          cur_in_first.dart_gptr(),
-          ds.nelem,
-          ds.dtype),
-        DART_OK);
-      req_handles.push_back(in_first.dart_gptr());
+    DASH_ASSERT_RETURNS(
+      dart_get(
+        out_first,
+        g_in_first.dart_gptr(),
+        ds.nelem,
+        ds.dtype),
+      DART_OK);
+    req_handles.push_back(in_first.dart_gptr());
 #else
-      dart_handle_t  get_handle;
-      dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
-      DASH_ASSERT_RETURNS(
-        dart_get_handle(
-          cur_out_first,
-          cur_in_first.dart_gptr(),
-          ds.nelem,
-          ds.dtype,
-          &get_handle),
-        DART_OK);
-      if (get_handle != NULL) {
-        req_handles.push_back(get_handle);
-      }
-#endif
-      num_elem_copied += num_copy_elem;
+    dart_handle_t  get_handle;
+    DASH_ASSERT_RETURNS(
+      dart_get_handle(
+        out_first,
+        g_in_first.dart_gptr(),
+        ds.nelem,
+        ds.dtype,
+        &get_handle),
+      DART_OK);
+    if (get_handle != NULL) {
+      req_handles.push_back(get_handle);
     }
+#endif
+    num_elem_copied = num_elem_total;
   } else {
     // Input range is spread over several remote units:
     DASH_LOG_TRACE("dash::copy_async_impl", "input range spans multiple units");
     //
-    // Copy elements from every unit:
+    // Copy elements from every unit in a single indexed transfer:
     //
-    while (num_elem_copied < num_elem_total) {
-      // Global iterator pointing at begin of current unit's input range:
-      auto cur_in_first    = g_in_first + num_elem_copied;
-      // unit and local index of first element in current range segment:
-      auto local_pos       = pattern.local(static_cast<index_type>(
-                                             cur_in_first.pos()));
-      // Number of elements located at current source unit:
-      size_type max_elem_per_unit = pattern.local_size(local_pos.unit);
-      // Local offset of first element in input range at current unit:
-      auto l_in_first_idx  = local_pos.index;
-      // Maximum number of elements to copy from current unit:
-      auto num_unit_elem   = max_elem_per_unit - l_in_first_idx;
-      // Number of elements left to copy:
-      auto total_elem_left = num_elem_total - num_elem_copied;
-      // Number of elements to copy in this iteration.
-      auto num_copy_elem   = (num_unit_elem < max_copy_elem)
-                             ? num_unit_elem
-                             : max_copy_elem;
-      if (num_copy_elem > total_elem_left) {
-        num_copy_elem = total_elem_left;
-      }
-      DASH_ASSERT_GT(num_copy_elem, 0,
-                     "Number of element to copy is 0");
-      DASH_LOG_TRACE("dash::copy_async_impl",
-                     "start g_idx:",    cur_in_first.pos(),
-                     "->",
-                     "unit:",           local_pos.unit,
-                     "l_idx:",          l_in_first_idx,
-                     "->",
-                     "unit elements:",  num_unit_elem,
-                     "max elem/unit:",  max_elem_per_unit,
-                     "copy max:",       max_copy_elem,
-                     "get elements:",   num_copy_elem,
-                     "total:",          num_elem_total,
-                     "copied:",         num_elem_copied,
-                     "left:",           total_elem_left);
-      auto src_gptr = cur_in_first.dart_gptr();
-      auto dest_ptr = out_first + num_elem_copied;
+    auto req_gptrs = get_indexed_by_unit(g_in_first,
+                                         num_elem_total,
+                                         out_first);
 #ifdef DASH__ALGORITHM__COPY__USE_FLUSH
-      dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
-      if (dart_get(
-            dest_ptr,
-            src_gptr,
-            ds.nelem,
-            ds.dtype)
-          != DART_OK) {
-        DASH_LOG_ERROR("dash::copy_async_impl", "dart_get failed");
-        DASH_THROW(
-          dash::exception::RuntimeError, "dart_get failed");
-      }
-      req_handles.push_back(src_gptr);
+    req_handles.insert(req_handles.end(), req_gptrs.begin(), req_gptrs.end());
 #else
-      dart_handle_t  get_handle;
-      dart_storage_t ds = dash::dart_storage<ValueType>(num_copy_elem);
-      DASH_ASSERT_RETURNS(
-        dart_get_handle(
-          dest_ptr,
-          src_gptr,
-          ds.nelem,
-          ds.dtype,
-          &get_handle),
-        DART_OK);
-      if (get_handle != NULL) {
-        req_handles.push_back(get_handle);
-      }
-#endif
-      num_elem_copied += num_copy_elem;
+    for (auto gptr : req_gptrs) {
+      dart_flush_local(gptr);
     }
+#endif
+    num_elem_copied = num_elem_total;
   }
 #ifdef DASH_ENABLE_TRACE_LOGGING
   for (auto gptr : req_handles) {
@@ -610,6 +746,221 @@ dash::Future<GlobOutputIt> copy_async_impl(
   return result;
 }
 
+// =========================================================================
+// Global to Global
+// =========================================================================
+
+/**
+ * Issues non-blocking get operations copying the elements of the global
+ * input range \c [in_first, in_first + num_elem_total) to the elements of
+ * the global output range starting at \c out_first that are located in
+ * the calling unit's local memory, for ranges in one-dimensional patterns
+ * without view projection.
+ * Local output elements are split into runs that are contiguous in global
+ * index space, the runs overlapping with the local memory of every unit
+ * in the input range are transferred in a single indexed get operation.
+ *
+ * \returns  Global pointers of the source regions that have to be flushed
+ *           to complete the get operations.
+ */
+template <
+  class    GlobInputIt,
+  class    GlobOutputIt,
+  typename SizeType >
+std::vector<dart_gptr_t> get_local_output_range(
+  GlobInputIt   in_first,
+  SizeType      num_elem_total,
+  GlobOutputIt  out_first,
+  std::true_type /* contiguous global index space */)
+{
+  const auto & pattern = out_first.pattern();
+  // Output elements in local memory, contiguous in local index space:
+  auto l_out_range     = dash::local_index_range(
+                           out_first, out_first + num_elem_total);
+  DASH_LOG_TRACE("dash::internal::get_local_output_range",
+                 "l_out_begin:", l_out_range.begin,
+                 "l_out_end:",   l_out_range.end);
+  std::vector<SizeType> in_offsets;
+  std::vector<SizeType> nelems;
+  std::vector<SizeType> out_offsets;
+  for (auto l_idx = l_out_range.begin; l_idx < l_out_range.end; ) {
+    auto     g_idx = pattern.global(l_idx);
+    SizeType nrun  = contiguous_run_length(
+                       pattern, g_idx,
+                       static_cast<SizeType>(l_out_range.end - l_idx));
+    in_offsets.push_back(g_idx - out_first.pos());
+    nelems.push_back(nrun);
+    out_offsets.push_back(l_idx);
+    l_idx += nrun;
+  }
+  if (nelems.empty()) {
+    return std::vector<dart_gptr_t>();
+  }
+  return get_indexed_by_unit(in_first,
+                             in_offsets,
+                             nelems,
+                             out_offsets,
+                             out_first.globmem().lbegin());
+}
+
+/**
+ * Offset of the element at global index \c g_idx in the global range
+ * starting at \c first.
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    GlobMemType,
+  class    PointerType,
+  class    ReferenceType >
+typename PatternType::index_type global_range_offset(
+  const GlobIter<
+          ElementType, PatternType, GlobMemType,
+          PointerType, ReferenceType >   & first,
+  typename PatternType::index_type         g_idx)
+{
+  return g_idx - first.pos();
+}
+
+/**
+ * Offset of the element at global index \c g_idx in the global range
+ * starting at \c first, or a negative offset if the element is not
+ * contained in the view of \c first.
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    GlobMemType,
+  class    PointerType,
+  class    ReferenceType >
+typename PatternType::index_type global_range_offset(
+  const GlobViewIter<
+          ElementType, PatternType, GlobMemType,
+          PointerType, ReferenceType >   & first,
+  typename PatternType::index_type         g_idx)
+{
+  typedef typename PatternType::index_type index_type;
+  if (!first.is_relative()) {
+    return g_idx - first.rpos();
+  }
+  // Project global coordinates to view index space:
+  auto viewspec = first.viewspec();
+  auto coords   = first.pattern().coords(g_idx);
+  for (dim_t d = 0; d < PatternType::ndim(); ++d) {
+    coords[d] -= viewspec.offset(d);
+    if (coords[d] < 0 ||
+        coords[d] >= static_cast<index_type>(viewspec.extent(d))) {
+      return -1;
+    }
+  }
+  CartesianIndexSpace<
+    PatternType::ndim(), PatternType::memory_order(), index_type>
+    view_index_space(viewspec.extents());
+  return view_index_space.at(coords) - first.rpos();
+}
+
+/**
+ * Issues non-blocking get operations copying the elements of the global
+ * input range \c [in_first, in_first + num_elem_total) to the elements of
+ * the global output range starting at \c out_first that are located in
+ * the calling unit's local memory, for ranges in multi-dimensional
+ * patterns or view projections.
+ * Resolves the positions of the calling unit's local elements in the
+ * output range, elements that are contiguous in both the input range and
+ * local memory are transferred in a single run, see \c indexed_get_runs.
+ *
+ * \returns  Global pointers of the source regions that have to be flushed
+ *           to complete the get operations.
+ */
+template <
+  class    GlobInputIt,
+  class    GlobOutputIt,
+  typename SizeType >
+std::vector<dart_gptr_t> get_local_output_range(
+  GlobInputIt   in_first,
+  SizeType      num_elem_total,
+  GlobOutputIt  out_first,
+  std::false_type /* contiguous global index space */)
+{
+  typedef typename GlobOutputIt::value_type   value_type;
+  typedef typename GlobOutputIt::pattern_type pattern_t;
+  typedef typename pattern_t::index_type      index_type;
+
+  const auto & pattern  = out_first.pattern();
+  index_type   l_size   = pattern.local_size();
+  index_type   num_elem = num_elem_total;
+
+  indexed_get_runs<value_type> runs(out_first.globmem().lbegin());
+  // Current run of elements contiguous in local memory and in the input
+  // range:
+  dart_gptr_t run_gptr    = DART_GPTR_NULL;
+  index_type  run_nelem   = 0;
+  index_type  run_l_first = 0;
+  for (index_type l_idx = 0; l_idx < l_size; ++l_idx) {
+    auto offset = global_range_offset(out_first, pattern.global(l_idx));
+    if (offset < 0 || offset >= num_elem) {
+      // Local element not in output range:
+      continue;
+    }
+    dart_gptr_t src = (in_first + offset).dart_gptr();
+    if (run_nelem > 0                          &&
+        run_l_first + run_nelem == l_idx       &&
+        run_gptr.unitid         == src.unitid  &&
+        run_gptr.segid          == src.segid   &&
+        run_gptr.teamid         == src.teamid  &&
+        run_gptr.addr_or_offs.offset + run_nelem * sizeof(value_type)
+                                == src.addr_or_offs.offset) {
+      // Element extends the current run:
+      ++run_nelem;
+      continue;
+    }
+    if (run_nelem > 0) {
+      runs.add(run_gptr, run_nelem, run_l_first);
+    }
+    run_gptr    = src;
+    run_nelem   = 1;
+    run_l_first = l_idx;
+  }
+  if (run_nelem > 0) {
+    runs.add(run_gptr, run_nelem, run_l_first);
+  }
+  return runs.get();
+}
+
+/**
+ * Issues non-blocking get operations copying the elements of the global
+ * input range \c [in_first, in_first + num_elem_total) to the elements of
+ * the global output range starting at \c out_first that are located in
+ * the calling unit's local memory.
+ *
+ * \returns  Global pointers of the source regions that have to be flushed
+ *           to complete the get operations.
+ */
+template <
+  class    GlobInputIt,
+  class    GlobOutputIt,
+  typename SizeType >
+std::vector<dart_gptr_t> get_local_output_range(
+  GlobInputIt   in_first,
+  SizeType      num_elem_total,
+  GlobOutputIt  out_first)
+{
+  typedef typename GlobInputIt::pattern_type           in_pattern_t;
+  typedef typename GlobOutputIt::pattern_type          out_pattern_t;
+  typedef decltype(in_first.global())                  g_in_iter_t;
+  typedef decltype(out_first.global())                 g_out_iter_t;
+  // Positions in ranges of one-dimensional patterns without view
+  // projection correspond to global indices:
+  typedef std::integral_constant<bool,
+            in_pattern_t::ndim()  == 1 &&
+            out_pattern_t::ndim() == 1 &&
+            std::is_same<GlobInputIt,  g_in_iter_t>::value &&
+            std::is_same<GlobOutputIt, g_out_iter_t>::value >
+    is_contiguous_t;
+  return get_local_output_range(
+           in_first, num_elem_total, out_first, is_contiguous_t());
+}
+
 } // namespace internal
 
 
@@ -692,6 +1043,15 @@ dash::Future<ValueType *> copy_async(
                  "in_first.is_local:", in_first.is_local());
   // Futures of asynchronous get requests:
   auto futures = std::vector< dash::Future<ValueType *> >();
+  // The local subrange is copied separately only if it is contiguous in
+  // global index space. Otherwise, e.g. in a block-cyclic distribution,
+  // local elements are copied like remote elements:
+  if (num_local_elem > 0 &&
+      (in_first.pattern().global(li_range_in.end - 1) -
+       in_first.pattern().global(li_range_in.begin) + 1) != num_local_elem) {
+    DASH_LOG_TRACE("dash::copy_async", "local subrange is not contiguous");
+    num_local_elem = 0;
+  }
   // Check if global input range is partially local:
   if (num_local_elem > 0) {
     // Part of the input range is local, copy local input subrange to local
@@ -895,6 +1255,15 @@ ValueType * copy(
                  li_range_in.begin,
                  li_range_in.end,
                  "in_first.is_local:", in_first.is_local());
+  // The local subrange is copied separately only if it is contiguous in
+  // global index space. Otherwise, e.g. in a block-cyclic distribution,
+  // local elements are copied like remote elements:
+  if (num_local_elem > 0 &&
+      (in_first.pattern().global(li_range_in.end - 1) -
+       in_first.pattern().global(li_range_in.begin) + 1) != num_local_elem) {
+    DASH_LOG_TRACE("dash::copy", "local subrange is not contiguous");
+    num_local_elem = 0;
+  }
   // Check if global input range is partially local:
   if (num_local_elem > 0) {
     // Part of the input range is local, copy local input subrange to local
@@ -1179,28 +1548,87 @@ copy_async(
 }
 #endif
 
+// =========================================================================
+// Global to Global, Distributed Range
+// =========================================================================
+
+/**
+ * Variant of \c dash::copy as asynchronous global-to-global copy
+ * operation.
+ *
+ * Being a collective operation, every unit copies the elements of the
+ * output range located in its local memory, the returned future only
+ * waits for completion of these local elements.
+ * Input and output ranges may have different patterns.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt >
+typename std::enable_if<
+  !std::is_pointer<GlobInputIt>::value &&
+  !std::is_pointer<GlobOutputIt>::value,
+  dash::Future<GlobOutputIt> >::type
+copy_async(
+  GlobInputIt   in_first,
+  GlobInputIt   in_last,
+  GlobOutputIt  out_first)
+{
+  DASH_LOG_TRACE("dash::copy_async()", "global to global");
+  auto num_elem_total = dash::distance(in_first, in_last);
+  auto out_last       = out_first + num_elem_total;
+  if (num_elem_total <= 0) {
+    return dash::Future<GlobOutputIt>([=]() { return out_last; });
+  }
+  auto req_gptrs = dash::internal::get_local_output_range(
+                     in_first, num_elem_total, out_first);
+  return dash::Future<GlobOutputIt>([=]() {
+    for (auto gptr : req_gptrs) {
+      dart_flush_local_all(gptr);
+    }
+    return out_last;
+  });
+}
+
 /**
  * Specialization of \c dash::copy as global-to-global blocking copy
  * operation.
  *
+ * Being a collective operation, every unit copies the elements of the
+ * output range located in its local memory from the input range.
+ * Input and output ranges may have different patterns, e.g. to
+ * redistribute elements between arrays. The overlap of the local output
+ * elements with the local memory of every unit in the input range is
+ * transferred in a single operation.
+ * Units must synchronize before accessing output elements located at
+ * other units.
+ *
  * \ingroup  DashAlgorithms
  */
 template <
-  typename ValueType,
   class GlobInputIt,
   class GlobOutputIt >
-GlobOutputIt copy(
+typename std::enable_if<
+  !std::is_pointer<GlobInputIt>::value &&
+  !std::is_pointer<GlobOutputIt>::value,
+  GlobOutputIt >::type
+copy(
   GlobInputIt   in_first,
   GlobInputIt   in_last,
   GlobOutputIt  out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
-
-  // TODO:
-  // - Implement adapter for local-to-global dash::copy here
-  // - Return if global input range has no local sub-range
-
-  return GlobOutputIt();
+  auto num_elem_total = dash::distance(in_first, in_last);
+  if (num_elem_total <= 0) {
+    return out_first;
+  }
+  auto req_gptrs = dash::internal::get_local_output_range(
+                     in_first, num_elem_total, out_first);
+  for (auto gptr : req_gptrs) {
+    dart_flush_local(gptr);
+  }
+  return out_first + num_elem_total;
 }
 
 #endif // DOXYGEN
@@ -0,0 +1,111 @@
+#ifndef DASH__ALGORITHM__COUNT_H__
+#define DASH__ALGORITHM__COUNT_H__
+
+#include <dash/LaunchPolicy.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+
+#include <type_traits>
+
+
+namespace dash {
+
+/**
+ * Counts the elements in the range \c [first, last) that satisfy the
+ * predicate \c p.
+ * The local elements are processed according to the given execution
+ * policy, the local counts are combined in a single all-reduce.
+ *
+ * Collective operation.
+ *
+ * \return  The number of elements satisfying the predicate, available at
+ *          all units.
+ *
+ * \see     dash::transform_reduce
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  typename PatternType::index_type >::type
+count_if(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                             p)
+{
+  typedef typename PatternType::index_type index_t;
+  return dash::transform_reduce(
+           policy, first, last, index_t(0), dash::plus<index_t>(),
+           [&p](const ElementType & value) -> index_t {
+             return p(value) ? 1 : 0;
+           });
+}
+
+/**
+ * Counts the elements in the range \c [first, last) that satisfy the
+ * predicate \c p.
+ *
+ * Collective operation.
+ *
+ * \return  The number of elements satisfying the predicate, available at
+ *          all units.
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+typename PatternType::index_type count_if(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate                             p)
+{
+  return dash::count_if(dash::execution::seq, first, last, p);
+}
+
+/**
+ * Counts the elements in the range \c [first, last) that compare equal
+ * to \c value.
+ *
+ * Collective operation.
+ *
+ * \return  The number of elements equal to \c value, available at all
+ *          units.
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType >
+typename PatternType::index_type count(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Value to compare the elements to
+  const ElementType                        & value)
+{
+  return dash::count_if(
+           dash::execution::par, first, last,
+           [&value](const ElementType & v) { return v == value; });
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__COUNT_H__
@@ -1,97 +1,89 @@
 #ifndef DASH__ALGORITHM__EQUAL_H__
 #define DASH__ALGORITHM__EQUAL_H__
 
-#include <dash/Array.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
-#include <dash/dart/if/dart_communication.h>
+#include <dash/algorithm/Reduce.h>
+
+#include <functional>
+
 
 namespace dash {
 
 /**
  * Returns true if the range \c [first1, last1) is equal to the range
- * \c [first2, first2 + (last1 - first1)), and false otherwise.
+ * \c [first2, first2 + (last1 - first1)) with respect to a specified
+ * predicate, and false otherwise.
+ *
+ * Every unit compares the elements of the first range stored in its local
+ * memory to the corresponding elements of the second range. The local
+ * results are combined in a single all-reduce without further
+ * synchronization.
+ *
+ * Collective operation.
+ *
+ * \return  Whether the ranges are equal, available at all units.
  *
  * \ingroup     DashAlgorithms
  */
 template <
   typename ElementType,
-  class    PatternType >
+  class    PatternType,
+  class    BinaryPredicate >
 bool equal(
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first_1,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last_1,
-  GlobIter<ElementType, PatternType>   first_2)
+  GlobIter<ElementType, PatternType>   first_2,
+  BinaryPredicate                      pred)
 {
-  auto & team        = first_1.team();
-  auto myid          = team.myid();
-  // Global iterators to local range:
-  auto index_range   = dash::local_range(first_1, last_1);
-  auto l_first_1     = index_range.begin;
-  auto l_last_1      = index_range.end;
-  auto l_result      = std::equal(l_first_1, l_last_1, first_2);
-
-  dash::Array<bool> l_results(team.size(), team);
-
-  l_results.local[0] = l_result;
-  bool return_result = true;
-
-  // wait for all units to contribute their data
-  team.barrier();
-
-  // All local offsets stored in l_results
-  if (myid == 0) {
-    for (int u = 0; u < team.size(); u++) {
-      return_result &= l_results.local[u];
+  auto & team         = first_1.team();
+  auto & pattern      = first_1.pattern();
+  // Local index range of the first sequence:
+  auto index_range    = dash::local_index_range(first_1, last_1);
+  auto lbegin_index   = index_range.begin;
+  auto lend_index     = index_range.end;
+  int  l_result       = 1;
+  if (lbegin_index != lend_index) {
+    auto l_first_1 = (first_1 + (pattern.global(lbegin_index) -
+                                 first_1.pos())).local();
+    for (auto lidx = lbegin_index; lidx < lend_index; ++lidx) {
+      // Corresponding element of the second sequence:
+      auto        g_offset = pattern.global(lidx) - first_1.pos();
+      ElementType value_2  = *(first_2 + g_offset);
+      if (!pred(l_first_1[lidx - lbegin_index], value_2)) {
+        l_result = 0;
+        break;
+      }
     }
   }
-  return return_result;
+  return dash::allreduce(l_result, dash::min<int>(), team) != 0;
 }
 
 /**
  * Returns true if the range \c [first1, last1) is equal to the range
- * \c [first2, first2 + (last1 - first1)) with respect to a specified
- * predicate, and false otherwise.
+ * \c [first2, first2 + (last1 - first1)), and false otherwise.
+ *
+ * Collective operation.
+ *
+ * \return  Whether the ranges are equal, available at all units.
  *
  * \ingroup     DashAlgorithms
  */
 template <
   typename ElementType,
-  class    PatternType,
-  class    BinaryPredicate >
+  class    PatternType >
 bool equal(
   /// Iterator to the initial position in the sequence
   GlobIter<ElementType, PatternType>   first_1,
   /// Iterator to the final position in the sequence
   GlobIter<ElementType, PatternType>   last_1,
-  GlobIter<ElementType, PatternType>   first_2,
-  BinaryPredicate                      pred)
+  GlobIter<ElementType, PatternType>   first_2)
 {
-  auto & team        = first_1.team();
-  auto myid          = team.myid();
-  // Global iterators to local range:
-  auto index_range   = dash::local_range(first_1, last_1);
-  auto l_first_1     = index_range.begin;
-  auto l_last_1      = index_range.end;
-  auto l_result      = std::equal(l_first_1, l_last_1, first_2, pred);
-
-  dash::Array<bool> l_results(team.size(), team);
-
-  l_results.local[0] = l_result;
-
-  bool return_result = true;
-
-  team.barrier();
-
-  // All local offsets stored in l_results
-  if (myid == 0) {
-    for (int u = 0; u < team.size(); u++) {
-      return_result &= l_results.local[u];
-    }
-  }
-  return return_result;
+  return dash::equal(first_1, last_1, first_2,
+                     std::equal_to<ElementType>());
 }
 
 } // namespace dash
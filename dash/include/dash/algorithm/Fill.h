@@ -1,20 +1,18 @@
 #ifndef DASH__ALGORITHM__FILL_H__
 #define DASH__ALGORITHM__FILL_H__
 
-#include <dash/internal/Config.h>
+#include <dash/LaunchPolicy.h>
 
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
-
-#include <dash/util/UnitLocality.h>
+#include <dash/algorithm/Sync.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 #include <dash/dart/if/dart_communication.h>
 
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <type_traits>
 
 
 namespace dash {
@@ -24,15 +22,25 @@ namespace dash {
  *
  * Being a collaborative operation, each unit will assign the value to
  * its local elements only.
+ * The local elements are processed according to the given execution
+ * policy.
  *
- * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      ExecutionPolicy  Execution policy of the local portion,
+ *                               \see dash::execution
  * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
  *              pattern and \c nl local elements within the global range
  *
  * \ingroup     DashAlgorithms
  */
-template <typename GlobIterType>
-void fill(
+template <
+  class ExecutionPolicy,
+  class GlobIterType >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value >::type
+fill(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy  && policy,
   /// Iterator to the initial position in the sequence
   GlobIterType        first,
   /// Iterator to the final position in the sequence
@@ -40,7 +48,6 @@ void fill(
   /// Value which will be assigned to the elements in range [first, last)
   const typename GlobIterType::value_type & value)
 {
-  typedef typename GlobIterType::index_type index_t;
   typedef typename GlobIterType::value_type value_t;
 
   // Global iterators to local range:
@@ -49,33 +56,89 @@ void fill(
   value_t * llast       = index_range.end;
   auto      nlocal      = llast - lfirst;
 
-#if 0
-  for (index_t lt = 0; lt < nlocal; lt++) {
-    lfirst[lt] = value;
-  }
-#else
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::fill", "thread capacity:",  n_threads);
-  #pragma omp parallel num_threads(n_threads)
-  for (index_t lt = 0; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
+  DASH_LOG_DEBUG("dash::fill", "local elements:", nlocal);
+  dash::internal::parallel_for(
+    policy, nlocal,
+    [lfirst, &value](decltype(nlocal) lt) {
+      lfirst[lt] = value;
+    });
+}
+
+/**
+ * Assigns the given value to the elements in the range [first, last)
+ *
+ * Being a collaborative operation, each unit will assign the value to
+ * its local elements only, using multiple threads if available.
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIterType>
+void fill(
+  /// Iterator to the initial position in the sequence
+  GlobIterType        first,
+  /// Iterator to the final position in the sequence
+  GlobIterType        last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const typename GlobIterType::value_type & value)
+{
+  dash::fill(dash::execution::par_unseq, first, last, value);
+}
+
+/**
+ * Assigns the given value to the elements in the range [first, last)
+ * and returns a token of the pending synchronization of the iterators'
+ * team.
+ * Assigned values are guaranteed to be visible to all units after the
+ * token has been synchronized, allowing to fuse the synchronization with
+ * that of subsequent algorithms.
+ *
+ * \see         dash::sync
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobIterType >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  dash::SyncToken >::type
+fill_nosync(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy  && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIterType        first,
+  /// Iterator to the final position in the sequence
+  GlobIterType        last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const typename GlobIterType::value_type & value)
+{
+  dash::fill(policy, first, last, value);
+  return dash::SyncToken(first.team());
+}
 
-  #pragma omp parallel num_threads(n_threads)
-  for (index_t lt = 1; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-#else
-  for (index_t lt = 0; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-  for (index_t lt = 1; lt < nlocal; lt += 2) {
-    lfirst[lt] = value;
-  }
-#endif
-#endif
+/**
+ * Assigns the given value to the elements in the range [first, last)
+ * and returns a token of the pending synchronization of the iterators'
+ * team.
+ *
+ * \see         dash::sync
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIterType>
+dash::SyncToken fill_nosync(
+  /// Iterator to the initial position in the sequence
+  GlobIterType        first,
+  /// Iterator to the final position in the sequence
+  GlobIterType        last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const typename GlobIterType::value_type & value)
+{
+  return dash::fill_nosync(dash::execution::par_unseq, first, last, value);
 }
 
 } // namespace dash
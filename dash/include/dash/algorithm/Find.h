@@ -2,49 +2,46 @@
 #define DASH__ALGORITHM__FIND_H__
 
 #include <dash/Array.h>
+#include <dash/Future.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/Collective.h>
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
 namespace dash {
 
+namespace internal {
+
 /**
- * Returns an iterator to the first element in the range \c [first,last) that
- * compares equal to \c val.
- * If no such element is found, the function returns \c last.
- *
- * \ingroup     DashAlgorithms
+ * Offset in the range \c [first,last) of the first element in its local
+ * part that compares equal to \c value, or the maximum value of the
+ * pattern's index type if no such element is found.
  */
 template<
   typename ElementType,
   class    PatternType>
-GlobIter<ElementType, PatternType> find(
-  /// Iterator to the initial position in the sequence
-  GlobIter<ElementType, PatternType>   first,
-  /// Iterator to the final position in the sequence
-  GlobIter<ElementType, PatternType>   last,
-  /// Value which will be assigned to the elements in range [first, last)
-  const ElementType                  & value)
+typename PatternType::index_type local_find_index(
+  const GlobIter<ElementType, PatternType> & first,
+  const GlobIter<ElementType, PatternType> & last,
+  const ElementType                        & value)
 {
   using p_index_t = typename PatternType::index_type;
 
-  if(first >= last) {
-    return last;
-  }
-
   p_index_t g_index;
   auto & pattern     = first.pattern();
-  auto & team        = pattern.team();
   auto index_range   = dash::local_index_range(first, last);
   auto l_begin_index = index_range.begin;
   auto l_end_index   = index_range.end;
-  auto first_offset  = first.pos();
   if(l_begin_index == l_end_index){
     g_index = std::numeric_limits<p_index_t>::max();
   } else {
-   auto g_begin_index = pattern.global(l_begin_index);
-
     // Pointer to first element in local memory:
     const ElementType * lbegin        = first.globmem().lbegin();
     // Pointers to first / final element in local range:
@@ -59,30 +56,301 @@ GlobIter<ElementType, PatternType> find(
       g_index = std::numeric_limits<p_index_t>::max();
     } else {
       auto l_hit_index = l_result - lbegin;
-      g_index = pattern.global(l_hit_index);
+      g_index = pattern.global(l_hit_index) - first.gpos();
     }
   }
+  return g_index;
+}
+
+/**
+ * Number of local elements searched by \c dash::find_if between polls of
+ * the index of the first match found by any unit.
+ */
+constexpr std::size_t find_poll_interval = 4096;
+
+/**
+ * Global words of a team at unit 0 in which units publish the offset of
+ * the first match found by \c dash::find_if.
+ * Consecutive searches alternate between the two words: a word is reset
+ * by unit 0 after the final reduction of the search that used it, which
+ * precedes the next search using the word at all units.
+ */
+struct find_hit_words_t {
+  dart_gptr_t gptr     = DART_GPTR_NULL;
+  std::size_t nsearch  = 0;
+};
+
+/**
+ * Hit words of the given team for index type \c IndexType, allocated in
+ * the first search of the team and freed with the team's other
+ * team-allocated objects.
+ *
+ * Collective operation in the first call for a team.
+ */
+template <typename IndexType>
+find_hit_words_t & find_hit_words(dash::Team & team)
+{
+  static std::map<dart_team_t, find_hit_words_t> team_words;
+
+  dart_team_t team_id = team.dart_id();
+  auto        words   = team_words.find(team_id);
+  if (words != team_words.end()) {
+    return words->second;
+  }
+  const IndexType   not_found[2] = {
+                      std::numeric_limits<IndexType>::max(),
+                      std::numeric_limits<IndexType>::max() };
+  dart_datatype_t   dtype        = dash::dart_datatype<IndexType>::value;
+  find_hit_words_t & hit_words   = team_words[team_id];
+  DASH_ASSERT_RETURNS(
+    dart_team_memalloc_aligned(team_id, 2, dtype, &hit_words.gptr),
+    DART_OK);
+  if (team.myid() == 0) {
+    DASH_ASSERT_RETURNS(
+      dart_put_blocking(hit_words.gptr, not_found, 2, dtype),
+      DART_OK);
+  }
   team.barrier();
+  team.register_deallocator(
+    &hit_words,
+    [team_id]() {
+      auto words = team_words.find(team_id);
+      DASH_ASSERT_RETURNS(
+        dart_team_memfree(words->second.gptr),
+        DART_OK);
+      team_words.erase(words);
+    });
+  return hit_words;
+}
+
+/**
+ * Offset of the first element in the range \c [first,last) that
+ * satisfies the predicate, or the maximum value of the pattern's index
+ * type if no such element is found.
+ *
+ * In one-dimensional ranges with more than \c find_poll_interval
+ * elements per unit, units publish their first match using an atomic
+ * minimum on a global offset and poll it while searching their next
+ * \c find_poll_interval local elements. A unit stops its local search
+ * once a match preceding its remaining local elements has been found.
+ *
+ * Collective operation.
+ */
+template<
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+typename PatternType::index_type find_if_offset(
+  const GlobIter<ElementType, PatternType> & first,
+  const GlobIter<ElementType, PatternType> & last,
+  UnaryPredicate                             predicate)
+{
+  typedef typename PatternType::index_type index_t;
+
+  const index_t   not_found   = std::numeric_limits<index_t>::max();
+  dart_datatype_t dtype       = dash::dart_datatype<index_t>::value;
+  auto          & pattern     = first.pattern();
+  auto          & team        = pattern.team();
+  auto            index_range = dash::local_index_range(first, last);
+  // Local elements of one-dimensional patterns are stored in order of
+  // their global index:
+  bool            early_exit  = PatternType::ndim() == 1 &&
+                                static_cast<std::size_t>(last - first) >
+                                team.size() * find_poll_interval;
+  // Pointer to first element in local memory:
+  const ElementType * lbegin  = first.globmem().lbegin();
+
+  // Offset of the first match found by any unit, stored at unit 0:
+  dart_gptr_t g_hit = DART_GPTR_NULL;
+  index_t     g_hit_offset = not_found;
+  if (early_exit) {
+    auto & hit_words = find_hit_words<index_t>(team);
+    g_hit = hit_words.gptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_incaddr(
+        &g_hit, (hit_words.nsearch++ % 2) * sizeof(index_t)),
+      DART_OK);
+  }
+  // Pending poll of the offset of the first match:
+  index_t       g_hit_poll  = not_found;
+  dart_handle_t poll_handle = nullptr;
 
-  // receive buffer for global maximal index
-  p_index_t g_hit_idx;
+  index_t l_hit_offset = not_found;
+  index_t l_chunk_size = early_exit
+                         ? static_cast<index_t>(find_poll_interval)
+                         : index_range.end - index_range.begin;
+  for (index_t l_chunk = index_range.begin; l_chunk < index_range.end;
+       l_chunk += l_chunk_size) {
+    index_t l_chunk_end = std::min<index_t>(
+                            l_chunk + l_chunk_size, index_range.end);
+    if (early_exit) {
+      // Poll completed while searching the previous chunk:
+      int32_t polled = 1;
+      if (poll_handle != nullptr) {
+        DASH_ASSERT_RETURNS(
+          dart_test(poll_handle, &polled),
+          DART_OK);
+      }
+      if (polled) {
+        // Handle has been released in dart_test:
+        poll_handle  = nullptr;
+        g_hit_offset = g_hit_poll;
+        if (g_hit_offset < pattern.global(l_chunk) - first.gpos()) {
+          DASH_LOG_DEBUG("dash::find_if", "match found by other unit:",
+                         g_hit_offset);
+          break;
+        }
+        DASH_ASSERT_RETURNS(
+          dart_get_handle(&g_hit_poll, g_hit, 1, dtype, &poll_handle),
+          DART_OK);
+      }
+    }
+    auto l_hit = std::find_if(lbegin + l_chunk, lbegin + l_chunk_end,
+                              predicate);
+    if (l_hit != lbegin + l_chunk_end) {
+      l_hit_offset = pattern.global(l_hit - lbegin) - first.gpos();
+      if (early_exit) {
+        DASH_ASSERT_RETURNS(
+          dart_fetch_and_op(
+            g_hit, &l_hit_offset, &g_hit_offset, dtype, DART_OP_MIN),
+          DART_OK);
+      }
+      break;
+    }
+  }
+  if (poll_handle != nullptr) {
+    DASH_ASSERT_RETURNS(
+      dart_wait(poll_handle),
+      DART_OK);
+  }
 
+  // Units only skip local elements following a match, the minimum of
+  // local matches is the first match in the range:
   DASH_ASSERT_RETURNS(
-      dart_allreduce(
-        &g_index,
-        &g_hit_idx,
-        1,
-        dart_datatype<p_index_t>::value,
-        DART_OP_MIN,
-        team.dart_id()),
+    dart_allreduce(
+      &l_hit_offset,
+      &g_hit_offset,
+      1,
+      dtype,
+      DART_OP_MIN,
+      team.dart_id()),
+    DART_OK);
+  if (early_exit && team.myid() == 0) {
+    // All units completed their updates of the hit word in the reduction:
+    index_t prev_hit_offset;
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(
+        g_hit, &not_found, &prev_hit_offset, dtype, DART_OP_REPLACE),
       DART_OK);
+  }
+  return g_hit_offset;
+}
+
+} // namespace internal
 
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * compares equal to \c val.
+ * If no such element is found, the function returns \c last.
+ *
+ * \see dash::find_async
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType>
+GlobIter<ElementType, PatternType> find(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const ElementType                  & value)
+{
+  using p_index_t = typename PatternType::index_type;
+
+  if(first >= last) {
+    return last;
+  }
+
+  p_index_t g_hit_idx = internal::find_if_offset(
+                          first, last,
+                          [&value](const ElementType & v) {
+                            return v == value;
+                          });
   if (g_hit_idx == std::numeric_limits<p_index_t>::max()) {
     DASH_LOG_DEBUG("element not found");
-  } else {
-    return first + g_hit_idx;
+    return last;
   }
-  return last;
+  return first + g_hit_idx;
+}
+
+/**
+ * Asynchronous variant of \c dash::find.
+ * Searches the local part of the range and starts a non-blocking
+ * reduction of the positions found, allowing to overlap the reduction
+ * with local computation.
+ *
+ * Collective operation, all units in the range's team must call
+ * \c get() or \c wait() on the returned future.
+ *
+ * \return A future of the iterator to the first element in the range
+ *         \c [first,last) that compares equal to \c val, or \c last if
+ *         no such element is found.
+ *
+ * \see dash::find
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename ElementType,
+  class    PatternType>
+dash::Future< GlobIter<ElementType, PatternType> > find_async(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const ElementType                  & value)
+{
+  using p_index_t = typename PatternType::index_type;
+  typedef GlobIter<ElementType, PatternType>                   globiter_t;
+  typedef internal::CollectiveRequest< std::vector<p_index_t> > request_t;
+
+  if(first >= last) {
+    return dash::Future<globiter_t>([=]() { return last; });
+  }
+
+  auto & team    = first.pattern().team();
+  // Buffer of offsets of local and global hit:
+  auto   request = std::make_shared<request_t>(std::vector<p_index_t>(2));
+  request->buffer[0] = internal::local_find_index(first, last, value);
+
+  DASH_ASSERT_RETURNS(
+      dart_iallreduce(
+        &request->buffer[0],
+        &request->buffer[1],
+        1,
+        dart_datatype<p_index_t>::value,
+        DART_OP_MIN,
+        team.dart_id(),
+        &request->handle),
+      DART_OK);
+
+  return dash::Future<globiter_t>(
+    [=]() {
+      request->wait();
+      p_index_t g_hit_idx = request->buffer[1];
+      if (g_hit_idx == std::numeric_limits<p_index_t>::max()) {
+        DASH_LOG_DEBUG("element not found");
+        return last;
+      }
+      return first + g_hit_idx;
+    },
+    [=]() {
+      return request->test();
+    });
 }
 
 /**
@@ -109,41 +377,15 @@ GlobIter<ElementType, PatternType> find_if(
 {
   typedef typename PatternType::index_type index_t;
 
-  auto & team        = first.pattern().team();
-  auto myid          = team.myid();
-  /// Global iterators to local range:
-  auto index_range   = dash::local_range(first, last);
-  auto l_first       = index_range.begin;
-  auto l_last        = index_range.end;
-
-  auto l_result      = std::find_if(l_first, l_last, predicate);
-  auto l_offset      = std::distance(l_first, l_result);
-  if (l_result == l_last) {
-    l_offset = -1;
+  if (first >= last) {
+    return last;
   }
-
-  dash::Array<index_t> l_results(team.size(), team);
-
-  l_results.local[0] = l_offset;
-
-  team.barrier();
-
-  // All local offsets stored in l_results
-  auto result = last;
-
-  for (auto u = 0; u < team.size(); u++) {
-    if (l_results[u] >= 0) {
-      auto g_offset = first.pattern()
-                           .global_index(
-                              u,
-                              { l_results[u] });
-      result = first + g_offset - first.pos();
-      break;
-    }
+  index_t g_hit_idx = internal::find_if_offset(first, last, predicate);
+  if (g_hit_idx == std::numeric_limits<index_t>::max()) {
+    DASH_LOG_DEBUG("dash::find_if", "no element satisfies predicate");
+    return last;
   }
-
-  team.barrier();
-  return result;
+  return first + g_hit_idx;
 }
 
 /**
@@ -1,14 +1,137 @@
 #ifndef DASH__ALGORITHM__FOR_EACH_H__
 #define DASH__ALGORITHM__FOR_EACH_H__
 
+#include <dash/LaunchPolicy.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Sync.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 #include <algorithm>
+#include <type_traits>
 
 
 namespace dash {
 
+/**
+ * Invoke a function on every element in a range distributed by a pattern.
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only.
+ * The local elements are processed according to the given execution
+ * policy, e.g. by multiple threads for \c dash::execution::par.
+ * Does not synchronize the team, modified elements are visible to other
+ * units after the returned token has been synchronized.
+ *
+ * \see         dash::sync
+ *
+ * \tparam      ExecutionPolicy  Execution policy of the local portion,
+ *                               \see dash::execution
+ * \tparam      ElementType      Type of the elements in the sequence
+ * \tparam      UnaryFunction    Function to invoke for each element
+ *                               in the specified range with signature
+ *                               \c (void (const ElementType &)).
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunction >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  dash::SyncToken >::type
+for_each_nosync(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  UnaryFunction                              func)
+{
+  /// Global iterators to local index range:
+  auto index_range  = dash::local_index_range(first, last);
+  auto lbegin_index = index_range.begin;
+  auto lend_index   = index_range.end;
+  auto & team       = first.pattern().team();
+  if (lbegin_index != lend_index) {
+    // Pattern from global begin iterator:
+    auto & pattern    = first.pattern();
+    // Local range to native pointers:
+    auto lrange_begin = (first + (pattern.global(lbegin_index) -
+                                  first.pos())).local();
+    dash::internal::parallel_for(
+      policy, lend_index - lbegin_index,
+      [lrange_begin, &func](decltype(lend_index) i) {
+        func(lrange_begin[i]);
+      });
+  }
+  return dash::SyncToken(team);
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern
+ * without synchronizing the team.
+ *
+ * \see         dash::for_each_nosync
+ * \see         dash::sync
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunction >
+dash::SyncToken for_each_nosync(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  UnaryFunction                              func)
+{
+  return dash::for_each_nosync(dash::execution::seq, first, last, func);
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern.
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only.
+ * The local elements are processed according to the given execution
+ * policy, e.g. by multiple threads for \c dash::execution::par.
+ *
+ * \tparam      ExecutionPolicy  Execution policy of the local portion,
+ *                               \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunction >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value >::type
+for_each(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  UnaryFunction                              func)
+{
+  dash::for_each_nosync(policy, first, last, func).wait();
+}
+
 /**
  * Invoke a function on every element in a range distributed by a pattern.
  * This function has the same signature as \c std::for_each but
@@ -39,6 +162,52 @@ void for_each(
   const GlobIter<ElementType, PatternType> & last,
   /// Function to invoke on every index in the range
   UnaryFunction                              func)
+{
+  dash::for_each(dash::execution::seq, first, last, func);
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern.
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only. The index passed to the function is
+ * a global index.
+ * The local elements are processed according to the given execution
+ * policy, e.g. by multiple threads for \c dash::execution::par.
+ * Does not synchronize the team, modified elements are visible to other
+ * units after the returned token has been synchronized.
+ *
+ * \see         dash::sync
+ *
+ * \tparam      ExecutionPolicy        Execution policy of the local
+ *                                     portion, \see dash::execution
+ * \tparam      ElementType            Type of the elements in the sequence
+ * \tparam      UnaryFunctionWithIndex Function to invoke for each element
+ *                                     in the specified range with signature
+ *                                     \c void (const ElementType &, index_t)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunctionWithIndex >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  dash::SyncToken >::type
+for_each_with_index_nosync(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  UnaryFunctionWithIndex                     func)
 {
   /// Global iterators to local index range:
   auto index_range  = dash::local_index_range(first, last);
@@ -49,11 +218,75 @@ void for_each(
     // Pattern from global begin iterator:
     auto & pattern    = first.pattern();
     // Local range to native pointers:
-    auto lrange_begin = (first + pattern.global(lbegin_index)).local();
-    auto lrange_end   = lrange_begin + lend_index;
-    std::for_each(lrange_begin, lrange_end, func);
+    auto lrange_begin = (first + (pattern.global(lbegin_index) -
+                                  first.pos())).local();
+    dash::internal::parallel_for(
+      policy, lend_index - lbegin_index,
+      [lrange_begin, lbegin_index, &pattern, &func](
+        decltype(lend_index) i) {
+        func(lrange_begin[i], pattern.global(lbegin_index + i));
+      });
   }
-  team.barrier();
+  return dash::SyncToken(team);
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern
+ * with the element's global index, without synchronizing the team.
+ *
+ * \see         dash::for_each_with_index_nosync
+ * \see         dash::sync
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunctionWithIndex >
+dash::SyncToken for_each_with_index_nosync(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  UnaryFunctionWithIndex                     func)
+{
+  return dash::for_each_with_index_nosync(
+           dash::execution::seq, first, last, func);
+}
+
+/**
+ * Invoke a function on every element in a range distributed by a pattern.
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only. The index passed to the function is
+ * a global index.
+ * The local elements are processed according to the given execution
+ * policy, e.g. by multiple threads for \c dash::execution::par.
+ *
+ * \tparam      ExecutionPolicy  Execution policy of the local portion,
+ *                               \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    UnaryFunctionWithIndex >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value >::type
+for_each_with_index(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function to invoke on every index in the range
+  UnaryFunctionWithIndex                     func)
+{
+  dash::for_each_with_index_nosync(policy, first, last, func).wait();
 }
 
 /**
@@ -87,25 +320,7 @@ void for_each_with_index(
   /// Function to invoke on every index in the range
   UnaryFunctionWithIndex                     func)
 {
-  /// Global iterators to local index range:
-  auto index_range  = dash::local_index_range(first, last);
-  auto lbegin_index = index_range.begin;
-  auto lend_index   = index_range.end;
-  auto & team       = first.pattern().team();
-  if (lbegin_index != lend_index) {
-    // Pattern from global begin iterator:
-    auto & pattern    = first.pattern();
-    // Iterate local index range:
-    for (auto lindex = lbegin_index;
-         lindex != lend_index;
-         ++lindex) {
-      auto gindex       = pattern.global(lindex);
-      auto first_offset = first.pos();
-      auto element_it   = first + (gindex - first_offset);
-      func(*(element_it.local()), gindex);
-    }
-  }
-  team.barrier();
+  dash::for_each_with_index(dash::execution::seq, first, last, func);
 }
 
 } // namespace dash
@@ -1,17 +1,71 @@
 #ifndef DASH__ALGORITHM__GENERATE_H__
 #define DASH__ALGORITHM__GENERATE_H__
 
+#include <dash/LaunchPolicy.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Sync.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 #include <dash/dart/if/dart_communication.h>
 
 #include <algorithm>
+#include <type_traits>
 
 
 namespace dash {
 
+/**
+ * Assigns each element in range [first, last) a value generated by the
+ * given function object g.
+ *
+ * Being a collaborative operation, each unit will invoke the given
+ * function on its local elements only.
+ * The local elements are processed according to the given execution
+ * policy, so the generator must be safe to invoke concurrently for
+ * policies other than \c dash::execution::seq.
+ *
+ * \tparam      ExecutionPolicy  Execution policy of the local portion,
+ *                               \see dash::execution
+ * \tparam      ElementType      Type of the elements in the sequence
+ * \tparam      Generator        Generator function with signature
+ *                               \c ElementType()
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    class    ExecutionPolicy,
+    typename ElementType,
+    class    PatternType,
+    class    Generator >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value >::type
+generate(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy                 && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Generator function
+  Generator                          gen) {
+  /// Global iterators to local range:
+  auto lrange = dash::local_range(first, last);
+  auto lfirst = lrange.begin;
+  auto nlocal = lrange.end - lfirst;
+
+  dash::internal::parallel_for(
+    policy, nlocal,
+    [lfirst, &gen](decltype(nlocal) lt) {
+      lfirst[lt] = gen();
+    });
+}
+
 /**
  * Assigns each element in range [first, last) a value generated by the
  * given function object g.
@@ -40,12 +94,63 @@ void generate (
   GlobIter<ElementType, PatternType> last,
   /// Generator function
   UnaryFunction                      gen) {
-  /// Global iterators to local range:
-  auto lrange = dash::local_range(first, last);
-  auto lfirst = lrange.begin;
-  auto llast  = lrange.end;
+  dash::generate(dash::execution::seq, first, last, gen);
+}
 
-  std::generate(lfirst, llast, gen);
+/**
+ * Assigns each element in range [first, last) a value generated by the
+ * given function object g and returns a token of the pending
+ * synchronization of the iterators' team.
+ * Generated values are guaranteed to be visible to all units after the
+ * token has been synchronized.
+ *
+ * \see         dash::sync
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    class    ExecutionPolicy,
+    typename ElementType,
+    class    PatternType,
+    class    Generator >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  dash::SyncToken >::type
+generate_nosync(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy                 && policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Generator function
+  Generator                          gen) {
+  dash::generate(policy, first, last, gen);
+  return dash::SyncToken(first.team());
+}
+
+/**
+ * Assigns each element in range [first, last) a value generated by the
+ * given function object g and returns a token of the pending
+ * synchronization of the iterators' team.
+ *
+ * \see         dash::sync
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    typename ElementType,
+    class    PatternType,
+    class    UnaryFunction >
+dash::SyncToken generate_nosync(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType> first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType> last,
+  /// Generator function
+  UnaryFunction                      gen) {
+  return dash::generate_nosync(dash::execution::seq, first, last, gen);
 }
 
 } // namespace dash
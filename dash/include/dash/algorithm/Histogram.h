@@ -0,0 +1,440 @@
+#ifndef DASH__ALGORITHM__HISTOGRAM_H__
+#define DASH__ALGORITHM__HISTOGRAM_H__
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/LaunchPolicy.h>
+
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/ParallelFor.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Modes of local counting and exchange of bins in \c dash::histogram.
+ *
+ * \ingroup DashAlgorithms
+ */
+enum class histogram_mode : uint16_t {
+  /// Every thread counts into a private array of all bins, the counts of
+  /// all units are combined in a single reduce-scatter to the bins'
+  /// owners. Suited for histograms with few bins or mostly non-empty bins.
+  dense  = 0,
+  /// Every thread counts into a hash map of the bins occurring in its
+  /// elements, only non-empty bins are sent to the bins' owners. Suited
+  /// for histograms with many bins of which most are empty at every unit.
+  sparse = 1
+};
+
+/**
+ * Bin function of \c dash::histogram for integral values, the bin of an
+ * element is its value.
+ *
+ * \ingroup DashAlgorithms
+ */
+struct identity_bins {
+  template <class ValueType>
+  int64_t operator()(const ValueType & value) const {
+    return static_cast<int64_t>(value);
+  }
+};
+
+/**
+ * Bin function of \c dash::histogram splitting the value range
+ * \c [lower, upper) into \c nbins bins of equal width.
+ * Values outside of the range are not counted.
+ *
+ * \ingroup DashAlgorithms
+ */
+template <class ValueType>
+class uniform_bins {
+public:
+  uniform_bins(ValueType lower, ValueType upper, size_t nbins)
+  : _lower(lower)
+  , _upper(upper)
+  , _nbins(nbins)
+  , _scale(static_cast<double>(nbins) /
+           static_cast<double>(upper - lower))
+  { }
+
+  int64_t operator()(const ValueType & value) const {
+    if (value < _lower || !(value < _upper)) {
+      return -1;
+    }
+    int64_t bin = static_cast<int64_t>((value - _lower) * _scale);
+    // Rounding of values close to the upper bound:
+    return std::min<int64_t>(bin, _nbins - 1);
+  }
+
+  size_t size() const {
+    return _nbins;
+  }
+
+private:
+  ValueType _lower;
+  ValueType _upper;
+  int64_t   _nbins;
+  double    _scale;
+};
+
+namespace internal {
+
+/**
+ * Count of a bin sent to the bin's owner, with the bin's local index at
+ * the owner.
+ */
+template <
+  class IndexType,
+  class CountType >
+struct sparse_bin_count_t {
+  IndexType l_index;
+  CountType count;
+};
+
+/**
+ * Counts the \c nlocal elements starting at \c lfirst into an array of
+ * \c nbins bins. Every chunk of the local elements is counted into a
+ * private array of bins which are summed up afterwards.
+ */
+template <
+  class CountType,
+  class ExecutionPolicy,
+  class ValueType,
+  class BinFunction >
+std::vector<CountType> local_dense_histogram(
+  ExecutionPolicy  && policy,
+  const ValueType   * lfirst,
+  size_t              nlocal,
+  BinFunction       & bins,
+  size_t              nbins)
+{
+  int n_chunks = num_parallel_chunks(policy, nlocal);
+  std::vector< std::vector<CountType> > chunk_bins(n_chunks);
+  parallel_for_chunks(
+    n_chunks, nlocal,
+    [&](int chunk, size_t chunk_begin, size_t chunk_end) {
+      // Allocated by the thread counting into the bins:
+      auto & c_bins = chunk_bins[chunk];
+      c_bins.assign(nbins, CountType(0));
+      for (size_t i = chunk_begin; i < chunk_end; ++i) {
+        int64_t bin = bins(lfirst[i]);
+        if (bin >= 0 && static_cast<size_t>(bin) < nbins) {
+          ++c_bins[bin];
+        }
+      }
+    });
+  auto & l_bins = chunk_bins[0];
+  parallel_for_chunks(
+    n_chunks, nbins,
+    [&](int, size_t bin_begin, size_t bin_end) {
+      for (int c = 1; c < n_chunks; ++c) {
+        const auto & c_bins = chunk_bins[c];
+        for (size_t b = bin_begin; b < bin_end; ++b) {
+          l_bins[b] += c_bins[b];
+        }
+      }
+    });
+  return std::move(l_bins);
+}
+
+/**
+ * Counts the \c nlocal elements starting at \c lfirst into a hash map of
+ * non-empty bins.
+ */
+template <
+  class CountType,
+  class ExecutionPolicy,
+  class ValueType,
+  class BinFunction >
+std::unordered_map<int64_t, CountType> local_sparse_histogram(
+  ExecutionPolicy  && policy,
+  const ValueType   * lfirst,
+  size_t              nlocal,
+  BinFunction       & bins,
+  size_t              nbins)
+{
+  typedef std::unordered_map<int64_t, CountType> bin_map_t;
+
+  int n_chunks = num_parallel_chunks(policy, nlocal);
+  std::vector<bin_map_t> chunk_bins(n_chunks);
+  parallel_for_chunks(
+    n_chunks, nlocal,
+    [&](int chunk, size_t chunk_begin, size_t chunk_end) {
+      auto & c_bins = chunk_bins[chunk];
+      for (size_t i = chunk_begin; i < chunk_end; ++i) {
+        int64_t bin = bins(lfirst[i]);
+        if (bin >= 0 && static_cast<size_t>(bin) < nbins) {
+          ++c_bins[bin];
+        }
+      }
+    });
+  auto & l_bins = chunk_bins[0];
+  for (int c = 1; c < n_chunks; ++c) {
+    for (const auto & bin_count : chunk_bins[c]) {
+      l_bins[bin_count.first] += bin_count.second;
+    }
+  }
+  return std::move(l_bins);
+}
+
+/**
+ * Sums the local bin arrays of all units into the bins array \c out
+ * using a single reduce-scatter.
+ */
+template <
+  class CountType,
+  class ContainerType >
+void scatter_dense_histogram(
+  const std::vector<CountType> & l_bins,
+  ContainerType                & out,
+  dash::Team                   & team)
+{
+  typedef typename ContainerType::index_type index_t;
+  static_assert(
+    dash::dart_datatype<CountType>::value != DART_TYPE_UNDEFINED,
+    "dash::histogram in dense mode requires bin counts of a DART type");
+
+  auto & pattern = out.pattern();
+  size_t nunits  = team.size();
+  std::vector<size_t> recv_counts(nunits);
+  std::vector<size_t> recv_displs(nunits);
+  // Whether local blocks of units are stored in the bins array in order
+  // of units, like in blocked patterns:
+  bool   unit_major = true;
+  size_t displ      = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    team_unit_t unit(u);
+    recv_counts[u] = pattern.local_size(unit);
+    recv_displs[u] = displ;
+    if (recv_counts[u] > 0) {
+      auto g_first = pattern.global_index(unit, {{ 0 }});
+      auto g_last  = pattern.global_index(
+                       unit, {{ static_cast<index_t>(recv_counts[u] - 1) }});
+      unit_major   = unit_major &&
+                     static_cast<size_t>(g_first) == displ &&
+                     static_cast<size_t>(g_last - g_first) + 1 ==
+                       recv_counts[u];
+    }
+    displ += recv_counts[u];
+  }
+  // Arrange bins in order of their owners' local blocks:
+  const CountType      * sendbuf = l_bins.data();
+  std::vector<CountType> unit_bins;
+  if (!unit_major) {
+    unit_bins.resize(l_bins.size());
+    for (size_t g = 0; g < l_bins.size(); ++g) {
+      auto l_pos = pattern.local(g);
+      unit_bins[recv_displs[l_pos.unit.id] + l_pos.index] = l_bins[g];
+    }
+    sendbuf = unit_bins.data();
+  }
+  DASH_ASSERT_RETURNS(
+    dart_reduce_scatter(
+      sendbuf,
+      out.lbegin(),
+      recv_counts.data(),
+      dash::dart_datatype<CountType>::value,
+      DART_OP_SUM,
+      team.dart_id()),
+    DART_OK);
+}
+
+/**
+ * Sends the non-empty local bins of all units to their owners in the bins
+ * array \c out using a single all-to-all exchange, owners sum up the
+ * received counts.
+ */
+template <
+  class CountType,
+  class ContainerType >
+void scatter_sparse_histogram(
+  const std::unordered_map<int64_t, CountType> & l_bins,
+  ContainerType                                & out,
+  dash::Team                                   & team)
+{
+  typedef typename ContainerType::index_type           index_t;
+  typedef sparse_bin_count_t<index_t, CountType>      bin_count_t;
+
+  auto & pattern = out.pattern();
+  size_t nunits  = team.size();
+  std::vector<size_t> send_counts(nunits, 0);
+  std::vector<size_t> send_displs(nunits, 0);
+  for (const auto & bin_count : l_bins) {
+    ++send_counts[pattern.unit_at(bin_count.first).id];
+  }
+  for (size_t u = 1; u < nunits; ++u) {
+    send_displs[u] = send_displs[u - 1] + send_counts[u - 1];
+  }
+  std::vector<bin_count_t> send_bins(l_bins.size());
+  std::vector<size_t>      send_pos(send_displs);
+  for (const auto & bin_count : l_bins) {
+    auto l_pos = pattern.local(static_cast<index_t>(bin_count.first));
+    auto & s_pos = send_pos[l_pos.unit.id];
+    send_bins[s_pos].l_index = l_pos.index;
+    send_bins[s_pos].count   = bin_count.second;
+    ++s_pos;
+  }
+
+  std::vector<size_t> recv_counts(nunits);
+  DASH_ASSERT_RETURNS(
+    dart_alltoall(
+      send_counts.data(),
+      recv_counts.data(),
+      1,
+      DART_TYPE_SIZET,
+      team.dart_id()),
+    DART_OK);
+  std::vector<size_t> recv_displs(nunits, 0);
+  for (size_t u = 1; u < nunits; ++u) {
+    recv_displs[u] = recv_displs[u - 1] + recv_counts[u - 1];
+  }
+  std::vector<bin_count_t> recv_bins(
+                             recv_displs[nunits - 1] +
+                             recv_counts[nunits - 1]);
+  // Exchange bin counts as bytes:
+  for (size_t u = 0; u < nunits; ++u) {
+    send_counts[u] *= sizeof(bin_count_t);
+    send_displs[u] *= sizeof(bin_count_t);
+    recv_counts[u] *= sizeof(bin_count_t);
+    recv_displs[u] *= sizeof(bin_count_t);
+  }
+  DASH_ASSERT_RETURNS(
+    dart_alltoallv(
+      send_bins.data(),
+      send_counts.data(),
+      send_displs.data(),
+      DART_TYPE_BYTE,
+      recv_bins.data(),
+      recv_counts.data(),
+      recv_displs.data(),
+      team.dart_id()),
+    DART_OK);
+
+  CountType * l_out = out.lbegin();
+  std::fill(l_out, l_out + pattern.local_size(), CountType(0));
+  for (const auto & bin_count : recv_bins) {
+    l_out[bin_count.l_index] += bin_count.count;
+  }
+}
+
+} // namespace internal
+
+/**
+ * Counts the elements in the range \c [first, last) into the bins array
+ * \c out. The function \c bins maps an element's value to the index of
+ * its bin in \c out, elements mapped to indices outside of \c out are not
+ * counted.
+ *
+ * Every unit counts its local elements into bins privatized per thread
+ * according to the execution policy, local counts are then sent to the
+ * units owning the bins in \c out in a single collective exchange instead
+ * of remote atomic increments.
+ * In \c histogram_mode::dense, the local counts of all bins are combined
+ * in a reduce-scatter. In \c histogram_mode::sparse, only bins occurring
+ * in the local elements are counted in a hash map and sent to their
+ * owners.
+ *
+ * \code
+ *   dash::Array<int> keys(num_keys);
+ *   dash::Array<int> histo(max_key);
+ *   // ...
+ *   dash::histogram(keys.begin(), keys.end(), dash::identity_bins(), histo);
+ * \endcode
+ *
+ * Collective operation, previous counts in \c out are overwritten.
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    BinFunction,
+  class    ContainerType >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value >::type
+histogram(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function mapping element values to bin indices
+  BinFunction                                bins,
+  /// Array of bins
+  ContainerType                            & out,
+  /// Mode of counting and exchange of bins
+  histogram_mode                             mode = histogram_mode::dense)
+{
+  typedef typename ContainerType::value_type count_t;
+
+  auto & team        = out.pattern().team();
+  auto   index_range = dash::local_index_range(first, last);
+  size_t nlocal      = index_range.end - index_range.begin;
+  size_t nbins       = out.size();
+  const ElementType * lfirst = first.globmem().lbegin() + index_range.begin;
+  DASH_LOG_DEBUG("dash::histogram()",
+                 "local elements:", nlocal, "bins:", nbins);
+
+  if (mode == histogram_mode::dense) {
+    auto l_bins = internal::local_dense_histogram<count_t>(
+                    policy, lfirst, nlocal, bins, nbins);
+    internal::scatter_dense_histogram(l_bins, out, team);
+  } else {
+    auto l_bins = internal::local_sparse_histogram<count_t>(
+                    policy, lfirst, nlocal, bins, nbins);
+    DASH_LOG_DEBUG("dash::histogram()",
+                   "non-empty local bins:", l_bins.size());
+    internal::scatter_sparse_histogram(l_bins, out, team);
+  }
+  team.barrier();
+}
+
+/**
+ * Counts the elements in the range \c [first, last) into the bins array
+ * \c out, processing local elements in multiple threads.
+ *
+ * Collective operation, previous counts in \c out are overwritten.
+ *
+ * \see  dash::histogram
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    BinFunction,
+  class    ContainerType >
+void histogram(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Function mapping element values to bin indices
+  BinFunction                                bins,
+  /// Array of bins
+  ContainerType                            & out,
+  /// Mode of counting and exchange of bins
+  histogram_mode                             mode = histogram_mode::dense)
+{
+  dash::histogram(dash::execution::par, first, last, bins, out, mode);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__HISTOGRAM_H__
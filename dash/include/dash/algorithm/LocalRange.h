@@ -9,6 +9,8 @@
 
 #include <dash/internal/Logging.h>
 
+#include <limits>
+
 
 namespace dash {
 
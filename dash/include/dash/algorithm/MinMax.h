@@ -3,23 +3,26 @@
 
 #include <dash/internal/Config.h>
 
-#include <dash/Allocator.h>
+#include <dash/Future.h>
+#include <dash/LaunchPolicy.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Collective.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
-#include <dash/util/UnitLocality.h>
 
 #include <dash/iterator/GlobIter.h>
 #include <dash/internal/Logging.h>
 
+#include <dash/dart/if/dart_communication.h>
+
 #include <algorithm>
 #include <memory>
-
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 namespace dash {
@@ -27,24 +30,34 @@ namespace dash {
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
- * Specialization for local range, delegates to std::min_element.
+ * Specialization for local range, the range is split into chunks that
+ * are searched using \c std::min_element according to the given
+ * execution policy.
  *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
  *
- * \tparam      ElementType  Type of the elements in the sequence
- * \tparam      Compare      Binary comparison function with signature
- *                           \c bool (const TypeA &a, const TypeB &b)
+ * \tparam      ExecutionPolicy  Execution policy of the local search,
+ *                               \see dash::execution
+ * \tparam      ElementType      Type of the elements in the sequence
+ * \tparam      Compare          Binary comparison function with signature
+ *                               \c bool (const TypeA &a, const TypeB &b)
  *
- * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
- *              pattern and \c nl local elements within the global range
+ * \complexity  O(nl), with \c nl local elements in the range
  *
  * \ingroup     DashAlgorithms
  */
 template <
+  class ExecutionPolicy,
   class ElementType,
   class Compare = std::less<const ElementType &> >
-const ElementType * min_element(
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  const ElementType * >::type
+min_element(
+  /// Execution policy of the local search
+  ExecutionPolicy  && policy,
   /// Iterator to the initial position in the sequence
   const ElementType * l_range_begin,
   /// Iterator to the final position in the sequence
@@ -53,87 +66,37 @@ const ElementType * min_element(
   Compare             compare
     = std::less<const ElementType &>())
 {
-  typedef typename std::decay<ElementType>::type      value_t;
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::min_element", "thread capacity:",  n_threads);
-
-  // TODO: Should also restrict on elements/units > ~10240.
-  //       Find a model for the minimum work laod.
-  if (n_threads > 1) {
-    auto          l_size     = l_range_end - l_range_begin;
-    int           min_idx_l  = 0;
-    ElementType   min_val_l  = *l_range_begin;
-
-    typedef struct min_pos_t { value_t val; size_t idx; } min_pos;
-
-    DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size);
-    int       align_bytes      = uloc.cache_line_size(0);
-    size_t    min_vals_t_size  = n_threads + 1 +
-                                 (align_bytes / sizeof(min_pos));
-    size_t    min_vals_t_bytes = min_vals_t_size * sizeof(min_pos);
-    min_pos * min_vals_t_raw   = new min_pos[min_vals_t_size];
-    void    * min_vals_t_alg   = min_vals_t_raw;
-    min_pos * min_vals_t       = static_cast<min_pos *>(
-                                   dash::align(
-                                     align_bytes,
-                                     sizeof(min_pos),
-                                     min_vals_t_alg,
-                                     min_vals_t_bytes));
-    DASH_LOG_TRACE("dash::min_element", "min * alloc:",   min_vals_t_raw);
-    DASH_LOG_TRACE("dash::min_element", "min * aligned:", min_vals_t);
-    DASH_LOG_TRACE("dash::min_element", "min * size:",    min_vals_t_bytes);
-    DASH_ASSERT_GE(min_vals_t_bytes, n_threads * sizeof(min_pos),
-                   "Aligned buffer of min_pos has insufficient size");
-    DASH_ASSERT_MSG(nullptr != min_vals_t,
-                    "Aligned allocation of min_pos returned nullptr");
-
-    // Cannot use user-defined reduction (OpenMP 4.0) as the compare
-    // predicate cannot be used in `omp declare reduction`.
-    // Avoid omp for + omp critical section by using array of
-    // thread-local minimum values, aligned to prevent false sharing:
-    int t_id;
-    #pragma omp parallel num_threads(n_threads) private(t_id)
-    {
-      // Documentation of Intel MIC intrinsics, see:
-      // https://software.intel.com/de-de/node/523533
-      // https://software.intel.com/de-de/node/523387
-      t_id = omp_get_thread_num();
-      DASH_LOG_TRACE("dash::min_element", "starting thread", t_id);
-      min_vals_t[t_id].idx = min_idx_l;
-      min_vals_t[t_id].val = min_val_l;
-      // Cannot use explicit private(min_val_t) as ElementType might
-      // not be default-constructible:
-      #pragma omp for schedule(static)
-      for (int i = 0; i < l_size; i++) {
-        const ElementType & val_t = *(l_range_begin + i);
-        if (compare(val_t, min_vals_t[t_id].val)) {
-          min_vals_t[t_id].val = val_t;
-          min_vals_t[t_id].idx = i;
-        }
-      }
-      DASH_LOG_TRACE("dash::min_element", "local minimum at thread", t_id,
-                     "idx:", min_vals_t[t_id].idx,
-                     "val:", min_vals_t[t_id].val);
-    }
-    min_pos min_pos_l = min_vals_t[0];
-    for (int t = 1; t < n_threads; t++) {
-      const min_pos & mpt = min_vals_t[t];
-      if (compare(mpt.val, min_pos_l.val)) {
-        min_pos_l = mpt;
-      }
+  auto l_size   = l_range_end - l_range_begin;
+  int  n_chunks = dash::internal::num_parallel_chunks(policy, l_size);
+  DASH_LOG_DEBUG("dash::min_element", "local range size:", l_size,
+                 "chunks:", n_chunks);
+  if (n_chunks < 2) {
+    return ::std::min_element(l_range_begin, l_range_end, compare);
+  }
+  // Minimum of every chunk, resolved in order of chunks to return the
+  // first occurrence of the smallest value:
+  std::vector<const ElementType *> chunk_mins(n_chunks);
+  dash::internal::parallel_for_chunks(
+    n_chunks, l_size,
+    [&](int c, decltype(l_size) chunk_begin, decltype(l_size) chunk_end) {
+      chunk_mins[c] = ::std::min_element(l_range_begin + chunk_begin,
+                                         l_range_begin + chunk_end,
+                                         compare);
+    });
+  const ElementType * lmin = chunk_mins[0];
+  for (int c = 1; c < n_chunks; ++c) {
+    if (compare(*chunk_mins[c], *lmin)) {
+      lmin = chunk_mins[c];
     }
-    delete[] min_vals_t_raw;
-    return (l_range_begin + min_pos_l.idx);
   }
-#endif // DASH_ENABLE_OPENMP
-  return ::std::min_element(l_range_begin, l_range_end, compare);
+  return lmin;
 }
 
 /**
  * Finds an iterator pointing to the element with the smallest value in
  * the range [first,last).
+ * Specialization for local range, searches the range using multiple
+ * threads if available.
  *
  * \return      An iterator to the first occurrence of the smallest value
  *              in the range, or \c last if the range is empty.
@@ -149,38 +112,56 @@ const ElementType * min_element(
  */
 template <
   class ElementType,
-  class PatternType,
   class Compare = std::less<const ElementType &> >
-GlobIter<ElementType, PatternType> min_element(
+const ElementType * min_element(
   /// Iterator to the initial position in the sequence
-  const GlobIter<ElementType, PatternType> & first,
+  const ElementType * l_range_begin,
   /// Iterator to the final position in the sequence
-  const GlobIter<ElementType, PatternType> & last,
+  const ElementType * l_range_end,
   /// Element comparison function, defaults to std::less
-  Compare                                    compare
+  Compare             compare
     = std::less<const ElementType &>())
 {
-  typedef dash::GlobIter<ElementType, PatternType> globiter_t;
-  typedef PatternType                               pattern_t;
-  typedef typename pattern_t::index_type              index_t;
-  typedef typename std::decay<ElementType>::type      value_t;
+  return dash::min_element(
+           dash::execution::par, l_range_begin, l_range_end, compare);
+}
 
-  // return last for empty array
-  if (first == last) {
-    DASH_LOG_DEBUG("dash::min_element >",
-                   "empty range, returning last", last);
-    return last;
-  }
+namespace internal {
 
-  dash::util::Trace trace("min_element");
+/**
+ * Local minimum of a unit in a global range and its global index, which
+ * is -1 if the local part of the range is empty.
+ */
+template <
+  class ValueType,
+  class IndexType >
+struct local_min_element_t {
+  ValueType value;
+  IndexType g_index;
+};
+
+/**
+ * Finds the element with the smallest value in the local part of the
+ * global range [first,last).
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class PatternType,
+  class Compare >
+local_min_element_t<
+  typename std::decay<ElementType>::type,
+  typename PatternType::index_type >
+local_min_element(
+  ExecutionPolicy                         && policy,
+  const GlobIter<ElementType, PatternType> & first,
+  const GlobIter<ElementType, PatternType> & last,
+  Compare                                    compare)
+{
+  typedef typename PatternType::index_type            index_t;
+  typedef typename std::decay<ElementType>::type      value_t;
 
   auto & pattern = first.pattern();
-  auto & team    = pattern.team();
-  DASH_LOG_DEBUG("dash::min_element()",
-                 "allocate minarr, size", team.size());
-  // Global position of end element in range:
-  auto    gi_last            = last.gpos();
-  // Find the local min. element in parallel
   // Get local address range between global iterators:
   auto    local_idx_range    = dash::local_index_range(first, last);
   // Pointer to local minimum element:
@@ -191,43 +172,26 @@ GlobIter<ElementType, PatternType> min_element(
     // local range is empty
     DASH_LOG_DEBUG("dash::min_element", "local range empty");
   } else {
-    trace.enter_state("local");
-
     // Pointer to first element in local memory:
     const ElementType * lbegin        = first.globmem().lbegin();
     // Pointers to first / final element in local range:
     const ElementType * l_range_begin = lbegin + local_idx_range.begin;
     const ElementType * l_range_end   = lbegin + local_idx_range.end;
 
-    lmin = dash::min_element(l_range_begin, l_range_end, compare);
+    lmin = dash::min_element(policy, l_range_begin, l_range_end, compare);
 
     if (lmin != l_range_end) {
       DASH_LOG_TRACE_VAR("dash::min_element", *lmin);
       // Offset of local minimum in local memory:
       l_idx_lmin = lmin - lbegin;
     }
-
-    trace.exit_state("local");
   }
   DASH_LOG_TRACE("dash::min_element",
                  "local index of local minimum:", l_idx_lmin);
-  DASH_LOG_TRACE("dash::min_element",
-                 "waiting for local min of other units");
-
-  trace.enter_state("barrier");
-  team.barrier();
-  trace.exit_state("barrier");
-
-  typedef struct {
-    value_t  value;
-    index_t  g_index;
-  } local_min_t;
-
-  std::vector<local_min_t> local_min_values(team.size());
 
   // Set global index of local minimum to -1 if no local minimum has been
   // found:
-  local_min_t local_min;
+  local_min_element_t<value_t, index_t> local_min;
   local_min.value   = l_idx_lmin < 0
                       ? ElementType()
                       : *lmin;
@@ -235,21 +199,32 @@ GlobIter<ElementType, PatternType> min_element(
                       ? -1
                       : pattern.global(l_idx_lmin);
 
-  DASH_LOG_TRACE("dash::min_element", "sending local minimum: {",
+  DASH_LOG_TRACE("dash::min_element", "local minimum: {",
                  "value:",   local_min.value,
                  "g.index:", local_min.g_index, "}");
+  return local_min;
+}
 
-  DASH_LOG_TRACE("dash::min_element", "dart_allgather()");
-  trace.enter_state("allgather");
-  DASH_ASSERT_RETURNS(
-    dart_allgather(
-      &local_min,
-      local_min_values.data(),
-      sizeof(local_min_t),
-      DART_TYPE_BYTE,
-      team.dart_id()),
-    DART_OK);
-  trace.exit_state("allgather");
+/**
+ * Resolves the global minimum element in the range [first,last) from the
+ * local minima of all units.
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class Compare >
+GlobIter<ElementType, PatternType> global_min_element(
+  const GlobIter<ElementType, PatternType> & first,
+  const GlobIter<ElementType, PatternType> & last,
+  const std::vector<
+          local_min_element_t<
+            typename std::decay<ElementType>::type,
+            typename PatternType::index_type > > & local_min_values,
+  Compare                                    compare)
+{
+  typedef local_min_element_t<
+            typename std::decay<ElementType>::type,
+            typename PatternType::index_type >   local_min_t;
 
 #ifdef DASH_ENABLE_LOGGING
   for (int lmin_u = 0; lmin_u < local_min_values.size(); lmin_u++) {
@@ -269,7 +244,7 @@ GlobIter<ElementType, PatternType> min_element(
                              // Ignore elements with global index -1 (no
                              // element found):
                              return (b.g_index < 0 ||
-                                     (a.g_index > 0 &&
+                                     (a.g_index >= 0 &&
                                       compare(a.value, b.value)));
                            });
 
@@ -286,20 +261,416 @@ GlobIter<ElementType, PatternType> min_element(
                  "global idx:", gi_minimum);
 
   DASH_LOG_TRACE_VAR("dash::min_element", gi_minimum);
-  if (gi_minimum < 0 || gi_minimum == gi_last) {
+  if (gi_minimum < 0 || gi_minimum == last.gpos()) {
     DASH_LOG_DEBUG_VAR("dash::min_element >", last);
     return last;
   }
   // iterator 'first' is relative to start of input range, convert to start
   // of its referenced container (= container.begin()), then apply global
   // offset of minimum element:
-  globiter_t minimum = (first - first.gpos()) + gi_minimum;
+  auto minimum = (first - first.gpos()) + gi_minimum;
   DASH_LOG_DEBUG("dash::min_element >", minimum,
                  "=", static_cast<ElementType>(*minimum));
 
   return minimum;
 }
 
+/**
+ * Reduction operation on local minima passed to \c dart_op_create,
+ * keeps the smaller value of valid entries and the smaller global index
+ * of equivalent values.
+ */
+template <
+  class ValueType,
+  class IndexType,
+  class Compare >
+void min_element_reduce_op(
+  const void * invec,
+  void       * inoutvec,
+  size_t       len,
+  void       * compare)
+{
+  typedef local_min_element_t<ValueType, IndexType> local_min_t;
+
+  const local_min_t * in    = static_cast<const local_min_t *>(invec);
+  local_min_t       * inout = static_cast<local_min_t *>(inoutvec);
+  Compare           & comp  = *static_cast<Compare *>(compare);
+  for (size_t i = 0; i < len; ++i) {
+    if (in[i].g_index < 0) {
+      continue;
+    }
+    if (inout[i].g_index < 0 ||
+        comp(in[i].value, inout[i].value) ||
+        (!comp(inout[i].value, in[i].value) &&
+         in[i].g_index < inout[i].g_index)) {
+      inout[i] = in[i];
+    }
+  }
+}
+
+/**
+ * Local minimum and maximum of a unit in a global range.
+ */
+template <
+  class ValueType,
+  class IndexType >
+struct local_minmax_element_t {
+  local_min_element_t<ValueType, IndexType> min;
+  local_min_element_t<ValueType, IndexType> max;
+};
+
+/**
+ * Reduction operation on local minima and maxima passed to
+ * \c dart_op_create, keeps the first minimum and the last maximum like
+ * \c std::minmax_element.
+ */
+template <
+  class ValueType,
+  class IndexType,
+  class Compare >
+void minmax_element_reduce_op(
+  const void * invec,
+  void       * inoutvec,
+  size_t       len,
+  void       * compare)
+{
+  typedef local_minmax_element_t<ValueType, IndexType> local_minmax_t;
+
+  const local_minmax_t * in    = static_cast<const local_minmax_t *>(invec);
+  local_minmax_t       * inout = static_cast<local_minmax_t *>(inoutvec);
+  Compare              & comp  = *static_cast<Compare *>(compare);
+  for (size_t i = 0; i < len; ++i) {
+    if (in[i].min.g_index < 0) {
+      continue;
+    }
+    if (inout[i].min.g_index < 0) {
+      inout[i] = in[i];
+      continue;
+    }
+    if (comp(in[i].min.value, inout[i].min.value) ||
+        (!comp(inout[i].min.value, in[i].min.value) &&
+         in[i].min.g_index < inout[i].min.g_index)) {
+      inout[i].min = in[i].min;
+    }
+    if (comp(inout[i].max.value, in[i].max.value) ||
+        (!comp(in[i].max.value, inout[i].max.value) &&
+         in[i].max.g_index > inout[i].max.g_index)) {
+      inout[i].max = in[i].max;
+    }
+  }
+}
+
+/**
+ * Comparison object of the reduction in progress in the calling thread.
+ * Reduction operations are shared by all calls, so the comparison
+ * object of a call cannot be passed as user data of the operation.
+ */
+template <class Compare>
+Compare *& reduce_op_compare()
+{
+  static thread_local Compare * compare = nullptr;
+  return compare;
+}
+
+/**
+ * Applies \c ReduceOp with the comparison object of the reduction in
+ * progress in the calling thread.
+ */
+template <
+  class Compare,
+  dart_operator_t ReduceOp >
+void reduce_op_with_compare(
+  const void * invec,
+  void       * inoutvec,
+  size_t       len,
+  void       * /* userdata */)
+{
+  ReduceOp(invec, inoutvec, len, reduce_op_compare<Compare>());
+}
+
+/**
+ * All-reduce of the local result \c value of every unit using the
+ * reduction function \c ReduceOp with comparison \c compare, stores the
+ * result in \c value.
+ */
+template <
+  class ValueType,
+  class Compare,
+  dart_operator_t ReduceOp >
+void allreduce_user_op(
+  ValueType       & value,
+  Compare         & compare,
+  dash::Team      & team)
+{
+  // DART returns the existing operation for every combination of value
+  // type, comparison and reduction function created before, it is not
+  // destroyed to be reused until dart_exit:
+  dart_operation_t dart_op;
+  DASH_ASSERT_RETURNS(
+    dart_op_create(
+      &reduce_op_with_compare<Compare, ReduceOp>,
+      nullptr, true, sizeof(ValueType), &dart_op),
+    DART_OK);
+  // Send and receive buffers of MPI_Allreduce must not overlap:
+  ValueType l_value = value;
+  reduce_op_compare<Compare>() = &compare;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_value,
+      &value,
+      sizeof(ValueType),
+      DART_TYPE_BYTE,
+      dart_op,
+      team.dart_id()),
+    DART_OK);
+  reduce_op_compare<Compare>() = nullptr;
+}
+
+/**
+ * Iterator to the element at global index \c g_index in the container
+ * referenced by \c first, or \c last if \c g_index is negative.
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class IndexType >
+GlobIter<ElementType, PatternType> global_element_at(
+  const GlobIter<ElementType, PatternType> & first,
+  const GlobIter<ElementType, PatternType> & last,
+  IndexType                                  g_index)
+{
+  if (g_index < 0 || g_index == last.gpos()) {
+    return last;
+  }
+  return (first - first.gpos()) + g_index;
+}
+
+} // namespace internal
+
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last).
+ * The local elements are searched according to the given execution
+ * policy.
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ExecutionPolicy  Execution policy of the local search,
+ *                               \see dash::execution
+ * \tparam      ElementType      Type of the elements in the sequence
+ * \tparam      Compare          Binary comparison function with signature
+ *                               \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \see         dash::min_element_async
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class PatternType,
+  class Compare = std::less<const ElementType &> >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  GlobIter<ElementType, PatternType> >::type
+min_element(
+  /// Execution policy of the local search
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare
+    = std::less<const ElementType &>())
+{
+  typedef typename PatternType::index_type            index_t;
+  typedef typename std::decay<ElementType>::type      value_t;
+  typedef internal::local_min_element_t<value_t, index_t>
+                                                      local_min_t;
+
+  // return last for empty array
+  if (first == last) {
+    DASH_LOG_DEBUG("dash::min_element >",
+                   "empty range, returning last", last);
+    return last;
+  }
+
+  dash::util::Trace trace("min_element");
+
+  auto & team    = first.pattern().team();
+  // Find the local min. element in parallel
+  trace.enter_state("local");
+  local_min_t local_min = internal::local_min_element(
+                            policy, first, last, compare);
+  trace.exit_state("local");
+
+  // Single reduction of local minima using a user-defined operation
+  // instead of gathering the local minima of all units:
+  DASH_LOG_TRACE("dash::min_element", "dart_allreduce()");
+  trace.enter_state("allreduce");
+  internal::allreduce_user_op<
+    local_min_t, Compare,
+    &internal::min_element_reduce_op<value_t, index_t, Compare> >(
+      local_min, compare, team);
+  trace.exit_state("allreduce");
+
+  DASH_LOG_TRACE("dash::min_element",
+                 "min. value:", local_min.value,
+                 "global idx:", local_min.g_index);
+  return internal::global_element_at(first, last, local_min.g_index);
+}
+
+/**
+ * Finds an iterator pointing to the element with the smallest value in
+ * the range [first,last), searching the local elements using multiple
+ * threads if available.
+ *
+ * \return      An iterator to the first occurrence of the smallest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \see         dash::min_element_async
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class Compare = std::less<const ElementType &> >
+GlobIter<ElementType, PatternType> min_element(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare
+    = std::less<const ElementType &>())
+{
+  return dash::min_element(dash::execution::par, first, last, compare);
+}
+
+/**
+ * Asynchronous variant of \c dash::min_element.
+ * Finds the local minimum element and starts a non-blocking exchange of
+ * the local minima, allowing to overlap the exchange with local
+ * computation.
+ *
+ * Collective operation, all units in the range's team must call
+ * \c get() or \c wait() on the returned future.
+ *
+ * \return      A future of the iterator to the first occurrence of the
+ *              smallest value in the range, or \c last if the range is
+ *              empty.
+ *
+ * \see         dash::min_element
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class Compare = std::less<const ElementType &> >
+dash::Future< GlobIter<ElementType, PatternType> > min_element_async(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare
+    = std::less<const ElementType &>())
+{
+  typedef dash::GlobIter<ElementType, PatternType>    globiter_t;
+  typedef typename PatternType::index_type            index_t;
+  typedef typename std::decay<ElementType>::type      value_t;
+  typedef internal::local_min_element_t<value_t, index_t>
+                                                      local_min_t;
+  typedef internal::CollectiveRequest< std::vector<local_min_t> >
+                                                      request_t;
+
+  if (first == last) {
+    DASH_LOG_DEBUG("dash::min_element_async >",
+                   "empty range, returning last", last);
+    return dash::Future<globiter_t>([=]() { return last; });
+  }
+
+  auto & team    = first.pattern().team();
+  auto   request = std::make_shared<request_t>(
+                     std::vector<local_min_t>(team.size()));
+  request->buffer[team.myid()] = internal::local_min_element(
+                                   dash::execution::par,
+                                   first, last, compare);
+
+  DASH_LOG_TRACE("dash::min_element_async", "dart_iallgather()");
+  DASH_ASSERT_RETURNS(
+    dart_iallgather(
+      nullptr,
+      request->buffer.data(),
+      sizeof(local_min_t),
+      DART_TYPE_BYTE,
+      team.dart_id(),
+      &request->handle),
+    DART_OK);
+
+  return dash::Future<globiter_t>(
+    [=]() {
+      request->wait();
+      return internal::global_min_element(
+               first, last, request->buffer, compare);
+    },
+    [=]() {
+      return request->test();
+    });
+}
+
+/**
+ * Finds an iterator pointing to the element with the greatest value in
+ * the range [first,last).
+ * The local elements are searched according to the given execution
+ * policy.
+ *
+ * \return      An iterator to the first occurrence of the greatest value
+ *              in the range, or \c last if the range is empty.
+ *
+ * \tparam      ExecutionPolicy  Execution policy of the local search,
+ *                               \see dash::execution
+ * \tparam      ElementType      Type of the elements in the sequence
+ * \tparam      Compare          Binary comparison function with signature
+ *                               \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class ElementType,
+  class PatternType,
+  class Compare = std::greater<const ElementType &> >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  GlobIter<ElementType, PatternType> >::type
+max_element(
+  /// Execution policy of the local search
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::greater
+  Compare                                    compare
+    = std::greater<const ElementType &>())
+{
+  // Same as min_element with different compare function
+  return dash::min_element(policy, first, last, compare);
+}
+
 /**
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
@@ -333,6 +704,113 @@ GlobIter<ElementType, PatternType> max_element(
   return dash::min_element(first, last, compare);
 }
 
+/**
+ * Asynchronous variant of \c dash::max_element.
+ *
+ * \return      A future of the iterator to the first occurrence of the
+ *              greatest value in the range, or \c last if the range is
+ *              empty.
+ *
+ * \see         dash::max_element
+ * \see         dash::min_element_async
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class Compare = std::greater<const ElementType &> >
+dash::Future< GlobIter<ElementType, PatternType> > max_element_async(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::greater
+  Compare                                    compare
+    = std::greater<const ElementType &>())
+{
+  // Same as min_element_async with different compare function
+  return dash::min_element_async(first, last, compare);
+}
+
+/**
+ * Finds iterators pointing to the elements with the smallest and the
+ * greatest value in the range [first,last) in a single pass and a single
+ * reduction.
+ *
+ * \return      A pair of iterators to the first occurrence of the
+ *              smallest value and the last occurrence of the greatest
+ *              value in the range like \c std::minmax_element, or a pair
+ *              of \c last if the range is empty.
+ *
+ * \tparam      ElementType  Type of the elements in the sequence
+ * \tparam      Compare      Binary comparison function with signature
+ *                           \c bool (const TypeA &a, const TypeB &b)
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ElementType,
+  class PatternType,
+  class Compare = std::less<const ElementType &> >
+std::pair<
+  GlobIter<ElementType, PatternType>,
+  GlobIter<ElementType, PatternType> >
+minmax_element(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & last,
+  /// Element comparison function, defaults to std::less
+  Compare                                    compare
+    = std::less<const ElementType &>())
+{
+  typedef typename PatternType::index_type            index_t;
+  typedef typename std::decay<ElementType>::type      value_t;
+  typedef internal::local_minmax_element_t<value_t, index_t>
+                                                      local_minmax_t;
+
+  if (first == last) {
+    DASH_LOG_DEBUG("dash::minmax_element >",
+                   "empty range, returning last", last);
+    return std::make_pair(last, last);
+  }
+
+  auto & team            = first.pattern().team();
+  auto & pattern         = first.pattern();
+  auto   local_idx_range = dash::local_index_range(first, last);
+
+  local_minmax_t local_minmax;
+  local_minmax.min.value   = value_t();
+  local_minmax.min.g_index = -1;
+  local_minmax.max         = local_minmax.min;
+  if (local_idx_range.begin != local_idx_range.end) {
+    const ElementType * lbegin = first.globmem().lbegin();
+    auto lminmax = std::minmax_element(
+                     lbegin + local_idx_range.begin,
+                     lbegin + local_idx_range.end,
+                     compare);
+    local_minmax.min.value   = *lminmax.first;
+    local_minmax.min.g_index = pattern.global(lminmax.first - lbegin);
+    local_minmax.max.value   = *lminmax.second;
+    local_minmax.max.g_index = pattern.global(lminmax.second - lbegin);
+  }
+
+  internal::allreduce_user_op<
+    local_minmax_t, Compare,
+    &internal::minmax_element_reduce_op<value_t, index_t, Compare> >(
+      local_minmax, compare, team);
+
+  return std::make_pair(
+           internal::global_element_at(
+             first, last, local_minmax.min.g_index),
+           internal::global_element_at(
+             first, last, local_minmax.max.g_index));
+}
+
 /**
  * Finds an iterator pointing to the element with the greatest value in
  * the range [first,last).
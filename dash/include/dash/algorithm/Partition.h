@@ -0,0 +1,62 @@
+#ifndef DASH__ALGORITHM__PARTITION_H__
+#define DASH__ALGORITHM__PARTITION_H__
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/internal/Rebalance.h>
+
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Reorders the elements in the range \c [first, last) such that all
+ * elements satisfying the predicate \c p precede the elements that do
+ * not satisfy it.
+ * The relative order of elements within both groups is preserved like in
+ * \c std::stable_partition.
+ *
+ * Every unit partitions its local elements, the partitions are then moved
+ * to their final position in bulk transfers, based on the partition sizes
+ * of preceding units.
+ * The local elements of every unit must be contiguous in the range, like
+ * in \c dash::BLOCKED patterns.
+ *
+ * Collective operation.
+ *
+ * \return  Iterator to the first element of the second group, equal at
+ *          all units.
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+GlobIter<ElementType, PatternType> partition(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate which returns \c true for elements of the first group
+  UnaryPredicate                       p)
+{
+  auto lrange = dash::internal::contiguous_local_range(first, last);
+
+  std::vector<ElementType> l_true;
+  std::vector<ElementType> l_false;
+  for (auto l_it = lrange.lbegin; l_it != lrange.lbegin + lrange.size;
+       ++l_it) {
+    if (p(*l_it)) {
+      l_true.push_back(*l_it);
+    } else {
+      l_false.push_back(*l_it);
+    }
+  }
+  return dash::internal::rebalance_partitions(
+           first, lrange, l_true, l_false);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__PARTITION_H__
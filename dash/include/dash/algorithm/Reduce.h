@@ -0,0 +1,495 @@
+#ifndef DASH__ALGORITHM__REDUCE_H__
+#define DASH__ALGORITHM__REDUCE_H__
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+
+#include <dash/LaunchPolicy.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/internal/ParallelFor.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Result of reducing the local part of a global range, \c valid is
+ * \c 0 if the local part of the range is empty.
+ */
+template <class ValueType>
+struct local_accumulate_t {
+  ValueType value;
+  int32_t   valid;
+};
+
+/**
+ * Combines two local results, results with \c valid set to \c 0 are
+ * ignored.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+local_accumulate_t<ValueType> combine_local_results(
+  const local_accumulate_t<ValueType> & lhs,
+  const local_accumulate_t<ValueType> & rhs,
+  BinaryOperation                       binary_op)
+{
+  if (!lhs.valid) {
+    return rhs;
+  }
+  if (!rhs.valid) {
+    return lhs;
+  }
+  local_accumulate_t<ValueType> result;
+  result.value = binary_op(lhs.value, rhs.value);
+  result.valid = 1;
+  return result;
+}
+
+/**
+ * Reduces the transformed values of the local range \c [first, last)
+ * in the calling thread.
+ */
+template <
+  class ValueType,
+  class InputIt,
+  class BinaryOperation,
+  class UnaryOperation >
+local_accumulate_t<ValueType> local_transform_reduce(
+  InputIt         first,
+  InputIt         last,
+  BinaryOperation binary_op,
+  UnaryOperation  unary_op)
+{
+  local_accumulate_t<ValueType> result;
+  result.valid = (first != last);
+  if (result.valid) {
+    ValueType acc = unary_op(*first);
+    for (++first; first != last; ++first) {
+      acc = binary_op(acc, unary_op(*first));
+    }
+    result.value = acc;
+  }
+  return result;
+}
+
+/**
+ * Reduces the transformed values of \c nlocal local elements starting at
+ * \c lfirst according to the given execution policy.
+ * Every thread reduces a contiguous chunk of elements, chunk results are
+ * combined in order so \c binary_op must be associative but is not
+ * required to be commutative.
+ */
+template <
+  class ValueType,
+  class ExecutionPolicy,
+  class LocalIt,
+  class BinaryOperation,
+  class UnaryOperation >
+local_accumulate_t<ValueType> local_transform_reduce(
+  ExecutionPolicy && policy,
+  LocalIt            lfirst,
+  size_t             nlocal,
+  BinaryOperation    binary_op,
+  UnaryOperation     unary_op)
+{
+  int n_chunks = num_parallel_chunks(policy, nlocal);
+  std::vector< local_accumulate_t<ValueType> > chunk_results(n_chunks);
+  parallel_for_chunks(
+    n_chunks, nlocal,
+    [&](int chunk, size_t chunk_begin, size_t chunk_end) {
+      chunk_results[chunk] = local_transform_reduce<ValueType>(
+                               lfirst + chunk_begin, lfirst + chunk_end,
+                               binary_op, unary_op);
+    });
+  local_accumulate_t<ValueType> result = chunk_results[0];
+  for (int chunk = 1; chunk < n_chunks; ++chunk) {
+    result = combine_local_results(result, chunk_results[chunk], binary_op);
+  }
+  return result;
+}
+
+/**
+ * Identity element of a reduce operation, used as contribution of units
+ * with empty local range in reductions performed by DART.
+ * Only defined for reduce operations supported by DART.
+ */
+template <class BinaryOperation>
+struct reduce_identity
+: public std::false_type
+{ };
+
+template <typename ValueType>
+struct reduce_identity< dash::plus<ValueType> >
+: public std::is_arithmetic<ValueType> {
+  static ValueType value() { return ValueType(0); }
+};
+
+template <typename ValueType>
+struct reduce_identity< dash::multiply<ValueType> >
+: public std::is_arithmetic<ValueType> {
+  static ValueType value() { return ValueType(1); }
+};
+
+template <typename ValueType>
+struct reduce_identity< dash::min<ValueType> >
+: public std::is_arithmetic<ValueType> {
+  static ValueType value() { return std::numeric_limits<ValueType>::max(); }
+};
+
+template <typename ValueType>
+struct reduce_identity< dash::max<ValueType> >
+: public std::is_arithmetic<ValueType> {
+  static ValueType value() {
+    return std::numeric_limits<ValueType>::lowest();
+  }
+};
+
+template <typename ValueType>
+struct reduce_identity< dash::bit_and<ValueType> >
+: public std::is_integral<ValueType> {
+  static ValueType value() { return ~ValueType(0); }
+};
+
+template <typename ValueType>
+struct reduce_identity< dash::bit_or<ValueType> >
+: public std::is_integral<ValueType> {
+  static ValueType value() { return ValueType(0); }
+};
+
+template <typename ValueType>
+struct reduce_identity< dash::bit_xor<ValueType> >
+: public std::is_integral<ValueType> {
+  static ValueType value() { return ValueType(0); }
+};
+
+/**
+ * Whether values of type \c ValueType can be reduced using
+ * \c BinaryOperation in DART.
+ * Excludes types mapped to DART types of different signedness or to
+ * \c DART_TYPE_BYTE which does not support reduce operations.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+struct is_dart_reducible
+: public std::integral_constant<bool,
+           reduce_identity<BinaryOperation>::value &&
+           dash::dart_datatype<ValueType>::value != DART_TYPE_UNDEFINED &&
+           dash::dart_datatype<ValueType>::value != DART_TYPE_BYTE &&
+           !(dash::dart_datatype<ValueType>::value == DART_TYPE_SHORT &&
+             std::is_unsigned<ValueType>::value) >
+{ };
+
+/**
+ * Message tag of point-to-point communication in reduction trees.
+ */
+constexpr int reduce_tree_tag = 0x7e3d;
+
+/**
+ * All-reduce of local results in DART.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+local_accumulate_t<ValueType> allreduce_local_result(
+  const local_accumulate_t<ValueType> & l_result,
+  BinaryOperation                       binary_op,
+  dash::Team                          & team,
+  std::true_type                        /* DART reduce operation */)
+{
+  typedef reduce_identity<BinaryOperation> identity_t;
+
+  ValueType l_value = l_result.valid ? l_result.value : identity_t::value();
+  int32_t   l_valid = l_result.valid;
+  local_accumulate_t<ValueType> result;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_value,
+      &result.value,
+      1,
+      dash::dart_datatype<ValueType>::value,
+      binary_op.dart_operation(),
+      team.dart_id()),
+    DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_valid,
+      &result.valid,
+      1,
+      DART_TYPE_INT,
+      DART_OP_LOR,
+      team.dart_id()),
+    DART_OK);
+  return result;
+}
+
+/**
+ * All-reduce of local results using a binomial reduction tree of
+ * point-to-point messages followed by a broadcast of the result.
+ * Local results are combined in order of unit ids, so \c binary_op must
+ * be associative but is not required to be commutative.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+local_accumulate_t<ValueType> allreduce_local_result(
+  const local_accumulate_t<ValueType> & l_result,
+  BinaryOperation                       binary_op,
+  dash::Team                          & team,
+  std::false_type                       /* user-defined operation */)
+{
+  typedef local_accumulate_t<ValueType> local_result_t;
+  static_assert(
+    std::is_trivially_copyable<ValueType>::value,
+    "Reduction of values with user-defined operation requires trivially "
+    "copyable value type");
+
+  const size_t nunits = team.size();
+  const size_t myid   = team.myid().id;
+  local_result_t acc  = l_result;
+  // Unit myid holds the combined results of units [myid, myid + mask):
+  for (size_t mask = 1; mask < nunits; mask <<= 1) {
+    if (myid & mask) {
+      DASH_ASSERT_RETURNS(
+        dart_send(
+          &acc,
+          sizeof(local_result_t),
+          DART_TYPE_BYTE,
+          reduce_tree_tag,
+          team.global_id(team_unit_t(myid - mask))),
+        DART_OK);
+      break;
+    }
+    if (myid + mask < nunits) {
+      local_result_t other;
+      DASH_ASSERT_RETURNS(
+        dart_recv(
+          &other,
+          sizeof(local_result_t),
+          DART_TYPE_BYTE,
+          reduce_tree_tag,
+          team.global_id(team_unit_t(myid + mask))),
+        DART_OK);
+      if (other.valid) {
+        acc.value = acc.valid ? binary_op(acc.value, other.value)
+                              : other.value;
+        acc.valid = 1;
+      }
+    }
+  }
+  DASH_ASSERT_RETURNS(
+    dart_bcast(
+      &acc,
+      sizeof(local_result_t),
+      DART_TYPE_BYTE,
+      team_unit_t(0),
+      team.dart_id()),
+    DART_OK);
+  return acc;
+}
+
+/**
+ * All-reduce of local results, uses the reduce operations of DART for
+ * DART data types and a reduction tree for user-defined operations.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+local_accumulate_t<ValueType> allreduce_local_result(
+  const local_accumulate_t<ValueType> & l_result,
+  BinaryOperation                       binary_op,
+  dash::Team                          & team)
+{
+  return allreduce_local_result(
+           l_result, binary_op, team,
+           is_dart_reducible<ValueType, BinaryOperation>());
+}
+
+} // namespace internal
+
+/**
+ * Reduces the values of all units in the team using the given binary
+ * reduce function \c op.
+ * Values are combined in order of unit ids, so \c binary_op must be
+ * associative.
+ *
+ * Collective operation.
+ *
+ * Semantics:
+ *
+ *     result = value[unit 0] (+) value[unit 1] (+) ... (+) value[unit n]
+ *
+ * \return  The reduced value, available at all units.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+ValueType allreduce(
+  const ValueType & value,
+  BinaryOperation   binary_op = BinaryOperation(),
+  dash::Team      & team      = dash::Team::All())
+{
+  internal::local_accumulate_t<ValueType> l_result;
+  l_result.value = value;
+  l_result.valid = 1;
+  return internal::allreduce_local_result(l_result, binary_op, team).value;
+}
+
+/**
+ * Reduces the values in range \c [first, last) using the given binary
+ * reduce function \c op.
+ * Local ranges are reduced in every unit and the local results are
+ * combined using the reduce operations of DART if supported for the value
+ * type and operation, or in a reduction tree otherwise.
+ * Does not allocate global memory.
+ *
+ * Collective operation.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) in[0] (+) in[1] (+) ... (+) in[n]
+ *
+ * \return  The reduced value, available at all units.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType> >
+ValueType reduce(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init,
+  BinaryOperation binary_op = BinaryOperation())
+{
+  auto & team      = in_first.team();
+  auto index_range = dash::local_range(in_first, in_last);
+  auto l_first     = index_range.begin;
+  auto l_last      = index_range.end;
+
+  internal::local_accumulate_t<ValueType> l_result;
+  l_result.valid = (l_first != l_last);
+  if (l_result.valid) {
+    l_result.value = std::accumulate(
+                       l_first + 1, l_last, ValueType(*l_first), binary_op);
+  }
+  auto result = internal::allreduce_local_result(l_result, binary_op, team);
+  return result.valid ? binary_op(init, result.value) : init;
+}
+
+/**
+ * Transforms the values in range \c [first, last) using the unary
+ * function \c unary_op and reduces the results using the binary reduce
+ * function \c binary_op.
+ * The local portion is processed according to the given execution policy,
+ * every thread reduces a contiguous chunk of local elements. Local results
+ * are combined like in \c dash::reduce.
+ *
+ * Collective operation.
+ *
+ * Semantics:
+ *
+ *     acc = init (+) f(in[0]) (+) f(in[1]) (+) ... (+) f(in[n])
+ *
+ * \tparam  ExecutionPolicy  Execution policy of the local portion,
+ *                           \see dash::execution
+ *
+ * \return  The reduced value, available at all units.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  ValueType >::type
+transform_reduce(
+  ExecutionPolicy && policy,
+  GlobInputIt        in_first,
+  GlobInputIt        in_last,
+  ValueType          init,
+  BinaryOperation    binary_op,
+  UnaryOperation     unary_op)
+{
+  auto & team      = in_first.team();
+  auto index_range = dash::local_range(in_first, in_last);
+  auto l_first     = index_range.begin;
+  auto nlocal      = index_range.end - l_first;
+
+  auto l_result = internal::local_transform_reduce<ValueType>(
+                    policy, l_first, nlocal, binary_op, unary_op);
+  auto result   = internal::allreduce_local_result(l_result, binary_op, team);
+  return result.valid ? binary_op(init, result.value) : init;
+}
+
+/**
+ * Transforms the values in range \c [first, last) using the unary
+ * function \c unary_op and reduces the results using the binary reduce
+ * function \c binary_op, using multiple threads if available.
+ *
+ * Collective operation.
+ *
+ * \return  The reduced value, available at all units.
+ *
+ * \see      dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation,
+  class UnaryOperation >
+ValueType transform_reduce(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init,
+  BinaryOperation binary_op,
+  UnaryOperation  unary_op)
+{
+  return dash::transform_reduce(
+           dash::execution::par, in_first, in_last, init,
+           binary_op, unary_op);
+}
+
+/**
+ * Reduces the values in range \c [first, last) to their sum.
+ *
+ * Collective operation.
+ *
+ * \return  The sum of values in the range, available at all units.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobInputIt>
+typename GlobInputIt::value_type reduce(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last)
+{
+  typedef typename GlobInputIt::value_type value_t;
+  return dash::reduce(in_first, in_last, value_t(), dash::plus<value_t>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__REDUCE_H__
@@ -0,0 +1,84 @@
+#ifndef DASH__ALGORITHM__REMOVE_H__
+#define DASH__ALGORITHM__REMOVE_H__
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/internal/Rebalance.h>
+
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Removes all elements satisfying the predicate \c p from the range
+ * \c [first, last) and returns an iterator to the new end of the range.
+ * The order of the remaining elements is preserved, the values of
+ * elements between the new and the old end of the range are unspecified.
+ *
+ * Every unit compacts its local elements, the remaining elements are then
+ * moved to their final position in a single bulk transfer per target
+ * unit, based on the number of remaining elements of preceding units.
+ * The local elements of every unit must be contiguous in the range, like
+ * in \c dash::BLOCKED patterns.
+ *
+ * Collective operation.
+ *
+ * \return  Iterator to the new end of the range, equal at all units.
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    UnaryPredicate >
+GlobIter<ElementType, PatternType> remove_if(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Predicate which returns \c true for elements to be removed
+  UnaryPredicate                       p)
+{
+  auto lrange = dash::internal::contiguous_local_range(first, last);
+
+  std::vector<ElementType> l_kept;
+  l_kept.reserve(lrange.size);
+  for (auto l_it = lrange.lbegin; l_it != lrange.lbegin + lrange.size;
+       ++l_it) {
+    if (!p(*l_it)) {
+      l_kept.push_back(*l_it);
+    }
+  }
+  return dash::internal::rebalance_partitions(
+           first, lrange, l_kept, std::vector<ElementType>());
+}
+
+/**
+ * Removes all elements equal to \c value from the range
+ * \c [first, last) and returns an iterator to the new end of the range.
+ *
+ * Collective operation.
+ *
+ * \see     dash::remove_if
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType >
+GlobIter<ElementType, PatternType> remove(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Value of the elements to remove
+  const ElementType                  & value)
+{
+  return dash::remove_if(
+           first, last,
+           [&value](const ElementType & v) { return v == value; });
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__REMOVE_H__
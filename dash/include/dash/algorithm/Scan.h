@@ -0,0 +1,496 @@
+#ifndef DASH__ALGORITHM__SCAN_H__
+#define DASH__ALGORITHM__SCAN_H__
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/LaunchPolicy.h>
+
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/internal/Collective.h>
+#include <dash/algorithm/internal/ParallelFor.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Exclusive prefix reduction of local results in DART.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+local_accumulate_t<ValueType> exscan_local_result(
+  const local_accumulate_t<ValueType> & l_result,
+  BinaryOperation                       binary_op,
+  dash::Team                          & team,
+  std::true_type                        /* DART reduce operation */)
+{
+  typedef reduce_identity<BinaryOperation> identity_t;
+
+  ValueType l_value = l_result.valid ? l_result.value : identity_t::value();
+  int32_t   l_valid = l_result.valid;
+  local_accumulate_t<ValueType> result;
+  DASH_ASSERT_RETURNS(
+    dart_exscan(
+      &l_value,
+      &result.value,
+      1,
+      dash::dart_datatype<ValueType>::value,
+      binary_op.dart_operation(),
+      team.dart_id()),
+    DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_exscan(
+      &l_valid,
+      &result.valid,
+      1,
+      DART_TYPE_INT,
+      DART_OP_LOR,
+      team.dart_id()),
+    DART_OK);
+  // Result at unit 0 is undefined:
+  if (team.myid().id == 0) {
+    result.valid = 0;
+  }
+  return result;
+}
+
+/**
+ * Exclusive prefix reduction of local results gathered from all units,
+ * local results are combined in order of unit ids.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+local_accumulate_t<ValueType> exscan_local_result(
+  const local_accumulate_t<ValueType> & l_result,
+  BinaryOperation                       binary_op,
+  dash::Team                          & team,
+  std::false_type                       /* user-defined operation */)
+{
+  typedef local_accumulate_t<ValueType> local_result_t;
+  static_assert(
+    std::is_trivially_copyable<ValueType>::value,
+    "Scan with user-defined operation requires trivially copyable "
+    "value type");
+
+  std::vector<local_result_t> l_results(team.size());
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_result,
+      l_results.data(),
+      sizeof(local_result_t),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+  local_result_t result;
+  result.valid = 0;
+  for (size_t u = 0; u < static_cast<size_t>(team.myid().id); ++u) {
+    result = combine_local_results(result, l_results[u], binary_op);
+  }
+  return result;
+}
+
+/**
+ * Exclusive prefix reduction of local results, uses \c dart_exscan for
+ * DART data types and reduce operations.
+ *
+ * \return  The combined local results of all units with smaller id,
+ *          \c valid is \c 0 at unit 0 or if the local ranges of these
+ *          units are empty.
+ */
+template <
+  class ValueType,
+  class BinaryOperation >
+local_accumulate_t<ValueType> exscan_local_result(
+  const local_accumulate_t<ValueType> & l_result,
+  BinaryOperation                       binary_op,
+  dash::Team                          & team)
+{
+  return exscan_local_result(
+           l_result, binary_op, team,
+           is_dart_reducible<ValueType, BinaryOperation>());
+}
+
+/**
+ * Scan of the global range \c [in_first, in_last) to the global range
+ * starting at \c out_first, shared implementation of
+ * \c dash::inclusive_scan and \c dash::exclusive_scan.
+ *
+ * Every unit reduces the chunks of its local range in multiple threads,
+ * the prefix of the local range is obtained from an exclusive prefix
+ * reduction of local results over units. The local range is then scanned
+ * starting from the prefix of every chunk.
+ */
+template <
+  class ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    GlobOutputIt,
+  class    ValueType,
+  class    BinaryOperation >
+GlobOutputIt scan(
+  ExecutionPolicy                        && policy,
+  const GlobIter<ElementType, PatternType> & in_first,
+  const GlobIter<ElementType, PatternType> & in_last,
+  GlobOutputIt                               out_first,
+  BinaryOperation                            binary_op,
+  const local_accumulate_t<ValueType>      & init,
+  bool                                       inclusive)
+{
+  typedef local_accumulate_t<ValueType> local_result_t;
+
+  auto & team       = in_first.team();
+  auto & pattern    = in_first.pattern();
+  auto index_range  = dash::local_index_range(in_first, in_last);
+  auto lbegin_index = index_range.begin;
+  auto lend_index   = index_range.end;
+  size_t nlocal     = lend_index - lbegin_index;
+
+  // Local validation errors, thrown at all units if any unit failed:
+  enum { SCAN_OK = 0, SCAN_OUTPUT_DIST, SCAN_NON_CONTIGUOUS };
+  int l_error = SCAN_OK;
+
+  ElementType *                 l_in  = nullptr;
+  decltype(out_first.local())   l_out = nullptr;
+  if (nlocal > 0) {
+    auto g_first = pattern.global(lbegin_index) - in_first.pos();
+    auto g_last  = pattern.global(lend_index - 1) - in_first.pos();
+    if (g_last - g_first + 1 != static_cast<decltype(g_last)>(nlocal)) {
+      l_error = SCAN_NON_CONTIGUOUS;
+    } else {
+      l_in  = (in_first + g_first).local();
+      l_out = (out_first + g_first).local();
+      if (l_out == nullptr ||
+          (out_first + g_last).local() != l_out + (nlocal - 1)) {
+        l_error = SCAN_OUTPUT_DIST;
+      }
+    }
+  }
+  int error = allreduce_error(l_error, team.dart_id());
+  if (error == SCAN_NON_CONTIGUOUS) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::scan: local elements must be contiguous in the global "
+      "range");
+  } else if (error == SCAN_OUTPUT_DIST) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::scan: output range must be distributed like the input "
+      "range");
+  }
+
+  // Reduce local chunks:
+  int n_chunks = num_parallel_chunks(policy, nlocal);
+  std::vector<local_result_t> chunk_prefix(n_chunks);
+  parallel_for_chunks(
+    n_chunks, nlocal,
+    [&](int chunk, size_t chunk_begin, size_t chunk_end) {
+      chunk_prefix[chunk] = local_transform_reduce<ValueType>(
+                              l_in + chunk_begin, l_in + chunk_end,
+                              binary_op,
+                              [](const ElementType & v) { return v; });
+    });
+  local_result_t l_result = chunk_prefix[0];
+  for (int chunk = 1; chunk < n_chunks; ++chunk) {
+    l_result = combine_local_results(l_result, chunk_prefix[chunk],
+                                     binary_op);
+  }
+
+  // Prefix of the local range from preceding units:
+  local_result_t prefix = combine_local_results(
+                            init,
+                            exscan_local_result(l_result, binary_op, team),
+                            binary_op);
+  // Exclusive prefix of every chunk:
+  for (int chunk = 0; chunk < n_chunks; ++chunk) {
+    local_result_t chunk_result = chunk_prefix[chunk];
+    chunk_prefix[chunk] = prefix;
+    prefix = combine_local_results(prefix, chunk_result, binary_op);
+  }
+
+  // Scan local chunks:
+  parallel_for_chunks(
+    n_chunks, nlocal,
+    [&](int chunk, size_t chunk_begin, size_t chunk_end) {
+      local_result_t acc = chunk_prefix[chunk];
+      for (size_t i = chunk_begin; i < chunk_end; ++i) {
+        ValueType value = l_in[i];
+        if (!inclusive) {
+          l_out[i] = acc.value;
+        }
+        acc.value = acc.valid ? binary_op(acc.value, value) : value;
+        acc.valid = 1;
+        if (inclusive) {
+          l_out[i] = acc.value;
+        }
+      }
+    });
+  return out_first + (in_last - in_first);
+}
+
+} // namespace internal
+
+/**
+ * Computes the inclusive prefix reduction of the values in range
+ * \c [in_first, in_last) using the binary operation \c op, starting with
+ * \c init, and writes the results to the range beginning at \c out_first.
+ * The output range may be equal to the input range.
+ *
+ * Every unit scans its local elements. The local phases are processed
+ * according to the given execution policy, prefixes of local ranges are
+ * obtained from a single exclusive prefix reduction over units.
+ * The global range must be distributed in contiguous blocks in order of
+ * unit ids, like in a one-dimensional \c dash::BLOCKED pattern, and the
+ * output range must be distributed like the input range.
+ *
+ * Collective operation. Does not synchronize the team, results are
+ * visible to other units after the next barrier.
+ *
+ * Semantics:
+ *
+ *     out[i] = init (+) in[0] (+) in[1] (+) ... (+) in[i]
+ *
+ * \tparam      ExecutionPolicy  Execution policy of the local portion,
+ *                               \see dash::execution
+ *
+ * \return      Output iterator to the element past the last element
+ *              written.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    GlobOutputIt,
+  class    BinaryOperation,
+  class    ValueType >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  GlobOutputIt >::type
+inclusive_scan(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & in_first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & in_last,
+  /// Iterator to the initial position of the output range
+  GlobOutputIt                               out_first,
+  /// Associative binary operation
+  BinaryOperation                            binary_op,
+  /// Initial value of the prefix reduction
+  ValueType                                  init)
+{
+  internal::local_accumulate_t<ValueType> l_init;
+  l_init.value = init;
+  l_init.valid = 1;
+  return internal::scan(policy, in_first, in_last, out_first, binary_op,
+                        l_init, true);
+}
+
+/**
+ * Computes the inclusive prefix reduction of the values in range
+ * \c [in_first, in_last) using the binary operation \c op and writes the
+ * results to the range beginning at \c out_first.
+ *
+ * Semantics:
+ *
+ *     out[i] = in[0] (+) in[1] (+) ... (+) in[i]
+ *
+ * \see         dash::inclusive_scan
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    GlobOutputIt,
+  class    BinaryOperation = dash::plus<ElementType> >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  GlobOutputIt >::type
+inclusive_scan(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & in_first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & in_last,
+  /// Iterator to the initial position of the output range
+  GlobOutputIt                               out_first,
+  /// Associative binary operation
+  BinaryOperation                            binary_op = BinaryOperation())
+{
+  internal::local_accumulate_t<ElementType> l_init;
+  l_init.valid = 0;
+  return internal::scan(policy, in_first, in_last, out_first, binary_op,
+                        l_init, true);
+}
+
+/**
+ * Computes the inclusive prefix reduction of the values in range
+ * \c [in_first, in_last) using the binary operation \c op, starting with
+ * \c init, using multiple threads if available.
+ *
+ * \see         dash::inclusive_scan
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    GlobOutputIt,
+  class    BinaryOperation,
+  class    ValueType >
+GlobOutputIt inclusive_scan(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & in_first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & in_last,
+  /// Iterator to the initial position of the output range
+  GlobOutputIt                               out_first,
+  /// Associative binary operation
+  BinaryOperation                            binary_op,
+  /// Initial value of the prefix reduction
+  ValueType                                  init)
+{
+  return dash::inclusive_scan(dash::execution::par, in_first, in_last,
+                              out_first, binary_op, init);
+}
+
+/**
+ * Computes the inclusive prefix reduction of the values in range
+ * \c [in_first, in_last) using the binary operation \c op, using multiple
+ * threads if available.
+ *
+ * \see         dash::inclusive_scan
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    GlobOutputIt,
+  class    BinaryOperation = dash::plus<ElementType> >
+GlobOutputIt inclusive_scan(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & in_first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & in_last,
+  /// Iterator to the initial position of the output range
+  GlobOutputIt                               out_first,
+  /// Associative binary operation
+  BinaryOperation                            binary_op = BinaryOperation())
+{
+  return dash::inclusive_scan(dash::execution::par, in_first, in_last,
+                              out_first, binary_op);
+}
+
+/**
+ * Computes the exclusive prefix reduction of the values in range
+ * \c [in_first, in_last) using the binary operation \c op, starting with
+ * \c init, and writes the results to the range beginning at \c out_first.
+ * The i-th output element does not include the i-th input element.
+ * The output range may be equal to the input range.
+ *
+ * Same requirements on the distribution of the ranges as
+ * \c dash::inclusive_scan.
+ *
+ * Collective operation. Does not synchronize the team.
+ *
+ * Semantics:
+ *
+ *     out[i] = init (+) in[0] (+) in[1] (+) ... (+) in[i-1]
+ *
+ * \tparam      ExecutionPolicy  Execution policy of the local portion,
+ *                               \see dash::execution
+ *
+ * \return      Output iterator to the element past the last element
+ *              written.
+ *
+ * \see         dash::inclusive_scan
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class    ExecutionPolicy,
+  typename ElementType,
+  class    PatternType,
+  class    GlobOutputIt,
+  class    ValueType,
+  class    BinaryOperation = dash::plus<ValueType> >
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  GlobOutputIt >::type
+exclusive_scan(
+  /// Execution policy of the local portion of the algorithm
+  ExecutionPolicy                         && policy,
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & in_first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & in_last,
+  /// Iterator to the initial position of the output range
+  GlobOutputIt                               out_first,
+  /// Initial value of the prefix reduction
+  ValueType                                  init,
+  /// Associative binary operation
+  BinaryOperation                            binary_op = BinaryOperation())
+{
+  internal::local_accumulate_t<ValueType> l_init;
+  l_init.value = init;
+  l_init.valid = 1;
+  return internal::scan(policy, in_first, in_last, out_first, binary_op,
+                        l_init, false);
+}
+
+/**
+ * Computes the exclusive prefix reduction of the values in range
+ * \c [in_first, in_last) using the binary operation \c op, starting with
+ * \c init, using multiple threads if available.
+ *
+ * \see         dash::exclusive_scan
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    GlobOutputIt,
+  class    ValueType,
+  class    BinaryOperation = dash::plus<ValueType> >
+GlobOutputIt exclusive_scan(
+  /// Iterator to the initial position in the sequence
+  const GlobIter<ElementType, PatternType> & in_first,
+  /// Iterator to the final position in the sequence
+  const GlobIter<ElementType, PatternType> & in_last,
+  /// Iterator to the initial position of the output range
+  GlobOutputIt                               out_first,
+  /// Initial value of the prefix reduction
+  ValueType                                  init,
+  /// Associative binary operation
+  BinaryOperation                            binary_op = BinaryOperation())
+{
+  return dash::exclusive_scan(dash::execution::par, in_first, in_last,
+                              out_first, init, binary_op);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SCAN_H__
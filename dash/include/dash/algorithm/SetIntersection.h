@@ -0,0 +1,236 @@
+#ifndef DASH__ALGORITHM__SET_INTERSECTION_H__
+#define DASH__ALGORITHM__SET_INTERSECTION_H__
+
+#include <dash/Range.h>
+#include <dash/Distribution.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/internal/Rebalance.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Intersects the local elements of the sorted range \c [first_1, last_1)
+ * with the matching elements of the sorted range \c [first_2, last_2).
+ *
+ * Every unit merges its local block of the first range with the segment
+ * of the second range in the value range of the block, located by binary
+ * search. Elements of the second range equivalent to the first element of
+ * the block are skipped as often as the element occurs in the blocks of
+ * preceding units, so every element is matched at most once like in
+ * \c std::set_intersection.
+ */
+template <
+  typename ElementType,
+  class    PatternType1,
+  class    PatternType2,
+  class    Compare >
+std::vector<ElementType> local_set_intersection(
+  const GlobIter<ElementType, PatternType1>                & first_1,
+  const contiguous_local_range_t<
+          ElementType, typename PatternType1::index_type > & lrange_1,
+  const GlobIter<ElementType, PatternType2>                & first_2,
+  const GlobIter<ElementType, PatternType2>                & last_2,
+  Compare                                                    comp)
+{
+  std::vector<ElementType> l_result;
+  if (lrange_1.size == 0 || first_2 == last_2) {
+    return l_result;
+  }
+  const ElementType * l_first = lrange_1.lbegin;
+  const ElementType * l_last  = lrange_1.lbegin + lrange_1.size;
+  const ElementType   v_front = *l_first;
+  const ElementType   v_back  = *(l_last - 1);
+
+  // Occurrences of the first local value in preceding blocks:
+  auto g_first_1   = first_1 + lrange_1.offset;
+  auto n_preceding = g_first_1 -
+                     std::lower_bound(first_1, g_first_1, v_front, comp);
+  // Segment of the second range in the value range of the local block:
+  auto seg_first   = std::lower_bound(first_2, last_2, v_front, comp);
+  auto seg_skipped = std::upper_bound(seg_first, last_2, v_front, comp);
+  seg_first        = (seg_skipped - seg_first > n_preceding)
+                     ? seg_first + n_preceding
+                     : seg_skipped;
+  auto seg_last    = std::upper_bound(seg_first, last_2, v_back, comp);
+  if (seg_first == seg_last) {
+    return l_result;
+  }
+
+  std::vector<ElementType> segment(seg_last - seg_first);
+  dash::copy(seg_first, seg_last, segment.data());
+  std::set_intersection(l_first, l_last,
+                        segment.begin(), segment.end(),
+                        std::back_inserter(l_result), comp);
+  return l_result;
+}
+
+/**
+ * Writes the local results of all units to the global range starting at
+ * \c out_first in order of the units' local blocks in the first input
+ * range.
+ *
+ * \return  Iterator past the last element written.
+ */
+template <
+  typename ElementType,
+  class    IndexType,
+  class    GlobOutputIt >
+GlobOutputIt put_set_results(
+  const contiguous_local_range_t<ElementType, IndexType> & lrange_1,
+  const std::vector<ElementType>                         & l_result,
+  const GlobOutputIt                                     & out_first,
+  dash::Team                                             & team)
+{
+  local_block_counts_t l_counts;
+  l_counts.offset  = lrange_1.offset;
+  l_counts.size    = lrange_1.size;
+  l_counts.nfirst  = l_result.size();
+  l_counts.nsecond = 0;
+  auto counts = allgather_block_counts(l_counts, team);
+
+  int64_t n_total    = 0;
+  int64_t out_offset = 0;
+  for (const auto & block : counts) {
+    n_total += block.nfirst;
+    if (block.size > 0 && block.offset < lrange_1.offset) {
+      out_offset += block.nfirst;
+    }
+  }
+  auto out_last = out_first + n_total;
+
+  // Local blocks of the output range:
+  auto lrange_out = contiguous_local_range(out_first, out_last);
+  l_counts.offset = lrange_out.offset;
+  l_counts.size   = lrange_out.size;
+  auto out_blocks = allgather_block_counts(l_counts, team);
+
+  put_to_blocks(l_result.data(), l_result.size(), out_offset,
+                out_first, out_blocks);
+  team.barrier();
+  return out_last;
+}
+
+} // namespace internal
+
+/**
+ * Constructs the sorted intersection of the sorted ranges
+ * \c [first_1, last_1) and \c [first_2, last_2) in the range beginning
+ * at \c out_first, which must be large enough to hold the result.
+ * Like in \c std::set_intersection, an element occurring \c m times in
+ * the first and \c n times in the second range is contained
+ * \c min(m, n) times in the result.
+ *
+ * Every unit merges its local block of the first range with the
+ * corresponding segment of the second range, the local results are then
+ * written to the output range in bulk transfers based on the result sizes
+ * of preceding units.
+ * The local elements of every unit must be contiguous in the first range
+ * and the output range, like in \c dash::BLOCKED patterns.
+ *
+ * Collective operation.
+ *
+ * \return  Iterator past the last element written, equal at all units.
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType1,
+  class    PatternType2,
+  class    GlobOutputIt,
+  class    Compare = std::less<ElementType> >
+typename std::enable_if<
+  !dash::is_range<GlobOutputIt>::value,
+  GlobOutputIt >::type
+set_intersection(
+  /// Iterator to the initial position in the first sorted range
+  GlobIter<ElementType, PatternType1> first_1,
+  /// Iterator to the final position in the first sorted range
+  GlobIter<ElementType, PatternType1> last_1,
+  /// Iterator to the initial position in the second sorted range
+  GlobIter<ElementType, PatternType2> first_2,
+  /// Iterator to the final position in the second sorted range
+  GlobIter<ElementType, PatternType2> last_2,
+  /// Iterator to the initial position of the output range
+  GlobOutputIt                        out_first,
+  /// Strict weak ordering of the ranges' elements
+  Compare                             comp = Compare())
+{
+  auto & team     = first_1.pattern().team();
+  auto   lrange_1 = dash::internal::contiguous_local_range(first_1, last_1);
+  auto   l_result = dash::internal::local_set_intersection(
+                      first_1, lrange_1, first_2, last_2, comp);
+  return dash::internal::put_set_results(
+           lrange_1, l_result, out_first, team);
+}
+
+/**
+ * Constructs the sorted intersection of the sorted ranges
+ * \c [first_1, last_1) and \c [first_2, last_2) in the array \c out.
+ * If \c out has not been allocated yet, it is allocated with the size of
+ * the intersection in a \c dash::BLOCKED distribution. Otherwise, the
+ * result is stored in the first elements of \c out.
+ *
+ * Collective operation.
+ *
+ * \return  Iterator past the last element written, equal at all units.
+ *
+ * \see     dash::set_intersection
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType1,
+  class    PatternType2,
+  class    ContainerType,
+  class    Compare = std::less<ElementType> >
+typename std::enable_if<
+  dash::is_range<ContainerType>::value,
+  typename ContainerType::iterator >::type
+set_intersection(
+  /// Iterator to the initial position in the first sorted range
+  GlobIter<ElementType, PatternType1> first_1,
+  /// Iterator to the final position in the first sorted range
+  GlobIter<ElementType, PatternType1> last_1,
+  /// Iterator to the initial position in the second sorted range
+  GlobIter<ElementType, PatternType2> first_2,
+  /// Iterator to the final position in the second sorted range
+  GlobIter<ElementType, PatternType2> last_2,
+  /// Array storing the result
+  ContainerType                     & out,
+  /// Strict weak ordering of the ranges' elements
+  Compare                             comp = Compare())
+{
+  auto & team     = first_1.pattern().team();
+  auto   lrange_1 = dash::internal::contiguous_local_range(first_1, last_1);
+  auto   l_result = dash::internal::local_set_intersection(
+                      first_1, lrange_1, first_2, last_2, comp);
+  if (out.size() == 0) {
+    int64_t n_total = dash::allreduce(
+                        static_cast<int64_t>(l_result.size()),
+                        dash::plus<int64_t>(), team);
+    if (n_total == 0) {
+      return out.begin();
+    }
+    out.allocate(n_total, dash::BLOCKED, team);
+  }
+  return dash::internal::put_set_results(
+           lrange_1, l_result, out.begin(), team);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SET_INTERSECTION_H__
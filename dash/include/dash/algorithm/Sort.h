@@ -0,0 +1,483 @@
+#ifndef DASH__ALGORITHM__SORT_H__
+#define DASH__ALGORITHM__SORT_H__
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Copy.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Whether elements of type \c ValueType are sorted by radix sort if no
+ * comparison function is specified.
+ */
+template <typename ValueType>
+struct is_radix_sortable
+: public std::integral_constant<bool,
+           std::is_integral<ValueType>::value &&
+           !std::is_same<ValueType, bool>::value >
+{ };
+
+/**
+ * Sorts the range \c [first, last) of integral values in ascending order
+ * using least significant digit radix sort with 8-bit digits.
+ *
+ * \complexity  O(n * sizeof(ValueType)) with n elements in the range
+ */
+template <typename ValueType>
+void radix_sort(
+  ValueType * first,
+  ValueType * last)
+{
+  typedef typename std::make_unsigned<ValueType>::type key_type;
+
+  const size_t   nelem    = last - first;
+  const int      nbits    = sizeof(ValueType) * 8;
+  // Flip the sign bit of signed keys so negative values precede positive
+  // values in the order of unsigned keys:
+  const key_type sign_bit = std::is_signed<ValueType>::value
+                            ? static_cast<key_type>(key_type(1) << (nbits-1))
+                            : key_type(0);
+  if (nelem < 2) {
+    return;
+  }
+
+  std::vector<ValueType> buffer(nelem);
+  ValueType * src = first;
+  ValueType * dst = buffer.data();
+  for (int shift = 0; shift < nbits; shift += 8) {
+    size_t count[257] = { 0 };
+    for (size_t i = 0; i < nelem; ++i) {
+      key_type key = static_cast<key_type>(src[i]) ^ sign_bit;
+      ++count[((key >> shift) & 0xff) + 1];
+    }
+    // Skip digits that are equal in all keys:
+    if (std::find(count + 1, count + 257, nelem) != count + 257) {
+      continue;
+    }
+    for (int d = 0; d < 256; ++d) {
+      count[d + 1] += count[d];
+    }
+    for (size_t i = 0; i < nelem; ++i) {
+      key_type key = static_cast<key_type>(src[i]) ^ sign_bit;
+      dst[count[(key >> shift) & 0xff]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+  if (src != first) {
+    std::copy(src, src + nelem, first);
+  }
+}
+
+/**
+ * Merges consecutive sorted runs in the range starting at \c first into
+ * a single sorted run. Run \c r is located in the range
+ * \c [first + run_offsets[r], first + run_offsets[r+1]).
+ */
+template <
+  typename ValueType,
+  class    Compare >
+void merge_sorted_runs(
+  ValueType           * first,
+  std::vector<size_t>   run_offsets,
+  Compare               comp,
+  int                   nthreads = 1)
+{
+  // Merge pairs of neighboring runs until a single run is left:
+  while (run_offsets.size() > 2) {
+    auto nruns  = static_cast<int>(run_offsets.size() - 1);
+    auto npairs = nruns / 2;
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+#endif
+    for (int p = 0; p < npairs; ++p) {
+      std::inplace_merge(first + run_offsets[2 * p],
+                         first + run_offsets[2 * p + 1],
+                         first + run_offsets[2 * p + 2],
+                         comp);
+    }
+    std::vector<size_t> merged_offsets;
+    merged_offsets.reserve(npairs + 2);
+    for (int r = 0; r <= nruns; r += 2) {
+      merged_offsets.push_back(run_offsets[r]);
+    }
+    if (nruns % 2 != 0) {
+      merged_offsets.push_back(run_offsets[nruns]);
+    }
+    run_offsets.swap(merged_offsets);
+  }
+  DASH_LOG_TRACE("dash::internal::merge_sorted_runs", "threads:", nthreads);
+}
+
+/**
+ * Sorts the local range \c [first, last). If multiple threads are
+ * available to the calling unit, the range is split into one chunk per
+ * thread, chunks are sorted in parallel using \c sort_chunk and finally
+ * merged.
+ */
+template <
+  typename ValueType,
+  class    Compare,
+  class    ChunkSort >
+void sort_local(
+  ValueType * first,
+  ValueType * last,
+  Compare     comp,
+  ChunkSort   sort_chunk)
+{
+  size_t nelem    = last - first;
+  int    nthreads = 1;
+#ifdef DASH_ENABLE_OPENMP
+  // Sorting very small chunks in parallel does not pay off:
+  const size_t min_chunk_size = 1 << 14;
+  dash::util::UnitLocality uloc;
+  nthreads = std::max<int>(
+               1, std::min<size_t>(uloc.num_domain_threads(),
+                                   nelem / min_chunk_size));
+#endif
+  DASH_LOG_DEBUG("dash::internal::sort_local", "nelem:", nelem,
+                 "threads:", nthreads);
+  if (nthreads < 2) {
+    sort_chunk(first, last);
+    return;
+  }
+  std::vector<size_t> chunk_offsets(nthreads + 1);
+  for (int t = 0; t <= nthreads; ++t) {
+    chunk_offsets[t] = (nelem * t) / nthreads;
+  }
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads)
+#endif
+  for (int t = 0; t < nthreads; ++t) {
+    sort_chunk(first + chunk_offsets[t], first + chunk_offsets[t + 1]);
+  }
+  merge_sorted_runs(first, chunk_offsets, comp, nthreads);
+}
+
+/**
+ * Implementation of \c dash::sort, sorts the global range
+ * \c [first, last) by parallel sorting by regular sampling:
+ *
+ * 1. Every unit sorts its local elements in the range using
+ *    \c sort_chunk.
+ * 2. Every unit picks regularly spaced samples from its sorted local
+ *    elements. From the gathered samples, all units select identical
+ *    splitters that partition the values into one bucket per unit.
+ * 3. Every unit fetches the elements in its bucket from all units in
+ *    an all-to-all exchange and merges them.
+ * 4. Buckets are written to their final position in the global range.
+ */
+template <
+  class GlobRandomIt,
+  class Compare,
+  class ChunkSort >
+void sort_impl(
+  GlobRandomIt first,
+  GlobRandomIt last,
+  Compare      comp,
+  ChunkSort    sort_chunk)
+{
+  typedef typename GlobRandomIt::value_type value_type;
+
+  auto & pattern = first.pattern();
+  auto & team    = pattern.team();
+  size_t myid    = team.myid().id;
+  size_t nunits  = team.size();
+
+  if (team == dash::Team::Null()) {
+    DASH_LOG_DEBUG("dash::sort", "Sorting on dash::Team::Null()");
+    return;
+  }
+  if (first == last) {
+    DASH_LOG_DEBUG("dash::sort", "empty range");
+    return;
+  }
+
+  auto         l_range = dash::local_range(first, last);
+  value_type * l_first = l_range.begin;
+  value_type * l_last  = l_range.end;
+  size_t       nlocal  = l_last - l_first;
+  DASH_LOG_DEBUG("dash::sort", "local elements:", nlocal);
+
+  // Sort local elements:
+  dash::internal::sort_local(l_first, l_last, comp, sort_chunk);
+
+  if (nunits == 1) {
+    return;
+  }
+
+  // Regular sampling of local elements, units without local elements in
+  // the range do not contribute samples:
+  size_t                  nsamples = nunits - 1;
+  std::vector<value_type> samples(nsamples);
+  size_t                  nvalid   = (nlocal > 0) ? nsamples : 0;
+  for (size_t s = 0; s < nvalid; ++s) {
+    samples[s] = l_first[((s + 1) * nlocal) / nunits];
+  }
+  std::vector<value_type> all_samples(nsamples * nunits);
+  std::vector<size_t>     all_nvalid(nunits);
+  dart_storage_t ds_samples = dash::dart_storage<value_type>(nsamples);
+  dart_storage_t ds_size    = dash::dart_storage<size_t>(1);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(samples.data(), all_samples.data(),
+                   ds_samples.nelem, ds_samples.dtype, team.dart_id()),
+    DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(&nvalid, all_nvalid.data(),
+                   ds_size.nelem, ds_size.dtype, team.dart_id()),
+    DART_OK);
+
+  // Select splitters from the sorted samples:
+  std::vector<value_type> valid_samples;
+  for (size_t u = 0; u < nunits; ++u) {
+    valid_samples.insert(valid_samples.end(),
+                         all_samples.begin() + u * nsamples,
+                         all_samples.begin() + u * nsamples + all_nvalid[u]);
+  }
+  std::sort(valid_samples.begin(), valid_samples.end(), comp);
+  std::vector<value_type> splitters;
+  if (!valid_samples.empty()) {
+    for (size_t s = 0; s < nsamples; ++s) {
+      splitters.push_back(
+        valid_samples[((s + 1) * valid_samples.size()) / nunits]);
+    }
+  }
+
+  // Offsets of buckets in local elements, bucket b contains the elements
+  // in range [bucket_offsets[b], bucket_offsets[b+1]). The offset of the
+  // local elements in the unit's local memory is appended for remote
+  // access to local elements:
+  std::vector<size_t> bucket_offsets(nunits + 2, 0);
+  for (size_t b = 0; b < splitters.size(); ++b) {
+    bucket_offsets[b + 1] = std::upper_bound(
+                              l_first, l_last, splitters[b], comp)
+                            - l_first;
+  }
+  bucket_offsets[nunits]     = nlocal;
+  bucket_offsets[nunits + 1] = (nlocal > 0)
+                               ? l_first - first.globmem().lbegin()
+                               : 0;
+  std::vector<size_t> all_bucket_offsets((nunits + 2) * nunits);
+  dart_storage_t ds_offsets = dash::dart_storage<size_t>(nunits + 2);
+  DASH_ASSERT_RETURNS(
+    dart_allgather(bucket_offsets.data(), all_bucket_offsets.data(),
+                   ds_offsets.nelem, ds_offsets.dtype, team.dart_id()),
+    DART_OK);
+  auto bucket_offset = [&](size_t unit, size_t bucket) {
+    return all_bucket_offsets[unit * (nunits + 2) + bucket];
+  };
+
+  // Fetch elements in the bucket of the calling unit from all units:
+  std::vector<size_t> run_offsets(nunits + 1, 0);
+  for (size_t u = 0; u < nunits; ++u) {
+    run_offsets[u + 1] = run_offsets[u] +
+                         bucket_offset(u, myid + 1) - bucket_offset(u, myid);
+  }
+  size_t                     nbucket = run_offsets[nunits];
+  std::vector<value_type>    bucket(nbucket);
+  std::vector<dart_handle_t> handles;
+  DASH_LOG_DEBUG("dash::sort", "bucket size:", nbucket);
+  for (size_t u = 0; u < nunits; ++u) {
+    size_t nrun = run_offsets[u + 1] - run_offsets[u];
+    if (nrun == 0) {
+      continue;
+    }
+    size_t l_offs = bucket_offset(u, nunits + 1) + bucket_offset(u, myid);
+    if (u == myid) {
+      std::copy(first.globmem().lbegin() + l_offs,
+                first.globmem().lbegin() + l_offs + nrun,
+                bucket.data() + run_offsets[u]);
+      continue;
+    }
+    dart_handle_t  handle;
+    dart_storage_t ds = dash::dart_storage<value_type>(nrun);
+    DASH_ASSERT_RETURNS(
+      dart_get_handle(
+        bucket.data() + run_offsets[u],
+        first.globmem().at(team_unit_t(u), l_offs).dart_gptr(),
+        ds.nelem, ds.dtype, &handle),
+      DART_OK);
+    handles.push_back(handle);
+  }
+  if (!handles.empty()) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall(handles.data(), handles.size()),
+      DART_OK);
+  }
+  dash::internal::merge_sorted_runs(bucket.data(), run_offsets, comp);
+
+  // All units have fetched their buckets, local elements may be
+  // overwritten:
+  team.barrier();
+
+  // Write bucket to its final position in the range:
+  size_t g_offset = 0;
+  for (size_t b = 0; b < myid; ++b) {
+    for (size_t u = 0; u < nunits; ++u) {
+      g_offset += bucket_offset(u, b + 1) - bucket_offset(u, b);
+    }
+  }
+  handles.clear();
+  size_t nwritten = 0;
+  while (nwritten < nbucket) {
+    auto   out_it = first + (g_offset + nwritten);
+    size_t nrun   = dash::internal::contiguous_run_length(
+                      pattern, out_it.pos(), nbucket - nwritten);
+    if (out_it.is_local()) {
+      std::copy(bucket.data() + nwritten,
+                bucket.data() + nwritten + nrun,
+                out_it.local());
+    } else {
+      dart_handle_t  handle;
+      dart_storage_t ds = dash::dart_storage<value_type>(nrun);
+      DASH_ASSERT_RETURNS(
+        dart_put_handle(
+          out_it.dart_gptr(),
+          bucket.data() + nwritten,
+          ds.nelem, ds.dtype, &handle),
+        DART_OK);
+      handles.push_back(handle);
+    }
+    nwritten += nrun;
+  }
+  if (!handles.empty()) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall(handles.data(), handles.size()),
+      DART_OK);
+  }
+  team.barrier();
+}
+
+} // namespace internal
+
+/**
+ * Sorts the elements in the global range \c [first, last) in ascending
+ * order according to the comparison function \c comp.
+ *
+ * Being a collective operation, \c dash::sort must be called by all units
+ * in the team of the range.
+ * Elements are sorted by parallel sorting by regular sampling: units sort
+ * their local elements, agree on splitters selected from samples of the
+ * local elements and exchange elements such that every unit merges the
+ * elements between two splitters, which are finally written back to the
+ * range. Local sorting is parallelized if multiple threads are available
+ * to the calling unit.
+ *
+ * The sort is not stable. Splitters are selected from a sample of size
+ * \c p(p-1) for \c p units in the team, every unit merges at most about
+ * \c 2n/p elements for \c n elements in the range unless the range
+ * contains many duplicate values.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Array<double> array(nelem);
+ *   // ...
+ *   dash::sort(array.begin(), array.end(),
+ *              [](double a, double b) { return a > b; });
+ * \endcode
+ *
+ * \tparam      GlobRandomIt  Global iterator type of the range
+ * \tparam      Compare       Comparison function object type, strict weak
+ *                            ordering of the elements
+ *
+ * \complexity  O((n/p) log(n/p)) local computation and O(n/p) elements
+ *              communicated per unit
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class GlobRandomIt,
+  class Compare >
+void sort(
+  /// Iterator to the initial position in the sequence
+  GlobRandomIt first,
+  /// Iterator to the final position in the sequence
+  GlobRandomIt last,
+  /// Comparison function
+  Compare      comp)
+{
+  typedef typename GlobRandomIt::value_type value_type;
+  dash::internal::sort_impl(
+    first, last, comp,
+    [comp](value_type * l_first, value_type * l_last) {
+      std::sort(l_first, l_last, comp);
+    });
+}
+
+/**
+ * Sorts the elements in the global range \c [first, last) in ascending
+ * order.
+ *
+ * Local elements of integral type are sorted by radix sort, elements of
+ * other types are compared using \c operator<.
+ *
+ * \see dash::sort(GlobRandomIt, GlobRandomIt, Compare)
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <class GlobRandomIt>
+typename std::enable_if<
+  dash::internal::is_radix_sortable<
+    typename GlobRandomIt::value_type >::value,
+  void >::type
+sort(
+  /// Iterator to the initial position in the sequence
+  GlobRandomIt first,
+  /// Iterator to the final position in the sequence
+  GlobRandomIt last)
+{
+  typedef typename GlobRandomIt::value_type value_type;
+  dash::internal::sort_impl(
+    first, last, std::less<value_type>(),
+    [](value_type * l_first, value_type * l_last) {
+      dash::internal::radix_sort(l_first, l_last);
+    });
+}
+
+/**
+ * Sorts the elements in the global range \c [first, last) in ascending
+ * order.
+ *
+ * \see dash::sort(GlobRandomIt, GlobRandomIt, Compare)
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <class GlobRandomIt>
+typename std::enable_if<
+  !dash::internal::is_radix_sortable<
+    typename GlobRandomIt::value_type >::value,
+  void >::type
+sort(
+  /// Iterator to the initial position in the sequence
+  GlobRandomIt first,
+  /// Iterator to the final position in the sequence
+  GlobRandomIt last)
+{
+  typedef typename GlobRandomIt::value_type value_type;
+  dash::sort(first, last, std::less<value_type>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SORT_H__
@@ -0,0 +1,181 @@
+#ifndef DASH__ALGORITHM__SYNC_H__
+#define DASH__ALGORITHM__SYNC_H__
+
+#include <dash/Team.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Completion handle of a collective algorithm variant that does not
+ * synchronize its team before returning, like \c dash::for_each_nosync.
+ *
+ * The results of the algorithm are visible to all units of the team
+ * after the token has been synchronized using \c wait() or
+ * \c dash::sync. As synchronization is collective, all units must
+ * synchronize the token. Tokens can be moved but not copied so every
+ * pending synchronization is performed exactly once.
+ * A token that is still pending when it is destroyed or assigned to
+ * synchronizes its team first, so pending synchronization is never
+ * dropped.
+ *
+ * \see  dash::sync
+ *
+ * \ingroup  DashAlgorithms
+ */
+class SyncToken
+{
+public:
+  SyncToken() = default;
+
+  /**
+   * Creates a token of a pending synchronization of the given team.
+   */
+  explicit SyncToken(dash::Team & team)
+  : _team(&team)
+  { }
+
+  SyncToken(const SyncToken & other)             = delete;
+  SyncToken & operator=(const SyncToken & other) = delete;
+
+  SyncToken(SyncToken && other)
+  : _team(other._team)
+  {
+    other._team = nullptr;
+  }
+
+  /**
+   * Synchronizes the pending synchronization of this token before taking
+   * over the pending synchronization of \c other.
+   *
+   * Collective operation if this token is pending.
+   */
+  SyncToken & operator=(SyncToken && other)
+  {
+    if (this != &other) {
+      wait();
+      _team       = other._team;
+      other._team = nullptr;
+    }
+    return *this;
+  }
+
+  /**
+   * Synchronizes the token's team if the synchronization is pending.
+   *
+   * Collective operation if the token is pending.
+   */
+  ~SyncToken()
+  {
+    if (_team != nullptr && !_team->is_null()) {
+      dart_barrier(_team->dart_id());
+    }
+  }
+
+  /**
+   * Whether the synchronization of the token is pending.
+   */
+  bool pending() const
+  {
+    return _team != nullptr;
+  }
+
+  /**
+   * Team to be synchronized, \c nullptr if no synchronization is pending.
+   */
+  dash::Team * team() const
+  {
+    return _team;
+  }
+
+  /**
+   * Synchronizes the token's team if the synchronization is pending.
+   *
+   * Collective operation.
+   */
+  void wait()
+  {
+    if (_team != nullptr) {
+      _team->barrier();
+      _team = nullptr;
+    }
+  }
+
+  /**
+   * Marks the synchronization as completed without synchronizing the team,
+   * returns the team that had to be synchronized.
+   */
+  dash::Team * release()
+  {
+    dash::Team * team = _team;
+    _team = nullptr;
+    return team;
+  }
+
+private:
+  dash::Team * _team = nullptr;
+
+}; // class SyncToken
+
+namespace internal {
+
+inline void release_sync_tokens(
+  std::vector<dash::Team *> & /* teams */)
+{ }
+
+/**
+ * Releases the given tokens and collects the distinct teams with pending
+ * synchronization, in order of their first occurrence.
+ */
+template <class... Tokens>
+void release_sync_tokens(
+  std::vector<dash::Team *> & teams,
+  dash::SyncToken           & token,
+  Tokens                 && ... tokens)
+{
+  dash::Team * team = token.release();
+  if (team != nullptr &&
+      std::find(teams.begin(), teams.end(), team) == teams.end()) {
+    teams.push_back(team);
+  }
+  release_sync_tokens(teams, tokens...);
+}
+
+} // namespace internal
+
+/**
+ * Synchronizes the pending tokens of algorithm variants that skipped
+ * their final synchronization, using a single barrier for all tokens
+ * of the same team.
+ * Allows to chain several algorithms with a single synchronization:
+ *
+ * \code
+ *   auto t_fill = dash::fill_nosync(a.begin(), a.end(), 0);
+ *   auto t_each = dash::for_each_nosync(b.begin(), b.end(), f);
+ *   dash::sync(t_fill, t_each);
+ * \endcode
+ *
+ * Collective operation, all units must pass the same tokens in the same
+ * order.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class... Tokens>
+void sync(Tokens && ... tokens)
+{
+  std::vector<dash::Team *> teams;
+  internal::release_sync_tokens(teams, tokens...);
+  for (auto team : teams) {
+    team->barrier();
+  }
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SYNC_H__
@@ -3,10 +3,13 @@
 
 #include <dash/GlobRef.h>
 #include <dash/GlobAsyncRef.h>
+#include <dash/LaunchPolicy.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 #include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/Sync.h>
+#include <dash/algorithm/internal/ParallelFor.h>
 
 #include <dash/iterator/GlobIter.h>
 
@@ -16,10 +19,7 @@
 #include <dash/dart/if/dart_communication.h>
 
 #include <iterator>
-
-#ifdef DASH_ENABLE_OPENMP
-#include <omp.h>
-#endif
+#include <type_traits>
 
 namespace dash {
 
@@ -171,7 +171,9 @@ GlobOutputIt transform(
  * Transform operation on ranges with identical distribution and start
  * offset.
  * In this case, no communication is needed as all output values can be
- * obtained from input values in local memory:
+ * obtained from input values in local memory.
+ * The local elements are processed according to the given execution
+ * policy.
  *
  * \note
  * This function does not execute the transformation as atomic operation
@@ -188,16 +190,22 @@ GlobOutputIt transform(
  */
 template<
   typename ValueType,
+  class ExecutionPolicy,
   class InputAIt,
   class InputBIt,
   class OutputIt,
   class BinaryOperation >
-OutputIt transform_local(
-  InputAIt        in_a_first,
-  InputAIt        in_a_last,
-  InputBIt        in_b_first,
-  OutputIt        out_first,
-  BinaryOperation binary_op)
+typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type >::value,
+  OutputIt >::type
+transform_local(
+  ExecutionPolicy && policy,
+  InputAIt           in_a_first,
+  InputAIt           in_a_last,
+  InputBIt           in_b_first,
+  OutputIt           out_first,
+  BinaryOperation    binary_op)
 {
   DASH_LOG_DEBUG("dash::transform_local()");
   DASH_ASSERT_MSG(in_a_first.pattern() == in_b_first.pattern(),
@@ -222,37 +230,46 @@ OutputIt transform_local(
   auto num_gvalues       = dash::distance(in_a_first, in_b_first);
   DASH_LOG_TRACE_VAR("dash::transform_local", num_gvalues);
   // Number of local elements:
-  DASH_LOG_TRACE("dash::transform_local", "local elements:", lend_a-lbegin_a);
+  auto l_size            = lend_a - lbegin_a;
+  DASH_LOG_TRACE("dash::transform_local", "local elements:", l_size);
   // Local subrange of input range b:
   ValueType * lbegin_b   = (in_b_first + g_offset_first).local();
   // Local pointer of initial output element:
   ValueType * lbegin_out = (out_first  + g_offset_first).local();
   // Generate output values:
-#ifdef DASH_ENABLE_OPENMP
-  dash::util::UnitLocality uloc;
-  auto n_threads = uloc.num_domain_threads();
-  DASH_LOG_DEBUG("dash::transform_local", "thread capacity:",  n_threads);
-  if (n_threads > 1) {
-    auto l_size = lend_a - lbegin_a;
-    // TODO: Vectorize.
-    // Documentation of Intel MIC intrinsics, see:
-    // https://software.intel.com/de-de/node/523533
-    // https://software.intel.com/de-de/node/523387
-    #pragma omp parallel for num_threads(n_threads) schedule(static)
-    for (int i = 0; i < l_size; i++) {
+  dash::internal::parallel_for(
+    policy, l_size,
+    [=, &binary_op](decltype(l_size) i) {
       lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
-    }
-    return out_first + num_gvalues;
-  }
-#endif
-  // No OpenMP or insufficient number of threads for parallelization:
-  for (; lbegin_a != lend_a; ++lbegin_a, ++lbegin_b, ++lbegin_out) {
-    *lbegin_out = binary_op(*lbegin_a, *lbegin_b);
-  }
+    });
   // Return out_end iterator past final transformed element;
   return out_first + num_gvalues;
 }
 
+/**
+ * Transform operation on ranges with identical distribution and start
+ * offset, using multiple threads if available.
+ *
+ * \see  dash::transform_local
+ */
+template<
+  typename ValueType,
+  class InputAIt,
+  class InputBIt,
+  class OutputIt,
+  class BinaryOperation >
+OutputIt transform_local(
+  InputAIt        in_a_first,
+  InputAIt        in_a_last,
+  InputBIt        in_b_first,
+  OutputIt        out_first,
+  BinaryOperation binary_op)
+{
+  return dash::transform_local<ValueType>(
+           dash::execution::par,
+           in_a_first, in_a_last, in_b_first, out_first, binary_op);
+}
+
 /**
  * Local lhs input ranges on global output range.
  *
@@ -422,6 +439,49 @@ GlobOutputIt transform(
   return out_first + global_offset + num_local_elements;
 }
 
+/**
+ * Variant of \c dash::transform for global lhs input range that returns a
+ * token of the pending synchronization of the input range's team instead
+ * of the output iterator.
+ * Transformed values are guaranteed to be visible to all units after the
+ * token has been synchronized, allowing to fuse the synchronization with
+ * that of preceding and subsequent algorithms:
+ *
+ * \code
+ *   auto t_fill = dash::fill_nosync(a.begin(), a.end(), 1);
+ *   auto t_tf   = dash::transform_nosync(a.begin(), a.end(),
+ *                                        b.begin(), b.begin(),
+ *                                        dash::plus<int>());
+ *   auto t_each = dash::for_each_nosync(b.begin(), b.end(), f);
+ *   dash::sync(t_fill, t_tf, t_each);
+ * \endcode
+ *
+ * Chaining is only valid if every unit's output elements depend on its
+ * local input elements, e.g. for ranges with identical distribution.
+ *
+ * \see      dash::transform
+ * \see      dash::sync
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename ValueType,
+  class PatternType,
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation >
+dash::SyncToken transform_nosync(
+  GlobIter<ValueType, PatternType> in_a_first,
+  GlobIter<ValueType, PatternType> in_a_last,
+  GlobInputIt                      in_b_first,
+  GlobOutputIt                     out_first,
+  BinaryOperation                  binary_op = dash::plus<ValueType>())
+{
+  dash::transform<ValueType>(
+    in_a_first, in_a_last, in_b_first, out_first, binary_op);
+  return dash::SyncToken(in_a_first.pattern().team());
+}
+
 /**
  * Specialization of \c dash::transform as non-blocking operation.
  *
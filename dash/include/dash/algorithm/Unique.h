@@ -0,0 +1,95 @@
+#ifndef DASH__ALGORITHM__UNIQUE_H__
+#define DASH__ALGORITHM__UNIQUE_H__
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/algorithm/internal/Rebalance.h>
+
+#include <functional>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * Removes all but the first element from every group of consecutive
+ * equivalent elements in the range \c [first, last) and returns an
+ * iterator to the new end of the range.
+ * The values of elements between the new and the old end of the range
+ * are unspecified.
+ *
+ * Every unit compacts its local elements, comparing its first local
+ * element to the last element of the preceding unit. The remaining
+ * elements are then moved to their final position like in
+ * \c dash::remove_if.
+ * The local elements of every unit must be contiguous in the range, like
+ * in \c dash::BLOCKED patterns.
+ *
+ * Collective operation.
+ *
+ * \return  Iterator to the new end of the range, equal at all units.
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType,
+  class    BinaryPredicate >
+GlobIter<ElementType, PatternType> unique(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last,
+  /// Equivalence relation of elements
+  BinaryPredicate                      pred)
+{
+  auto lrange = dash::internal::contiguous_local_range(first, last);
+
+  std::vector<ElementType> l_kept;
+  if (lrange.size > 0) {
+    const ElementType * l_first = lrange.lbegin;
+    const ElementType * l_last  = lrange.lbegin + lrange.size;
+    if (lrange.offset == 0) {
+      l_kept.push_back(*l_first);
+    } else {
+      // Compare to the last element preceding the local block:
+      ElementType prev = *(first + (lrange.offset - 1));
+      if (!pred(prev, *l_first)) {
+        l_kept.push_back(*l_first);
+      }
+    }
+    for (auto l_it = l_first + 1; l_it != l_last; ++l_it) {
+      if (!pred(*(l_it - 1), *l_it)) {
+        l_kept.push_back(*l_it);
+      }
+    }
+  }
+  return dash::internal::rebalance_partitions(
+           first, lrange, l_kept, std::vector<ElementType>());
+}
+
+/**
+ * Removes all but the first element from every group of consecutive
+ * equal elements in the range \c [first, last) and returns an iterator
+ * to the new end of the range.
+ *
+ * Collective operation.
+ *
+ * \see     dash::unique
+ *
+ * \ingroup DashAlgorithms
+ */
+template <
+  typename ElementType,
+  class    PatternType >
+GlobIter<ElementType, PatternType> unique(
+  /// Iterator to the initial position in the sequence
+  GlobIter<ElementType, PatternType>   first,
+  /// Iterator to the final position in the sequence
+  GlobIter<ElementType, PatternType>   last)
+{
+  return dash::unique(first, last, std::equal_to<ElementType>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__UNIQUE_H__
@@ -0,0 +1,116 @@
+#ifndef DASH__ALGORITHM__INTERNAL__COLLECTIVE_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__COLLECTIVE_H__INCLUDED
+
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * State of a non-blocking collective operation started by an asynchronous
+ * algorithm, shared by all copies of the \c dash::Future returned by the
+ * algorithm.
+ * Holds the buffer of the operation which must not be released before the
+ * operation has completed, so the destructor waits for completion.
+ */
+template <typename BufferType>
+class CollectiveRequest
+{
+public:
+  typedef BufferType buffer_type;
+
+public:
+  CollectiveRequest() = default;
+
+  explicit CollectiveRequest(const buffer_type & buf)
+  : buffer(buf)
+  { }
+
+  CollectiveRequest(const CollectiveRequest & other)             = delete;
+  CollectiveRequest & operator=(const CollectiveRequest & other) = delete;
+
+  ~CollectiveRequest()
+  {
+    if (handle != nullptr) {
+      dart_wait(handle);
+    }
+  }
+
+  /**
+   * Block until the collective operation has completed.
+   */
+  void wait()
+  {
+    if (handle != nullptr) {
+      DASH_ASSERT_RETURNS(
+        dart_wait(handle),
+        DART_OK);
+      handle = nullptr;
+    }
+  }
+
+  /**
+   * Whether the collective operation has completed, does not block.
+   */
+  bool test()
+  {
+    if (handle != nullptr) {
+      int32_t finished;
+      DASH_ASSERT_RETURNS(
+        dart_test(handle, &finished),
+        DART_OK);
+      if (!finished) {
+        return false;
+      }
+      // Handle has been released in dart_test:
+      handle = nullptr;
+    }
+    return true;
+  }
+
+public:
+  /// Send and receive buffer of the collective operation.
+  buffer_type   buffer;
+  /// Handle of the collective operation.
+  dart_handle_t handle = nullptr;
+
+}; // class CollectiveRequest
+
+/**
+ * Combines error codes of arguments validated locally at every unit of a
+ * collective algorithm, so that all units fail consistently instead of
+ * leaving units with valid local arguments blocked in subsequent
+ * collective operations.
+ *
+ * Collective operation.
+ *
+ * \return  The largest error code of all units in the team, \c 0 if
+ *          validation succeeded at all units.
+ */
+inline int allreduce_error(
+  int         l_error,
+  dart_team_t team)
+{
+  int error = 0;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_error,
+      &error,
+      1,
+      DART_TYPE_INT,
+      DART_OP_MAX,
+      team),
+    DART_OK);
+  return error;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__COLLECTIVE_H__INCLUDED
@@ -0,0 +1,185 @@
+#ifndef DASH__ALGORITHM__INTERNAL__PARALLEL_FOR_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__PARALLEL_FOR_H__INCLUDED
+
+#include <dash/LaunchPolicy.h>
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Minimum number of local elements processed by a single thread in
+ * multithreaded local kernels of algorithms.
+ */
+constexpr size_t parallel_for_min_chunk = 1024;
+
+/**
+ * Number of threads to process \c nelem local elements in multithreaded
+ * local kernels of algorithms, limited by the threads available to the
+ * calling unit.
+ *
+ * \see  dash::util::UnitLocality::num_domain_threads
+ */
+inline int num_local_threads(size_t nelem)
+{
+  if (nelem < 2 * parallel_for_min_chunk) {
+    return 1;
+  }
+  dash::util::UnitLocality uloc;
+  int n_threads = std::max<int>(uloc.num_domain_threads(), 1);
+  n_threads     = std::min<size_t>(n_threads,
+                                   nelem / parallel_for_min_chunk);
+  DASH_LOG_TRACE("dash::internal::num_local_threads",
+                 "nelem:", nelem, "threads:", n_threads);
+  return n_threads;
+}
+
+/**
+ * Number of chunks the local range of \c nelem elements is split into
+ * in multithreaded local kernels of algorithms, one chunk per thread.
+ */
+inline int num_parallel_chunks(
+  const dash::execution::sequenced_policy &,
+  size_t /* nelem */)
+{
+  return 1;
+}
+
+template <class ExecutionPolicy>
+int num_parallel_chunks(
+  const ExecutionPolicy &,
+  size_t nelem)
+{
+  return num_local_threads(nelem);
+}
+
+/**
+ * Splits the indices \c [0, nelem) into \c n_chunks contiguous chunks
+ * and invokes \c func(chunk, chunk_begin, chunk_end) on every chunk in a
+ * separate thread, using OpenMP if enabled or \c std::thread otherwise.
+ * The calling thread processes the last chunk.
+ */
+template <
+  typename IndexType,
+  class    Function >
+void parallel_for_chunks(
+  int         n_chunks,
+  IndexType   nelem,
+  Function && func)
+{
+  if (n_chunks < 2) {
+    func(0, IndexType(0), nelem);
+    return;
+  }
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(n_chunks) schedule(static, 1)
+  for (int c = 0; c < n_chunks; ++c) {
+    func(c, (nelem * c) / n_chunks, (nelem * (c + 1)) / n_chunks);
+  }
+#else
+  std::vector<std::thread> threads;
+  threads.reserve(n_chunks - 1);
+  for (int c = 0; c < n_chunks - 1; ++c) {
+    IndexType chunk_begin = (nelem * c) / n_chunks;
+    IndexType chunk_end   = (nelem * (c + 1)) / n_chunks;
+    threads.emplace_back([=, &func]() {
+      func(c, chunk_begin, chunk_end);
+    });
+  }
+  func(n_chunks - 1, (nelem * (n_chunks - 1)) / n_chunks, nelem);
+  for (auto & thread : threads) {
+    thread.join();
+  }
+#endif
+}
+
+/**
+ * Invokes \c func on the indices \c [0, nelem) sequentially.
+ */
+template <
+  typename IndexType,
+  class    Function >
+void parallel_for(
+  const dash::execution::sequenced_policy &,
+  IndexType   nelem,
+  Function && func)
+{
+  for (IndexType i = 0; i < nelem; ++i) {
+    func(i);
+  }
+}
+
+/**
+ * Invokes \c func on the indices \c [0, nelem) in multiple threads using
+ * OpenMP if enabled, or \c std::thread otherwise.
+ */
+template <
+  typename IndexType,
+  class    Function >
+void parallel_for(
+  const dash::execution::parallel_policy &,
+  IndexType   nelem,
+  Function && func)
+{
+  int n_threads = num_local_threads(nelem);
+  if (n_threads < 2) {
+    parallel_for(dash::execution::seq, nelem, func);
+    return;
+  }
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(n_threads) schedule(static)
+  for (IndexType i = 0; i < nelem; ++i) {
+    func(i);
+  }
+#else
+  parallel_for_chunks(
+    n_threads, nelem,
+    [&func](int, IndexType chunk_begin, IndexType chunk_end) {
+      for (IndexType i = chunk_begin; i < chunk_end; ++i) {
+        func(i);
+      }
+    });
+#endif
+}
+
+/**
+ * Invokes \c func on the indices \c [0, nelem) in multiple threads and
+ * vectorized loops using OpenMP if enabled, or in multiple threads using
+ * \c std::thread otherwise.
+ */
+template <
+  typename IndexType,
+  class    Function >
+void parallel_for(
+  const dash::execution::parallel_unsequenced_policy &,
+  IndexType   nelem,
+  Function && func)
+{
+#if defined(DASH_ENABLE_OPENMP) && DASH__OPENMP_VERSION >= 40
+  int n_threads = num_local_threads(nelem);
+  #pragma omp parallel for simd num_threads(n_threads) schedule(static)
+  for (IndexType i = 0; i < nelem; ++i) {
+    func(i);
+  }
+#else
+  parallel_for(dash::execution::par, nelem, func);
+#endif
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__PARALLEL_FOR_H__INCLUDED
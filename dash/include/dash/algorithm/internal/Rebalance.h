@@ -0,0 +1,215 @@
+#ifndef DASH__ALGORITHM__INTERNAL__REBALANCE_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__REBALANCE_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/internal/Collective.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Local elements of a global range, contiguous in global index space.
+ */
+template <
+  class ValueType,
+  class IndexType >
+struct contiguous_local_range_t {
+  /// Native pointer to the first local element, \c nullptr if empty
+  ValueType * lbegin;
+  /// Offset of the first local element in the global range
+  IndexType   offset;
+  /// Number of local elements in the global range
+  IndexType   size;
+};
+
+/**
+ * Resolves the local elements in the global range \c [first, last).
+ *
+ * Collective operation, validates the local ranges of all units.
+ *
+ * \throws  dash::exception::InvalidArgument  at all units if the local
+ *          elements of any unit are not contiguous in the global range,
+ *          e.g. in block-cyclic patterns.
+ */
+template <class GlobIter>
+contiguous_local_range_t<
+  typename GlobIter::value_type,
+  typename GlobIter::index_type >
+contiguous_local_range(
+  const GlobIter & first,
+  const GlobIter & last)
+{
+  typedef typename GlobIter::index_type index_t;
+
+  contiguous_local_range_t<typename GlobIter::value_type, index_t> lrange;
+  lrange.lbegin = nullptr;
+  lrange.offset = 0;
+  lrange.size   = 0;
+
+  auto & pattern     = first.pattern();
+  auto   index_range = dash::local_index_range(first, last);
+  bool   contiguous  = true;
+  if (index_range.begin != index_range.end) {
+    lrange.size   = index_range.end - index_range.begin;
+    lrange.offset = pattern.global(index_range.begin) - first.pos();
+    index_t g_last_offset = pattern.global(index_range.end - 1)
+                            - first.pos();
+    contiguous    = (g_last_offset - lrange.offset + 1 == lrange.size);
+  }
+  // Units with contiguous local elements must not proceed to subsequent
+  // collective operations if other units fail:
+  if (allreduce_error(contiguous ? 0 : 1,
+                      pattern.team().dart_id()) != 0) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "local elements must be contiguous in the global range");
+  }
+  if (lrange.size > 0) {
+    lrange.lbegin = (first + lrange.offset).local();
+  }
+  return lrange;
+}
+
+/**
+ * Offset and size of a unit's local block in a global range and number
+ * of elements in the partitions of the block, exchanged between units to
+ * rebalance partitioned elements.
+ */
+struct local_block_counts_t {
+  int64_t offset;
+  int64_t size;
+  int64_t nfirst;
+  int64_t nsecond;
+};
+
+/**
+ * Gathers the local block counts of all units in the team.
+ */
+inline std::vector<local_block_counts_t> allgather_block_counts(
+  const local_block_counts_t & l_counts,
+  dash::Team                 & team)
+{
+  std::vector<local_block_counts_t> counts(team.size());
+  DASH_ASSERT_RETURNS(
+    dart_allgather(
+      &l_counts,
+      counts.data(),
+      sizeof(local_block_counts_t),
+      DART_TYPE_BYTE,
+      team.dart_id()),
+    DART_OK);
+  return counts;
+}
+
+/**
+ * Writes \c nelem values to the elements of a global range starting at
+ * offset \c out_offset, using one blocking put for every unit's local
+ * block overlapping the target range.
+ */
+template <
+  class ValueType,
+  class GlobOutputIt >
+void put_to_blocks(
+  const ValueType                         * values,
+  int64_t                                   nelem,
+  int64_t                                   out_offset,
+  const GlobOutputIt                      & out_first,
+  const std::vector<local_block_counts_t> & out_blocks)
+{
+  for (const auto & block : out_blocks) {
+    int64_t seg_begin = std::max(out_offset, block.offset);
+    int64_t seg_end   = std::min(out_offset + nelem,
+                                 block.offset + block.size);
+    if (seg_begin >= seg_end) {
+      continue;
+    }
+    dart_storage_t ds = dash::dart_storage<ValueType>(seg_end - seg_begin);
+    DASH_ASSERT_RETURNS(
+      dart_put_blocking(
+        (out_first + seg_begin).dart_gptr(),
+        values + (seg_begin - out_offset),
+        ds.nelem,
+        ds.dtype),
+      DART_OK);
+  }
+}
+
+/**
+ * Rebalances the local elements of all units partitioned into
+ * \c l_first and \c l_second in the global range \c [first, last):
+ * the first partitions of all units are stored at the beginning of the
+ * range in order of the units' local blocks, followed by the second
+ * partitions.
+ * Values must be copied from the range before as they are overwritten by
+ * other units.
+ *
+ * Collective operation, synchronizes the team before and after
+ * redistributing elements.
+ *
+ * \return  Iterator to the first element of the second partition.
+ */
+template <
+  class GlobIter,
+  class ValueType,
+  class IndexType >
+GlobIter rebalance_partitions(
+  const GlobIter                                       & first,
+  const contiguous_local_range_t<ValueType, IndexType> & lrange,
+  const std::vector<ValueType>                         & l_first,
+  const std::vector<ValueType>                         & l_second)
+{
+  auto & team = first.pattern().team();
+
+  local_block_counts_t l_counts;
+  l_counts.offset  = lrange.offset;
+  l_counts.size    = lrange.size;
+  l_counts.nfirst  = l_first.size();
+  l_counts.nsecond = l_second.size();
+  auto counts = allgather_block_counts(l_counts, team);
+
+  // Offsets of the partitions from the local blocks preceding the
+  // local block in the range:
+  int64_t nfirst_total     = 0;
+  int64_t first_offset     = 0;
+  int64_t second_offset    = 0;
+  for (const auto & block : counts) {
+    nfirst_total += block.nfirst;
+    if (block.size > 0 && block.offset < lrange.offset) {
+      first_offset  += block.nfirst;
+      second_offset += block.nsecond;
+    }
+  }
+  second_offset += nfirst_total;
+  DASH_LOG_TRACE("dash::internal::rebalance_partitions",
+                 "nfirst total:",  nfirst_total,
+                 "first offset:",  first_offset,
+                 "second offset:", second_offset);
+
+  // Wait for all units to copy their values from the range:
+  team.barrier();
+  put_to_blocks(l_first.data(),  l_first.size(),  first_offset,
+                first, counts);
+  put_to_blocks(l_second.data(), l_second.size(), second_offset,
+                first, counts);
+  team.barrier();
+
+  return first + nfirst_total;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__REBALANCE_H__INCLUDED
@@ -3,10 +3,17 @@
 
 #include <dash/memory/GlobStaticMem.h>
 #include <dash/iterator/GlobIter.h>
+#include <dash/Cartesian.h>
+
+#include <dash/dart/if/dart_communication.h>
 
 #include <dash/internal/Logging.h>
 
+#include <array>
 #include <functional>
+#include <map>
+#include <utility>
+#include <vector>
 
 namespace dash {
 namespace experimental {
@@ -94,6 +101,17 @@ enum class HaloRegion: std::uint8_t{
   COUNT //number of regions
 };
 
+/**
+ * Property of the global boundary of a block in a dimension.
+ */
+enum class BoundaryProp: std::uint8_t{
+  /// No halo regions at the global boundary
+  NONE,
+  /// Halo regions at the global boundary contain the elements at the
+  /// opposite global boundary (periodic boundary)
+  CYCLIC
+};
+
 
 template<dim_t NumDimensions>
 class HaloSpec
@@ -698,15 +716,22 @@ public:
   using viewspec_t   = typename PatternT::viewspec_type;
   using halospec_t   = HaloSpec<NumDimensions>;
   using block_view_t = HaloBlockView<ElementT, PatternT>;
+  using pattern_t    = PatternT;
+  using bound_props_t = std::array<BoundaryProp, NumDimensions>;
 
 public:
   /**
    * Creates a new instance of HaloBlock that extends a given pattern block
    * by halo semantics.
+   *
+   * Halo regions at the global boundary in dimensions with boundary
+   * property \c BoundaryProp::CYCLIC have coordinates outside of the
+   * pattern's extents and refer to the elements at the opposite boundary.
    */
   HaloBlock(GlobMem_t & globmem, const PatternT & pattern, const viewspec_t &  view,
-    const halospec_t & halospec)
-  : _globmem(globmem), _pattern(pattern), _view(view), _halospec(halospec)
+    const halospec_t & halospec, const bound_props_t & bound_props = bound_props_t{})
+  : _globmem(globmem), _pattern(pattern), _view(view), _halospec(halospec),
+    _bound_props(bound_props)
   {
     _halo_regions.reserve(NumDimensions * 2);
     _boundary_regions.reserve(NumDimensions * 2);
@@ -725,8 +750,9 @@ public:
       auto region_extents = view.extents();
       auto view_offset    = view.offset(d);
       auto view_extent    = view.extent(d);
+      bool cyclic         = bound_props[d] == BoundaryProp::CYCLIC;
 
-      if(halo_offs_minus == 0 || view_offset < halo_offs_minus)
+      if(halo_offs_minus == 0 || (!cyclic && view_offset < halo_offs_minus))
       {
         _view_save.resize_dim(d, view_offset + halo_offs_minus, view_extent - halo_offs_minus);
         _view_inner.resize_dim(d, view_offset + halo_offs_minus, view_extent - halo_offs_minus);
@@ -749,12 +775,12 @@ public:
         _halo_regions.push_back(viewspec_t(region_offsets, region_extents));
       }
 
-      if(halo_offs_plus == 0 ||
+      if(halo_offs_plus == 0 || (!cyclic &&
           std::abs(
             static_cast<index_type>(view_offset) +
             static_cast<index_type>(view_extent) +
             static_cast<index_type>(halo_offs_plus)
-          ) > static_cast<index_type>(_pattern.extent(d)))
+          ) > static_cast<index_type>(_pattern.extent(d))))
       {
         _view_save.resize_dim(d, _view_save.offset(d), _view_save.extent(d) - halo_offs_plus);
         _view_inner.resize_dim(d, _view_inner.offset(d), _view_inner.extent(d) - halo_offs_plus);
@@ -816,6 +842,14 @@ public:
     return _halospec;
   }
 
+  /**
+   * Property of the global boundary in the given dimension.
+   */
+  BoundaryProp bound_prop(dim_t dimension) const
+  {
+    return _bound_props[dimension];
+  }
+
   /**
    * Creates view on halo region for a given dimension and halo region.
    * For example, the east halo region in a two-dimensional block
@@ -899,6 +933,9 @@ private:
         auto halo_off_minus = std::abs(_halospec.halo_offset(d).minus);
         auto halo_off_plus = _halospec.halo_offset(d).plus;
 
+        if(_bound_props[d] == BoundaryProp::CYCLIC)
+          continue;
+
         if(offsets[d] < halo_off_minus)
         {
           offsets[d] += halo_off_minus;
@@ -930,6 +967,8 @@ private:
 
   const halospec_t &        _halospec;
 
+  bound_props_t             _bound_props;
+
   viewspec_t                _view_save;
 
   viewspec_t                _view_inner;
@@ -998,6 +1037,196 @@ private:
   std::vector<value_t*>   _halo_offsets;
 };
 
+/**
+ * Persistent plan for updating halo regions of a \c HaloBlock in its
+ * \c HaloMemory.
+ *
+ * The source elements of the halo regions are resolved once when the plan
+ * is created. Elements that are contiguous both in the local memory of
+ * their unit and in the halo memory are merged into blocks, and the blocks
+ * of all regions located at the same unit are fetched in a single indexed
+ * transfer in every update.
+ */
+template<typename HaloBlockT>
+class HaloUpdatePlan
+{
+public:
+  static constexpr dim_t NumDimensions = HaloBlockT::ndim();
+
+  using value_t    = typename HaloBlockT::value_t;
+  using index_type = typename HaloBlockT::index_type;
+  using size_type  = typename HaloBlockT::size_type;
+  using pattern_t  = typename HaloBlockT::pattern_t;
+  using region_t   = std::pair<dim_t, HaloRegion>;
+
+private:
+  static constexpr MemArrange MemoryArrange = pattern_t::memory_order();
+
+  using region_space_t = CartesianIndexSpace<NumDimensions, MemoryArrange,
+                                             index_type>;
+
+  /// Blocks of halo elements located at a single unit.
+  struct transfer_t
+  {
+    /// global pointer to the unit's local memory
+    dart_gptr_t         gptr;
+    std::vector<size_t> nelems;
+    /// block offsets in the unit's local memory
+    std::vector<size_t> src_displs;
+    /// block offsets in the halo memory
+    std::vector<size_t> dest_displs;
+  };
+
+public:
+  /**
+   * Creates a plan updating all halo regions of the given block.
+   */
+  HaloUpdatePlan(const HaloBlockT & haloblock,
+                 HaloMemory<HaloBlockT> & halomemory)
+  : _dest(halomemory.startPos())
+  {
+    for(dim_t d = 0; d < NumDimensions; ++d)
+    {
+      addRegion(haloblock, halomemory, region_t(d, HaloRegion::MINUS));
+      addRegion(haloblock, halomemory, region_t(d, HaloRegion::PLUS));
+    }
+  }
+
+  /**
+   * Creates a plan updating the given halo regions of the given block.
+   */
+  HaloUpdatePlan(const HaloBlockT & haloblock,
+                 HaloMemory<HaloBlockT> & halomemory,
+                 const std::vector<region_t> & regions)
+  : _dest(halomemory.startPos())
+  {
+    for(const auto & region : regions)
+      addRegion(haloblock, halomemory, region);
+  }
+
+  /**
+   * Starts fetching the halo elements, one transfer per unit.
+   * Completed by \c wait().
+   */
+  void update_async()
+  {
+    for(auto & transfer : _transfers)
+    {
+      DASH_ASSERT_RETURNS(
+        dart_get_indexed(_dest, transfer.gptr, transfer.nelems.size(),
+                         transfer.nelems.data(), transfer.src_displs.data(),
+                         transfer.dest_displs.data(), _dtype),
+        DART_OK);
+    }
+  }
+
+  /**
+   * Waits for completion of the transfers started in \c update_async().
+   */
+  void wait()
+  {
+    for(auto & transfer : _transfers)
+      DASH_ASSERT_RETURNS(dart_flush_local(transfer.gptr), DART_OK);
+  }
+
+  /**
+   * Fetches the halo elements.
+   */
+  void update()
+  {
+    update_async();
+    wait();
+  }
+
+  /**
+   * Number of units the halo elements are fetched from.
+   */
+  size_type num_transfers() const
+  {
+    return _transfers.size();
+  }
+
+  /**
+   * Number of contiguous blocks of halo elements in all transfers.
+   */
+  size_type num_blocks() const
+  {
+    size_type nblocks = 0;
+    for(const auto & transfer : _transfers)
+      nblocks += transfer.nelems.size();
+    return nblocks;
+  }
+
+private:
+  void addRegion(const HaloBlockT & haloblock,
+                 HaloMemory<HaloBlockT> & halomemory,
+                 const region_t & region)
+  {
+    const auto & view = haloblock.halo_region(region.first, region.second)
+                                 .region_view();
+    if(view.size() == 0)
+      return;
+
+    const auto & pattern = haloblock.pattern();
+    // halo elements are stored in the region's memory order:
+    region_space_t region_space(view.extents());
+    size_t dest_offset = halomemory.haloPos(region.first, region.second) -
+                         halomemory.startPos();
+    std::array<index_type, NumDimensions> coords;
+    for(index_type i = 0; i < static_cast<index_type>(view.size()); ++i)
+    {
+      auto rcoords = region_space.coords(i);
+      for(dim_t d = 0; d < NumDimensions; ++d)
+      {
+        // coordinates outside of the pattern in cyclic halo regions:
+        index_type extent = pattern.extent(d);
+        coords[d] = ((view.offset(d) + rcoords[d]) % extent + extent)
+                    % extent;
+      }
+      auto lpos = pattern.local_index(coords);
+      addElement(haloblock, lpos.unit, lpos.index, dest_offset + i);
+    }
+  }
+
+  void addElement(const HaloBlockT & haloblock, team_unit_t unit,
+                  index_type src_offset, size_t dest_offset)
+  {
+    auto dstorage = dash::dart_storage<value_t>(1);
+    _dtype        = dstorage.dtype;
+    size_t src    = src_offset  * dstorage.nelem;
+    size_t dest   = dest_offset * dstorage.nelem;
+
+    auto unit_it = _unit_transfers.find(unit.id);
+    if(unit_it == _unit_transfers.end())
+    {
+      transfer_t transfer;
+      transfer.gptr = haloblock.globmem().at(unit, 0).dart_gptr();
+      unit_it = _unit_transfers.insert(
+                  std::make_pair(unit.id, _transfers.size())).first;
+      _transfers.push_back(std::move(transfer));
+    }
+    auto & transfer = _transfers[unit_it->second];
+    // extend last block if the element follows it in both memory spaces:
+    if(!transfer.nelems.empty() &&
+       transfer.src_displs.back()  + transfer.nelems.back() == src &&
+       transfer.dest_displs.back() + transfer.nelems.back() == dest)
+    {
+      transfer.nelems.back() += dstorage.nelem;
+      return;
+    }
+    transfer.nelems.push_back(dstorage.nelem);
+    transfer.src_displs.push_back(src);
+    transfer.dest_displs.push_back(dest);
+  }
+
+private:
+  value_t *                     _dest;
+  dart_datatype_t               _dtype = DART_TYPE_BYTE;
+  std::vector<transfer_t>       _transfers;
+  /// maps units to the index of their transfer
+  std::map<dart_unit_t, size_t> _unit_transfers;
+};
+
 } // namespace dash
 } // namespace experimental
 
@@ -10,7 +10,9 @@
 #include <dash/experimental/Halo.h>
 #include <dash/experimental/iterator/HaloMatrixIterator.h>
 
+#include <map>
 #include <type_traits>
+#include <vector>
 
 
 namespace dash {
@@ -32,6 +34,8 @@ public:
   using HaloBlock_t          = HaloBlock<value_t, pattern_t>;
   using HaloBlockView_t      = typename HaloBlock_t::block_view_t;
   using HaloMemory_t         = HaloMemory<HaloBlock_t>;
+  using HaloUpdatePlan_t     = HaloUpdatePlan<HaloBlock_t>;
+  using BoundProps_t         = typename HaloBlock_t::bound_props_t;
 
   using iterator             = HaloMatrixIterator<
                                  value_t,
@@ -59,15 +63,23 @@ public:
    *
    * Sets the associated team to DART_TEAM_NULL for global matrix instances
    * that are declared before \c dash::Init().
+   *
+   * The halo regions are resolved to transfers once, see
+   * \c HaloUpdatePlan. With boundary property \c BoundaryProp::CYCLIC in
+   * a dimension, halo regions at the global boundary are updated with the
+   * elements at the opposite boundary.
    */
   //TODO adapt to more than one local block
-  HaloMatrix(MatrixT & matrix, const HaloSpecT & halospec)
+  HaloMatrix(MatrixT & matrix, const HaloSpecT & halospec,
+             const BoundProps_t & bound_props = BoundProps_t{})
     : _matrix(matrix),
       _halospec(halospec),
       _view_local(matrix.local.extents()),
       _view_global(ViewSpec_t(matrix.local.offsets(), matrix.local.extents())),
-      _haloblock(matrix.begin().globmem(), matrix.pattern(), _view_global, halospec),
+      _haloblock(matrix.begin().globmem(), matrix.pattern(), _view_global,
+                 halospec, bound_props),
       _halomemory(_haloblock),
+      _updateplan(_haloblock, _halomemory),
       _begin(_haloblock, _halomemory, 0),
       _end(_haloblock, _halomemory, _haloblock.view_save().size()),
       _ibegin(_haloblock, _halomemory, 0),
@@ -75,22 +87,6 @@ public:
       _bbegin(_haloblock, _halomemory, 0),
       _bend(_haloblock, _halomemory, _haloblock.boundary_size())
   {
-    const auto & offsets = halospec.halo_offsets();
-
-    for(auto d = 0; d < NumDimensions; ++d)
-    {
-      if(offsets[d].minus)
-        initBlockViewData(d, HaloRegion::MINUS);
-
-      if(offsets[d].plus)
-        initBlockViewData(d, HaloRegion::PLUS);
-    }
-  }
-
-  ~HaloMatrix()
-  {
-    for(auto & view : _blockview_data)
-      free(view.second.handle);
   }
 
   iterator begin() noexcept
@@ -163,79 +159,56 @@ public:
     return _haloblock;
   }
 
-  void updateHalosAsync()
+  /**
+   * Local memory of the halo regions, updated in \c updateHalos().
+   */
+  HaloMemory_t & haloMemory()
   {
-    for(auto & view : _blockview_data)
-      updateHaloIntern(view.first.first, view.first.second, true);
+    return _halomemory;
   }
 
-  void waitHalosAsync()
+  const HaloUpdatePlan_t & updatePlan() const
   {
-    for(auto & view : _blockview_data)
-      dart_waitall(view.second.handle, view.second.num_handles);
+    return _updateplan;
   }
 
-  void updateHalos()
+  /**
+   * Starts the update of all halo regions, allows to compute the inner
+   * block elements while halo elements are transferred.
+   * Completed by \c waitHalosAsync().
+   */
+  void updateHalosAsync()
   {
-    for(auto & view : _blockview_data)
-      updateHaloIntern(view.first.first, view.first.second, false);
+    _updateplan.update_async();
   }
 
-  void updateHalo(dim_t dim, HaloRegion region)
+  void waitHalosAsync()
   {
-    updateHaloIntern(dim, region, false);
+    _updateplan.wait();
   }
 
-  const ViewSpec_t & getLocalView()
+  void updateHalos()
   {
-    return _view_local;
+    _updateplan.update();
   }
 
-private:
-  void initBlockViewData(dim_t dim, HaloRegion region)
+  void updateHalo(dim_t dim, HaloRegion region)
   {
-    const auto blockview = _haloblock.halo_region(dim, region);
-    if(blockview.size() == 0)
-      return;
-
-    // number of contiguous elements
-    size_type cont_elems;
-    size_type num_handle;
-    if((MemoryArrange == ROW_MAJOR && dim == 0) ||
-       (MemoryArrange == COL_MAJOR && dim == NumDimensions - 1))
+    auto region_key = std::make_pair(dim, region);
+    auto it_find    = _region_plans.find(region_key);
+    if(it_find == _region_plans.end())
     {
-      cont_elems = blockview.size();
-      num_handle = 1;
+      it_find = _region_plans.insert(std::make_pair(
+                  region_key,
+                  HaloUpdatePlan_t(_haloblock, _halomemory, { region_key })))
+                .first;
     }
-    else
-    {
-      cont_elems = blockview.region_view().extent(dim);
-      num_handle = blockview.size() / cont_elems;
-    }
-
-    auto nbytes = cont_elems * sizeof(value_t);
-    dart_handle_t * handle = (dart_handle_t*) malloc (sizeof (dart_handle_t) * num_handle);
-    for(auto i = 0; i < num_handle; ++i)
-      handle[i] = nullptr;
-    _blockview_data.insert(std::make_pair(
-          std::move(std::make_pair(dim, region)), Data{std::move(blockview), handle, num_handle, cont_elems, nbytes}));
+    it_find->second.update();
   }
 
-  void updateHaloIntern(dim_t dim, HaloRegion region, bool async)
+  const ViewSpec_t & getLocalView()
   {
-    auto it_find = _blockview_data.find(std::make_pair(dim, region));
-    if(it_find != _blockview_data.end())
-    {
-      auto & data = it_find->second;
-      auto off = _halomemory.haloPos(dim, region);
-      auto it = data.blockview.begin();
-      for(auto i = 0; i < data.num_handles; ++i, it += data.cont_elems){
-        dart_storage_t ds = dash::dart_storage<value_t>(data.cont_elems);
-        dart_get_handle (off + ds.nelem * i, it.dart_gptr(), ds.nelem, ds.dtype, &(data.handle[i]));
-      }
-      if(!async)
-        dart_waitall(data.handle, data.num_handles);
-    }
+    return _view_local;
   }
 
 private:
@@ -246,15 +219,9 @@ private:
   const HaloBlock_t       _haloblock;
   HaloMemory_t            _halomemory;
 
-  struct Data
-  {
-    const HaloBlockView_t blockview;
-    dart_handle_t *       handle;
-    size_type             num_handles;
-    size_type             cont_elems;
-    std::uint64_t         nbytes;
-  };
-  std::map<std::pair<dim_t, HaloRegion>, Data> _blockview_data;
+  HaloUpdatePlan_t        _updateplan;
+  /// plans for updates of single halo regions
+  std::map<std::pair<dim_t, HaloRegion>, HaloUpdatePlan_t> _region_plans;
 
   iterator                _begin;
   iterator                _end;
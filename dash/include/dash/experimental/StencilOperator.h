@@ -0,0 +1,694 @@
+#ifndef DASH__EXPERIMENTAL__STENCIL_OPERATOR_H__INCLUDED
+#define DASH__EXPERIMENTAL__STENCIL_OPERATOR_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+
+#include <dash/experimental/Halo.h>
+#include <dash/experimental/HaloMatrix.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <ratio>
+#include <tuple>
+#include <vector>
+
+
+namespace dash {
+namespace experimental {
+
+namespace internal {
+
+template<typename T>
+constexpr T stencil_nth_value(std::size_t, T first)
+{
+  return first;
+}
+
+/**
+ * Value at the given position in a parameter pack.
+ */
+template<typename T, typename... Ts>
+constexpr T stencil_nth_value(std::size_t n, T first, Ts... rest)
+{
+  return (n == 0) ? first : stencil_nth_value<T>(n - 1, rest...);
+}
+
+template<typename T>
+constexpr T stencil_max_value(T max)
+{
+  return max;
+}
+
+/**
+ * Maximum of a value and the values in a parameter pack.
+ */
+template<typename T, typename... Ts>
+constexpr T stencil_max_value(T max, T first, Ts... rest)
+{
+  return stencil_max_value<T>((first > max) ? first : max, rest...);
+}
+
+constexpr dim_t stencil_count_nonzero(dim_t count)
+{
+  return count;
+}
+
+/**
+ * Number of non-zero values in a parameter pack.
+ */
+template<typename... Ts>
+constexpr dim_t stencil_count_nonzero(dim_t count, int first, Ts... rest)
+{
+  return stencil_count_nonzero(count + (first != 0 ? 1 : 0), rest...);
+}
+
+} // namespace internal
+
+/**
+ * Point of a stencil, specified by its weight and its offsets to the
+ * center element in every dimension at compile time.
+ *
+ * Weights are rational numbers given as \c std::ratio. For example, the
+ * north neighbor of a two-dimensional stencil with weight 0.25 is
+ * \c StencilPoint<std::ratio<1,4>, -1, 0>.
+ */
+template<typename WeightRatio, int... Offsets>
+class StencilPoint
+{
+  static_assert(sizeof...(Offsets) > 0,
+                "StencilPoint requires an offset in every dimension");
+
+public:
+  static constexpr dim_t ndim()
+  {
+    return sizeof...(Offsets);
+  }
+
+  static constexpr double weight()
+  {
+    return static_cast<double>(WeightRatio::num) / WeightRatio::den;
+  }
+
+  static constexpr int offset(dim_t dim)
+  {
+    return internal::stencil_nth_value<int>(dim, Offsets...);
+  }
+
+  /**
+   * Number of dimensions with non-zero offset.
+   */
+  static constexpr dim_t num_offset_dims()
+  {
+    return internal::stencil_count_nonzero(0, Offsets...);
+  }
+};
+
+/**
+ * Stencil specified at compile time by a list of \c StencilPoint types.
+ *
+ * Example for the three-point stencil of a one-dimensional Jacobi
+ * iteration:
+ *
+ * \code
+ *   using jacobi_1d_t = StencilSpec<
+ *                         StencilPoint<std::ratio<1,4>, -1>,
+ *                         StencilPoint<std::ratio<1,2>,  0>,
+ *                         StencilPoint<std::ratio<1,4>,  1> >;
+ * \endcode
+ */
+template<typename... Points>
+class StencilSpec
+{
+  static_assert(sizeof...(Points) > 0,
+                "StencilSpec requires at least one point");
+
+public:
+  static constexpr dim_t NumDimensions =
+    std::tuple_element<0, std::tuple<Points...>>::type::ndim();
+
+  using halospec_t = HaloSpec<NumDimensions>;
+
+public:
+  static constexpr std::size_t num_points()
+  {
+    return sizeof...(Points);
+  }
+
+  static constexpr dim_t ndim()
+  {
+    return NumDimensions;
+  }
+
+  static constexpr double weight(std::size_t point)
+  {
+    return internal::stencil_nth_value<double>(point, Points::weight()...);
+  }
+
+  static constexpr int offset(std::size_t point, dim_t dim)
+  {
+    return internal::stencil_nth_value<int>(point, Points::offset(dim)...);
+  }
+
+  /**
+   * Largest distance of a point to the center element in negative
+   * direction of the given dimension.
+   */
+  static constexpr int radius_minus(dim_t dim)
+  {
+    return internal::stencil_max_value<int>(0, -Points::offset(dim)...);
+  }
+
+  /**
+   * Largest distance of a point to the center element in positive
+   * direction of the given dimension.
+   */
+  static constexpr int radius_plus(dim_t dim)
+  {
+    return internal::stencil_max_value<int>(0, Points::offset(dim)...);
+  }
+
+  /**
+   * Whether every point has a non-zero offset in at most one dimension.
+   */
+  static constexpr bool is_star()
+  {
+    return internal::stencil_max_value<dim_t>(
+             0, Points::num_offset_dims()...) <= 1;
+  }
+
+  /**
+   * Halo specification with halo regions wide enough to apply the stencil
+   * in the given number of time steps per halo update.
+   */
+  static halospec_t halospec(int steps = 1)
+  {
+    std::array<typename halospec_t::halo_offset_pair_t, NumDimensions>
+      halo_offsets;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      halo_offsets[d].minus = -radius_minus(d) * steps;
+      halo_offsets[d].plus  =  radius_plus(d)  * steps;
+    }
+    return halospec_t(halo_offsets);
+  }
+};
+
+/**
+ * Applies a stencil given as \c StencilSpec to the elements of a matrix
+ * in iterative time steps, alternating between two matrices with identical
+ * pattern that contain the values of the previous and the next time step.
+ *
+ * In every time step, the elements in the inner region of the local block
+ * are computed in a loop over contiguous rows in local memory, blocked in
+ * tiles of the contiguous dimension, while the halo regions are updated.
+ * The remaining elements at the block boundary are computed from the halo
+ * memory afterwards.
+ * Elements at the global boundary that are not covered by halo regions are
+ * not modified, see \c BoundaryProp.
+ *
+ * If the halo regions are wider than required by the stencil and halo
+ * regions exist in only one dimension, multiple time steps are computed
+ * from a single halo update (temporal blocking) on a copy of the local
+ * block extended by its halo regions, see \c steps_per_update().
+ * With temporal blocking, the elements not modified at the global
+ * boundary are those within the stencil radius instead of the halo width.
+ *
+ * As the halo model does not contain corner regions, only stencils with
+ * points offset in a single dimension are supported.
+ */
+template<typename MatrixT, typename StencilSpecT>
+class StencilOperator
+{
+  static_assert(MatrixT::ndim() == StencilSpecT::ndim(),
+                "Number of dimensions of Matrix and StencilSpec not equal");
+  static_assert(StencilSpecT::is_star(),
+                "StencilOperator requires stencil points offset in at most "
+                "one dimension");
+
+public:
+  using pattern_t    = typename MatrixT::pattern_type;
+  using index_type   = typename MatrixT::index_type;
+  using size_type    = typename MatrixT::size_type;
+  using value_t      = typename MatrixT::value_type;
+  using halospec_t   = HaloSpec<MatrixT::ndim()>;
+  using HaloMatrix_t = HaloMatrix<MatrixT, halospec_t>;
+  using BoundProps_t = typename HaloMatrix_t::BoundProps_t;
+
+private:
+  static constexpr dim_t       NumDimensions = MatrixT::ndim();
+  static constexpr MemArrange  MemoryArrange = pattern_t::memory_order();
+  static constexpr std::size_t NumPoints     = StencilSpecT::num_points();
+  /// Dimension of elements contiguous in local memory
+  static constexpr dim_t       ContDim       = (MemoryArrange == ROW_MAJOR)
+                                               ? NumDimensions - 1
+                                               : 0;
+  /// Number of contiguous elements computed for every row before
+  /// proceeding to the next row
+  static constexpr index_type  TileExtent    = 1024;
+
+  using self_t          = StencilOperator<MatrixT, StencilSpecT>;
+  using coords_t        = std::array<index_type, NumDimensions>;
+  using point_offsets_t = std::array<index_type, NumPoints>;
+
+public:
+  /**
+   * Creates a stencil operator on two matrices with identical pattern.
+   * The first time step reads from matrix \c first.
+   *
+   * The halo specification must cover the stencil, halo regions that are
+   * a multiple of the stencil radius allow temporal blocking.
+   */
+  StencilOperator(
+    MatrixT            & first,
+    MatrixT            & second,
+    const halospec_t   & halospec    = StencilSpecT::halospec(),
+    const BoundProps_t & bound_props = BoundProps_t{})
+  : _halospec(halospec),
+    _matrices{{ &first, &second }},
+    _halo_first(first, _halospec, bound_props),
+    _halo_second(second, _halospec, bound_props)
+  {
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      auto halo_minus = std::abs(_halospec.halo_offset(d).minus);
+      auto halo_plus  = _halospec.halo_offset(d).plus;
+      if (halo_minus < StencilSpecT::radius_minus(d) ||
+          halo_plus  < StencilSpecT::radius_plus(d)) {
+        DASH_THROW(
+          dash::exception::InvalidArgument,
+          "StencilOperator: halo specification does not cover the stencil "
+          << "in dimension " << d);
+      }
+    }
+
+    const auto & haloblock = _halo_first.haloBlock();
+    const auto & view      = haloblock.view();
+    const auto & inner     = haloblock.view_inner();
+    coords_t local_extents;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      local_extents[d] = view.extent(d);
+      _inner_lo[d]     = inner.offset(d) - view.offset(d);
+      _inner_hi[d]     = _inner_lo[d] + inner.extent(d);
+    }
+    _local_extents = local_extents;
+    _local_strides = strides(local_extents);
+    _local_offsets = point_offsets(_local_strides);
+
+    for (std::size_t p = 0; p < NumPoints; ++p) {
+      _point_dims[p] = -1;
+      for (dim_t d = 0; d < NumDimensions; ++d) {
+        if (StencilSpecT::offset(p, d) != 0) {
+          _point_dims[p] = d;
+        }
+      }
+    }
+
+    init_temporal_blocking(bound_props);
+  }
+
+  StencilOperator() = delete;
+  StencilOperator(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Applies the stencil in the given number of time steps.
+   * Collective operation, the results are contained in \c current().
+   */
+  void apply(size_type steps = 1)
+  {
+    while (steps > 0) {
+      auto nsteps = std::min(steps, _steps_per_update);
+      if (_steps_per_update > 1) {
+        sweep(nsteps);
+      } else {
+        step();
+      }
+      _current = 1 - _current;
+      steps   -= nsteps;
+      // Values of all units are read in the next halo update:
+      _matrices[_current]->barrier();
+    }
+  }
+
+  /**
+   * The matrix containing the values of the last time step.
+   */
+  MatrixT & current()
+  {
+    return *_matrices[_current];
+  }
+
+  /**
+   * Number of time steps computed from a single halo update.
+   */
+  size_type steps_per_update() const
+  {
+    return _steps_per_update;
+  }
+
+private:
+  HaloMatrix_t & halo(int idx)
+  {
+    return (idx == 0) ? _halo_first : _halo_second;
+  }
+
+  void init_temporal_blocking(const BoundProps_t & bound_props)
+  {
+    // Corner regions would be required for halo regions in more than one
+    // dimension:
+    const auto & teamspec = _matrices[0]->pattern().teamspec();
+    dim_t num_halo_dims   = 0;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      if (_halospec.width(d) > 0 &&
+          (teamspec.extent(d) > 1 ||
+           bound_props[d] == BoundaryProp::CYCLIC)) {
+        _halo_dim = d;
+        ++num_halo_dims;
+      }
+    }
+    _steps_per_update = 1;
+    if (num_halo_dims != 1) {
+      return;
+    }
+    const auto & haloblock = _halo_first.haloBlock();
+    _halo_minus = haloblock.halo_size(_halo_dim, HaloRegion::MINUS) > 0
+                  ? std::abs(_halospec.halo_offset(_halo_dim).minus) : 0;
+    _halo_plus  = haloblock.halo_size(_halo_dim, HaloRegion::PLUS) > 0
+                  ? _halospec.halo_offset(_halo_dim).plus : 0;
+
+    size_type steps_minus = std::numeric_limits<size_type>::max();
+    size_type steps_plus  = std::numeric_limits<size_type>::max();
+    if (StencilSpecT::radius_minus(_halo_dim) > 0) {
+      steps_minus = std::abs(_halospec.halo_offset(_halo_dim).minus) /
+                    StencilSpecT::radius_minus(_halo_dim);
+    }
+    if (StencilSpecT::radius_plus(_halo_dim) > 0) {
+      steps_plus  = _halospec.halo_offset(_halo_dim).plus /
+                    StencilSpecT::radius_plus(_halo_dim);
+    }
+    _steps_per_update = std::min(steps_minus, steps_plus);
+    if (_steps_per_update < 2) {
+      _steps_per_update = 1;
+      return;
+    }
+
+    coords_t ext_extents = _local_extents;
+    ext_extents[_halo_dim] += _halo_minus + _halo_plus;
+    _ext_extents = ext_extents;
+    _ext_strides = strides(ext_extents);
+    _ext_offsets = point_offsets(_ext_strides);
+    size_type ext_size = 1;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      ext_size *= ext_extents[d];
+    }
+    _ext_buffers[0].resize(ext_size);
+    _ext_buffers[1].resize(ext_size);
+  }
+
+  /**
+   * Single time step, computing inner elements while the halo regions are
+   * updated.
+   */
+  void step()
+  {
+    auto & src_halo  = halo(_current);
+    const value_t * in = _matrices[_current]->lbegin();
+    value_t       * out = _matrices[1 - _current]->lbegin();
+
+    src_halo.updateHalosAsync();
+
+    apply_region(in, out, _inner_lo, _inner_hi, _local_strides,
+                 _local_offsets);
+
+    src_halo.waitHalosAsync();
+
+    for (auto it = src_halo.bbegin(); it != src_halo.bend(); ++it) {
+      double value = 0;
+      for (std::size_t p = 0; p < NumPoints; ++p) {
+        auto dim = _point_dims[p];
+        value += StencilSpecT::weight(p) *
+                 ((dim < 0) ? *it
+                            : it.halo_value(dim, StencilSpecT::offset(p, dim)));
+      }
+      out[it.lpos()] = static_cast<value_t>(value);
+    }
+  }
+
+  /**
+   * Multiple time steps from a single halo update on the local block
+   * extended by the halo regions.
+   * The computed region shrinks by the stencil radius in every step until
+   * it matches the local block.
+   */
+  void sweep(size_type nsteps)
+  {
+    auto & src_halo     = halo(_current);
+    const value_t * in  = _matrices[_current]->lbegin();
+    value_t       * out = _matrices[1 - _current]->lbegin();
+
+    src_halo.updateHalos();
+
+    auto & halomemory = src_halo.haloMemory();
+    coords_t origin{};
+    coords_t block_origin{};
+    block_origin[_halo_dim] = _halo_minus;
+    copy_region(in, _local_strides, origin,
+                _ext_buffers[0].data(), _ext_strides, block_origin,
+                _local_extents);
+    if (_halo_minus > 0) {
+      coords_t region_extents = _local_extents;
+      region_extents[_halo_dim] = _halo_minus;
+      copy_region(halomemory.haloPos(_halo_dim, HaloRegion::MINUS),
+                  strides(region_extents), origin,
+                  _ext_buffers[0].data(), _ext_strides, origin,
+                  region_extents);
+    }
+    if (_halo_plus > 0) {
+      coords_t region_extents = _local_extents;
+      region_extents[_halo_dim] = _halo_plus;
+      coords_t region_origin{};
+      region_origin[_halo_dim] = _halo_minus + _local_extents[_halo_dim];
+      copy_region(halomemory.haloPos(_halo_dim, HaloRegion::PLUS),
+                  strides(region_extents), origin,
+                  _ext_buffers[0].data(), _ext_strides, region_origin,
+                  region_extents);
+    }
+    // Elements that are not computed are read from both buffers:
+    std::copy(_ext_buffers[0].begin(), _ext_buffers[0].end(),
+              _ext_buffers[1].begin());
+
+    coords_t lo;
+    coords_t hi;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      lo[d] = StencilSpecT::radius_minus(d);
+      hi[d] = _ext_extents[d] - StencilSpecT::radius_plus(d);
+    }
+    int ext_in = 0;
+    for (size_type s = 1; s <= nsteps; ++s) {
+      index_type rem = nsteps - s;
+      if (_halo_minus > 0) {
+        lo[_halo_dim] = _halo_minus -
+                        rem * StencilSpecT::radius_minus(_halo_dim);
+      }
+      if (_halo_plus > 0) {
+        hi[_halo_dim] = _halo_minus + _local_extents[_halo_dim] +
+                        rem * StencilSpecT::radius_plus(_halo_dim);
+      }
+      apply_region(_ext_buffers[ext_in].data(),
+                   _ext_buffers[1 - ext_in].data(),
+                   lo, hi, _ext_strides, _ext_offsets);
+      ext_in = 1 - ext_in;
+    }
+
+    copy_region(_ext_buffers[ext_in].data(), _ext_strides, block_origin,
+                out, _local_strides, origin,
+                _local_extents);
+  }
+
+  /**
+   * Computes the elements in the given region of a memory block with the
+   * given strides.
+   */
+  static void apply_region(
+    const value_t         * in,
+    value_t               * out,
+    const coords_t        & lo,
+    const coords_t        & hi,
+    const coords_t        & strides,
+    const point_offsets_t & offsets)
+  {
+    for_each_row(lo, hi, strides, TileExtent,
+      [&](index_type row_offset, index_type first, index_type last) {
+        const value_t * center = in  + row_offset;
+        value_t       * dest   = out + row_offset;
+#ifdef DASH_ENABLE_OPENMP
+        #pragma omp simd
+#endif
+        for (index_type i = first; i < last; ++i) {
+          double value = 0;
+          for (std::size_t p = 0; p < NumPoints; ++p) {
+            value += StencilSpecT::weight(p) * center[i + offsets[p]];
+          }
+          dest[i] = static_cast<value_t>(value);
+        }
+      });
+  }
+
+  /**
+   * Copies a region with the given extents between memory blocks with
+   * different strides.
+   */
+  static void copy_region(
+    const value_t  * src,
+    const coords_t & src_strides,
+    const coords_t & src_origin,
+    value_t        * dest,
+    const coords_t & dest_strides,
+    const coords_t & dest_origin,
+    const coords_t & extents)
+  {
+    src  += offset(src_origin, src_strides);
+    dest += offset(dest_origin, dest_strides);
+    coords_t origin{};
+    for_each_row(origin, extents, src_strides, extents[ContDim],
+      [&](index_type, index_type first, index_type last,
+          const coords_t & coords) {
+        auto src_row  = src  + offset(coords, src_strides);
+        auto dest_row = dest + offset(coords, dest_strides);
+        std::copy(src_row + first, src_row + last, dest_row + first);
+      });
+  }
+
+  /**
+   * Calls a function for every row of the region [lo, hi) in the
+   * contiguous dimension, split into tiles of the given extent.
+   * Rows are visited in memory order within each tile.
+   */
+  template<typename RowFunc>
+  static void for_each_row(
+    const coords_t & lo,
+    const coords_t & hi,
+    const coords_t & strides,
+    index_type       tile_extent,
+    RowFunc          func)
+  {
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      if (lo[d] >= hi[d]) {
+        return;
+      }
+    }
+    for (index_type first = lo[ContDim]; first < hi[ContDim];
+         first += tile_extent) {
+      index_type last = std::min(first + tile_extent, hi[ContDim]);
+      coords_t coords = lo;
+      coords[ContDim] = 0;
+      while (true) {
+        call_row_func(func, offset(coords, strides), first, last, coords);
+        // Advance to next row, skipping the contiguous dimension:
+        dim_t i = 1;
+        for (; i < NumDimensions; ++i) {
+          dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - i : i;
+          if (++coords[d] < hi[d]) {
+            break;
+          }
+          coords[d] = lo[d];
+        }
+        if (i == NumDimensions) {
+          break;
+        }
+      }
+    }
+  }
+
+  template<typename RowFunc>
+  static auto call_row_func(
+    RowFunc        & func,
+    index_type       row_offset,
+    index_type       first,
+    index_type       last,
+    const coords_t & coords)
+  -> decltype(func(row_offset, first, last, coords))
+  {
+    return func(row_offset, first, last, coords);
+  }
+
+  template<typename RowFunc>
+  static auto call_row_func(
+    RowFunc        & func,
+    index_type       row_offset,
+    index_type       first,
+    index_type       last,
+    const coords_t & )
+  -> decltype(func(row_offset, first, last))
+  {
+    return func(row_offset, first, last);
+  }
+
+  static index_type offset(const coords_t & coords, const coords_t & strides)
+  {
+    index_type offs = 0;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      offs += coords[d] * strides[d];
+    }
+    return offs;
+  }
+
+  static coords_t strides(const coords_t & extents)
+  {
+    coords_t strides;
+    index_type stride = 1;
+    for (dim_t i = 0; i < NumDimensions; ++i) {
+      dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - i : i;
+      strides[d] = stride;
+      stride    *= extents[d];
+    }
+    return strides;
+  }
+
+  static point_offsets_t point_offsets(const coords_t & strides)
+  {
+    point_offsets_t offsets;
+    for (std::size_t p = 0; p < NumPoints; ++p) {
+      offsets[p] = 0;
+      for (dim_t d = 0; d < NumDimensions; ++d) {
+        offsets[p] += StencilSpecT::offset(p, d) * strides[d];
+      }
+    }
+    return offsets;
+  }
+
+private:
+  halospec_t                _halospec;
+  std::array<MatrixT *, 2>  _matrices;
+  HaloMatrix_t              _halo_first;
+  HaloMatrix_t              _halo_second;
+  /// Index of the matrix containing the values of the last time step
+  int                       _current          = 0;
+
+  coords_t                  _local_extents;
+  coords_t                  _local_strides;
+  point_offsets_t           _local_offsets;
+  /// Inner region of the local block in local coordinates
+  coords_t                  _inner_lo;
+  coords_t                  _inner_hi;
+  /// Dimension of the offset of every point, -1 for the center element
+  std::array<int, NumPoints> _point_dims;
+
+  size_type                 _steps_per_update = 1;
+  /// Dimension of halo regions in temporal blocking
+  dim_t                     _halo_dim         = 0;
+  index_type                _halo_minus       = 0;
+  index_type                _halo_plus        = 0;
+  /// Local block extended by halo regions in temporal blocking
+  coords_t                  _ext_extents;
+  coords_t                  _ext_strides;
+  point_offsets_t           _ext_offsets;
+  std::vector<value_t>      _ext_buffers[2];
+};
+
+}  // namespace experimental
+}  // namespace dash
+
+#endif  // DASH__EXPERIMENTAL__STENCIL_OPERATOR_H__INCLUDED
@@ -159,11 +159,11 @@ public:
 
         if(diff < 0)
         {
-          halo_coords[dim] = std::abs(_halospec.halo_offset(dim).minus) + offset;
+          halo_coords[dim] = std::abs(_halospec.halo_offset(dim).minus) + diff;
         }
         else
         {
-          halo_coords[dim] = offset - 1;
+          halo_coords[dim] = diff - _haloblock.view().extent(dim);
           halo_region = HaloRegion::PLUS;
         }
 
@@ -14,8 +14,12 @@
 #include <dash/atomic/GlobAtomicRef.h>
 
 #include <dash/map/UnorderedMapLocalRef.h>
+#include <dash/map/UnorderedMapConcurrentRef.h>
 #include <dash/map/UnorderedMapLocalIter.h>
 #include <dash/map/UnorderedMapGlobIter.h>
+#include <dash/map/UnorderedMapLocalIndex.h>
+
+#include <dash/dart/if/dart_communication.h>
 
 #include <iterator>
 #include <utility>
@@ -24,6 +28,9 @@
 #include <functional>
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
 
 
 namespace dash {
@@ -70,12 +77,76 @@ private:
   team_unit_t   _myid;
 }; // class HashLocal
 
+/**
+ * Hash function of \c dash::UnorderedMap mapping keys to units by their
+ * hash values, distributing keys evenly over all units in the team.
+ * Every key has a fixed owner unit, so elements can be looked up without
+ * searching other units.
+ */
+template<
+  typename Key,
+  typename KeyHash = std::hash<Key> >
+class HashPartition
+{
+private:
+  typedef dash::default_size_t size_type;
+
+public:
+  typedef Key          argument_type;
+  typedef team_unit_t result_type;
+
+public:
+  /**
+   * Default constructor.
+   */
+  HashPartition()
+  : _nunits(0)
+  { }
+
+  /**
+   * Constructor.
+   */
+  HashPartition(
+    dash::Team & team)
+  : _nunits(team.size())
+  { }
+
+  result_type operator()(
+    const argument_type & key) const
+  {
+    if (_nunits == 0) {
+      return result_type{0};
+    }
+    return result_type(
+             dash::internal::unordered_map_hash_mix(_key_hash(key))
+             % _nunits);
+  }
+
+private:
+  size_type _nunits = 0;
+  KeyHash   _key_hash;
+}; // class HashPartition
+
+namespace internal {
+
+/**
+ * Whether elements are stored at the unit inserting them instead of a
+ * fixed owner unit of their key.
+ */
+template<typename Hash>
+struct is_local_hash : std::false_type { };
+
+template<typename Key>
+struct is_local_hash< dash::HashLocal<Key> > : std::true_type { };
+
+} // namespace internal
+
 #ifndef DOXYGEN
 
 template<
   typename Key,
   typename Mapped,
-  typename Hash    = dash::HashLocal<Key>,
+  typename Hash    = dash::HashPartition<Key>,
   typename Pred    = std::equal_to<Key>,
   typename Alloc   = dash::allocator::EpochSynchronizedAllocator<
                        std::pair<const Key, Mapped> > >
@@ -89,6 +160,9 @@ class UnorderedMap
   template<typename K_, typename M_, typename H_, typename P_, typename A_>
   friend class UnorderedMapLocalRef;
 
+  template<typename K_, typename M_, typename H_, typename P_, typename A_>
+  friend class UnorderedMapConcurrentRef;
+
   template<typename K_, typename M_, typename H_, typename P_, typename A_>
   friend class UnorderedMapGlobIter;
 
@@ -112,6 +186,8 @@ public:
   typedef std::pair<const key_type, mapped_type>                  value_type;
 
   typedef UnorderedMapLocalRef<Key, Mapped, Hash, Pred, Alloc>    local_type;
+  typedef UnorderedMapConcurrentRef<Key, Mapped, Hash, Pred, Alloc>
+    concurrent_type;
 
   typedef dash::GlobHeapMem<value_type, allocator_type>        glob_mem_type;
 
@@ -168,6 +244,39 @@ public:
             size_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
     local_sizes_map;
 
+  /// Operation combining the mapped values of an existing element and of
+  /// a value inserted with an equivalent key, e.g. \c dash::plus.
+  typedef std::function<
+            mapped_type(const mapped_type &, const mapped_type &) >
+    merge_function;
+
+private:
+  typedef dash::internal::UnorderedMapLocalIndex<Key, Pred, index_type>
+    local_index_map;
+  typedef typename local_index_map::slot_type
+    index_slot_type;
+
+  /// Result of the insertion of a value at its owner unit.
+  struct insert_result_t {
+    index_type lidx;
+    index_type inserted;
+  };
+
+  /// Values inserted by threads in concurrent local mode with keys in a
+  /// range of hash values.
+  struct concurrent_stripe_t {
+    std::mutex              mutex;
+    std::vector<value_type> values;
+    /// Maps keys of values to their position in \c values.
+    local_index_map         index;
+    /// Merge operation of the values, keeps the first value if empty.
+    merge_function          merge;
+  };
+
+  /// Number of separately locked stripes of values inserted in concurrent
+  /// local mode.
+  static constexpr size_type concurrent_stripes = 64;
+
 private:
   /// Team containing all units interacting with the map.
   dash::Team           * _team            = nullptr;
@@ -189,9 +298,31 @@ private:
   local_sizes_map        _local_sizes;
   /// Cumulative (postfix sum) local sizes of all units.
   std::vector<size_type> _local_cumul_sizes;
-  /// Iterators to elements in local memory space that are marked for move
-  /// to remote unit in next commit.
-  std::vector<iterator>  _move_elements;
+  /// Local indices of elements in local memory space that are marked for
+  /// move to their owner unit in next commit.
+  std::vector<index_type> _move_elements;
+  /// Hash table mapping keys of local elements to their local index.
+  local_index_map        _local_index;
+  /// Values of range insertions since the last commit, grouped by owner
+  /// unit.
+  std::vector< std::vector<value_type> > _staged_values;
+  /// Hash tables mapping keys of staged values to their position in
+  /// \c _staged_values, for every owner unit.
+  std::vector<local_index_map>           _staged_index;
+  /// Operation merging staged values with elements with equivalent keys,
+  /// existing elements are kept if empty.
+  merge_function         _staged_merge;
+  /// Whether values have been staged without merge operation since the
+  /// last commit.
+  bool                   _staged_unmerged = false;
+  /// Values inserted by threads in concurrent local mode since the last
+  /// commit.
+  std::unique_ptr<concurrent_stripe_t[]> _concurrent_stripes;
+  /// Global pointer to the local hash tables of all units as published in
+  /// the last commit.
+  dart_gptr_t            _index_gptr      = DART_GPTR_NULL;
+  /// Number of slots in the published local hash table of every unit.
+  size_type              _index_capacity  = 0;
   /// Global pointer to local element in _local_sizes.
   dart_gptr_t            _local_size_gptr = DART_GPTR_NULL;
   /// Hash type for mapping of key to unit and local offset.
@@ -207,6 +338,9 @@ private:
 public:
   /// Local proxy object, allows use in range-based for loops.
   local_type local;
+  /// Proxy object for concurrent insertion and lookup by multiple threads
+  /// of the local unit.
+  concurrent_type concurrent;
 
 public:
   UnorderedMap(
@@ -215,7 +349,8 @@ public:
   : _team(&team),
     _myid(team.myid()),
     _key_hash(team),
-    local(this)
+    local(this),
+    concurrent(this)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap(nelem,team)", nelem);
     if (_team->size() > 0) {
@@ -232,7 +367,8 @@ public:
     _myid(team.myid()),
     _key_hash(team),
     _local_buffer_size(nlbuf),
-    local(this)
+    local(this),
+    concurrent(this)
   {
     DASH_LOG_TRACE("UnorderedMap(nelem,nlbuf,team)",
                    "nelem:", nelem, "nlbuf:", nlbuf);
@@ -273,9 +409,15 @@ public:
   void barrier()
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.barrier()", _team->dart_id());
-    // Apply changes in local memory spaces to global memory space:
     if (_globmem != nullptr) {
+      // Move elements and staged values inserted for remote units to their
+      // owners:
+      _commit_inserts();
+      // Apply changes in local memory spaces to global memory space:
       _globmem->commit();
+      // Publish local hash tables for lookups of remote units, made
+      // visible by the barrier on local sizes:
+      _publish_index();
     }
     // Accumulate local sizes of remote units:
     _local_sizes.barrier();
@@ -302,6 +444,7 @@ public:
                    "invalid size after global commit");
     _begin = iterator(this, 0);
     _end   = iterator(this, new_size);
+    _lend  = _lbegin + lsize();
     DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
   }
 
@@ -332,6 +475,13 @@ public:
     }
     _key_hash    = hasher(*_team);
     _remote_size = 0;
+    _local_index.clear();
+    _move_elements.clear();
+    _staged_values.clear();
+    _staged_index.clear();
+    _staged_merge     = merge_function();
+    _staged_unmerged  = false;
+    _concurrent_stripes.reset(new concurrent_stripe_t[concurrent_stripes]);
     auto lcap    = dash::math::div_ceil(nelem, _team->size());
     // Initialize members:
     _myid        = _team->myid();
@@ -390,6 +540,20 @@ public:
       delete _globmem;
       _globmem = nullptr;
     }
+    if (!DART_GPTR_ISNULL(_index_gptr)) {
+      DASH_ASSERT_RETURNS(
+        dart_team_memfree(_index_gptr),
+        DART_OK);
+      _index_gptr     = DART_GPTR_NULL;
+      _index_capacity = 0;
+    }
+    _local_index.clear();
+    _move_elements.clear();
+    _staged_values.clear();
+    _staged_index.clear();
+    _staged_merge     = merge_function();
+    _staged_unmerged  = false;
+    _concurrent_stripes.reset();
     _local_cumul_sizes    = std::vector<size_type>(_team->size(), 0);
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
@@ -552,16 +716,22 @@ public:
   mapped_type_reference at(const key_type & key)
   {
     DASH_LOG_TRACE("UnorderedMap.at()", "key:", key);
-    // TODO: Unoptimized, currently calls find(key) twice as operator[](key)
-    //       calls insert(key).
-    const_iterator git_value = find(key);
+    iterator git_value = find(key);
     if (git_value == _end) {
       // No equivalent key in map, throw:
       DASH_THROW(
         dash::exception::InvalidArgument,
         "No element in map for key " << key);
     }
-    auto mapped = this->operator[](key);
+    dart_gptr_t   gptr_mapped = git_value.dart_gptr();
+    value_type  * lptr_value  = static_cast<value_type *>(
+                                  git_value.local());
+    mapped_type * lptr_mapped = nullptr;
+
+    _lptr_value_to_mapped(lptr_value, gptr_mapped, lptr_mapped);
+    // Create global reference to mapped value member in element:
+    mapped_type_reference mapped(gptr_mapped,
+                                 lptr_mapped);
     DASH_LOG_TRACE("UnorderedMap.at >", mapped);
     return mapped;
   }
@@ -584,24 +754,120 @@ public:
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    iterator found = _end;
+    // Elements in local memory, including elements inserted for remote
+    // units since the last commit:
+    index_type lidx = _local_index.find(key, _key_equal);
+    if (lidx >= 0) {
+      found = iterator(this, _myid, lidx);
+    } else {
+      // Look up key in the hash table of its owner:
+      auto unit = _key_hash(key);
+      if (unit != _myid) {
+        lidx = _find_remote(unit, key);
+        if (lidx >= 0) {
+          found = iterator(this, unit, lidx);
+        }
+      } else if (dash::internal::is_local_hash<hasher>::value) {
+        // Key might be stored at any unit:
+        for (size_type u = 0; u < _team->size() && lidx < 0; ++u) {
+          team_unit_t unit_u(u);
+          if (unit_u != _myid) {
+            lidx = _find_remote(unit_u, key);
+            if (lidx >= 0) {
+              found = iterator(this, unit_u, lidx);
+            }
+          }
+        }
+      }
+    }
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
 
   const_iterator find(const key_type & key) const
   {
-    DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
-    DASH_LOG_TRACE("UnorderedMap.find const >", found);
+    return const_cast<self_t *>(this)->find(key);
+  }
+
+  template<class InputIterator>
+  std::vector<iterator> find_many(
+    /// Iterator at first key in the range to look up.
+    InputIterator first,
+    /// Iterator past the last key in the range to look up.
+    InputIterator last)
+  {
+    DASH_LOG_TRACE("UnorderedMap.find_many()");
+    std::vector<key_type> keys(first, last);
+    std::vector<iterator> found(keys.size(), _end);
+    if (dash::internal::is_local_hash<hasher>::value) {
+      // Keys have no owner unit:
+      for (size_type k = 0; k < keys.size(); ++k) {
+        found[k] = find(keys[k]);
+      }
+      return found;
+    }
+
+    // Keys not found in local memory, grouped by owner unit:
+    size_type               nunits = _team->size();
+    std::vector<size_t>     send_counts(nunits, 0);
+    std::vector<team_unit_t> owners(keys.size(), _myid);
+    for (size_type k = 0; k < keys.size(); ++k) {
+      index_type lidx = _local_index.find(keys[k], _key_equal);
+      if (lidx >= 0) {
+        found[k] = iterator(this, _myid, lidx);
+        continue;
+      }
+      owners[k] = _key_hash(keys[k]);
+      if (owners[k] != _myid) {
+        ++send_counts[owners[k].id];
+      }
+    }
+    std::vector<size_t> send_offsets = _exclusive_sum(send_counts);
+    std::vector<size_t> send_pos     = send_offsets;
+    std::vector<char>   send_keys(
+                          (send_offsets[nunits - 1] +
+                           send_counts[nunits - 1]) * sizeof(key_type));
+    for (size_type k = 0; k < keys.size(); ++k) {
+      if (owners[k] != _myid) {
+        std::memcpy(send_keys.data() +
+                      send_pos[owners[k].id]++ * sizeof(key_type),
+                    &keys[k], sizeof(key_type));
+      }
+    }
+
+    // Owners look up received keys in their published hash table:
+    std::vector<size_t> recv_counts = send_counts;
+    std::vector<char>   recv_keys   = _exchange(
+                                        send_keys, recv_counts,
+                                        sizeof(key_type));
+    size_type nrecv = recv_keys.size() / sizeof(key_type);
+    std::vector<char> replies(nrecv * sizeof(index_type));
+    for (size_type r = 0; r < nrecv; ++r) {
+      key_type key;
+      std::memcpy(&key, recv_keys.data() + r * sizeof(key_type),
+                  sizeof(key_type));
+      index_type lidx = _find_published(key);
+      std::memcpy(replies.data() + r * sizeof(index_type),
+                  &lidx, sizeof(index_type));
+    }
+    std::vector<char> lidcs = _exchange(
+                                replies, recv_counts, sizeof(index_type));
+
+    send_pos = send_offsets;
+    for (size_type k = 0; k < keys.size(); ++k) {
+      if (owners[k] != _myid) {
+        index_type lidx;
+        std::memcpy(&lidx,
+                    lidcs.data() + send_pos[owners[k].id]++ * sizeof(index_type),
+                    sizeof(index_type));
+        if (lidx >= 0) {
+          found[k] = iterator(this, owners[k], lidx);
+        }
+      }
+    }
+    DASH_LOG_TRACE("UnorderedMap.find_many >",
+                   "keys:", keys.size(), "remote:", nrecv);
     return found;
   }
 
@@ -627,15 +893,21 @@ public:
     if (found != _end) {
       DASH_LOG_TRACE("UnorderedMap.insert", "key found");
       // Existing element found, no insertion:
-      result.first  = iterator(this, found.pos());
+      result.first  = found;
       result.second = false;
     } else {
       DASH_LOG_TRACE("UnorderedMap.insert", "key not found");
       // Unit mapped to the new element's key by the hash function:
       auto unit = _key_hash(key);
       DASH_LOG_TRACE("UnorderedMap.insert", "target unit:", unit);
-      // No element with specified key exists, insert new value.
-      result = _insert_at(unit, value);
+      // No element with specified key exists, insert new value in local
+      // memory:
+      result = _insert_at(_myid, value);
+      if (unit != _myid) {
+        DASH_LOG_TRACE("UnorderedMap.insert", "remote insertion");
+        // Mark inserted element for move to remote unit in next commit:
+        _move_elements.push_back(lsize() - 1);
+      }
     }
     DASH_LOG_DEBUG("UnorderedMap.insert >",
                    (result.second ? "inserted" : "existing"), ":",
@@ -650,13 +922,86 @@ public:
     // Iterator past the last value in the range to insert.
     InputIterator last)
   {
-    // TODO: Calling insert() on every single element in the range could cause
-    //       multiple calls of globmem.grow(_local_buffer_size).
-    //       Could be optimized to allocate additional memory in a single call
-    //       of globmem.grow(std::distance(first,last)).
+    _stage_values(first, last, merge_function());
+  }
+
+  template<class InputIterator, class MergeOp>
+  void insert(
+    // Iterator at first value in the range to insert.
+    InputIterator first,
+    // Iterator past the last value in the range to insert.
+    InputIterator last,
+    // Binary operation merging mapped values with equivalent keys.
+    MergeOp       merge)
+  {
+    _stage_values(first, last, merge_function(merge));
+  }
+
+  template<class InputIterator>
+  std::vector< std::pair<iterator, bool> > insert_many(
+    /// Iterator at first value in the range to insert.
+    InputIterator first,
+    /// Iterator past the last value in the range to insert.
+    InputIterator last)
+  {
+    DASH_LOG_TRACE("UnorderedMap.insert_many()");
+    // Move elements inserted before so local indices of elements do not
+    // change in the commit below:
+    _commit_inserts();
+
+    // Values grouped by owner unit:
+    size_type                nunits = _team->size();
+    std::vector<size_t>      send_counts(nunits, 0);
+    std::vector<team_unit_t> owners;
     for (auto it = first; it != last; ++it) {
-      insert(*it);
+      owners.push_back(_key_hash((*it).first));
+      ++send_counts[owners.back().id];
+    }
+    std::vector<size_t> send_offsets = _exclusive_sum(send_counts);
+    std::vector<size_t> send_pos     = send_offsets;
+    std::vector<char>   send_values(owners.size() * sizeof(value_type));
+    size_type           v = 0;
+    for (auto it = first; it != last; ++it, ++v) {
+      const value_type & value = *it;
+      std::memcpy(send_values.data() +
+                    send_pos[owners[v].id]++ * sizeof(value_type),
+                  &value, sizeof(value_type));
+    }
+
+    // Owners insert received values and reply their local index:
+    std::vector<size_t> recv_counts = send_counts;
+    std::vector<char>   recv_values = _exchange(
+                                        send_values, recv_counts,
+                                        sizeof(value_type));
+    auto inserted = _insert_local_values(
+                      reinterpret_cast<const value_type *>(
+                        recv_values.data()),
+                      recv_values.size() / sizeof(value_type),
+                      merge_function());
+    std::vector<char> replies(inserted.size() * sizeof(insert_result_t));
+    std::memcpy(replies.data(), inserted.data(), replies.size());
+    std::vector<char> results = _exchange(
+                                  replies, recv_counts,
+                                  sizeof(insert_result_t));
+
+    // Commit inserted elements, updating global iteration space:
+    barrier();
+
+    std::vector< std::pair<iterator, bool> > result;
+    result.reserve(owners.size());
+    send_pos = send_offsets;
+    for (v = 0; v < owners.size(); ++v) {
+      insert_result_t res;
+      std::memcpy(&res,
+                  results.data() +
+                    send_pos[owners[v].id]++ * sizeof(insert_result_t),
+                  sizeof(insert_result_t));
+      result.push_back(
+        std::make_pair(iterator(this, owners[v], res.lidx),
+                       res.inserted != 0));
     }
+    DASH_LOG_TRACE("UnorderedMap.insert_many >", "values:", owners.size());
+    return result;
   }
 
   iterator erase(
@@ -826,18 +1171,13 @@ private:
     // Using placement new to avoid assignment/copy as value_type is
     // const:
     new (lptr_insert) value_type(value);
+    _local_index.insert(value.first, old_local_size);
     // Convert local iterator to global iterator:
     DASH_LOG_TRACE("UnorderedMap._insert_at", "converting to global iterator",
                    "unit:", unit, "lidx:", old_local_size);
     result.first  = iterator(this, unit, old_local_size);
     result.second = true;
 
-    if (unit != _myid) {
-      DASH_LOG_TRACE("UnorderedMap.insert", "remote insertion");
-      // Mark inserted element for move to remote unit in next commit:
-      _move_elements.push_back(result.first);
-    }
-
     // Update iterators as global memory space has been changed for the
     // active unit:
     auto new_size = size();
@@ -846,6 +1186,7 @@ private:
     _begin        = iterator(this, 0);
     DASH_LOG_TRACE("UnorderedMap._insert_at", "updating _end");
     _end          = iterator(this, new_size);
+    _lend         = _lbegin + lsize();
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _begin);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _end);
     DASH_LOG_DEBUG("UnorderedMap._insert_at >",
@@ -854,6 +1195,519 @@ private:
     return result;
   }
 
+  /**
+   * Stages values of a range insertion for the next commit, grouped by
+   * their owner unit.
+   * Values with equivalent keys are merged before they are sent.
+   */
+  template<class InputIterator>
+  void _stage_values(
+    InputIterator  first,
+    InputIterator  last,
+    merge_function merge)
+  {
+    DASH_LOG_TRACE("UnorderedMap._stage_values()");
+    DASH_ASSERT(_globmem != nullptr);
+    if (merge) {
+      _staged_merge = merge;
+    } else if (first != last) {
+      _staged_unmerged = true;
+    }
+    for (auto it = first; it != last; ++it) {
+      _stage_value(*it, merge);
+    }
+    DASH_LOG_TRACE("UnorderedMap._stage_values >");
+  }
+
+  /**
+   * Stages a single value for the next commit, merging it with a staged
+   * value with equivalent key using the given merge operation.
+   */
+  void _stage_value(
+    const value_type     & value,
+    const merge_function & merge)
+  {
+    if (_staged_values.empty()) {
+      _staged_values.resize(_team->size());
+      _staged_index.resize(_team->size());
+    }
+    auto   unit   = _key_hash(value.first);
+    auto & staged = _staged_values[unit.id];
+    auto & index  = _staged_index[unit.id];
+    index_type pos = index.find(value.first, _key_equal);
+    if (pos < 0) {
+      index.insert(value.first, staged.size());
+      staged.push_back(value);
+    } else if (merge) {
+      staged[pos].second = merge(staged[pos].second, value.second);
+    }
+  }
+
+  /**
+   * Stripe of values inserted in concurrent local mode containing the
+   * given key.
+   */
+  concurrent_stripe_t & _concurrent_stripe(const key_type & key) const
+  {
+    uint64_t h = dash::internal::unordered_map_hash_mix(
+                   std::hash<key_type>()(key));
+    return _concurrent_stripes[(h >> 32) % concurrent_stripes];
+  }
+
+  /**
+   * Stages the values inserted by threads in concurrent local mode,
+   * aggregating them with values of range insertions by owner unit.
+   */
+  void _stage_concurrent_values()
+  {
+    if (!_concurrent_stripes) {
+      return;
+    }
+    for (size_type s = 0; s < concurrent_stripes; ++s) {
+      auto & stripe = _concurrent_stripes[s];
+      if (stripe.merge) {
+        _staged_merge = stripe.merge;
+      } else if (!stripe.values.empty()) {
+        _staged_unmerged = true;
+      }
+      for (const auto & value : stripe.values) {
+        _stage_value(value, stripe.merge);
+      }
+      std::vector<value_type>().swap(stripe.values);
+      stripe.index = local_index_map();
+      stripe.merge = merge_function();
+    }
+  }
+
+  /**
+   * Ensures local memory provides storage for \c nvalues additional
+   * elements, growing the local memory space in a single allocation.
+   */
+  void _reserve_local(size_type nvalues)
+  {
+    size_type new_local_size = lsize() + nvalues;
+    size_type local_capacity = _globmem->local_size();
+    if (new_local_size > local_capacity) {
+      DASH_LOG_TRACE("UnorderedMap._reserve_local",
+                     "globmem.grow(", new_local_size - local_capacity, ")");
+      _globmem->grow(
+        std::max(new_local_size - local_capacity, _local_buffer_size));
+    }
+  }
+
+  /**
+   * Inserts values with keys mapped to the local unit, reserving storage
+   * for all new elements in a single allocation.
+   * Values with keys that already exist are not inserted but merged into
+   * the existing element if a merge operation is specified.
+   *
+   * \return  Local index of every value's element and whether it has been
+   *          inserted.
+   */
+  std::vector<insert_result_t> _insert_local_values(
+    const value_type     * values,
+    size_type              nvalues,
+    const merge_function & merge)
+  {
+    DASH_LOG_TRACE("UnorderedMap._insert_local_values()",
+                   "values:", nvalues);
+    std::vector<insert_result_t> result(nvalues);
+    std::vector<size_type>       new_values;
+    // Local indices of elements and indices of values merged into them:
+    std::vector< std::pair<index_type, size_type> > merges;
+    size_type                    old_local_size = lsize();
+    _local_index.reserve(_local_index.size() + nvalues);
+    for (size_type v = 0; v < nvalues; ++v) {
+      index_type lidx = _local_index.find(values[v].first, _key_equal);
+      result[v].inserted = (lidx < 0);
+      if (lidx < 0) {
+        lidx = old_local_size + new_values.size();
+        _local_index.insert(values[v].first, lidx);
+        new_values.push_back(v);
+      } else if (merge) {
+        merges.push_back(std::make_pair(lidx, v));
+      }
+      result[v].lidx = lidx;
+    }
+    if (new_values.empty() && merges.empty()) {
+      return result;
+    }
+    _reserve_local(new_values.size());
+    auto l_it = _globmem->lbegin() + old_local_size;
+    for (auto v : new_values) {
+      new (static_cast<value_type *>(l_it)) value_type(values[v]);
+      ++l_it;
+    }
+    // Merge values in order of local index, keeping the order of values
+    // with equivalent keys:
+    std::stable_sort(merges.begin(), merges.end(),
+                     [](const std::pair<index_type, size_type> & a,
+                        const std::pair<index_type, size_type> & b) {
+                       return a.first < b.first;
+                     });
+    l_it = _globmem->lbegin();
+    index_type l_pos = 0;
+    for (const auto & m : merges) {
+      l_it  += m.first - l_pos;
+      l_pos  = m.first;
+      value_type * lptr = static_cast<value_type *>(l_it);
+      lptr->second = merge(lptr->second, values[m.second].second);
+    }
+    if (!new_values.empty()) {
+      GlobRef<Atomic<size_type>>(_local_size_gptr).fetch_add(
+                                                     new_values.size());
+      _local_cumul_sizes[_myid] += new_values.size();
+      _begin = iterator(this, 0);
+      _end   = iterator(this, size());
+      _lend  = _lbegin + lsize();
+    }
+    DASH_LOG_TRACE("UnorderedMap._insert_local_values >",
+                   "inserted:", new_values.size(), "merged:", merges.size());
+    return result;
+  }
+
+  /**
+   * Moves elements in local memory that are mapped to remote units and
+   * values staged in range insertions to their owners in a single
+   * all-to-all exchange.
+   * Owners reserve storage for all received values at once.
+   * If multiple units inserted elements with equivalent keys, the element
+   * received first is kept and staged values are merged into it.
+   *
+   * Collective operation.
+   *
+   * \throws dash::exception::InvalidArgument
+   *   at all units if values have been staged with a merge operation at
+   *   some but not all units, or with and without merge operation at a
+   *   single unit. Staged values are discarded in this case.
+   */
+  void _commit_inserts()
+  {
+    DASH_LOG_TRACE("UnorderedMap._commit_inserts()",
+                   "local elements to move:", _move_elements.size());
+    _stage_concurrent_values();
+    // Whether any unit specified a merge operation and whether any unit
+    // specified none for some of its values, checked before data is moved
+    // so all units throw:
+    int l_merge_flags[2] = { _staged_merge ? 1 : 0,
+                             (!_staged_merge || _staged_unmerged) ? 1 : 0 };
+    _staged_unmerged     = false;
+    int merge_flags[2]   = { 0, 0 };
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        l_merge_flags,
+        merge_flags,
+        2,
+        DART_TYPE_INT,
+        DART_OP_MAX,
+        _team->dart_id()),
+      DART_OK);
+    if (merge_flags[0] != 0 && merge_flags[1] != 0) {
+      _staged_values.clear();
+      _staged_index.clear();
+      _staged_merge = merge_function();
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "UnorderedMap: values staged with merge operation at some " <<
+        "but not all units or insertions, merge operation specified " <<
+        "at unit " << _myid << ": " <<
+        (l_merge_flags[0] == 0 ? "no" :
+         l_merge_flags[1] == 0 ? "yes" : "partially"));
+    }
+    size_type                 nunits = _team->size();
+    // Number of moved elements for every unit:
+    std::vector<size_t>       move_counts(nunits, 0);
+    std::vector<size_t>       send_counts(nunits, 0);
+    std::vector<team_unit_t>  owners;
+    std::vector<value_type *> lptrs;
+    std::sort(_move_elements.begin(), _move_elements.end());
+    auto l_it = _globmem->lbegin();
+    index_type l_pos = 0;
+    for (auto lidx : _move_elements) {
+      l_it  += lidx - l_pos;
+      l_pos  = lidx;
+      lptrs.push_back(static_cast<value_type *>(l_it));
+      owners.push_back(_key_hash(lptrs.back()->first));
+      ++move_counts[owners.back().id];
+    }
+    for (size_type u = 0; u < nunits; ++u) {
+      send_counts[u] = move_counts[u];
+      if (!_staged_values.empty()) {
+        send_counts[u] += _staged_values[u].size();
+      }
+    }
+    // Moved elements precede staged values for every unit:
+    std::vector<size_t> send_pos = _exclusive_sum(send_counts);
+    std::vector<char>   send_values(
+                          (send_pos[nunits - 1] + send_counts[nunits - 1])
+                          * sizeof(value_type));
+    for (size_type m = 0; m < lptrs.size(); ++m) {
+      std::memcpy(send_values.data() +
+                    send_pos[owners[m].id]++ * sizeof(value_type),
+                  lptrs[m], sizeof(value_type));
+    }
+    for (size_type u = 0; u < nunits && !_staged_values.empty(); ++u) {
+      std::memcpy(send_values.data() + send_pos[u] * sizeof(value_type),
+                  _staged_values[u].data(),
+                  _staged_values[u].size() * sizeof(value_type));
+    }
+    _staged_values.clear();
+    _staged_index.clear();
+    std::vector<size_t> recv_move_counts(nunits);
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(
+        move_counts.data(),
+        recv_move_counts.data(),
+        1,
+        DART_TYPE_SIZET,
+        _team->dart_id()),
+      DART_OK);
+    std::vector<size_t> recv_counts = send_counts;
+    std::vector<char>   recv_bytes  = _exchange(
+                                        send_values, recv_counts,
+                                        sizeof(value_type));
+    _remove_local_elements(_move_elements);
+    _move_elements.clear();
+    const value_type * recv_values =
+      reinterpret_cast<const value_type *>(recv_bytes.data());
+    _reserve_local(recv_bytes.size() / sizeof(value_type));
+    merge_function merge = _staged_merge;
+    _staged_merge        = merge_function();
+    for (size_type u = 0; u < nunits; ++u) {
+      size_type nmoved = recv_move_counts[u];
+      _insert_local_values(recv_values, nmoved, merge_function());
+      _insert_local_values(recv_values + nmoved,
+                           recv_counts[u] - nmoved, merge);
+      recv_values += recv_counts[u];
+    }
+    DASH_LOG_TRACE("UnorderedMap._commit_inserts >");
+  }
+
+  /**
+   * Removes elements at the given sorted local indices from local memory
+   * and rebuilds the local hash table.
+   */
+  void _remove_local_elements(
+    const std::vector<index_type> & lindices)
+  {
+    if (lindices.empty()) {
+      return;
+    }
+    size_type  old_local_size = lsize();
+    auto       l_in           = _globmem->lbegin();
+    auto       l_out          = l_in;
+    auto       remove_it      = lindices.begin();
+    index_type l_out_pos      = 0;
+    _local_index.clear();
+    for (index_type l_in_pos = 0; l_in_pos < old_local_size;
+         ++l_in_pos, ++l_in) {
+      if (remove_it != lindices.end() && *remove_it == l_in_pos) {
+        ++remove_it;
+        continue;
+      }
+      value_type * lptr_in = static_cast<value_type *>(l_in);
+      if (l_out_pos != l_in_pos) {
+        new (static_cast<value_type *>(l_out)) value_type(*lptr_in);
+      }
+      _local_index.insert(lptr_in->first, l_out_pos);
+      ++l_out;
+      ++l_out_pos;
+    }
+    size_type nremoved         = old_local_size - l_out_pos;
+    _local_sizes.local[0]      = l_out_pos;
+    _local_cumul_sizes[_myid] -= nremoved;
+    _lend                      = _lbegin + lsize();
+  }
+
+  /**
+   * Copies the local hash table to global memory, so remote units can
+   * look up keys of local elements.
+   * The published tables of all units have the same capacity.
+   *
+   * Collective operation, the published tables are visible to other units
+   * after the next barrier.
+   */
+  void _publish_index()
+  {
+    size_type l_capacity = _local_index.capacity();
+    size_type capacity   = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &l_capacity,
+        &capacity,
+        1,
+        dash::dart_datatype<size_type>::value,
+        DART_OP_MAX,
+        _team->dart_id()),
+      DART_OK);
+    if (capacity != _index_capacity) {
+      DASH_LOG_TRACE("UnorderedMap._publish_index",
+                     "reallocating published hash tables, capacity:",
+                     capacity);
+      if (!DART_GPTR_ISNULL(_index_gptr)) {
+        DASH_ASSERT_RETURNS(
+          dart_team_memfree(_index_gptr),
+          DART_OK);
+      }
+      DASH_ASSERT_RETURNS(
+        dart_team_memalloc_aligned(
+          _team->dart_id(),
+          capacity * sizeof(index_slot_type),
+          DART_TYPE_BYTE,
+          &_index_gptr),
+        DART_OK);
+      _index_capacity = capacity;
+    }
+    if (l_capacity < capacity) {
+      _local_index.rehash(capacity);
+    }
+    std::memcpy(_published_slots(),
+                _local_index.data(),
+                capacity * sizeof(index_slot_type));
+  }
+
+  /**
+   * Native pointer to the local hash table published in global memory.
+   */
+  index_slot_type * _published_slots() const
+  {
+    dart_gptr_t gptr = _index_gptr;
+    void      * addr = nullptr;
+    DASH_ASSERT_RETURNS(
+      dart_gptr_setunit(&gptr, _myid),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_gptr_getaddr(gptr, &addr),
+      DART_OK);
+    return static_cast<index_slot_type *>(addr);
+  }
+
+  /**
+   * Looks up a key in the local hash table as published in the last
+   * commit.
+   */
+  index_type _find_published(const key_type & key) const
+  {
+    if (_index_capacity == 0) {
+      return local_index_map::not_found;
+    }
+    const index_slot_type * slots = _published_slots();
+    size_type  home = local_index_map::home_slot(key, _index_capacity);
+    bool       done = false;
+    index_type lidx = local_index_map::find_in_slots(
+                        slots + home, _index_capacity - home,
+                        key, _key_equal, done);
+    if (!done) {
+      lidx = local_index_map::find_in_slots(
+               slots, home, key, _key_equal, done);
+    }
+    return lidx;
+  }
+
+  /**
+   * Looks up a key in the published hash table of a remote unit.
+   * Slots are read in windows starting at the key's home slot, usually a
+   * single read is required.
+   */
+  index_type _find_remote(
+    team_unit_t      unit,
+    const key_type & key) const
+  {
+    if (_index_capacity == 0) {
+      return local_index_map::not_found;
+    }
+    const size_type window = 8;
+    index_slot_type slots[window];
+    size_type slot = local_index_map::home_slot(key, _index_capacity);
+    for (size_type probed = 0; probed < _index_capacity; ) {
+      size_type   nslots = std::min(window, _index_capacity - slot);
+      dart_gptr_t gptr   = _index_gptr;
+      DASH_ASSERT_RETURNS(
+        dart_gptr_setunit(&gptr, unit),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_gptr_incaddr(&gptr, slot * sizeof(index_slot_type)),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_get_blocking(
+          slots, gptr, nslots * sizeof(index_slot_type), DART_TYPE_BYTE),
+        DART_OK);
+      bool       done = false;
+      index_type lidx = local_index_map::find_in_slots(
+                          slots, nslots, key, _key_equal, done);
+      if (done) {
+        return lidx;
+      }
+      probed += nslots;
+      slot    = (slot + nslots) & (_index_capacity - 1);
+    }
+    return local_index_map::not_found;
+  }
+
+  /**
+   * Sends \c counts[u] elements of \c elem_size bytes in \c sendbuf to
+   * every unit \c u in a single all-to-all exchange.
+   * On return, \c counts contains the number of elements received from
+   * every unit.
+   *
+   * Collective operation.
+   */
+  std::vector<char> _exchange(
+    const std::vector<char> & sendbuf,
+    std::vector<size_t>     & counts,
+    size_t                    elem_size) const
+  {
+    size_type           nunits = _team->size();
+    std::vector<size_t> recv_counts(nunits);
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(
+        counts.data(),
+        recv_counts.data(),
+        1,
+        DART_TYPE_SIZET,
+        _team->dart_id()),
+      DART_OK);
+    std::vector<size_t> send_displs = _exclusive_sum(counts);
+    std::vector<size_t> recv_displs = _exclusive_sum(recv_counts);
+    std::vector<char>   recvbuf(
+                          (recv_displs[nunits - 1] +
+                           recv_counts[nunits - 1]) * elem_size);
+    std::vector<size_t> send_bytes(nunits);
+    std::vector<size_t> recv_bytes(nunits);
+    for (size_type u = 0; u < nunits; ++u) {
+      send_bytes[u]   = counts[u]      * elem_size;
+      send_displs[u] *= elem_size;
+      recv_bytes[u]   = recv_counts[u] * elem_size;
+      recv_displs[u] *= elem_size;
+    }
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(
+        sendbuf.data(),
+        send_bytes.data(),
+        send_displs.data(),
+        DART_TYPE_BYTE,
+        recvbuf.data(),
+        recv_bytes.data(),
+        recv_displs.data(),
+        _team->dart_id()),
+      DART_OK);
+    counts = recv_counts;
+    return recvbuf;
+  }
+
+  /**
+   * Offsets of consecutive groups of elements with the given sizes.
+   */
+  static std::vector<size_t> _exclusive_sum(
+    const std::vector<size_t> & counts)
+  {
+    std::vector<size_t> offsets(counts.size(), 0);
+    for (size_type i = 1; i < counts.size(); ++i) {
+      offsets[i] = offsets[i - 1] + counts[i - 1];
+    }
+    return offsets;
+  }
+
 }; // class UnorderedMap
 
 #endif // ifndef DOXYGEN
@@ -0,0 +1,201 @@
+#ifndef DASH__MAP__UNORDERED_MAP_CONCURRENT_REF_H__INCLUDED
+#define DASH__MAP__UNORDERED_MAP_CONCURRENT_REF_H__INCLUDED
+
+#include <mutex>
+
+namespace dash {
+
+#ifdef DOXYGEN
+
+
+/**
+ * View specifier of a dynamic map container for concurrent insertion and
+ * lookup by multiple threads of the calling unit.
+ *
+ * Values are inserted into buffers in local memory, partitioned into
+ * stripes by key hash that are locked separately, so threads inserting
+ * different keys rarely contend.
+ * Buffered values are inserted at their owner units in the next call of
+ * \c dash::UnorderedMap::barrier(), values mapped to the same remote unit
+ * by all threads are sent in a single exchange.
+ *
+ * Lookups of elements in local memory do not acquire locks as the local
+ * memory space is not modified before the next commit.
+ *
+ * All methods of this view may be called concurrently by multiple threads.
+ * Other methods of the map, including \c barrier(), must not be called
+ * while threads access the view.
+ *
+ * \concept{DashUnorderedMapConcept}
+ *
+ * \ingroup{dash::UnorderedMap}
+ */
+template<
+  typename Key,
+  typename Mapped,
+  typename Hash,
+  typename Pred,
+  typename Alloc >
+class UnorderedMapConcurrentRef;
+
+#else // ifdef DOXYGEN
+
+// Forward-declaration.
+template<
+  typename Key,
+  typename Mapped,
+  typename Hash,
+  typename Pred,
+  typename Alloc >
+class UnorderedMap;
+
+template<
+  typename Key,
+  typename Mapped,
+  typename Hash,
+  typename Pred,
+  typename Alloc >
+class UnorderedMapConcurrentRef
+{
+private:
+  typedef UnorderedMapConcurrentRef<Key, Mapped, Hash, Pred, Alloc>
+    self_t;
+
+  typedef UnorderedMap<Key, Mapped, Hash, Pred, Alloc>
+    map_type;
+
+public:
+  typedef Key                                                       key_type;
+  typedef Mapped                                                 mapped_type;
+  typedef Hash                                                        hasher;
+  typedef Pred                                                     key_equal;
+  typedef Alloc                                               allocator_type;
+
+  typedef typename map_type::index_type                           index_type;
+  typedef typename map_type::difference_type                 difference_type;
+  typedef typename map_type::size_type                             size_type;
+  typedef typename map_type::value_type                           value_type;
+
+  typedef typename map_type::local_iterator                         iterator;
+  typedef typename map_type::const_local_iterator             const_iterator;
+
+private:
+  map_type * _map  = nullptr;
+
+public:
+  UnorderedMapConcurrentRef(
+    // Pointer to instance of \c dash::UnorderedMap referenced by the view
+    // specifier.
+    map_type * map)
+  : _map(map)
+  { }
+
+  UnorderedMapConcurrentRef() = default;
+
+  //////////////////////////////////////////////////////////////////////////
+  // Element Lookup
+  //////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Number of elements with the given key in local memory or inserted by
+   * threads of the calling unit since the last commit.
+   */
+  size_type count(const key_type & key) const
+  {
+    if (find(key) != _map->_lend) {
+      return 1;
+    }
+    auto & stripe = _map->_concurrent_stripe(key);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    return (stripe.index.find(key, _map->_key_equal) >= 0) ? 1 : 0;
+  }
+
+  /**
+   * Iterator to the element with the given key in local memory as of the
+   * last commit, or the local end iterator if not found.
+   */
+  iterator find(const key_type & key)
+  {
+    auto lidx = _map->_local_index.find(key, _map->_key_equal);
+    return (lidx >= 0) ? iterator(_map, lidx) : _map->_lend;
+  }
+
+  const_iterator find(const key_type & key) const
+  {
+    auto lidx = _map->_local_index.find(key, _map->_key_equal);
+    return (lidx >= 0) ? const_iterator(_map, lidx) : _map->_lend;
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // Modifiers
+  //////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Inserts a value in the next commit unless an element with an
+   * equivalent key exists in local memory or has been inserted by a thread
+   * of the calling unit since the last commit.
+   * Values with keys mapped to remote units are also discarded in the
+   * commit if their owner contains an equivalent key.
+   *
+   * \return  \c true if the value is buffered for insertion.
+   */
+  bool insert(
+    /// The element to insert.
+    const value_type & value)
+  {
+    DASH_LOG_TRACE("UnorderedMapConcurrentRef.insert()", "key:", value.first);
+    if (_map->_local_index.find(value.first, _map->_key_equal) >= 0) {
+      return false;
+    }
+    auto & stripe = _map->_concurrent_stripe(value.first);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    if (stripe.index.find(value.first, _map->_key_equal) >= 0) {
+      return false;
+    }
+    stripe.index.insert(value.first, stripe.values.size());
+    stripe.values.push_back(value);
+    return true;
+  }
+
+  /**
+   * Inserts a value in the next commit, merging its mapped value with
+   * values with equivalent keys inserted before and with an existing
+   * element using a binary operation like \c dash::plus.
+   *
+   * As for \c dash::UnorderedMap::insert(first, last, merge), all units
+   * must use the same merge operation.
+   *
+   * \return  \c true if no value with an equivalent key has been inserted
+   *          by threads of the calling unit since the last commit.
+   */
+  template<class MergeOp>
+  bool insert(
+    /// The element to insert.
+    const value_type & value,
+    /// Binary operation merging mapped values with equivalent keys.
+    MergeOp            merge)
+  {
+    DASH_LOG_TRACE("UnorderedMapConcurrentRef.insert()", "key:", value.first);
+    auto & stripe = _map->_concurrent_stripe(value.first);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    if (!stripe.merge) {
+      stripe.merge = merge;
+    }
+    index_type pos = stripe.index.find(value.first, _map->_key_equal);
+    if (pos >= 0) {
+      stripe.values[pos].second = merge(stripe.values[pos].second,
+                                        value.second);
+      return false;
+    }
+    stripe.index.insert(value.first, stripe.values.size());
+    stripe.values.push_back(value);
+    return true;
+  }
+
+}; // class UnorderedMapConcurrentRef
+
+#endif // ifdef DOXYGEN
+
+} // namespace dash
+
+#endif // DASH__MAP__UNORDERED_MAP_CONCURRENT_REF_H__INCLUDED
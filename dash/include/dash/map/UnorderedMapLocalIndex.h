@@ -0,0 +1,234 @@
+#ifndef DASH__MAP__UNORDERED_MAP_LOCAL_INDEX_H__INCLUDED
+#define DASH__MAP__UNORDERED_MAP_LOCAL_INDEX_H__INCLUDED
+
+#include <dash/Types.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Mixes the bits of a hash value, so keys with similar hash values like
+ * consecutive integers are spread evenly over units and slots.
+ */
+inline uint64_t unordered_map_hash_mix(uint64_t h) noexcept
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+/**
+ * Open-addressing hash table with linear probing, mapping keys of the
+ * elements stored at a unit to their local index in the unit's local
+ * memory space.
+ *
+ * Slots store a copy of the key so probing does not access the elements.
+ * The capacity is a power of two and kept at least twice the number of
+ * keys. As slots are trivially copyable, the table can be copied to
+ * global memory and probed by remote units, see
+ * \c find_in_slots.
+ */
+template <
+  typename Key,
+  typename Pred,
+  typename IndexType >
+class UnorderedMapLocalIndex
+{
+public:
+  typedef Key                 key_type;
+  typedef Pred                key_equal;
+  typedef IndexType           index_type;
+  typedef dash::default_size_t size_type;
+
+  struct slot_type {
+    /// Local index of the element with the slot's key, negative if empty
+    index_type lidx;
+    key_type   key;
+  };
+
+  /// Local index of keys not contained in the table
+  static constexpr index_type not_found    = -1;
+  /// Minimum capacity of a table
+  static constexpr size_type  min_capacity = 16;
+
+public:
+  UnorderedMapLocalIndex()
+  {
+    rehash(min_capacity);
+  }
+
+  /**
+   * Slot in a table of \c capacity slots at which the probe sequence for
+   * the given key starts.
+   */
+  static size_type home_slot(
+    const key_type & key,
+    size_type        capacity) noexcept
+  {
+    uint64_t h = unordered_map_hash_mix(std::hash<key_type>()(key));
+    // Use high bits, low bits are used to map keys to units:
+    return static_cast<size_type>(h >> 32 ^ h) & (capacity - 1);
+  }
+
+  /**
+   * Searches a key in \c nslots consecutive slots of a probe sequence.
+   *
+   * \return  Local index of the key if found, \c not_found otherwise.
+   *          Sets \c done to \c true if the key is found or the probe
+   *          sequence ends in the given slots.
+   */
+  static index_type find_in_slots(
+    const slot_type * slots,
+    size_type         nslots,
+    const key_type  & key,
+    const key_equal & equal,
+    bool            & done)
+  {
+    for (size_type s = 0; s < nslots; ++s) {
+      if (slots[s].lidx < 0) {
+        done = true;
+        return not_found;
+      }
+      if (equal(slots[s].key, key)) {
+        done = true;
+        return slots[s].lidx;
+      }
+    }
+    done = false;
+    return not_found;
+  }
+
+  /**
+   * Local index of the element with the given key.
+   *
+   * \return  The key's local index, or \c not_found.
+   */
+  index_type find(
+    const key_type  & key,
+    const key_equal & equal = key_equal()) const
+  {
+    size_type mask = _slots.size() - 1;
+    for (size_type s = home_slot(key, _slots.size()); ; s = (s + 1) & mask) {
+      const slot_type & slot = _slots[s];
+      if (slot.lidx < 0) {
+        return not_found;
+      }
+      if (equal(slot.key, key)) {
+        return slot.lidx;
+      }
+    }
+  }
+
+  /**
+   * Adds a key that is not contained in the table.
+   */
+  void insert(
+    const key_type & key,
+    index_type       lidx)
+  {
+    if (2 * (_size + 1) > _slots.size()) {
+      rehash(2 * _slots.size());
+    }
+    _insert_slot(key, lidx);
+    ++_size;
+  }
+
+  /**
+   * Ensures the table holds \c nkeys keys without rehashing.
+   */
+  void reserve(size_type nkeys)
+  {
+    size_type capacity = _slots.size();
+    while (capacity < 2 * nkeys) {
+      capacity *= 2;
+    }
+    if (capacity != _slots.size()) {
+      rehash(capacity);
+    }
+  }
+
+  /**
+   * Resizes the table to the given capacity, a power of two that is at
+   * least twice the number of keys.
+   */
+  void rehash(size_type capacity)
+  {
+    std::vector<slot_type> old_slots(capacity);
+    std::swap(old_slots, _slots);
+    for (auto & slot : _slots) {
+      slot.lidx = not_found;
+    }
+    for (const auto & slot : old_slots) {
+      if (slot.lidx >= 0) {
+        _insert_slot(slot.key, slot.lidx);
+      }
+    }
+  }
+
+  /**
+   * Removes all keys, retaining the capacity.
+   */
+  void clear()
+  {
+    for (auto & slot : _slots) {
+      slot.lidx = not_found;
+    }
+    _size = 0;
+  }
+
+  inline size_type size() const noexcept
+  {
+    return _size;
+  }
+
+  inline size_type capacity() const noexcept
+  {
+    return _slots.size();
+  }
+
+  inline const slot_type * data() const noexcept
+  {
+    return _slots.data();
+  }
+
+private:
+  void _insert_slot(
+    const key_type & key,
+    index_type       lidx)
+  {
+    size_type mask = _slots.size() - 1;
+    size_type s    = home_slot(key, _slots.size());
+    while (_slots[s].lidx >= 0) {
+      s = (s + 1) & mask;
+    }
+    _slots[s].lidx = lidx;
+    _slots[s].key  = key;
+  }
+
+private:
+  std::vector<slot_type> _slots;
+  size_type              _size = 0;
+}; // class UnorderedMapLocalIndex
+
+template <typename Key, typename Pred, typename IndexType>
+constexpr IndexType
+UnorderedMapLocalIndex<Key, Pred, IndexType>::not_found;
+
+template <typename Key, typename Pred, typename IndexType>
+constexpr typename UnorderedMapLocalIndex<Key, Pred, IndexType>::size_type
+UnorderedMapLocalIndex<Key, Pred, IndexType>::min_capacity;
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__MAP__UNORDERED_MAP_LOCAL_INDEX_H__INCLUDED
@@ -0,0 +1,343 @@
+#ifndef DASH__VIEW__EXPRESSION_H__INCLUDED
+#define DASH__VIEW__EXPRESSION_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+
+#include <dash/view/Local.h>
+#include <dash/view/Origin.h>
+#include <dash/view/ViewTraits.h>
+
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+
+#include <type_traits>
+#include <utility>
+
+
+namespace dash {
+
+/**
+ * Lazy element-wise expressions on views.
+ *
+ * A value expression composes a view or container with element-wise
+ * transformations and filters. Expressions do not store values, they are
+ * evaluated by algorithms like \c dash::reduce in a single pass over the
+ * local elements of the underlying view, without intermediate containers.
+ *
+ * \code
+ *   auto sum_sq = dash::reduce(
+ *                   dash::views::transform(
+ *                     dash::sub(100, 1000, array),
+ *                     [](double v) { return v * v; }),
+ *                   dash::plus<double>());
+ * \endcode
+ *
+ * Views passed as lvalue are referenced, temporary views are stored in
+ * the expression.
+ *
+ * \concept{DashViewConcept}
+ */
+namespace views {
+
+template <class DomainT, class UnaryFunction>
+class TransformExpr;
+
+template <class DomainT, class UnaryPredicate>
+class FilterExpr;
+
+/**
+ * Type trait, whether \c T is a lazy value expression.
+ */
+template <class T>
+struct is_expression
+: public std::false_type
+{ };
+
+template <class DomainT, class UnaryFunction>
+struct is_expression< TransformExpr<DomainT, UnaryFunction> >
+: public std::true_type
+{ };
+
+template <class DomainT, class UnaryPredicate>
+struct is_expression< FilterExpr<DomainT, UnaryPredicate> >
+: public std::true_type
+{ };
+
+namespace internal {
+
+/**
+ * Value type of the elements in an expression's domain.
+ */
+template <
+  class DomainT,
+  bool  IsExpression = is_expression<DomainT>::value >
+struct domain_value_type {
+  typedef typename std::decay<
+            decltype(*dash::begin(dash::local(std::declval<const DomainT &>())))
+          >::type type;
+};
+
+template <class DomainT>
+struct domain_value_type<DomainT, true> {
+  typedef typename DomainT::value_type type;
+};
+
+/**
+ * Invokes \c func on the values of the view's elements in local memory.
+ */
+template <
+  class DomainT,
+  class Function >
+typename std::enable_if< !is_expression<DomainT>::value >::type
+for_each_local(
+  const DomainT & domain,
+  Function      & func)
+{
+  auto && l_view = dash::local(domain);
+  auto    l_end  = dash::end(l_view);
+  for (auto l_it = dash::begin(l_view); l_it != l_end; ++l_it) {
+    func(*l_it);
+  }
+}
+
+/**
+ * Invokes \c func on the values of the expression evaluated on elements
+ * in local memory.
+ */
+template <
+  class DomainT,
+  class Function >
+typename std::enable_if< is_expression<DomainT>::value >::type
+for_each_local(
+  const DomainT & domain,
+  Function      & func)
+{
+  domain.for_each_local(func);
+}
+
+/**
+ * Team of the view's origin.
+ */
+template <class DomainT>
+typename std::enable_if< !is_expression<DomainT>::value, dash::Team & >::type
+domain_team(const DomainT & domain)
+{
+  return dash::origin(domain).pattern().team();
+}
+
+template <class DomainT>
+typename std::enable_if< is_expression<DomainT>::value, dash::Team & >::type
+domain_team(const DomainT & domain)
+{
+  return domain.team();
+}
+
+} // namespace internal
+
+/**
+ * Lazy expression applying a unary function to the elements of a domain.
+ *
+ * \see  dash::views::transform
+ */
+template <class DomainT, class UnaryFunction>
+class TransformExpr
+{
+  typedef typename std::decay<DomainT>::type                   domain_t;
+  typedef typename internal::domain_value_type<domain_t>::type
+    domain_value_t;
+
+public:
+  typedef domain_t                                           domain_type;
+  typedef typename std::decay<
+            decltype(std::declval<UnaryFunction &>()(
+                       std::declval<const domain_value_t &>()))
+          >::type                                             value_type;
+
+public:
+  TransformExpr(DomainT && domain, UnaryFunction func)
+  : _domain(std::forward<DomainT>(domain))
+  , _func(func)
+  { }
+
+  const domain_type & domain() const {
+    return _domain;
+  }
+
+  dash::Team & team() const {
+    return internal::domain_team(_domain);
+  }
+
+  /**
+   * Invokes \c func on the transformed values of the domain's elements
+   * in local memory.
+   */
+  template <class Function>
+  void for_each_local(Function & func) const {
+    auto apply = [this, &func](const domain_value_t & value) {
+                   func(_func(value));
+                 };
+    internal::for_each_local(_domain, apply);
+  }
+
+private:
+  DomainT       _domain;
+  UnaryFunction _func;
+};
+
+/**
+ * Lazy expression selecting the elements of a domain that satisfy a
+ * predicate.
+ *
+ * \see  dash::views::filter
+ */
+template <class DomainT, class UnaryPredicate>
+class FilterExpr
+{
+  typedef typename std::decay<DomainT>::type                   domain_t;
+
+public:
+  typedef domain_t                                           domain_type;
+  typedef typename internal::domain_value_type<domain_t>::type value_type;
+
+public:
+  FilterExpr(DomainT && domain, UnaryPredicate pred)
+  : _domain(std::forward<DomainT>(domain))
+  , _pred(pred)
+  { }
+
+  const domain_type & domain() const {
+    return _domain;
+  }
+
+  dash::Team & team() const {
+    return internal::domain_team(_domain);
+  }
+
+  /**
+   * Invokes \c func on the values of the domain's elements in local
+   * memory that satisfy the predicate.
+   */
+  template <class Function>
+  void for_each_local(Function & func) const {
+    auto apply = [this, &func](const value_type & value) {
+                   if (_pred(value)) {
+                     func(value);
+                   }
+                 };
+    internal::for_each_local(_domain, apply);
+  }
+
+private:
+  DomainT        _domain;
+  UnaryPredicate _pred;
+};
+
+/**
+ * Lazy element-wise transformation of a view, container or expression.
+ *
+ * \concept{DashViewConcept}
+ */
+template <class DomainT, class UnaryFunction>
+TransformExpr<DomainT, UnaryFunction>
+transform(DomainT && domain, UnaryFunction func)
+{
+  return TransformExpr<DomainT, UnaryFunction>(
+           std::forward<DomainT>(domain), func);
+}
+
+/**
+ * Lazy selection of the elements of a view, container or expression that
+ * satisfy the given predicate.
+ *
+ * \concept{DashViewConcept}
+ */
+template <class DomainT, class UnaryPredicate>
+FilterExpr<DomainT, UnaryPredicate>
+filter(DomainT && domain, UnaryPredicate pred)
+{
+  return FilterExpr<DomainT, UnaryPredicate>(
+           std::forward<DomainT>(domain), pred);
+}
+
+} // namespace views
+
+/**
+ * Reduces the values of a lazy expression using the given binary reduce
+ * function \c op.
+ * The expression is evaluated in a single pass over the local elements of
+ * its view at every unit, local results are combined like in
+ * \c dash::reduce.
+ *
+ * Collective operation.
+ *
+ * \return  The reduced value, available at all units.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExpressionT,
+  class ValueType,
+  class BinaryOperation >
+typename std::enable_if<
+  dash::views::is_expression<ExpressionT>::value,
+  ValueType >::type
+reduce(
+  const ExpressionT & expr,
+  ValueType           init,
+  BinaryOperation     binary_op)
+{
+  internal::local_accumulate_t<ValueType> l_result;
+  l_result.valid = 0;
+  auto accumulate = [&](const typename ExpressionT::value_type & value) {
+                      l_result.value = l_result.valid
+                                       ? binary_op(l_result.value, value)
+                                       : ValueType(value);
+                      l_result.valid = 1;
+                    };
+  expr.for_each_local(accumulate);
+  auto result = internal::allreduce_local_result(
+                  l_result, binary_op, expr.team());
+  return result.valid ? binary_op(init, result.value) : init;
+}
+
+/**
+ * Reduces the values of a lazy expression using the given binary reduce
+ * function \c op.
+ *
+ * Collective operation.
+ *
+ * \return  The reduced value, available at all units, or a
+ *          value-initialized value if the expression has no elements.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExpressionT,
+  class BinaryOperation >
+typename std::enable_if<
+  dash::views::is_expression<ExpressionT>::value,
+  typename ExpressionT::value_type >::type
+reduce(
+  const ExpressionT & expr,
+  BinaryOperation     binary_op)
+{
+  typedef typename ExpressionT::value_type value_t;
+
+  internal::local_accumulate_t<value_t> l_result;
+  l_result.valid = 0;
+  auto accumulate = [&](const value_t & value) {
+                      l_result.value = l_result.valid
+                                       ? binary_op(l_result.value, value)
+                                       : value;
+                      l_result.valid = 1;
+                    };
+  expr.for_each_local(accumulate);
+  auto result = internal::allreduce_local_result(
+                  l_result, binary_op, expr.team());
+  return result.valid ? result.value : value_t();
+}
+
+} // namespace dash
+
+#endif // DASH__VIEW__EXPRESSION_H__INCLUDED
@@ -0,0 +1,140 @@
+#ifndef DASH__VIEW__NODE_LOCAL_H__INCLUDED
+#define DASH__VIEW__NODE_LOCAL_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Range.h>
+
+#include <dash/dart/if/dart_globmem.h>
+
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * View on the memory of all units at the calling unit's node that can be
+ * accessed directly by the calling unit, i.e. the local memory of the
+ * calling unit and the local memory of units at the same node located in
+ * shared memory windows.
+ *
+ * Local memory ranges of co-located units are not contiguous in general,
+ * so the view is a range of local ranges, one for every unit that is
+ * accessible at the node, in ascending order of unit ids.
+ * Elements in the view are accessed with native loads and stores.
+ *
+ * \concept{DashViewConcept}
+ */
+template <typename ValueType>
+class NodeLocalView
+{
+  typedef NodeLocalView<ValueType>                          self_t;
+
+public:
+  typedef ValueType                                     value_type;
+  typedef dash::default_size_t                           size_type;
+  typedef dash::IteratorRange<value_type *, value_type *>
+                                                        block_type;
+  typedef typename std::vector<block_type>::const_iterator
+                                                          iterator;
+
+public:
+  NodeLocalView() = default;
+
+  /**
+   * Adds the local range of the given unit to the view.
+   */
+  void add_block(
+    team_unit_t  unit,
+    value_type * lbegin,
+    size_type    nlocal)
+  {
+    value_type * lend = lbegin + nlocal;
+    _blocks.push_back(block_type(lbegin, lend));
+    _units.push_back(unit);
+    _size += nlocal;
+  }
+
+  /**
+   * Iterator to the local range of the first unit in the view.
+   */
+  iterator begin() const {
+    return _blocks.begin();
+  }
+
+  /**
+   * Iterator past the local range of the last unit in the view.
+   */
+  iterator end() const {
+    return _blocks.end();
+  }
+
+  /**
+   * Local range of the block at the given position in the view.
+   */
+  const block_type & block(size_type block_idx) const {
+    return _blocks[block_idx];
+  }
+
+  /**
+   * Id of the unit owning the block at the given position in the view.
+   */
+  team_unit_t unit(size_type block_idx) const {
+    return _units[block_idx];
+  }
+
+  /**
+   * Number of blocks in the view, i.e. number of units whose local memory
+   * is accessible at the node.
+   */
+  size_type nblocks() const {
+    return _blocks.size();
+  }
+
+  /**
+   * Total number of elements in the view.
+   */
+  size_type size() const {
+    return _size;
+  }
+
+private:
+  std::vector<block_type>  _blocks;
+  std::vector<team_unit_t> _units;
+  size_type                _size = 0;
+
+}; // class NodeLocalView
+
+/**
+ * View on the elements of a container in the memory of all units at the
+ * calling unit's node that can be accessed directly by the calling unit.
+ *
+ * \see dash::NodeLocalView
+ *
+ * \concept{DashViewConcept}
+ */
+template <
+  class    ContainerType,
+  typename ValueType = typename ContainerType::value_type >
+NodeLocalView<ValueType>
+node_local(ContainerType & container)
+{
+  NodeLocalView<ValueType> view;
+  const auto & pattern = container.pattern();
+  const auto & globmem = container.begin().globmem();
+  for (team_unit_t u{0}; u < pattern.team().size(); ++u) {
+    auto nlocal = pattern.local_size(u);
+    if (nlocal == 0) {
+      continue;
+    }
+    void * addr = nullptr;
+    dart_gptr_getaddr_node(globmem.at(u, 0).dart_gptr(), &addr);
+    if (addr != nullptr) {
+      view.add_block(u, static_cast<ValueType *>(addr), nlocal);
+    }
+  }
+  return view;
+}
+
+} // namespace dash
+
+#endif // DASH__VIEW__NODE_LOCAL_H__INCLUDED
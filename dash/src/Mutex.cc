@@ -3,9 +3,12 @@
 
 namespace dash {
 
-Mutex::Mutex(Team & team){
-  dart_ret_t ret = dart_team_lock_init(team.dart_id(), &_mutex);
-  DASH_ASSERT_EQ(DART_OK, ret, "dart_team_lock_init failed");
+Mutex::Mutex(Team & team, mutex_variant variant){
+  dart_ret_t ret = dart_team_lock_init_variant(
+                     team.dart_id(),
+                     static_cast<dart_lock_variant_t>(variant),
+                     &_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_team_lock_init_variant failed");
 }
 
 Mutex::~Mutex(){
@@ -30,4 +33,14 @@ void Mutex::unlock(){
   DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_acquire failed");
 }
 
+void Mutex::lock_shared(){
+  dart_ret_t ret = dart_lock_acquire_shared(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_acquire_shared failed");
+}
+
+void Mutex::unlock_shared(){
+  dart_ret_t ret = dart_lock_release(_mutex);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_release failed");
+}
+
 } // namespace dash
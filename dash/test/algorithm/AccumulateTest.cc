@@ -31,6 +31,22 @@ TEST_F(AccumulateTest, SimpleConstructor) {
   }
 }
 
+TEST_F(AccumulateTest, FloatingPointAtAllUnits) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<double> target(num_elem_total, dash::BLOCKED);
+  dash::fill(target.begin(), target.end(), 0.5);
+  dash::barrier();
+
+  // Initial value is added once, result is available at all units:
+  double sum = dash::accumulate(target.begin(), target.end(), 1.25);
+  double max = dash::accumulate(target.begin(), target.end(),
+                                0.0, dash::max<double>());
+  EXPECT_EQ_U(1.25 + 0.5 * num_elem_total, sum);
+  EXPECT_EQ_U(0.5, max);
+}
+
 TEST_F(AccumulateTest, StringConcatOperaton) {
   const size_t num_elem_local = 100;
   size_t num_elem_total       = _dash_size * num_elem_local;
@@ -57,3 +73,22 @@ TEST_F(AccumulateTest, StringConcatOperaton) {
     ASSERT_STREQ("1-2-3-4", result.c_str());
   }
 }
+
+TEST_F(AccumulateTest, AccumulateAsync) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < target.lsize(); ++l) {
+    target.local[l] = dash::myid() + 1;
+  }
+  target.barrier();
+
+  auto sum_future = dash::accumulate_async(target.begin(), target.end(), 10);
+  auto max_future = dash::accumulate_async(target.begin(), target.end(),
+                                           0, dash::max<int>());
+  // Result is available at all units:
+  int expected_sum = 10 + num_elem_local * (_dash_size * (_dash_size + 1)) / 2;
+  ASSERT_EQ_U(expected_sum, sum_future.get());
+  ASSERT_EQ_U(_dash_size, max_future.get());
+}
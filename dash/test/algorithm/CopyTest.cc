@@ -319,6 +319,46 @@ TEST_F(CopyTest, BlockingGlobalToLocalMasterOnlyAllRemote)
   delete[] local_copy;
 }
 
+TEST_F(CopyTest, BlockingGlobalToLocalBlockCyclic)
+{
+  // Copy a range spanning blocks of every unit in a block-cyclic
+  // distribution, so elements of every unit are fetched from several
+  // non-contiguous blocks.
+  const int block_size        = 7;
+  const int num_blocks        = 3;
+  const int num_elem_per_unit = num_blocks * block_size;
+  size_t num_elem_total       = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(block_size));
+
+  for (auto l = 0; l < num_elem_per_unit; ++l) {
+    array.local[l] = ((dash::myid().id + 1) * 1000) + l;
+  }
+  array.barrier();
+
+  // Skip first and last elements to start and end in partial blocks:
+  const size_t num_copy_elem = num_elem_total - 2;
+  std::vector<int> local_copy(num_copy_elem);
+  int * dest_end = dash::copy(array.begin() + 1,
+                              array.end()   - 1,
+                              local_copy.data());
+  EXPECT_EQ_U(local_copy.data() + num_copy_elem, dest_end);
+  for (size_t g = 0; g < num_copy_elem; ++g) {
+    EXPECT_EQ_U(static_cast<int>(array[g + 1]),
+                local_copy[g]);
+  }
+
+  std::vector<int> local_copy_async(num_copy_elem);
+  auto fut_dest_end = dash::copy_async(array.begin() + 1,
+                                       array.end()   - 1,
+                                       local_copy_async.data());
+  EXPECT_EQ_U(local_copy_async.data() + num_copy_elem, fut_dest_end.get());
+  for (size_t g = 0; g < num_copy_elem; ++g) {
+    EXPECT_EQ_U(local_copy[g], local_copy_async[g]);
+  }
+  array.barrier();
+}
+
 TEST_F(CopyTest, BlockingGlobalToLocalBarrierUnaligned)
 {
   dash::global_unit_t myid = dash::myid();
@@ -803,6 +843,157 @@ TEST_F(CopyTest, AsyncGlobalToLocalBlock)
   }
 }
 
+TEST_F(CopyTest, BlockingGlobalToGlobalRedistribute)
+{
+  const size_t num_elem_per_unit = 23;
+  size_t num_elem_total          = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> src(num_elem_total, dash::BLOCKED);
+  dash::Array<int> dst(num_elem_total, dash::BLOCKCYCLIC(3));
+
+  for (size_t l = 0; l < src.lsize(); ++l) {
+    src.local[l] = src.pattern().global(l);
+  }
+  for (size_t l = 0; l < dst.lsize(); ++l) {
+    dst.local[l] = -1;
+  }
+  src.barrier();
+
+  auto dest_end = dash::copy(src.begin(), src.end(), dst.begin());
+  EXPECT_EQ_U(dst.end(), dest_end);
+
+  // Local output elements are valid before synchronization:
+  for (size_t l = 0; l < dst.lsize(); ++l) {
+    EXPECT_EQ_U(static_cast<int>(dst.pattern().global(l)),
+                static_cast<int>(dst.local[l]));
+  }
+  dst.barrier();
+
+  if (dash::myid() == 0) {
+    for (size_t g = 0; g < num_elem_total; ++g) {
+      EXPECT_EQ_U(static_cast<int>(g), static_cast<int>(dst[g]));
+    }
+  }
+}
+
+TEST_F(CopyTest, AsyncGlobalToGlobalSubrange)
+{
+  const size_t num_elem_per_unit = 17;
+  size_t num_elem_total          = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> src(num_elem_total, dash::BLOCKCYCLIC(5));
+  dash::Array<int> dst(num_elem_total, dash::BLOCKED);
+
+  for (size_t l = 0; l < src.lsize(); ++l) {
+    src.local[l] = 1000 + src.pattern().global(l);
+  }
+  for (size_t l = 0; l < dst.lsize(); ++l) {
+    dst.local[l] = -1;
+  }
+  src.barrier();
+
+  // Copy unaligned subrange of the source to a shifted position:
+  size_t in_offset  = 3;
+  size_t out_offset = 7;
+  size_t num_copy   = num_elem_total - out_offset - 2;
+
+  auto fut = dash::copy_async(src.begin() + in_offset,
+                              src.begin() + in_offset + num_copy,
+                              dst.begin() + out_offset);
+  fut.wait();
+  EXPECT_EQ_U(dst.begin() + out_offset + num_copy, fut.get());
+  dst.barrier();
+
+  if (dash::myid() == 0) {
+    for (size_t g = 0; g < num_elem_total; ++g) {
+      int expected = (g < out_offset || g >= out_offset + num_copy)
+                     ? -1
+                     : static_cast<int>(1000 + g - out_offset + in_offset);
+      EXPECT_EQ_U(expected, static_cast<int>(dst[g]));
+    }
+  }
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobalMatrixTiles)
+{
+  typedef dash::TilePattern<2>                src_pattern_t;
+  typedef dash::Pattern<2>                    dst_pattern_t;
+  typedef typename src_pattern_t::index_type  index_t;
+
+  size_t tilesize_0 = 2;
+  size_t tilesize_1 = 3;
+  size_t extent_0   = tilesize_0 * _dash_size * 2;
+  size_t extent_1   = tilesize_1 * 2;
+
+  dash::Matrix<int, 2, index_t, src_pattern_t> src(
+    dash::SizeSpec<2>(extent_0, extent_1),
+    dash::DistributionSpec<2>(dash::TILE(tilesize_0),
+                              dash::TILE(tilesize_1)),
+    dash::Team::All(),
+    dash::TeamSpec<2>(_dash_size, 1));
+  dash::Matrix<int, 2, index_t, dst_pattern_t> dst(
+    dash::SizeSpec<2>(extent_0, extent_1),
+    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE),
+    dash::Team::All(),
+    dash::TeamSpec<2>(_dash_size, 1));
+
+  for (size_t i = 0; i < extent_0; ++i) {
+    for (size_t j = 0; j < extent_1; ++j) {
+      if (src(i,j).is_local()) {
+        src(i,j) = static_cast<int>(i * extent_1 + j);
+      }
+      if (dst(i,j).is_local()) {
+        dst(i,j) = -1;
+      }
+    }
+  }
+  dash::barrier();
+
+  // Redistribute from tiles to blocks of rows:
+  dash::copy(src.begin(), src.end(), dst.begin());
+  dst.barrier();
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < extent_0; ++i) {
+      for (size_t j = 0; j < extent_1; ++j) {
+        EXPECT_EQ_U(static_cast<int>(i * extent_1 + j),
+                    static_cast<int>(dst(i,j)));
+      }
+    }
+  }
+  dst.barrier();
+
+  // Copy between views of rows at different offsets:
+  size_t in_offset  = 1;
+  size_t out_offset = 2;
+  size_t num_rows   = extent_0 - 3;
+  for (size_t i = 0; i < extent_0; ++i) {
+    for (size_t j = 0; j < extent_1; ++j) {
+      if (dst(i,j).is_local()) {
+        dst(i,j) = -1;
+      }
+    }
+  }
+  dash::barrier();
+
+  auto src_rows = src.sub<0>(in_offset, num_rows);
+  auto dst_rows = dst.sub<0>(out_offset, num_rows);
+  dash::copy(src_rows.begin(), src_rows.end(), dst_rows.begin());
+  dst.barrier();
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < extent_0; ++i) {
+      for (size_t j = 0; j < extent_1; ++j) {
+        int expected = (i < out_offset || i >= out_offset + num_rows)
+                       ? -1
+                       : static_cast<int>(
+                           (i - out_offset + in_offset) * extent_1 + j);
+        EXPECT_EQ_U(expected, static_cast<int>(dst(i,j)));
+      }
+    }
+  }
+}
+
 #if 0
 // TODO
 TEST_F(CopyTest, AsyncAllToLocalVector)
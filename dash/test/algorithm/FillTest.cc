@@ -42,3 +42,26 @@ TEST_F(FillTest, TestAllItemsFilled)
     EXPECT_EQ_U(17, static_cast<value_t>(*lbegin));
   }
 }
+
+TEST_F(FillTest, ExecutionPolicies)
+{
+  // Large enough to be processed by multiple threads:
+  size_t num_local_elem = 4 * 4096 + 13;
+
+  dash::Array<int> array(num_local_elem * dash::size());
+  dash::fill(dash::execution::seq, array.begin(), array.end(), 3);
+  array.barrier();
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(3, array.local[l]);
+  }
+  array.barrier();
+
+  // Subrange starting in the local range of the second unit:
+  size_t offset = num_local_elem + 11;
+  dash::fill(dash::execution::par, array.begin() + offset, array.end(), 5);
+  array.barrier();
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    int expected = (array.pattern().global(l) < offset) ? 3 : 5;
+    EXPECT_EQ_U(expected, array.local[l]);
+  }
+}
@@ -320,3 +320,82 @@ TEST_F(FindTest, LessElementsThanUnits)
   array.barrier();
 }
 
+
+TEST_F(FindTest, FindAsync)
+{
+  _num_elem           = dash::Team::All().size() * 10;
+  Element_t init_fill = 0;
+  Element_t find_me   = 24;
+  index_t   find_pos  = _num_elem - 3;
+
+  Array_t array(_num_elem);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = init_fill;
+  }
+  array.barrier();
+  if (dash::myid() == 0) {
+    array[find_pos] = find_me;
+  }
+  array.barrier();
+
+  auto found_future   = dash::find_async(array.begin(), array.end(), find_me);
+  auto missing_future = dash::find_async(array.begin(), array.end(),
+                                         find_me + 1);
+  auto found_gptr     = found_future.get();
+  LOG_MESSAGE("Completed dash::find_async");
+  EXPECT_EQ_U(found_gptr, array.begin() + find_pos);
+  EXPECT_EQ_U(find_me, static_cast<Element_t>(*found_gptr));
+  EXPECT_EQ_U(missing_future.get(), array.end());
+
+  // Range not starting at the first element:
+  index_t range_begin = 7;
+  auto sub_future     = dash::find_async(array.begin() + range_begin,
+                                         array.end(), find_me);
+  auto empty_future   = dash::find_async(array.begin() + range_begin,
+                                         array.begin() + find_pos,
+                                         find_me);
+  EXPECT_EQ_U(array.begin() + find_pos, sub_future.get());
+  EXPECT_EQ_U(array.begin() + find_pos, empty_future.get());
+
+  array.barrier();
+}
+
+TEST_F(FindTest, FindIfEarlyExit)
+{
+  // Large enough for units to poll matches of other units:
+  const size_t num_elem_local = 5 * dash::internal::find_poll_interval + 7;
+  _num_elem                   = dash::size() * num_elem_local;
+
+  Array_t array(_num_elem);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  // Matches at all units, the first one at unit 0:
+  index_t first_match = num_elem_local / 2 + 1;
+  auto found_gptr = dash::find_if(
+                      array.begin(), array.end(),
+                      [=](Element_t v) {
+                        return v >= first_match && v % 2 == 0;
+                      });
+  EXPECT_EQ_U(array.begin() + (first_match + first_match % 2), found_gptr);
+
+  // Single match in the last unit's block, in a range not starting at
+  // the first element:
+  index_t single_match = _num_elem - 3;
+  found_gptr = dash::find(array.begin() + 5, array.end(),
+                          static_cast<Element_t>(single_match));
+  EXPECT_EQ_U(array.begin() + single_match, found_gptr);
+
+  found_gptr = dash::find_if(array.begin(), array.end(),
+                             [](Element_t v) { return v < 0; });
+  EXPECT_EQ_U(array.end(), found_gptr);
+
+  // Matches published in previous searches do not affect later searches:
+  for (int rep = 0; rep < 2; ++rep) {
+    found_gptr = dash::find(array.begin(), array.end(),
+                            static_cast<Element_t>(single_match));
+    EXPECT_EQ_U(array.begin() + single_match, found_gptr);
+  }
+}
@@ -5,6 +5,8 @@
 #include <dash/Matrix.h>
 #include <dash/algorithm/ForEach.h>
 #include <dash/algorithm/Fill.h>
+#include <dash/algorithm/Generate.h>
+#include <dash/algorithm/Equal.h>
 #include <dash/SharedCounter.h>
 
 #include <functional>
@@ -166,3 +168,92 @@ TEST_F(ForEachTest, Lambdas)
                  });
 }
 
+
+TEST_F(ForEachTest, ExecutionPolicies)
+{
+  typedef dash::default_index_t index_t;
+
+  // Large enough to be processed by multiple threads:
+  const size_t num_elem_local = 4 * 4096 + 7;
+  const size_t num_elem_total = dash::size() * num_elem_local;
+  const size_t offset         = 5;
+
+  dash::Array<int> array(num_elem_total);
+  dash::fill(array.begin(), array.end(), 1);
+  array.barrier();
+
+  dash::for_each(dash::execution::par,
+                 array.begin() + offset, array.end(),
+                 [](int & el) {
+                   el += 1;
+                 });
+  dash::for_each(dash::execution::par_unseq,
+                 array.begin(), array.end(),
+                 [](int & el) {
+                   el *= 3;
+                 });
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    int expected = (array.pattern().global(l) < offset) ? 3 : 6;
+    EXPECT_EQ_U(expected, array.local[l]);
+  }
+  array.barrier();
+
+  dash::for_each_with_index(dash::execution::par,
+                            array.begin() + offset, array.end(),
+                            [](int & el, index_t gindex) {
+                              el = gindex;
+                            });
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    index_t gindex   = array.pattern().global(l);
+    int     expected = (gindex < offset) ? 3 : gindex;
+    EXPECT_EQ_U(expected, array.local[l]);
+  }
+}
+
+TEST_F(ForEachTest, NosyncChained)
+{
+  const size_t num_elem_local = 23;
+  const size_t num_elem_total = dash::size() * num_elem_local;
+
+  dash::Array<int> array_a(num_elem_total);
+  dash::Array<int> array_b(num_elem_total);
+
+  // Synchronize both algorithms in a single barrier:
+  auto t_fill = dash::fill_nosync(array_a.begin(), array_a.end(), 2);
+  auto t_gen  = dash::generate_nosync(array_b.begin(), array_b.end(),
+                                      []() { return 1; });
+  EXPECT_TRUE_U(t_fill.pending());
+  EXPECT_TRUE_U(t_gen.pending());
+  dash::sync(t_fill, t_gen);
+  EXPECT_FALSE_U(t_fill.pending());
+  EXPECT_FALSE_U(t_gen.pending());
+
+  // Values of other units are visible after synchronization:
+  size_t neighbor_gidx = ((dash::myid() + 1) % dash::size()) *
+                         num_elem_local;
+  EXPECT_EQ_U(2, static_cast<int>(array_a[neighbor_gidx]));
+  EXPECT_EQ_U(1, static_cast<int>(array_b[neighbor_gidx]));
+  // Wait for reads of other units before modifying local elements:
+  array_a.barrier();
+
+  auto t_each = dash::for_each_nosync(array_b.begin(), array_b.end(),
+                                      [](int & el) { el *= 2; });
+  auto t_idx  = dash::for_each_with_index_nosync(
+                  dash::execution::par,
+                  array_a.begin(), array_a.end(),
+                  [](int & el, dash::default_index_t gidx) {
+                    el += gidx;
+                  });
+  dash::sync(t_each, t_idx);
+  // Tokens already synchronized are ignored:
+  dash::sync(t_each);
+  t_idx.wait();
+
+  EXPECT_EQ_U(2 + static_cast<int>(neighbor_gidx),
+              static_cast<int>(array_a[neighbor_gidx]));
+  EXPECT_EQ_U(2, static_cast<int>(array_b[neighbor_gidx]));
+  EXPECT_FALSE_U(dash::equal(array_a.begin(), array_a.end(),
+                             array_b.begin()));
+  EXPECT_TRUE_U(dash::equal(array_a.begin(), array_a.begin() + 1,
+                            array_b.begin()));
+}
@@ -32,3 +32,18 @@ TEST_F(GenerateTest, TestAllItemsGenerated)
     ASSERT_EQ_U(17, static_cast<value_t>(*lbegin));
   }
 }
+
+TEST_F(GenerateTest, ExecutionPolicies)
+{
+  // Large enough to be processed by multiple threads:
+  size_t num_local_elem = 4 * 4096 + 3;
+
+  Array_t array(num_local_elem * dash::size());
+  dash::generate(dash::execution::par_unseq, array.begin(), array.end(),
+                 []() { return 23.0; });
+  array.barrier();
+
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(23.0, static_cast<Element_t>(array.local[l]));
+  }
+}
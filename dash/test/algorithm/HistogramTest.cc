@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include "HistogramTest.h"
+#include "../TestBase.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Histogram.h>
+
+#include <vector>
+
+
+TEST_F(HistogramTest, DenseAndSparseKeys)
+{
+  // Large enough to be counted by multiple threads:
+  const size_t num_keys_local = 4 * 1024 + 3;
+  const size_t num_bins       = 37;
+  size_t num_keys_total       = _dash_size * num_keys_local;
+
+  dash::Array<int> keys(num_keys_total, dash::BLOCKED);
+  for (size_t l = 0; l < keys.lsize(); ++l) {
+    size_t g = keys.pattern().global(l);
+    // Every fifth key is out of range and not counted:
+    keys.local[l] = (g % 5 == 0) ? -1 : (g * 7) % num_bins;
+  }
+  keys.barrier();
+
+  std::vector<long> expected(num_bins, 0);
+  for (size_t g = 0; g < num_keys_total; ++g) {
+    if (g % 5 != 0) {
+      ++expected[(g * 7) % num_bins];
+    }
+  }
+
+  dash::Array<long> histo_blocked(num_bins, dash::BLOCKED);
+  dash::histogram(keys.begin(), keys.end(), dash::identity_bins(),
+                  histo_blocked);
+  // Bins not stored in order of units:
+  dash::Array<long> histo_cyclic(num_bins, dash::CYCLIC);
+  dash::histogram(dash::execution::seq, keys.begin(), keys.end(),
+                  dash::identity_bins(), histo_cyclic);
+  dash::Array<long> histo_sparse(num_bins, dash::CYCLIC);
+  dash::histogram(keys.begin(), keys.end(), dash::identity_bins(),
+                  histo_sparse, dash::histogram_mode::sparse);
+
+  for (size_t l = 0; l < histo_blocked.lsize(); ++l) {
+    EXPECT_EQ_U(expected[histo_blocked.pattern().global(l)],
+                histo_blocked.local[l]);
+  }
+  for (size_t l = 0; l < histo_cyclic.lsize(); ++l) {
+    EXPECT_EQ_U(expected[histo_cyclic.pattern().global(l)],
+                histo_cyclic.local[l]);
+    EXPECT_EQ_U(expected[histo_sparse.pattern().global(l)],
+                histo_sparse.local[l]);
+  }
+}
+
+TEST_F(HistogramTest, UniformBins)
+{
+  const size_t num_values_local = 100;
+  const size_t num_bins         = 10;
+  size_t num_values_total       = _dash_size * num_values_local;
+
+  dash::Array<double> values(num_values_total, dash::BLOCKED);
+  for (size_t l = 0; l < values.lsize(); ++l) {
+    // Values between bin boundaries:
+    values.local[l] = values.pattern().global(l) + 0.5;
+  }
+  values.barrier();
+
+  dash::Array<int> histo(num_bins);
+  dash::histogram(values.begin(), values.end(),
+                  dash::uniform_bins<double>(
+                    0.0, num_values_total / 2, num_bins),
+                  histo, dash::histogram_mode::sparse);
+  // Half of the values are in range of the bins:
+  for (size_t l = 0; l < histo.lsize(); ++l) {
+    EXPECT_EQ_U(static_cast<int>(num_values_total / (2 * num_bins)),
+                histo.local[l]);
+  }
+}
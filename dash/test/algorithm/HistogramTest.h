@@ -0,0 +1,27 @@
+#ifndef DASH__TEST__HISTOGRAM_TEST_H_
+#define DASH__TEST__HISTOGRAM_TEST_H_
+
+#include "../TestBase.h"
+
+
+/**
+ * Test fixture for algorithm dash::histogram.
+ */
+class HistogramTest : public dash::test::TestBase {
+protected:
+  size_t _dash_id;
+  size_t _dash_size;
+
+  HistogramTest()
+  : _dash_id(0),
+    _dash_size(0)
+  { }
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    _dash_id   = dash::myid();
+    _dash_size = dash::size();
+  }
+};
+
+#endif // DASH__TEST__HISTOGRAM_TEST_H_
@@ -257,3 +257,99 @@ TEST_F(MinElementTest, TestFindMatrixDefault)
   EXPECT_EQ(min_value, found_min);
 }
 
+
+TEST_F(MinElementTest, TestFindArrayAsync)
+{
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  Element_t min_value         = -13;
+  Array_t array(num_elem_total, dash::BLOCKCYCLIC(10));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = (dash::myid() + 1) * 1000 + l;
+  }
+  array.barrier();
+  index_t min_pos = num_elem_total / 3;
+  if (dash::myid() == 0) {
+    array[min_pos] = min_value;
+  }
+  array.barrier();
+
+  auto min_future = dash::min_element_async(array.begin(), array.end());
+  auto max_future = dash::max_element_async(array.begin(), array.end());
+  // Futures can be tested without blocking:
+  min_future.test();
+  auto found_min = min_future.get();
+  auto found_max = max_future.get();
+  LOG_MESSAGE("Completed dash::min_element_async, dash::max_element_async");
+  EXPECT_EQ_U(found_min, array.begin() + min_pos);
+  EXPECT_EQ_U(min_value, static_cast<Element_t>(*found_min));
+  EXPECT_TRUE_U(min_future.test());
+
+  Element_t expected_max = dash::size() * 1000 + num_elem_local - 1;
+  EXPECT_EQ_U(expected_max, static_cast<Element_t>(*found_max));
+  array.barrier();
+}
+
+TEST_F(MinElementTest, TestMinMaxElementEqualValues)
+{
+  const size_t num_elem_local = 20;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  Array_t array(num_elem_total);
+  // Minimum value at every unit's second element, maximum value at every
+  // unit's last element:
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = (l == 1) ? -5 : 10;
+  }
+  array.local[array.lsize() - 1] = 99;
+  array.barrier();
+
+  auto found_min = dash::min_element(array.begin(), array.end());
+  EXPECT_EQ_U(array.begin() + 1, found_min);
+
+  auto found_max = dash::max_element(array.begin() + 2, array.end());
+  EXPECT_EQ_U(array.begin() + (num_elem_local - 1), found_max);
+
+  auto found_minmax = dash::minmax_element(array.begin(), array.end());
+  EXPECT_EQ_U(array.begin() + 1, found_minmax.first);
+  EXPECT_EQ_U(array.end() - 1, found_minmax.second);
+  EXPECT_EQ_U(-5, static_cast<Element_t>(*found_minmax.first));
+  EXPECT_EQ_U(99, static_cast<Element_t>(*found_minmax.second));
+
+  auto empty_minmax = dash::minmax_element(array.begin(), array.begin());
+  EXPECT_EQ_U(array.begin(), empty_minmax.first);
+  EXPECT_EQ_U(array.begin(), empty_minmax.second);
+  array.barrier();
+}
+
+TEST_F(MinElementTest, TestExecutionPolicies)
+{
+  // Large enough for multiple threads per unit, minimum value in several
+  // chunks of every unit's local range:
+  const size_t num_elem_local = 8 * dash::internal::parallel_for_min_chunk;
+  size_t num_elem_total       = dash::size() * num_elem_local;
+  Array_t array(num_elem_total);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = (l % 1500 == 700) ? -3 : static_cast<Element_t>(l);
+  }
+  array.barrier();
+
+  auto found_seq = dash::min_element(
+                     dash::execution::seq, array.begin(), array.end());
+  auto found_par = dash::min_element(
+                     dash::execution::par, array.begin(), array.end());
+  auto found_vec = dash::min_element(
+                     dash::execution::par_unseq, array.begin(), array.end());
+  EXPECT_EQ_U(array.begin() + 700, found_seq);
+  EXPECT_EQ_U(array.begin() + 700, found_par);
+  EXPECT_EQ_U(array.begin() + 700, found_vec);
+
+  auto found_max = dash::max_element(
+                     dash::execution::par, array.begin(), array.end());
+  EXPECT_EQ_U(array.begin() + (num_elem_local - 1), found_max);
+
+  const Element_t * lmin = dash::min_element(
+                             dash::execution::par,
+                             array.lbegin(), array.lend());
+  EXPECT_EQ_U(700, lmin - array.lbegin());
+  array.barrier();
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include "ReduceTest.h"
+#include "../TestBase.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Reduce.h>
+
+
+namespace {
+
+/// Value type without DART data type, reduced in a reduction tree
+struct interval_t {
+  int first;
+  int last;
+};
+
+/// Associative but not commutative operation, concatenates intervals
+struct concat_intervals {
+  interval_t operator()(const interval_t & lhs, const interval_t & rhs) const {
+    return interval_t { lhs.first, rhs.last };
+  }
+};
+
+} // namespace
+
+
+TEST_F(ReduceTest, SumDoubleAtAllUnits)
+{
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<double> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = 0.5;
+  }
+  array.barrier();
+
+  // Result must not be truncated to integer and is valid at all units:
+  double result = dash::reduce(array.begin(), array.end(), 0.25);
+  EXPECT_EQ_U(0.25 + 0.5 * num_elem_total, result);
+
+  double sum = dash::reduce(array.begin(), array.end());
+  EXPECT_EQ_U(0.5 * num_elem_total, sum);
+}
+
+TEST_F(ReduceTest, EmptyLocalRanges)
+{
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l) + 1;
+  }
+  array.barrier();
+
+  // Range only covers elements of the first unit:
+  auto first = array.begin() + 2;
+  auto last  = array.begin() + num_elem_local;
+
+  int sum = dash::reduce(first, last, 0, dash::plus<int>());
+  int prd = dash::reduce(first, first + 3, 1, dash::multiply<int>());
+  int min = dash::reduce(first, last, 100, dash::min<int>());
+  int max = dash::reduce(first, last, -1, dash::max<int>());
+
+  EXPECT_EQ_U(3 + 4 + 5 + 6 + 7 + 8 + 9 + 10, sum);
+  EXPECT_EQ_U(3 * 4 * 5, prd);
+  EXPECT_EQ_U(3, min);
+  EXPECT_EQ_U(static_cast<int>(num_elem_local), max);
+
+  // Empty range yields init value:
+  EXPECT_EQ_U(42, dash::reduce(first, first, 42, dash::plus<int>()));
+}
+
+TEST_F(ReduceTest, UserDefinedOperation)
+{
+  const size_t num_elem_local = 7;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<interval_t> array(num_elem_total, dash::BLOCKCYCLIC(3));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    int gidx = array.pattern().global(l);
+    array.local[l] = interval_t { gidx, gidx + 1 };
+  }
+  array.barrier();
+
+  // Local ranges are not contiguous in block-cyclic distribution, so
+  // reduce the range of the first unit's first block only:
+  auto result = dash::reduce(array.begin(), array.begin() + 3,
+                             interval_t { -1, 0 }, concat_intervals());
+  EXPECT_EQ_U(-1, result.first);
+  EXPECT_EQ_U(3,  result.last);
+}
+
+TEST_F(ReduceTest, AllreduceInUnitOrder)
+{
+  interval_t value { static_cast<int>(_dash_id),
+                     static_cast<int>(_dash_id) + 1 };
+  auto result = dash::allreduce(value, concat_intervals());
+  EXPECT_EQ_U(0, result.first);
+  EXPECT_EQ_U(static_cast<int>(_dash_size), result.last);
+
+  auto sum = dash::allreduce(static_cast<long>(_dash_id + 1));
+  EXPECT_EQ_U(static_cast<long>(_dash_size * (_dash_size + 1) / 2), sum);
+
+  auto max = dash::allreduce(static_cast<float>(_dash_id), dash::max<float>());
+  EXPECT_EQ_U(static_cast<float>(_dash_size - 1), max);
+}
+
+TEST_F(ReduceTest, TransformReduce)
+{
+  // Large enough to be reduced by multiple threads:
+  const size_t num_elem_local = 4 * 1024 + 3;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = (array.pattern().global(l) % 2 == 0) ? 2 : -1;
+  }
+  array.barrier();
+
+  // Sum of squares:
+  long sum_sq = dash::transform_reduce(
+                  array.begin(), array.end(), 1l, dash::plus<long>(),
+                  [](int v) { return static_cast<long>(v) * v; });
+  long n_even = (num_elem_total + 1) / 2;
+  long n_odd  = num_elem_total / 2;
+  EXPECT_EQ_U(1 + 4 * n_even + n_odd, sum_sq);
+
+  // Count of negative elements, sequential local phase:
+  int n_neg = dash::transform_reduce(
+                dash::execution::seq,
+                array.begin(), array.end(), 0, dash::plus<int>(),
+                [](int v) { return v < 0 ? 1 : 0; });
+  EXPECT_EQ_U(static_cast<int>(n_odd), n_neg);
+
+  // User-defined operation, chunk results combined in order:
+  auto range = dash::transform_reduce(
+                 array.begin(), array.end(), interval_t { -1, 0 },
+                 concat_intervals(),
+                 [](int) { return interval_t { 0, 1 }; });
+  EXPECT_EQ_U(-1, range.first);
+  EXPECT_EQ_U(1,  range.last);
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include "ScanTest.h"
+#include "../TestBase.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/Scan.h>
+
+
+namespace {
+
+/// Value type without DART data type, scanned using gathered unit results
+struct interval_t {
+  int first;
+  int last;
+};
+
+/// Associative but not commutative operation, concatenates intervals
+struct concat_intervals {
+  interval_t operator()(const interval_t & lhs, const interval_t & rhs) const {
+    return interval_t { lhs.first, rhs.last };
+  }
+};
+
+} // namespace
+
+
+TEST_F(ScanTest, InclusivePrefixSum)
+{
+  // Large enough to be scanned by multiple threads:
+  const size_t num_elem_local = 3 * 1024 + 11;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<long> in(num_elem_total, dash::BLOCKED);
+  dash::Array<long> out(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < in.lsize(); ++l) {
+    in.local[l] = in.pattern().global(l) + 1;
+  }
+  in.barrier();
+
+  auto out_end = dash::inclusive_scan(in.begin(), in.end(), out.begin());
+  EXPECT_TRUE_U(out.end() == out_end);
+  for (size_t l = 0; l < out.lsize(); ++l) {
+    long g = out.pattern().global(l) + 1;
+    EXPECT_EQ_U((g * (g + 1)) / 2, out.local[l]);
+  }
+
+  // In-place with initial value and sequential local phase:
+  dash::inclusive_scan(dash::execution::seq, in.begin(), in.end(),
+                       in.begin(), dash::plus<long>(), 100l);
+  for (size_t l = 0; l < in.lsize(); ++l) {
+    EXPECT_EQ_U(out.local[l] + 100, in.local[l]);
+  }
+}
+
+TEST_F(ScanTest, ExclusivePrefixSumOffsets)
+{
+  // Row lengths to row offsets, like in the construction of CSR data:
+  const size_t num_elem_local = 17;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> lengths(num_elem_total, dash::BLOCKED);
+  dash::Array<int> offsets(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < lengths.lsize(); ++l) {
+    lengths.local[l] = lengths.pattern().global(l) % 3;
+  }
+  lengths.barrier();
+
+  dash::exclusive_scan(lengths.begin(), lengths.end(), offsets.begin(), 0);
+  offsets.barrier();
+
+  if (_dash_id == 0) {
+    int expected = 0;
+    for (size_t g = 0; g < num_elem_total; ++g) {
+      EXPECT_EQ_U(expected, static_cast<int>(offsets[g]));
+      expected += g % 3;
+    }
+  }
+}
+
+TEST_F(ScanTest, EmptyLocalRanges)
+{
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 1);
+  array.barrier();
+
+  // Range only covers elements of the last unit:
+  auto first = array.end() - num_elem_local + 2;
+  dash::inclusive_scan(first, array.end(), first, dash::max<int>(), 5);
+  dash::exclusive_scan(array.begin(), array.begin() + 2, array.begin(), 7);
+  array.barrier();
+
+  if (_dash_id == 0) {
+    EXPECT_EQ_U(7, static_cast<int>(array[0]));
+    EXPECT_EQ_U(8, static_cast<int>(array[1]));
+    for (size_t g = num_elem_total - num_elem_local + 2;
+         g < num_elem_total; ++g) {
+      EXPECT_EQ_U(5, static_cast<int>(array[g]));
+    }
+  }
+}
+
+TEST_F(ScanTest, UserDefinedOperation)
+{
+  const size_t num_elem_local = 5;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<interval_t> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    int g = array.pattern().global(l);
+    array.local[l] = interval_t { g, g + 1 };
+  }
+  array.barrier();
+
+  // Operation is not commutative, prefixes must be combined in order:
+  dash::inclusive_scan(array.begin(), array.end(), array.begin(),
+                       concat_intervals());
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    int g = array.pattern().global(l);
+    interval_t value = array.local[l];
+    EXPECT_EQ_U(0,     value.first);
+    EXPECT_EQ_U(g + 1, value.last);
+  }
+}
+
+TEST_F(ScanTest, NonContiguousLocalRange)
+{
+  const size_t num_elem_local = 10;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  if (_dash_size < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+
+  dash::Array<int> array(num_elem_total, dash::CYCLIC);
+  EXPECT_THROW(
+    dash::inclusive_scan(array.begin(), array.end(), array.begin()),
+    dash::exception::InvalidArgument);
+}
+
+TEST_F(ScanTest, NonContiguousLocalRangeAtSomeUnits)
+{
+  if (_dash_size < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  // Two blocks at unit 0, local elements of the last unit are
+  // contiguous:
+  size_t num_elem_total = (_dash_size + 1) * 2;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKCYCLIC(2));
+  dash::fill(array.begin(), array.end(), 1);
+  array.barrier();
+  // All units throw, none remains in the prefix reduction:
+  EXPECT_THROW(
+    dash::inclusive_scan(array.begin(), array.end(), array.begin()),
+    dash::exception::InvalidArgument);
+  EXPECT_THROW(
+    dash::exclusive_scan(array.begin(), array.end(), array.begin(), 0),
+    dash::exception::InvalidArgument);
+  array.barrier();
+}
@@ -0,0 +1,28 @@
+#ifndef DASH__TEST__SCAN_TEST_H_
+#define DASH__TEST__SCAN_TEST_H_
+
+#include "../TestBase.h"
+
+
+/**
+ * Test fixture for algorithms dash::inclusive_scan and
+ * dash::exclusive_scan.
+ */
+class ScanTest : public dash::test::TestBase {
+protected:
+  size_t _dash_id;
+  size_t _dash_size;
+
+  ScanTest()
+  : _dash_id(0),
+    _dash_size(0)
+  { }
+
+  virtual void SetUp() {
+    dash::test::TestBase::SetUp();
+    _dash_id   = dash::myid();
+    _dash_size = dash::size();
+  }
+};
+
+#endif // DASH__TEST__SCAN_TEST_H_
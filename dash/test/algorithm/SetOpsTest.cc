@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+
+#include "SetOpsTest.h"
+#include "../TestBase.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Count.h>
+#include <dash/algorithm/Remove.h>
+#include <dash/algorithm/Partition.h>
+#include <dash/algorithm/Unique.h>
+#include <dash/algorithm/SetIntersection.h>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+
+TEST_F(SetOpsTest, CountIf)
+{
+  const size_t num_elem_local = 23;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l) % 3;
+  }
+  array.barrier();
+
+  auto n_zero = dash::count_if(array.begin(), array.end(),
+                               [](int v) { return v == 0; });
+  EXPECT_EQ_U((num_elem_total + 2) / 3, n_zero);
+
+  auto n_one  = dash::count(array.begin(), array.end(), 1);
+  EXPECT_EQ_U((num_elem_total + 1) / 3, n_one);
+
+  auto n_sub  = dash::count_if(dash::execution::par,
+                               array.begin() + 1, array.end() - 1,
+                               [](int v) { return v != 2; });
+  size_t exp_sub = 0;
+  for (size_t g = 1; g < num_elem_total - 1; ++g) {
+    exp_sub += (g % 3 != 2) ? 1 : 0;
+  }
+  EXPECT_EQ_U(exp_sub, n_sub);
+}
+
+TEST_F(SetOpsTest, RemoveIfPreservesOrder)
+{
+  const size_t num_elem_local = 19;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  auto new_end = dash::remove_if(array.begin(), array.end(),
+                                 [](int v) { return v % 2 != 0; });
+  size_t num_kept = (num_elem_total + 1) / 2;
+  EXPECT_EQ_U(num_kept, static_cast<size_t>(new_end - array.begin()));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    size_t g = array.pattern().global(l);
+    if (g < num_kept) {
+      EXPECT_EQ_U(static_cast<int>(2 * g), array.local[l]);
+    }
+  }
+  array.barrier();
+
+  // Remove the only element equal to 0 from the remaining range:
+  new_end = dash::remove(array.begin(), new_end, 0);
+  EXPECT_EQ_U(num_kept - 1, static_cast<size_t>(new_end - array.begin()));
+  if (_dash_id == 0) {
+    EXPECT_EQ_U(2, static_cast<int>(array[0]));
+  }
+}
+
+TEST_F(SetOpsTest, PartitionIsStable)
+{
+  const size_t num_elem_local = 17;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  auto pred  = [](int v) { return v % 3 == 0; };
+  auto split = dash::partition(array.begin(), array.end(), pred);
+
+  std::vector<int> expected(num_elem_total);
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    expected[g] = g;
+  }
+  auto exp_split = std::stable_partition(
+                     expected.begin(), expected.end(), pred);
+  EXPECT_EQ_U(exp_split - expected.begin(), split - array.begin());
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    EXPECT_EQ_U(expected[array.pattern().global(l)], array.local[l]);
+  }
+}
+
+TEST_F(SetOpsTest, UniqueAcrossUnits)
+{
+  // Runs of equal values span unit boundaries:
+  const size_t num_elem_local = 7;
+  const size_t run_length     = 5;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l) / run_length;
+  }
+  array.barrier();
+
+  auto new_end   = dash::unique(array.begin(), array.end());
+  size_t num_uniq = (num_elem_total + run_length - 1) / run_length;
+  EXPECT_EQ_U(num_uniq, static_cast<size_t>(new_end - array.begin()));
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    size_t g = array.pattern().global(l);
+    if (g < num_uniq) {
+      EXPECT_EQ_U(static_cast<int>(g), array.local[l]);
+    }
+  }
+}
+
+TEST_F(SetOpsTest, SetIntersectionWithDuplicates)
+{
+  // Every value occurs twice in the first and three times in the second
+  // range, groups of equal values span unit boundaries:
+  const size_t num_elem_local_1 = 7;
+  const size_t num_elem_local_2 = 5;
+  size_t num_elem_total_1       = _dash_size * num_elem_local_1;
+  size_t num_elem_total_2       = _dash_size * num_elem_local_2;
+
+  dash::Array<int> range_1(num_elem_total_1, dash::BLOCKED);
+  dash::Array<int> range_2(num_elem_total_2, dash::BLOCKED);
+  for (size_t l = 0; l < range_1.lsize(); ++l) {
+    range_1.local[l] = range_1.pattern().global(l) / 2;
+  }
+  for (size_t l = 0; l < range_2.lsize(); ++l) {
+    range_2.local[l] = range_2.pattern().global(l) / 3 + 1;
+  }
+  dash::barrier();
+
+  std::vector<int> values_1(num_elem_total_1);
+  std::vector<int> values_2(num_elem_total_2);
+  for (size_t g = 0; g < num_elem_total_1; ++g) {
+    values_1[g] = g / 2;
+  }
+  for (size_t g = 0; g < num_elem_total_2; ++g) {
+    values_2[g] = g / 3 + 1;
+  }
+  std::vector<int> expected;
+  std::set_intersection(values_1.begin(), values_1.end(),
+                        values_2.begin(), values_2.end(),
+                        std::back_inserter(expected));
+
+  // Output range larger than the intersection:
+  dash::Array<int> out(num_elem_total_1, dash::BLOCKED);
+  auto out_end = dash::set_intersection(range_1.begin(), range_1.end(),
+                                        range_2.begin(), range_2.end(),
+                                        out.begin());
+  EXPECT_EQ_U(expected.size(),
+              static_cast<size_t>(out_end - out.begin()));
+  for (size_t l = 0; l < out.lsize(); ++l) {
+    size_t g = out.pattern().global(l);
+    if (g < expected.size()) {
+      EXPECT_EQ_U(expected[g], out.local[l]);
+    }
+  }
+
+  // Output array allocated by the algorithm:
+  dash::Array<int> out_alloc;
+  out_end = dash::set_intersection(range_1.begin(), range_1.end(),
+                                   range_2.begin(), range_2.end(),
+                                   out_alloc);
+  EXPECT_EQ_U(expected.size(), out_alloc.size());
+  EXPECT_TRUE_U(out_alloc.end() == out_end);
+  for (size_t l = 0; l < out_alloc.lsize(); ++l) {
+    EXPECT_EQ_U(expected[out_alloc.pattern().global(l)],
+                out_alloc.local[l]);
+  }
+}
+
+TEST_F(SetOpsTest, NonContiguousLocalRangeAtSomeUnits)
+{
+  if (_dash_size < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  // Two blocks at unit 0, local elements of the last unit are
+  // contiguous:
+  size_t num_elem_total = (_dash_size + 1) * 2;
+
+  dash::Array<int> cyclic(num_elem_total, dash::BLOCKCYCLIC(2));
+  dash::Array<int> blocked(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < cyclic.lsize(); ++l) {
+    cyclic.local[l] = cyclic.pattern().global(l);
+  }
+  for (size_t l = 0; l < blocked.lsize(); ++l) {
+    blocked.local[l] = blocked.pattern().global(l);
+  }
+  dash::barrier();
+
+  // All units throw, none remains in the exchange of block counts:
+  auto pred = [](int v) { return v % 2 != 0; };
+  EXPECT_THROW(
+    dash::remove_if(cyclic.begin(), cyclic.end(), pred),
+    dash::exception::InvalidArgument);
+  EXPECT_THROW(
+    dash::partition(cyclic.begin(), cyclic.end(), pred),
+    dash::exception::InvalidArgument);
+  EXPECT_THROW(
+    dash::unique(cyclic.begin(), cyclic.end()),
+    dash::exception::InvalidArgument);
+  // Valid input ranges, non-contiguous local elements in output range:
+  EXPECT_THROW(
+    dash::set_intersection(blocked.begin(), blocked.end(),
+                           blocked.begin(), blocked.end(),
+                           cyclic.begin()),
+    dash::exception::InvalidArgument);
+  dash::barrier();
+}
@@ -0,0 +1,117 @@
+
+#include "SortTest.h"
+
+#include <dash/algorithm/Sort.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/Array.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+
+namespace {
+
+/**
+ * Copies the elements in the range [first, last) of a global array to a
+ * local vector.
+ */
+template <class GlobIterType>
+std::vector<typename GlobIterType::value_type>
+copy_to_local(GlobIterType first, GlobIterType last)
+{
+  std::vector<typename GlobIterType::value_type> values(last - first);
+  dash::copy(first, last, values.data());
+  return values;
+}
+
+} // namespace
+
+TEST_F(SortTest, ArrayBlockedIntegral)
+{
+  typedef long value_t;
+  dash::Array<value_t> array(_num_elem_per_unit * dash::size());
+
+  std::mt19937 gen(dash::myid() + 1);
+  std::uniform_int_distribution<value_t> dist(-1000000, 1000000);
+  for (auto & value : array.local) {
+    value = dist(gen);
+  }
+  array.barrier();
+
+  auto unsorted = copy_to_local(array.begin(), array.end());
+  array.barrier();
+
+  dash::sort(array.begin(), array.end());
+
+  auto sorted = copy_to_local(array.begin(), array.end());
+  std::sort(unsorted.begin(), unsorted.end());
+  EXPECT_TRUE_U(std::equal(sorted.begin(), sorted.end(), unsorted.begin()));
+  EXPECT_TRUE_U(std::is_sorted(array.lbegin(), array.lend()));
+}
+
+TEST_F(SortTest, ArrayBlockcyclicCompare)
+{
+  typedef double value_t;
+  dash::Array<value_t> array(_num_elem_per_unit * dash::size(),
+                             dash::BLOCKCYCLIC(7));
+
+  std::mt19937 gen(dash::myid() + 1);
+  std::uniform_real_distribution<value_t> dist(-1.0, 1.0);
+  for (auto & value : array.local) {
+    value = dist(gen);
+  }
+  array.barrier();
+
+  auto unsorted = copy_to_local(array.begin(), array.end());
+  array.barrier();
+
+  dash::sort(array.begin(), array.end(), std::greater<value_t>());
+
+  auto sorted = copy_to_local(array.begin(), array.end());
+  std::sort(unsorted.begin(), unsorted.end(), std::greater<value_t>());
+  EXPECT_TRUE_U(std::equal(sorted.begin(), sorted.end(), unsorted.begin()));
+}
+
+TEST_F(SortTest, SubrangeDuplicates)
+{
+  typedef int value_t;
+  dash::Array<value_t> array(_num_elem_per_unit * dash::size());
+
+  // Few distinct values, buckets are imbalanced:
+  for (size_t l = 0; l < array.local.size(); ++l) {
+    array.local[l] = (l * 7 + dash::myid()) % 5;
+  }
+  array.barrier();
+
+  auto   unsorted = copy_to_local(array.begin(), array.end());
+  size_t offset   = _num_elem_per_unit / 2;
+  auto   first    = array.begin() + offset;
+  auto   last     = array.end()   - offset;
+  array.barrier();
+
+  dash::sort(first, last);
+
+  auto sorted = copy_to_local(array.begin(), array.end());
+  // Elements outside of the sorted range are unchanged:
+  EXPECT_TRUE_U(std::equal(sorted.begin(), sorted.begin() + offset,
+                           unsorted.begin()));
+  EXPECT_TRUE_U(std::equal(sorted.end() - offset, sorted.end(),
+                           unsorted.end() - offset));
+  std::sort(unsorted.begin() + offset, unsorted.end() - offset);
+  EXPECT_TRUE_U(std::equal(sorted.begin(), sorted.end(), unsorted.begin()));
+}
+
+TEST_F(SortTest, RadixSortLocal)
+{
+  std::vector<short> values;
+  for (int v = -2000; v < 2000; v += 3) {
+    values.push_back(static_cast<short>((v * 37) % 4001));
+  }
+  auto expected = values;
+  std::sort(expected.begin(), expected.end());
+
+  dash::internal::radix_sort(values.data(), values.data() + values.size());
+  EXPECT_EQ_U(expected, values);
+}
@@ -0,0 +1,24 @@
+#ifndef DASH__TEST__SORT_TEST_H_
+#define DASH__TEST__SORT_TEST_H_
+
+#include "../TestBase.h"
+
+#include <dash/Array.h>
+
+
+/**
+ * Test fixture for algorithm dash::sort.
+ */
+class SortTest : public dash::test::TestBase {
+protected:
+  /// Using a prime to cause inconvenient strides
+  const size_t _num_elem_per_unit = 997;
+
+  SortTest() {
+  }
+
+  virtual ~SortTest() {
+  }
+};
+
+#endif // DASH__TEST__SORT_TEST_H_
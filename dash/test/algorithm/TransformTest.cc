@@ -2,6 +2,8 @@
 #include "TransformTest.h"
 
 #include <dash/algorithm/Transform.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/ForEach.h>
 
 #include <dash/Array.h>
 #include <dash/Matrix.h>
@@ -153,6 +155,46 @@ TEST_F(TransformTest, ArrayGlobalPlusGlobalBlocking)
   }
 }
 
+TEST_F(TransformTest, NosyncChained)
+{
+  const size_t num_elem_local = 50;
+  size_t num_elem_total = dash::size() * num_elem_local;
+  dash::Array<int> array_dest(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_values(num_elem_total, dash::BLOCKED);
+
+  // fill -> transform -> for_each synchronized by a single barrier, output
+  // elements only depend on local input elements:
+  auto t_dest   = dash::fill_nosync(array_dest.begin(), array_dest.end(), 10);
+  auto t_values = dash::fill_nosync(
+                    array_values.begin(), array_values.end(), 1);
+  auto t_tf     = dash::transform_nosync(
+                    array_values.begin(), array_values.end(),
+                    array_dest.begin(),
+                    array_dest.begin(),
+                    dash::plus<int>());
+  auto t_each   = dash::for_each_nosync(
+                    array_dest.begin(), array_dest.end(),
+                    [](int & el) { el *= 2; });
+  EXPECT_TRUE_U(t_tf.pending());
+  dash::sync(t_dest, t_values, t_tf, t_each);
+
+  size_t neighbor_gidx = ((dash::myid() + 1) % dash::size()) *
+                         num_elem_local;
+  EXPECT_EQ_U(22, static_cast<int>(array_dest[neighbor_gidx]));
+  array_dest.barrier();
+
+  // Tokens reassigned or destroyed while pending synchronize their team:
+  {
+    auto t_fill = dash::fill_nosync(array_dest.begin(), array_dest.end(), 3);
+    t_fill      = dash::fill_nosync(
+                    array_values.begin(), array_values.end(), 4);
+    EXPECT_TRUE_U(t_fill.pending());
+  }
+  EXPECT_EQ_U(3, static_cast<int>(array_dest[neighbor_gidx]));
+  EXPECT_EQ_U(4, static_cast<int>(array_values[neighbor_gidx]));
+  array_dest.barrier();
+}
+
 TEST_F(TransformTest, MatrixGlobalPlusGlobalBlocking)
 {
   // Block-wise addition (a += b) of two matrices
@@ -5,6 +5,8 @@
 
 #include <dash/algorithm/ForEach.h>
 
+#include <dash/view/NodeLocal.h>
+
 #include <dash/pattern/BlockPattern1D.h>
 #include <dash/pattern/TilePattern1D.h>
 
@@ -229,3 +231,60 @@ TEST_F(ArrayTest, TeamSplit)
   team_all.barrier();
 }
 
+
+TEST_F(ArrayTest, NodeLocalAccess)
+{
+  const size_t nlocal = 10;
+  dash::Array<int> array(nlocal * dash::size(), dash::BLOCKED);
+
+  for (size_t l = 0; l < nlocal; ++l) {
+    array.local[l] = dash::myid() * 1000 + l;
+  }
+  array.barrier();
+
+  // Local elements are always accessible with native loads and stores:
+  auto lgptr = array.begin() + dash::myid() * nlocal;
+  EXPECT_TRUE_U(dash::is_node_local(lgptr));
+  EXPECT_TRUE_U(dash::is_node_local(*lgptr));
+  EXPECT_EQ_U(array.lbegin(), lgptr.globmem().at(dash::Team::All().myid(), 0)
+                                .node_local());
+
+  auto node_view = dash::node_local(array);
+  EXPECT_GE_U(node_view.nblocks(), 1);
+  EXPECT_EQ_U(node_view.nblocks() * nlocal, node_view.size());
+
+  size_t nblocks = 0;
+  for (auto block : node_view) {
+    auto unit = node_view.unit(nblocks++);
+    EXPECT_EQ_U(nlocal, block.end() - block.begin());
+    EXPECT_TRUE_U(dash::is_node_local(array.begin() + unit * nlocal));
+    for (size_t l = 0; l < nlocal; ++l) {
+      EXPECT_EQ_U(static_cast<int>(unit * 1000 + l), block.begin()[l]);
+      // Node-local elements referenced by GlobRef are accessed directly:
+      EXPECT_EQ_U(block.begin()[l],
+                  static_cast<int>(array[unit * nlocal + l]));
+    }
+  }
+  LOG_MESSAGE("node-local units: %zu", nblocks);
+
+  // Units not contained in the node-local view are not accessible
+  // directly:
+  size_t nnode_local = 0;
+  for (size_t u = 0; u < dash::size(); ++u) {
+    if (dash::is_node_local(array.begin() + u * nlocal)) {
+      ++nnode_local;
+    }
+  }
+  EXPECT_EQ_U(nblocks, nnode_local);
+
+  array.barrier();
+
+  // Write through global reference, uses native store if the element is
+  // node-local:
+  if (dash::myid() == 0) {
+    array[(dash::size() - 1) * nlocal] = -1;
+  }
+  array.barrier();
+
+  EXPECT_EQ_U(-1, static_cast<int>(array[(dash::size() - 1) * nlocal]));
+}
@@ -0,0 +1,82 @@
+
+#include "HaloMatrixTest.h"
+
+#include <dash/Matrix.h>
+#include <dash/Pattern.h>
+#include <dash/Distribution.h>
+
+#include <dash/experimental/HaloMatrix.h>
+
+#include <algorithm>
+
+
+TEST_F(HaloMatrixTest, CyclicUpdatePlan)
+{
+  typedef dash::Pattern<2>                       pattern_t;
+  typedef typename pattern_t::index_type         index_t;
+  typedef dash::Matrix<int, 2, index_t, pattern_t> matrix_t;
+  typedef dash::experimental::HaloSpec<2>         halospec_t;
+  typedef dash::experimental::HaloMatrix<matrix_t, halospec_t>
+                                                  halomatrix_t;
+
+  auto   num_units = dash::size();
+  size_t ext_rows  = 4 * num_units;
+  size_t ext_cols  = 5;
+
+  pattern_t pattern(dash::SizeSpec<2>(ext_rows, ext_cols),
+                    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE),
+                    dash::TeamSpec<2>());
+  matrix_t  matrix(pattern);
+
+  // Encode global coordinates in element values:
+  for (size_t r = 0; r < ext_rows; ++r) {
+    for (size_t c = 0; c < ext_cols; ++c) {
+      if (matrix(r,c).is_local()) {
+        matrix(r,c) = static_cast<int>(r * 100 + c);
+      }
+    }
+  }
+  matrix.barrier();
+
+  halospec_t halospec({ { { -1, 1 }, { -1, 1 } } });
+  halomatrix_t halomatrix(matrix, halospec,
+                          { { dash::experimental::BoundaryProp::CYCLIC,
+                              dash::experimental::BoundaryProp::CYCLIC } });
+
+  // Halo elements are fetched from the neighbor units and from the
+  // opposite columns of the calling unit's block:
+  EXPECT_EQ_U(std::min<size_t>(num_units, 3),
+              halomatrix.updatePlan().num_transfers());
+
+  halomatrix.updateHalosAsync();
+  halomatrix.waitHalosAsync();
+
+  for (auto it = halomatrix.bbegin(); it != halomatrix.bend(); ++it) {
+    int value = *it;
+    int r     = value / 100;
+    int c     = value % 100;
+    int r_n   = (r + ext_rows - 1) % ext_rows;
+    int r_s   = (r + 1) % ext_rows;
+    int c_w   = (c + ext_cols - 1) % ext_cols;
+    int c_e   = (c + 1) % ext_cols;
+    EXPECT_EQ_U(r_n * 100 + c,   it.halo_value(0, -1));
+    EXPECT_EQ_U(r_s * 100 + c,   it.halo_value(0,  1));
+    EXPECT_EQ_U(r   * 100 + c_w, it.halo_value(1, -1));
+    EXPECT_EQ_U(r   * 100 + c_e, it.halo_value(1,  1));
+  }
+
+  // Updating a single region uses its own plan:
+  std::fill(matrix.lbegin(), matrix.lend(), -1);
+  matrix.barrier();
+  halomatrix.updateHalo(0, dash::experimental::HaloRegion::MINUS);
+
+  for (auto it = halomatrix.bbegin(); it != halomatrix.bend(); ++it) {
+    if (it.lpos() < static_cast<index_t>(ext_cols)) {
+      EXPECT_EQ_U(-1, it.halo_value(0, -1));
+    }
+    if (it.lpos() >= static_cast<index_t>(3 * ext_cols)) {
+      EXPECT_NE_U(-1, it.halo_value(0,  1));
+    }
+  }
+  matrix.barrier();
+}
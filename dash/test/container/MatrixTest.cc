@@ -737,13 +737,25 @@ TEST_F(MatrixTest, BlockCopy)
   LOG_MESSAGE("Team barrier passed");
 
   // Copy block 1 of matrix_a to block 0 of matrix_b:
-  dash::copy<element_t>(matrix_a.block(1).begin(),
-                        matrix_a.block(1).end(),
-                        matrix_b.block(0).begin());
+  dash::copy(matrix_a.block(1).begin(),
+             matrix_a.block(1).end(),
+             matrix_b.block(0).begin());
 
   LOG_MESSAGE("Wait for team barrier ...");
   dash::barrier();
   LOG_MESSAGE("Team barrier passed");
+
+  if (myid == 0) {
+    // Iterators refer to the view specs of the blocks:
+    auto block_a = matrix_a.block(1);
+    auto block_b = matrix_b.block(0);
+    auto a_it    = block_a.begin();
+    auto b_it    = block_b.begin();
+    for (; a_it != block_a.end(); ++a_it, ++b_it) {
+      EXPECT_EQ_U(static_cast<element_t>(*a_it),
+                  static_cast<element_t>(*b_it));
+    }
+  }
 }
 
 TEST_F(MatrixTest, StorageOrder)
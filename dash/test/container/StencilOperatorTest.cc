@@ -0,0 +1,238 @@
+
+#include "StencilOperatorTest.h"
+
+#include <dash/Matrix.h>
+#include <dash/Pattern.h>
+#include <dash/Distribution.h>
+
+#include <dash/experimental/StencilOperator.h>
+
+#include <array>
+#include <ratio>
+#include <vector>
+
+using dash::experimental::BoundaryProp;
+using dash::experimental::StencilOperator;
+using dash::experimental::StencilPoint;
+using dash::experimental::StencilSpec;
+
+
+/**
+ * Applies a stencil with points offset by 1 to a row-major array in the
+ * given number of time steps. Elements at global boundaries that are not
+ * cyclic are not modified.
+ */
+template<typename StencilSpecT>
+std::vector<double> stencil_reference(
+  std::vector<double>          values,
+  const std::array<long, 2>  & extents,
+  const std::array<bool, 2>  & cyclic,
+  int                          steps)
+{
+  std::vector<double> next(values);
+  for (int s = 0; s < steps; ++s) {
+    for (long r = 0; r < extents[0]; ++r) {
+      for (long c = 0; c < extents[1]; ++c) {
+        std::array<long, 2> coords {{ r, c }};
+        bool fixed = false;
+        for (int d = 0; d < 2; ++d) {
+          if (!cyclic[d] && extents[d] > 1 &&
+              (coords[d] == 0 || coords[d] == extents[d] - 1)) {
+            fixed = true;
+          }
+        }
+        if (fixed) {
+          continue;
+        }
+        double value = 0;
+        for (std::size_t p = 0; p < StencilSpecT::num_points(); ++p) {
+          auto nr = (r + StencilSpecT::offset(p, 0) + extents[0]) % extents[0];
+          auto nc = (c + (StencilSpecT::ndim() > 1
+                          ? StencilSpecT::offset(p, StencilSpecT::ndim() - 1)
+                          : 0) + extents[1]) % extents[1];
+          value += StencilSpecT::weight(p) * values[nr * extents[1] + nc];
+        }
+        next[r * extents[1] + c] = value;
+      }
+    }
+    std::swap(values, next);
+  }
+  return values;
+}
+
+TEST_F(StencilOperatorTest, Jacobi1Dim)
+{
+  typedef dash::Pattern<1>                                pattern_t;
+  typedef typename pattern_t::index_type                  index_t;
+  typedef dash::Matrix<double, 1, index_t, pattern_t>     matrix_t;
+  typedef StencilSpec<
+            StencilPoint<std::ratio<1,4>, -1>,
+            StencilPoint<std::ratio<1,2>,  0>,
+            StencilPoint<std::ratio<1,4>,  1> >           stencil_t;
+
+  auto num_units = dash::size();
+  long nelem     = 20 * num_units;
+  int  steps     = 10;
+
+  std::vector<double> values(nelem);
+  for (long i = 0; i < nelem; ++i) {
+    values[i] = (i * 7) % 16;
+  }
+  auto expected = stencil_reference<stencil_t>(
+                    values, {{ nelem, 1 }}, {{ false, false }}, steps);
+
+  // Halo width of the stencil radius and wide halo regions for four
+  // time steps per halo update:
+  for (int halo_steps : { 1, 4 }) {
+    pattern_t pattern(dash::SizeSpec<1>(nelem),
+                      dash::DistributionSpec<1>(dash::BLOCKED),
+                      dash::TeamSpec<1>());
+    matrix_t  first(pattern);
+    matrix_t  second(pattern);
+    for (long i = 0; i < nelem; ++i) {
+      if (first[i].is_local()) {
+        first[i]  = values[i];
+        second[i] = values[i];
+      }
+    }
+    first.barrier();
+
+    StencilOperator<matrix_t, stencil_t> op(
+      first, second, stencil_t::halospec(halo_steps));
+    if (num_units > 1) {
+      EXPECT_EQ_U(halo_steps, op.steps_per_update());
+    } else if (halo_steps > 1) {
+      LOG_MESSAGE("StencilOperatorTest.Jacobi1Dim: "
+                  "temporal blocking requires at least 2 units");
+      continue;
+    }
+
+    op.apply(steps);
+    auto & result = op.current();
+
+    for (long i = 0; i < nelem; ++i) {
+      if (result[i].is_local()) {
+        EXPECT_EQ_U(expected[i], static_cast<double>(result[i]));
+      }
+    }
+    result.barrier();
+  }
+}
+
+TEST_F(StencilOperatorTest, FivePoint2DimCyclic)
+{
+  typedef dash::Pattern<2>                                pattern_t;
+  typedef typename pattern_t::index_type                  index_t;
+  typedef dash::Matrix<double, 2, index_t, pattern_t>     matrix_t;
+  typedef StencilSpec<
+            StencilPoint<std::ratio<1,8>, -1,  0>,
+            StencilPoint<std::ratio<1,8>,  0, -1>,
+            StencilPoint<std::ratio<1,2>,  0,  0>,
+            StencilPoint<std::ratio<1,8>,  0,  1>,
+            StencilPoint<std::ratio<1,8>,  1,  0> >       stencil_t;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+
+  long ext_rows = 6 * teamspec.extent(0);
+  long ext_cols = 5 * teamspec.extent(1);
+  int  steps    = 5;
+
+  std::vector<double> values(ext_rows * ext_cols);
+  for (long i = 0; i < ext_rows * ext_cols; ++i) {
+    values[i] = (i * 5) % 11;
+  }
+  auto expected = stencil_reference<stencil_t>(
+                    values, {{ ext_rows, ext_cols }}, {{ true, true }},
+                    steps);
+
+  pattern_t pattern(dash::SizeSpec<2>(ext_rows, ext_cols),
+                    dash::DistributionSpec<2>(dash::BLOCKED, dash::BLOCKED),
+                    teamspec);
+  matrix_t  first(pattern);
+  matrix_t  second(pattern);
+  for (long r = 0; r < ext_rows; ++r) {
+    for (long c = 0; c < ext_cols; ++c) {
+      if (first(r,c).is_local()) {
+        first(r,c) = values[r * ext_cols + c];
+      }
+    }
+  }
+  first.barrier();
+
+  StencilOperator<matrix_t, stencil_t> op(
+    first, second, stencil_t::halospec(),
+    {{ BoundaryProp::CYCLIC, BoundaryProp::CYCLIC }});
+  op.apply(steps);
+
+  auto & result = op.current();
+  for (long r = 0; r < ext_rows; ++r) {
+    for (long c = 0; c < ext_cols; ++c) {
+      if (result(r,c).is_local()) {
+        EXPECT_EQ_U(expected[r * ext_cols + c],
+                    static_cast<double>(result(r,c)));
+      }
+    }
+  }
+  result.barrier();
+}
+
+TEST_F(StencilOperatorTest, TemporalBlocking2Dim)
+{
+  typedef dash::Pattern<2>                                pattern_t;
+  typedef typename pattern_t::index_type                  index_t;
+  typedef dash::Matrix<double, 2, index_t, pattern_t>     matrix_t;
+  typedef StencilSpec<
+            StencilPoint<std::ratio<1,8>, -1,  0>,
+            StencilPoint<std::ratio<1,8>,  0, -1>,
+            StencilPoint<std::ratio<1,2>,  0,  0>,
+            StencilPoint<std::ratio<1,8>,  0,  1>,
+            StencilPoint<std::ratio<1,8>,  1,  0> >       stencil_t;
+
+  auto num_units = dash::size();
+  long ext_rows  = 8 * num_units;
+  long ext_cols  = 7;
+  // Not a multiple of the time steps per halo update:
+  int  steps     = 7;
+
+  std::vector<double> values(ext_rows * ext_cols);
+  for (long i = 0; i < ext_rows * ext_cols; ++i) {
+    values[i] = (i * 3) % 13;
+  }
+  auto expected = stencil_reference<stencil_t>(
+                    values, {{ ext_rows, ext_cols }}, {{ true, false }},
+                    steps);
+
+  // Halo regions only in the distributed, cyclic dimension:
+  pattern_t pattern(dash::SizeSpec<2>(ext_rows, ext_cols),
+                    dash::DistributionSpec<2>(dash::BLOCKED, dash::NONE),
+                    dash::TeamSpec<2>());
+  matrix_t  first(pattern);
+  matrix_t  second(pattern);
+  for (long r = 0; r < ext_rows; ++r) {
+    for (long c = 0; c < ext_cols; ++c) {
+      if (first(r,c).is_local()) {
+        first(r,c)  = values[r * ext_cols + c];
+        second(r,c) = values[r * ext_cols + c];
+      }
+    }
+  }
+  first.barrier();
+
+  StencilOperator<matrix_t, stencil_t> op(
+    first, second, stencil_t::halospec(3),
+    {{ BoundaryProp::CYCLIC, BoundaryProp::NONE }});
+  EXPECT_EQ_U(3, op.steps_per_update());
+  op.apply(steps);
+
+  auto & result = op.current();
+  for (long r = 0; r < ext_rows; ++r) {
+    for (long c = 0; c < ext_cols; ++c) {
+      if (result(r,c).is_local()) {
+        EXPECT_EQ_U(expected[r * ext_cols + c],
+                    static_cast<double>(result(r,c)));
+      }
+    }
+  }
+  result.barrier();
+}
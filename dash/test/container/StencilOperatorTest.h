@@ -0,0 +1,21 @@
+#ifndef DASH__TEST__STENCIL_OPERATOR_TEST_H_
+#define DASH__TEST__STENCIL_OPERATOR_TEST_H_
+
+#include <gtest/gtest.h>
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::experimental::StencilOperator
+ */
+class StencilOperatorTest : public dash::test::TestBase {
+protected:
+
+  StencilOperatorTest() {
+  }
+
+  virtual ~StencilOperatorTest() {
+  }
+};
+
+#endif // DASH__TEST__STENCIL_OPERATOR_TEST_H_
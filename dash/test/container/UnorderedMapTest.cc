@@ -4,18 +4,22 @@
 #include <dash/Meta.h>
 #include <dash/UnorderedMap.h>
 #include <dash/Atomic.h>
+#include <dash/algorithm/Reduce.h>
 
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
 
 TEST_F(UnorderedMapTest, Initialization)
 {
-  typedef int                                  key_t;
-  typedef double                               mapped_t;
-  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
-  typedef typename map_t::iterator             map_iterator;
-  typedef typename map_t::value_type           map_value;
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::HashLocal<key_t>                        hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::iterator                      map_iterator;
+  typedef typename map_t::value_type                    map_value;
 
   auto nunits    = dash::size();
   auto myid      = dash::myid();
@@ -76,11 +80,12 @@ TEST_F(UnorderedMapTest, Initialization)
 
 TEST_F(UnorderedMapTest, BalancedGlobalInsert)
 {
-  typedef int                                  key_t;
-  typedef double                               mapped_t;
-  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
-  typedef typename map_t::iterator             map_iterator;
-  typedef typename map_t::value_type           map_value;
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::HashLocal<key_t>                        hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::iterator                      map_iterator;
+  typedef typename map_t::value_type                    map_value;
 
   map_t map;
   EXPECT_EQ_U(0, map.size());
@@ -183,12 +188,13 @@ TEST_F(UnorderedMapTest, BalancedGlobalInsert)
 
 TEST_F(UnorderedMapTest, UnbalancedGlobalInsert)
 {
-  typedef int                                  key_t;
-  typedef double                               mapped_t;
-  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
-  typedef typename map_t::iterator             map_iterator;
-  typedef typename map_t::value_type           map_value;
-  typedef typename map_t::size_type            size_type;
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef dash::HashLocal<key_t>                        hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::iterator                      map_iterator;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
 
   if (dash::size() < 2) {
     LOG_MESSAGE(
@@ -543,3 +549,334 @@ TEST_F(UnorderedMapTest, MappedAtomics)
   }
 }
 
+
+TEST_F(UnorderedMapTest, PartitionedInsertFind)
+{
+  typedef int                                  key_t;
+  typedef double                               mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
+  typedef typename map_t::value_type           map_value;
+
+  int nunits         = dash::size();
+  int myid           = dash::myid().id;
+  int elem_per_unit  = 50;
+  int total_elements = nunits * elem_per_unit;
+
+  map_t map;
+  // Insert keys mapped to any unit:
+  for (int li = 0; li < elem_per_unit; ++li) {
+    key_t    key    = li * nunits + myid;
+    mapped_t mapped = 0.5 * key;
+    auto insertion  = map.insert(map_value(key, mapped));
+    EXPECT_TRUE_U(insertion.second);
+    EXPECT_FALSE_U(map.insert(map_value(key, mapped)).second);
+    // Elements inserted for remote units are accessible before commit:
+    EXPECT_EQ_U(1, map.count(key));
+    mapped_t lookup = map[key];
+    EXPECT_EQ_U(mapped, lookup);
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(total_elements, map.size());
+  // Elements are stored at the units their keys are mapped to:
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(myid, map.bucket(value.first));
+  }
+  // Look up keys inserted by all units:
+  for (key_t key = 0; key < total_elements; ++key) {
+    auto found = map.find(key);
+    ASSERT_TRUE_U(found != map.end());
+    map_value value = *found;
+    EXPECT_EQ_U(key, value.first);
+    EXPECT_EQ_U(0.5 * key, value.second);
+  }
+  EXPECT_EQ_U(map.end(), map.find(total_elements));
+  EXPECT_EQ_U(0, map.count(-1));
+}
+
+TEST_F(UnorderedMapTest, FindManyInsertMany)
+{
+  typedef int                                  key_t;
+  typedef double                               mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
+  typedef typename map_t::value_type           map_value;
+
+  int nunits         = dash::size();
+  int myid           = dash::myid().id;
+  int elem_per_unit  = 100;
+  int total_elements = nunits * elem_per_unit;
+
+  map_t map;
+  std::vector<map_value> values;
+  for (int li = 0; li < elem_per_unit; ++li) {
+    key_t key = li * nunits + myid;
+    values.push_back(map_value(key, 2.0 * key));
+  }
+  // Key inserted by every unit, only one value is inserted:
+  values.push_back(map_value(-1, 1.0 * myid));
+
+  auto inserted = map.insert_many(values.begin(), values.end());
+  ASSERT_EQ_U(values.size(), inserted.size());
+  for (int li = 0; li < elem_per_unit; ++li) {
+    EXPECT_TRUE_U(inserted[li].second);
+    map_value value = *inserted[li].first;
+    EXPECT_EQ_U(values[li].first,  value.first);
+    EXPECT_EQ_U(values[li].second, value.second);
+  }
+  EXPECT_EQ_U(total_elements + 1, map.size());
+  int ninserted_shared = dash::allreduce(
+                           static_cast<int>(inserted.back().second),
+                           dash::plus<int>());
+  EXPECT_EQ_U(1, ninserted_shared);
+
+  // Look up keys of the next unit and keys not contained in the map:
+  std::vector<key_t> keys;
+  for (int li = 0; li < elem_per_unit; ++li) {
+    keys.push_back(li * nunits + (myid + 1) % nunits);
+    keys.push_back(total_elements + li);
+  }
+  auto found = map.find_many(keys.begin(), keys.end());
+  ASSERT_EQ_U(keys.size(), found.size());
+  for (size_t k = 0; k < keys.size(); ++k) {
+    if (keys[k] < total_elements) {
+      ASSERT_TRUE_U(found[k] != map.end());
+      map_value value = *found[k];
+      EXPECT_EQ_U(keys[k],       value.first);
+      EXPECT_EQ_U(2.0 * keys[k], value.second);
+    } else {
+      EXPECT_EQ_U(map.end(), found[k]);
+    }
+  }
+}
+
+TEST_F(UnorderedMapTest, BulkInsertMerge)
+{
+  typedef int                                  key_t;
+  typedef int                                  mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
+  typedef typename map_t::value_type           map_value;
+
+  int nunits        = dash::size();
+  int myid          = dash::myid().id;
+  int elem_per_unit = 100;
+
+  map_t map;
+  // Every unit inserts every key twice, counts are summed:
+  std::vector<map_value> values;
+  for (int rep = 0; rep < 2; ++rep) {
+    for (int key = 0; key < elem_per_unit; ++key) {
+      values.push_back(map_value(key, 1));
+    }
+  }
+  if (myid == 0) {
+    // Single insertion, merged with values of range insertions:
+    map.insert(map_value(-1, 100));
+  }
+  values.push_back(map_value(-1, 1));
+  map.insert(values.begin(), values.end(), dash::plus<mapped_t>());
+  // Values of range insertions are not contained in the map before commit:
+  EXPECT_EQ_U(0, map.count(0));
+
+  map.barrier();
+  EXPECT_EQ_U(elem_per_unit + 1, map.size());
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(myid, map.bucket(value.first));
+  }
+  for (int key = 0; key < elem_per_unit; ++key) {
+    EXPECT_EQ_U(2 * nunits, static_cast<mapped_t>(map[key]));
+  }
+  EXPECT_EQ_U(100 + nunits, static_cast<mapped_t>(map[-1]));
+  map.barrier();
+
+  // Minimum of existing and inserted values, new keys are inserted:
+  values.clear();
+  for (int key = 0; key < 2 * elem_per_unit; ++key) {
+    values.push_back(map_value(key, myid + 1));
+  }
+  map.insert(values.begin(), values.end(), dash::min<mapped_t>());
+  map.barrier();
+  EXPECT_EQ_U(2 * elem_per_unit + 1, map.size());
+  for (int key = 0; key < 2 * elem_per_unit; ++key) {
+    EXPECT_EQ_U(1, static_cast<mapped_t>(map[key]));
+  }
+  map.barrier();
+
+  // Without merge operation, existing elements are kept:
+  values.clear();
+  for (int key = 0; key < 3 * elem_per_unit; ++key) {
+    values.push_back(map_value(key, -1));
+  }
+  map.insert(values.begin(), values.end());
+  map.barrier();
+  EXPECT_EQ_U(3 * elem_per_unit + 1, map.size());
+  for (int key = 0; key < 3 * elem_per_unit; ++key) {
+    EXPECT_EQ_U(key < 2 * elem_per_unit ? 1 : -1,
+                static_cast<mapped_t>(map[key]));
+  }
+}
+
+TEST_F(UnorderedMapTest, BulkInsertMergeAtSomeUnits)
+{
+  typedef int                                  key_t;
+  typedef int                                  mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
+  typedef typename map_t::value_type           map_value;
+
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+  int myid          = dash::myid().id;
+  int elem_per_unit = 50;
+
+  map_t map;
+  std::vector<map_value> values;
+  for (int key = 0; key < elem_per_unit; ++key) {
+    values.push_back(map_value(key, myid));
+  }
+  map.insert(values.begin(), values.end());
+  map.barrier();
+
+  // Merge operation only specified at unit 0, all units throw before
+  // values are exchanged:
+  values.clear();
+  for (int key = 0; key < 2 * elem_per_unit; ++key) {
+    values.push_back(map_value(key, -1));
+  }
+  if (myid == 0) {
+    map.insert(values.begin(), values.end(), dash::plus<mapped_t>());
+  } else {
+    map.insert(values.begin(), values.end());
+  }
+  EXPECT_THROW(map.barrier(), dash::exception::InvalidArgument);
+
+  // Staged values have been discarded:
+  map.barrier();
+  EXPECT_EQ_U(elem_per_unit, map.size());
+  EXPECT_EQ_U(0, map.count(elem_per_unit));
+  EXPECT_EQ_U(1, map.count(0));
+}
+
+TEST_F(UnorderedMapTest, InsertMergeAtSomeInsertions)
+{
+  typedef int                                  key_t;
+  typedef int                                  mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
+  typedef typename map_t::value_type           map_value;
+
+  int nkeys = 100;
+
+  map_t map;
+  std::vector<map_value> values;
+  for (int key = 0; key < nkeys; ++key) {
+    values.push_back(map_value(key, 1));
+  }
+  map.insert(values.begin(), values.end());
+  map.barrier();
+
+  // Range insertion with merge operation and concurrent insertions
+  // without merge operation at every unit, all units throw before values
+  // are exchanged:
+  values.clear();
+  for (int key = 0; key < nkeys; ++key) {
+    values.push_back(map_value(key, 1));
+  }
+  map.insert(values.begin(), values.end(), dash::plus<mapped_t>());
+  for (int key = nkeys; key < 2 * nkeys; ++key) {
+    map.concurrent.insert(map_value(key, 1));
+  }
+  EXPECT_THROW(map.barrier(), dash::exception::InvalidArgument);
+
+  // Staged values have been discarded:
+  map.barrier();
+  EXPECT_EQ_U(nkeys, map.size());
+  EXPECT_EQ_U(0, map.count(nkeys));
+
+  // Concurrent insertions with and without merge operation in different
+  // stripes at a single unit also throw at all units:
+  if (dash::myid() == 0) {
+    for (int key = 0; key < nkeys; ++key) {
+      map.concurrent.insert(map_value(key, 1), dash::plus<mapped_t>());
+    }
+    for (int key = nkeys; key < 2 * nkeys; ++key) {
+      map.concurrent.insert(map_value(key, 1));
+    }
+  } else {
+    for (int key = 0; key < nkeys; ++key) {
+      map.concurrent.insert(map_value(key, 1), dash::plus<mapped_t>());
+    }
+  }
+  EXPECT_THROW(map.barrier(), dash::exception::InvalidArgument);
+  map.barrier();
+  EXPECT_EQ_U(nkeys, map.size());
+  for (int key = 0; key < nkeys; ++key) {
+    EXPECT_EQ_U(1, static_cast<mapped_t>(map[key]));
+  }
+}
+
+TEST_F(UnorderedMapTest, ConcurrentLocalInsert)
+{
+  typedef int                                  key_t;
+  typedef int                                  mapped_t;
+  typedef dash::UnorderedMap<key_t, mapped_t>  map_t;
+  typedef typename map_t::value_type           map_value;
+
+  int nunits   = dash::size();
+  int nthreads = 4;
+  int nkeys    = 200;
+
+  map_t map;
+  std::vector<map_value> values;
+  for (int key = 0; key < nkeys / 2; ++key) {
+    values.push_back(map_value(key, 1));
+  }
+  map.insert(values.begin(), values.end());
+  map.barrier();
+
+  // Every thread adds 1 to every key:
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nthreads; ++t) {
+    threads.emplace_back([&]() {
+      for (int key = 0; key < nkeys; ++key) {
+        map.concurrent.insert(map_value(key, 1), dash::plus<mapped_t>());
+        EXPECT_EQ_U(1, map.concurrent.count(key));
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  map.barrier();
+  EXPECT_EQ_U(nkeys, map.size());
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    map_value value = *lit;
+    map_value found = *map.concurrent.find(value.first);
+    EXPECT_EQ_U(value.second, found.second);
+    int initial = (value.first < nkeys / 2) ? 1 : 0;
+    EXPECT_EQ_U(initial + nthreads * nunits, value.second);
+  }
+  map.barrier();
+
+  // Every key is inserted once by the threads of a unit:
+  int              lsize = map.lsize();
+  std::atomic<int> ninserted(0);
+  threads.clear();
+  for (int t = 0; t < nthreads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int key = 0; key < 2 * nkeys; ++key) {
+        if (map.concurrent.insert(map_value(key, -t))) {
+          ++ninserted;
+        }
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ_U(nkeys, map.size());
+  map.barrier();
+  EXPECT_EQ_U(2 * nkeys, map.size());
+  // Keys of local elements are not inserted again:
+  EXPECT_EQ_U(2 * nkeys - lsize, ninserted.load());
+}
@@ -3,6 +3,9 @@
 
 #include <dash/dart/if/dart.h>
 
+#include <algorithm>
+#include <vector>
+
 
 TEST_F(DARTCollectiveTest, Send_Recv) {
   // we need an even amount of participating units
@@ -50,3 +53,268 @@ TEST_F(DARTCollectiveTest, Sendrecv) {
     ASSERT_EQ(recv, data[partner]);
   }
 }
+
+TEST_F(DARTCollectiveTest, BcastAllreduceAllgather) {
+  // collective operations may be implemented in an intra-node and an
+  // inter-node phase, depending on the placement of units
+  const int nelem = 3;
+
+  for (int root = 0; root < _dash_size; ++root) {
+    std::vector<int> values(nelem, -1);
+    if (_dash_id == root) {
+      for (int i = 0; i < nelem; ++i) {
+        values[i] = root * 100 + i;
+      }
+    }
+    ASSERT_EQ(DART_OK,
+              dart_bcast(values.data(), nelem, DART_TYPE_INT,
+                         dart_team_unit_t{root}, DART_TEAM_ALL));
+    for (int i = 0; i < nelem; ++i) {
+      ASSERT_EQ(root * 100 + i, values[i]);
+    }
+  }
+  ASSERT_EQ(DART_OK, dart_barrier(DART_TEAM_ALL));
+
+  std::vector<int> send(nelem);
+  std::vector<int> sum(nelem);
+  for (int i = 0; i < nelem; ++i) {
+    send[i] = _dash_id + i;
+  }
+  ASSERT_EQ(DART_OK,
+            dart_allreduce(send.data(), sum.data(), nelem, DART_TYPE_INT,
+                           DART_OP_SUM, DART_TEAM_ALL));
+  for (int i = 0; i < nelem; ++i) {
+    int expected = (_dash_size * (_dash_size - 1)) / 2 + _dash_size * i;
+    ASSERT_EQ(expected, sum[i]);
+  }
+
+  std::vector<int> prefix(nelem, -1);
+  ASSERT_EQ(DART_OK,
+            dart_exscan(send.data(), prefix.data(), nelem, DART_TYPE_INT,
+                        DART_OP_SUM, DART_TEAM_ALL));
+  if (_dash_id > 0) {
+    int myid = static_cast<int>(_dash_id);
+    for (int i = 0; i < nelem; ++i) {
+      int expected = (myid * (myid - 1)) / 2 + myid * i;
+      ASSERT_EQ(expected, prefix[i]);
+    }
+  }
+
+  std::vector<int> gathered(nelem * _dash_size, -1);
+  ASSERT_EQ(DART_OK,
+            dart_allgather(send.data(), gathered.data(), nelem,
+                           DART_TYPE_INT, DART_TEAM_ALL));
+  for (int u = 0; u < _dash_size; ++u) {
+    for (int i = 0; i < nelem; ++i) {
+      ASSERT_EQ(u + i, gathered[u * nelem + i]);
+    }
+  }
+
+  // in-place variant
+  std::vector<int> inplace(nelem * _dash_size, -1);
+  for (int i = 0; i < nelem; ++i) {
+    inplace[_dash_id * nelem + i] = send[i];
+  }
+  ASSERT_EQ(DART_OK,
+            dart_allgather(nullptr, inplace.data(), nelem,
+                           DART_TYPE_INT, DART_TEAM_ALL));
+  ASSERT_EQ(gathered, inplace);
+}
+
+TEST_F(DARTCollectiveTest, NonBlocking) {
+  dart_handle_t barrier_handle;
+  ASSERT_EQ(DART_OK, dart_ibarrier(DART_TEAM_ALL, &barrier_handle));
+  ASSERT_EQ(DART_OK, dart_wait(barrier_handle));
+
+  int value = _dash_id + 1;
+  int sum   = 0;
+  std::vector<int> gathered(_dash_size, -1);
+  dart_handle_t handles[2];
+  ASSERT_EQ(DART_OK,
+            dart_iallreduce(&value, &sum, 1, DART_TYPE_INT, DART_OP_SUM,
+                            DART_TEAM_ALL, &handles[0]));
+  ASSERT_EQ(DART_OK,
+            dart_iallgather(&value, gathered.data(), 1, DART_TYPE_INT,
+                            DART_TEAM_ALL, &handles[1]));
+  int32_t finished = 0;
+  ASSERT_EQ(DART_OK, dart_test_local(handles[0], &finished));
+  ASSERT_EQ(DART_OK, dart_waitall(handles, 2));
+  ASSERT_EQ((_dash_size * (_dash_size + 1)) / 2, sum);
+  for (int u = 0; u < _dash_size; ++u) {
+    ASSERT_EQ(u + 1, gathered[u]);
+  }
+}
+
+namespace {
+
+struct value_count_t {
+  int    value;
+  double count;
+};
+
+/// Keeps the maximum value, sums the counts weighted by user data
+void max_value_sum_count(
+  const void * invec,
+  void       * inoutvec,
+  size_t       len,
+  void       * userdata)
+{
+  const value_count_t * in    = static_cast<const value_count_t *>(invec);
+  value_count_t       * inout = static_cast<value_count_t *>(inoutvec);
+  double                scale = *static_cast<double *>(userdata);
+  for (size_t i = 0; i < len; ++i) {
+    inout[i].value  = std::max(in[i].value, inout[i].value);
+    inout[i].count += scale * in[i].count;
+  }
+}
+
+struct unit_range_t {
+  int first;
+  int last;
+  int ordered;
+};
+
+/// Concatenates ranges of units, only ordered if adjacent in team order
+void concat_unit_ranges(
+  const void * invec,
+  void       * inoutvec,
+  size_t       len,
+  void       * userdata)
+{
+  const unit_range_t * in    = static_cast<const unit_range_t *>(invec);
+  unit_range_t       * inout = static_cast<unit_range_t *>(inoutvec);
+  for (size_t i = 0; i < len; ++i) {
+    inout[i].ordered = in[i].ordered && inout[i].ordered &&
+                       in[i].last + 1 == inout[i].first;
+    inout[i].first   = in[i].first;
+  }
+}
+
+} // namespace
+
+TEST_F(DARTCollectiveTest, UserDefinedOperation) {
+  const int        nelem = 3;
+  double           scale = 1.0;
+  dart_operation_t op;
+  ASSERT_EQ(DART_OK,
+            dart_op_create(&max_value_sum_count, &scale, true,
+                           sizeof(value_count_t), &op));
+
+  std::vector<value_count_t> send(nelem);
+  std::vector<value_count_t> recv(nelem);
+  for (int i = 0; i < nelem; ++i) {
+    send[i].value = _dash_id * 10 + i;
+    send[i].count = 1.0;
+  }
+  ASSERT_EQ(DART_OK,
+            dart_allreduce(send.data(), recv.data(),
+                           nelem * sizeof(value_count_t), DART_TYPE_BYTE,
+                           op, DART_TEAM_ALL));
+  for (int i = 0; i < nelem; ++i) {
+    ASSERT_EQ((_dash_size - 1) * 10 + i, recv[i].value);
+    ASSERT_EQ(static_cast<double>(_dash_size), recv[i].count);
+  }
+
+  // Number of bytes must be a multiple of the element size:
+  ASSERT_EQ(DART_ERR_INVAL,
+            dart_allreduce(send.data(), recv.data(),
+                           sizeof(value_count_t) + 1, DART_TYPE_BYTE,
+                           op, DART_TEAM_ALL));
+
+  // Operations created with identical arguments are shared and remain
+  // valid until destroyed as often as created:
+  dart_operation_t shared_op;
+  ASSERT_EQ(DART_OK,
+            dart_op_create(&max_value_sum_count, &scale, true,
+                           sizeof(value_count_t), &shared_op));
+  ASSERT_EQ(op, shared_op);
+  ASSERT_EQ(DART_OK, dart_op_destroy(&shared_op));
+  ASSERT_EQ(DART_OK,
+            dart_allreduce(send.data(), recv.data(),
+                           nelem * sizeof(value_count_t), DART_TYPE_BYTE,
+                           op, DART_TEAM_ALL));
+  ASSERT_EQ(static_cast<double>(_dash_size), recv[0].count);
+
+  ASSERT_EQ(DART_OK, dart_op_destroy(&op));
+  ASSERT_EQ(DART_OP_UNDEFINED, op);
+  // Released after the last reference has been destroyed:
+  ASSERT_EQ(DART_ERR_INVAL, dart_op_destroy(&shared_op));
+}
+
+TEST_F(DARTCollectiveTest, NonCommutativeUserDefinedOperation) {
+  dart_operation_t op;
+  ASSERT_EQ(DART_OK,
+            dart_op_create(&concat_unit_ranges, NULL, false,
+                           sizeof(unit_range_t), &op));
+
+  // Values are combined in team order regardless of unit placement:
+  int          myid = static_cast<int>(_dash_id);
+  unit_range_t send = { myid, myid, 1 };
+  unit_range_t recv = { -1, -1, 0 };
+  ASSERT_EQ(DART_OK,
+            dart_allreduce(&send, &recv, sizeof(unit_range_t),
+                           DART_TYPE_BYTE, op, DART_TEAM_ALL));
+  ASSERT_EQ(0,                                recv.first);
+  ASSERT_EQ(static_cast<int>(_dash_size) - 1, recv.last);
+  ASSERT_EQ(1,                                recv.ordered);
+
+  ASSERT_EQ(DART_OK, dart_op_destroy(&op));
+}
+
+TEST_F(DARTCollectiveTest, AlltoallReduceScatter) {
+  size_t nunits = _dash_size;
+  size_t myid   = _dash_id;
+
+  // Unit i sends value 100 * i + j to unit j:
+  std::vector<int> send(nunits);
+  std::vector<int> recv(nunits);
+  for (size_t j = 0; j < nunits; ++j) {
+    send[j] = 100 * myid + j;
+  }
+  ASSERT_EQ(DART_OK,
+            dart_alltoall(send.data(), recv.data(), 1, DART_TYPE_INT,
+                          DART_TEAM_ALL));
+  for (size_t i = 0; i < nunits; ++i) {
+    ASSERT_EQ(static_cast<int>(100 * i + myid), recv[i]);
+  }
+
+  // Unit i sends j + 1 values of i to unit j:
+  std::vector<size_t> nsend(nunits), sdispls(nunits);
+  std::vector<size_t> nrecv(nunits), rdispls(nunits);
+  size_t nsend_total = 0;
+  size_t nrecv_total = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    nsend[u]     = u + 1;
+    sdispls[u]   = nsend_total;
+    nsend_total += nsend[u];
+    nrecv[u]     = myid + 1;
+    rdispls[u]   = nrecv_total;
+    nrecv_total += nrecv[u];
+  }
+  std::vector<int> sendv(nsend_total, static_cast<int>(myid));
+  std::vector<int> recvv(nrecv_total, -1);
+  ASSERT_EQ(DART_OK,
+            dart_alltoallv(sendv.data(), nsend.data(), sdispls.data(),
+                           DART_TYPE_INT,
+                           recvv.data(), nrecv.data(), rdispls.data(),
+                           DART_TEAM_ALL));
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nrecv[u]; ++e) {
+      ASSERT_EQ(static_cast<int>(u), recvv[rdispls[u] + e]);
+    }
+  }
+
+  // Unit j receives the sums of elements j and nunits + j:
+  std::vector<size_t> nrecv_rs(nunits, 2);
+  std::vector<int>    send_rs(2 * nunits);
+  std::vector<int>    recv_rs(2);
+  for (size_t e = 0; e < send_rs.size(); ++e) {
+    send_rs[e] = e;
+  }
+  ASSERT_EQ(DART_OK,
+            dart_reduce_scatter(send_rs.data(), recv_rs.data(),
+                                nrecv_rs.data(), DART_TYPE_INT,
+                                DART_OP_SUM, DART_TEAM_ALL));
+  ASSERT_EQ(static_cast<int>(2 * myid * nunits),     recv_rs[0]);
+  ASSERT_EQ(static_cast<int>((2 * myid + 1) * nunits), recv_rs[1]);
+}
@@ -234,3 +234,112 @@ TEST_F(DARTLockTest, TeamLockUnlock) {
     dart_team_lock_destroy(&lock));
 
 }
+
+TEST_F(DARTLockTest, LocalSpinLockUnlock) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  dash::Shared<value_t> shared;
+  dart_lock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_init_variant(DART_TEAM_ALL, DART_LOCK_LOCAL_SPIN, &lock));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_acquire(lock));
+    shared.set(shared.get() + 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+
+    int32_t acquired;
+    do {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_try_acquire(lock, &acquired));
+    } while (!acquired);
+    shared.set(shared.get() + 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(2 * num_iterations * dash::size(),
+    static_cast<value_t>(shared.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, LocalSpinSharedLock) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  dash::Shared<value_t> shared;
+  dart_lock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_init_variant(DART_TEAM_ALL, DART_LOCK_LOCAL_SPIN, &lock));
+
+  dash::barrier();
+  // All units but unit 0 hold the lock in shared mode at the same time:
+  if (dash::myid() != 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_acquire_shared(lock));
+  }
+  dash::barrier();
+  if (dash::myid() == 0 && dash::size() > 1) {
+    int32_t acquired;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_try_acquire(lock, &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+  if (dash::myid() != 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  }
+
+  // Writers and readers alternating:
+  for (int i = 0; i < num_iterations; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_acquire(lock));
+    shared.set(shared.get() + 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_acquire_shared(lock));
+    EXPECT_GT_U(static_cast<value_t>(shared.get()), 0);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(num_iterations * dash::size(),
+    static_cast<value_t>(shared.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
@@ -4,6 +4,8 @@
 #include <dash/dart/if/dart_globmem.h>
 #include <dash/Array.h>
 
+#include <vector>
+
 TEST_F(DARTMemAllocTest, SmallLocalAlloc)
 {
 
@@ -96,6 +98,106 @@ TEST_F(DARTMemAllocTest, LocalAlloc)
     dart_memfree(gptr));
 }
 
+TEST_F(DARTMemAllocTest, GrowingLocalAlloc)
+{
+  typedef int value_t;
+  // Exceeds the size of the initial chunk of the local allocation pool
+  const size_t num_allocs = 24;
+  const size_t block_size = (1024 * 1024) / sizeof(value_t);
+
+  dart_memalloc_stats_t stats_init;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memalloc_stats(&stats_init));
+
+  std::vector<dart_gptr_t> gptrs(num_allocs);
+  for (size_t i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(block_size, DART_TYPE_INT, &gptrs[i]));
+    value_t *baseptr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_getaddr(gptrs[i], (void**)&baseptr));
+    for (size_t e = 0; e < block_size; ++e) {
+      baseptr[e] = dash::myid().id * 1000 + i;
+    }
+  }
+  // Small allocations are served from size-class bins
+  std::vector<dart_gptr_t> small_gptrs(100);
+  for (auto & gptr : small_gptrs) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(3, DART_TYPE_INT, &gptr));
+  }
+  // Allocation larger than a chunk
+  dart_gptr_t large_gptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memalloc(num_allocs * block_size, DART_TYPE_INT, &large_gptr));
+
+  dart_memalloc_stats_t stats;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memalloc_stats(&stats));
+  LOG_MESSAGE("dart_memalloc_stats: chunks:%zu total:%zu used:%zu "
+              "bin_free:%zu free:%zu largest_free:%zu",
+              stats.num_chunks, stats.total_bytes, stats.used_bytes,
+              stats.bin_free_bytes, stats.free_bytes,
+              stats.largest_free_bytes);
+  EXPECT_GT_U(stats.num_chunks, stats_init.num_chunks + 1);
+  EXPECT_GE_U(stats.used_bytes,
+              stats_init.used_bytes +
+                (2 * num_allocs * block_size + 100 * 3) * sizeof(value_t));
+  EXPECT_EQ_U(stats.total_bytes,
+              stats.used_bytes + stats.bin_free_bytes + stats.free_bytes);
+
+  // Access the last allocation of the neighbor, located in a chunk
+  // attached on demand:
+  dash::Array<dart_gptr_t> arr(dash::size());
+  arr.local[0] = gptrs[num_allocs - 1];
+  arr.barrier();
+
+  value_t neighbor_val;
+  size_t  neighbor_id = (dash::myid().id + 1) % dash::size();
+  dart_gptr_t gptr_neighbor = arr[neighbor_id];
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_gptr_incaddr(&gptr_neighbor, (block_size - 1) * sizeof(value_t)));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+        &neighbor_val,
+        gptr_neighbor,
+        1,
+        DART_TYPE_INT));
+  ASSERT_EQ_U(
+    static_cast<value_t>(neighbor_id * 1000 + num_allocs - 1),
+    neighbor_val);
+
+  arr.barrier();
+
+  for (auto & gptr : gptrs) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memfree(gptr));
+  }
+  for (auto & gptr : small_gptrs) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memfree(gptr));
+  }
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memfree(large_gptr));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memalloc_stats(&stats));
+  EXPECT_EQ_U(stats_init.used_bytes, stats.used_bytes);
+  EXPECT_EQ_U(stats.total_bytes,
+              stats.used_bytes + stats.bin_free_bytes + stats.free_bytes);
+}
 
 TEST_F(DARTMemAllocTest, SegmentReuseTest)
 {
@@ -159,3 +261,54 @@ TEST_F(DARTMemAllocTest, SegmentReuseTest)
     DART_OK,
     dart_team_memfree(gptr2));
 }
+
+TEST_F(DARTMemAllocTest, SegmentTeamLookup)
+{
+  // create teams until the team ID exceeds the initial size of the team
+  // table
+  dart_team_t team = DART_TEAM_NULL;
+  do {
+    if (team != DART_TEAM_NULL) {
+      ASSERT_EQ_U(DART_OK, dart_team_destroy(&team));
+    }
+    ASSERT_EQ_U(DART_OK, dart_team_clone(DART_TEAM_ALL, &team));
+  } while (team <= 300);
+  LOG_MESSAGE("DARTMemAllocTest.SegmentTeamLookup: team:%d", team);
+
+  dart_team_unit_t myid;
+  size_t           team_size;
+  ASSERT_EQ_U(DART_OK, dart_team_myid(team, &myid));
+  ASSERT_EQ_U(DART_OK, dart_team_size(team, &team_size));
+  ASSERT_EQ_U(dash::size(), team_size);
+
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memalloc_aligned(team, 1, DART_TYPE_INT, &gptr));
+  ASSERT_EQ_U(team, gptr.teamid);
+
+  int *baseptr;
+  dart_gptr_setunit(&gptr, myid);
+  ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr, (void**)&baseptr));
+  *baseptr = myid.id;
+  dart_barrier(team);
+
+  dart_team_unit_t neighbor;
+  neighbor.id = (myid.id + 1) % team_size;
+  dart_gptr_setunit(&gptr, neighbor);
+  int value = -1;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(&value, gptr, 1, DART_TYPE_INT));
+  ASSERT_EQ_U(neighbor.id, value);
+  dart_barrier(team);
+
+  // segment ID is unknown after the segment has been released
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr));
+  dart_gptr_setunit(&gptr, myid);
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_gptr_getaddr(gptr, (void**)&baseptr));
+
+  ASSERT_EQ_U(DART_OK, dart_team_destroy(&team));
+}
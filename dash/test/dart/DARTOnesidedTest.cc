@@ -3,6 +3,22 @@
 
 #include <dash/Array.h>
 #include <dash/Onesided.h>
+#include <dash/algorithm/Fill.h>
+
+#ifdef MPI_IMPL_ID
+#include <mpi.h>
+
+#include <climits>
+
+extern "C" {
+// Internal to DART-MPI, declared in dart_communication_priv.h:
+dart_ret_t dart__mpi__contiguous_type(
+  dart_datatype_t   dtype,
+  size_t            nelem,
+  MPI_Datatype    * mpi_type,
+  int             * count);
+}
+#endif
 
 
 TEST_F(DARTOnesidedTest, GetBlockingSingleBlock)
@@ -24,7 +40,7 @@ TEST_F(DARTOnesidedTest, GetBlockingSingleBlock)
   int g_src_index       = unit_src * block_size;
   // Copy values:
   dart_storage_t ds = dash::dart_storage<value_t>(block_size);
-  LOG_MESSAGE("DART storage: dtype:%d nelem:%d", ds.dtype, ds.nelem);
+  LOG_MESSAGE("DART storage: dtype:%d nelem:%zu", ds.dtype, ds.nelem);
   dart_get_blocking(
     local_array,                                // lptr dest
     (array.begin() + g_src_index).dart_gptr(),  // gptr start
@@ -56,7 +72,7 @@ TEST_F(DARTOnesidedTest, GetBlockingTwoBlocks)
   array.barrier();
   // Copy values from first two blocks:
   dart_storage_t ds = dash::dart_storage<value_t>(num_elem_copy);
-  LOG_MESSAGE("DART storage: dtype:%d nelem:%d", ds.dtype, ds.nelem);
+  LOG_MESSAGE("DART storage: dtype:%d nelem:%zu", ds.dtype, ds.nelem);
   dart_get_blocking(
     local_array,                      // lptr dest
     array.begin().dart_gptr(),        // gptr start
@@ -99,7 +115,7 @@ TEST_F(DARTOnesidedTest, GetHandleAllRemote)
       dart_handle_t handle;
 
       dart_storage_t ds = dash::dart_storage<value_t>(block_size);
-      LOG_MESSAGE("DART storage: dtype:%d nelem:%d", ds.dtype, ds.nelem);
+      LOG_MESSAGE("DART storage: dtype:%d nelem:%zu", ds.dtype, ds.nelem);
       EXPECT_EQ_U(
         DART_OK,
         dart_get_handle(
@@ -135,3 +151,324 @@ TEST_F(DARTOnesidedTest, GetHandleAllRemote)
   delete[] local_array;
   ASSERT_EQ_U(num_elem_copy, l);
 }
+
+TEST_F(DARTOnesidedTest, StridedGetPut)
+{
+  typedef int value_t;
+  const size_t block_size  = 4;
+  const size_t num_blocks  = 5;
+  const size_t stride      = 2 * block_size;
+  const size_t num_l_elem  = num_blocks * stride;
+  size_t num_elem_total    = dash::size() * num_l_elem;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  // Assign initial values: [ 1000, 1001, 1002, ... 2000, 2001, ... ]
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    array.local[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  array.barrier();
+  // Unit to copy values from:
+  dart_unit_t unit_src = (dash::myid() + 1) % dash::size();
+  auto        gptr_src = (array.begin() + unit_src * num_l_elem).dart_gptr();
+  // Get every second block of the remote unit's local range, packed:
+  value_t local_array[num_blocks * block_size];
+  dart_storage_t ds        = dash::dart_storage<value_t>(block_size);
+  dart_storage_t ds_stride = dash::dart_storage<value_t>(stride);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_strided(local_array, gptr_src, num_blocks, ds.nelem,
+                     ds_stride.nelem, ds.nelem, ds.dtype));
+  dart_flush_local(gptr_src);
+  for (size_t b = 0; b < num_blocks; ++b) {
+    for (size_t e = 0; e < block_size; ++e) {
+      value_t expected = ((unit_src + 1) * 1000) + (b * stride) + e;
+      ASSERT_EQ_U(expected, local_array[b * block_size + e]);
+    }
+  }
+  array.barrier();
+  // Negate values and write them back to the remote blocks:
+  for (size_t i = 0; i < num_blocks * block_size; ++i) {
+    local_array[i] = -local_array[i];
+  }
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_strided(gptr_src, local_array, num_blocks, ds.nelem,
+                     ds_stride.nelem, ds.nelem, ds.dtype));
+  dart_flush(gptr_src);
+  array.barrier();
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    value_t expected = ((dash::myid() + 1) * 1000) + l;
+    if ((l % stride) < block_size) {
+      expected = -expected;
+    }
+    ASSERT_EQ_U(expected, array.local[l]);
+  }
+}
+
+TEST_F(DARTOnesidedTest, IndexedGetPut)
+{
+  typedef int value_t;
+  const size_t num_l_elem = 100;
+  size_t num_elem_total   = dash::size() * num_l_elem;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    array.local[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  array.barrier();
+  dart_unit_t unit_src = (dash::myid() + 1) % dash::size();
+  auto        gptr_src = (array.begin() + unit_src * num_l_elem).dart_gptr();
+  // Blocks of different size in reverse order in destination buffer:
+  const size_t nblocks        = 3;
+  size_t       nelems[]       = {  3,  7,  1 };
+  size_t       src_displs[]   = {  2, 40, 99 };
+  size_t       dest_displs[]  = {  8,  1,  0 };
+  value_t      local_array[11];
+  dart_datatype_t dtype = dash::dart_storage<value_t>(1).dtype;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_indexed(local_array, gptr_src, nblocks, nelems, src_displs,
+                     dest_displs, dtype));
+  dart_flush_local(gptr_src);
+  for (size_t b = 0; b < nblocks; ++b) {
+    for (size_t e = 0; e < nelems[b]; ++e) {
+      value_t expected = ((unit_src + 1) * 1000) + src_displs[b] + e;
+      ASSERT_EQ_U(expected, local_array[dest_displs[b] + e]);
+    }
+  }
+  array.barrier();
+  // Write back packed source buffer:
+  value_t packed[11];
+  for (size_t i = 0; i < 11; ++i) {
+    packed[i] = -1;
+  }
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_indexed(gptr_src, packed, nblocks, nelems, src_displs,
+                     NULL, dtype));
+  dart_flush(gptr_src);
+  array.barrier();
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    bool in_block = false;
+    for (size_t b = 0; b < nblocks; ++b) {
+      in_block |= (l >= src_displs[b] && l < src_displs[b] + nelems[b]);
+    }
+    value_t expected = in_block ? -1 : ((dash::myid() + 1) * 1000) + l;
+    ASSERT_EQ_U(expected, array.local[l]);
+  }
+}
+
+TEST_F(DARTOnesidedTest, HandlePoolGetPut)
+{
+  typedef int value_t;
+  const size_t num_l_elem = 1000;
+  // Smaller than number of operations to test implicit completion of
+  // operations in a full pool:
+  const size_t capacity   = 64;
+  size_t num_elem_total   = dash::size() * num_l_elem;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    array.local[l] = ((dash::myid() + 1) * 1000) + l;
+  }
+  array.barrier();
+
+  dart_handle_pool_t pool;
+  ASSERT_EQ_U(DART_OK, dart_handle_pool_create(capacity, &pool));
+  dart_unit_t unit_src = (dash::myid() + 1) % dash::size();
+  auto g_src_first     = array.begin() + unit_src * num_l_elem;
+  std::vector<value_t> local_array(num_l_elem);
+  dart_storage_t ds = dash::dart_storage<value_t>(1);
+  // Get single elements in reverse order:
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    size_t idx = num_l_elem - l - 1;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_get_pooled(&local_array[idx], (g_src_first + idx).dart_gptr(),
+                      ds.nelem, ds.dtype, pool));
+    size_t size;
+    dart_handle_pool_size(pool, &size);
+    ASSERT_LE_U(size, capacity);
+  }
+  ASSERT_EQ_U(DART_OK, dart_handle_pool_waitall_local(pool));
+  size_t size;
+  dart_handle_pool_size(pool, &size);
+  ASSERT_EQ_U(0, size);
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    value_t expected = ((unit_src + 1) * 1000) + l;
+    ASSERT_EQ_U(expected, local_array[l]);
+  }
+  array.barrier();
+
+  // Put negated values back:
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    local_array[l] = -local_array[l];
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_put_pooled((g_src_first + l).dart_gptr(), &local_array[l],
+                      ds.nelem, ds.dtype, pool));
+  }
+  ASSERT_EQ_U(DART_OK, dart_handle_pool_destroy(&pool));
+  ASSERT_EQ_U(nullptr, pool);
+  array.barrier();
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    value_t expected = -(((dash::myid() + 1) * 1000) + l);
+    ASSERT_EQ_U(expected, array.local[l]);
+  }
+}
+
+TEST_F(DARTOnesidedTest, AggregationPutGetAccumulate)
+{
+  typedef int value_t;
+  const size_t num_l_elem = 1000;
+  // Smaller than the number of bytes transferred to test implicit
+  // flushes of full buffers:
+  const size_t threshold  = 512;
+  size_t num_elem_total   = dash::size() * num_l_elem;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  dart_aggregation_t agg;
+  ASSERT_EQ_U(DART_OK,
+              dart_aggregation_create(array.team().dart_id(), threshold,
+                                      &agg));
+  dart_unit_t unit_dst = (dash::myid() + 1) % dash::size();
+  auto g_dst_first     = array.begin() + unit_dst * num_l_elem;
+  dart_storage_t ds    = dash::dart_storage<value_t>(1);
+  // Put single elements, reusing the source buffer:
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    value_t value = ((dash::myid() + 1) * 1000) + l;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_aggregation_put(agg, (g_dst_first + l).dart_gptr(), &value,
+                           ds.nelem, ds.dtype));
+  }
+  // Barrier issues and completes buffered operations:
+  array.barrier();
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    value_t expected = ((((dash::myid() + dash::size() - 1) % dash::size())
+                         + 1) * 1000) + l;
+    ASSERT_EQ_U(expected, array.local[l]);
+  }
+  array.barrier();
+
+  // Every unit increments all elements of the first unit:
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    value_t value = 1;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_aggregation_accumulate(agg, (array.begin() + l).dart_gptr(),
+                                  &value, ds.nelem, ds.dtype,
+                                  DART_OP_SUM));
+  }
+  array.barrier();
+
+  std::vector<value_t> local_array(num_l_elem);
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_aggregation_get(agg, &local_array[l],
+                           (array.begin() + l).dart_gptr(),
+                           ds.nelem, ds.dtype));
+  }
+  ASSERT_EQ_U(DART_OK, dart_aggregation_flush(agg));
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    // Values put by the last unit, incremented by every unit:
+    value_t expected = (dash::size() * 1000) + l + dash::size();
+    ASSERT_EQ_U(expected, local_array[l]);
+  }
+  ASSERT_EQ_U(DART_OK, dart_aggregation_destroy(&agg));
+  ASSERT_EQ_U(nullptr, agg);
+}
+
+TEST_F(DARTOnesidedTest, LargeGetPut)
+{
+  typedef long value_t;
+  // Transfers exceeding DART_MPI_MAX_COUNT elements are described by a
+  // derived data type. With the default limit of INT_MAX elements, this is
+  // only exercised if DART is built with a small DART_MPI_MAX_COUNT, see
+  // ContiguousTypeLimit for the data types created for counts above the
+  // default limit. Use a size that is not a multiple of typical chunk
+  // sizes:
+  const size_t num_l_elem = 3 * 65536 + 7;
+  size_t num_elem_total   = dash::size() * num_l_elem;
+  dash::Array<value_t> array(num_elem_total, dash::BLOCKED);
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  dart_unit_t unit_dst  = (dash::myid() + 1) % dash::size();
+  dart_unit_t unit_src  = (dash::myid() + dash::size() - 1) % dash::size();
+  auto g_dst_first      = array.begin() + unit_dst * num_l_elem;
+  dart_storage_t ds     = dash::dart_storage<value_t>(num_l_elem);
+
+  std::vector<value_t> values(num_l_elem);
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    values[l] = (dash::myid() * num_l_elem) + l;
+  }
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_blocking(g_dst_first.dart_gptr(), values.data(),
+                      ds.nelem, ds.dtype));
+  array.barrier();
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    ASSERT_EQ_U(static_cast<value_t>(unit_src * num_l_elem + l),
+                array.local[l]);
+  }
+  array.barrier();
+
+  // Every unit adds its values to the block of its neighbor:
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_accumulate(g_dst_first.dart_gptr(), values.data(),
+                    ds.nelem, ds.dtype, DART_OP_SUM));
+  ASSERT_EQ_U(DART_OK, dart_flush(g_dst_first.dart_gptr()));
+  array.barrier();
+
+  std::vector<value_t> local_array(num_l_elem);
+  dart_handle_t handle;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_handle(local_array.data(), g_dst_first.dart_gptr(),
+                    ds.nelem, ds.dtype, &handle));
+  ASSERT_EQ_U(DART_OK, dart_wait(handle));
+  for (size_t l = 0; l < num_l_elem; ++l) {
+    ASSERT_EQ_U(2 * values[l], local_array[l]);
+  }
+  array.barrier();
+}
+
+#ifdef MPI_IMPL_ID
+TEST_F(DARTOnesidedTest, ContiguousTypeLimit)
+{
+  // Only creates data types, counts above INT_MAX do not allocate memory:
+  const size_t max_count = INT_MAX;
+  std::vector<size_t> nelems {
+    1, 1000, max_count, max_count + 1, 2 * max_count,
+    3 * max_count + 7 };
+  MPI_Count elem_size = sizeof(long);
+
+  for (auto nelem : nelems) {
+    MPI_Datatype mpi_type;
+    int          count = 0;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart__mpi__contiguous_type(DART_TYPE_LONG, nelem, &mpi_type, &count));
+    if (nelem > max_count) {
+      // Single element of a derived data type:
+      EXPECT_EQ_U(1, count);
+      EXPECT_NE_U(MPI_LONG, mpi_type);
+    } else if (mpi_type == MPI_LONG) {
+      EXPECT_EQ_U(nelem, static_cast<size_t>(count));
+    }
+    // Data type and count describe nelem contiguous elements:
+    MPI_Count type_size, true_lb, true_extent;
+    MPI_Type_size_x(mpi_type, &type_size);
+    MPI_Type_get_true_extent_x(mpi_type, &true_lb, &true_extent);
+    EXPECT_EQ_U(static_cast<MPI_Count>(nelem) * elem_size,
+                type_size * count);
+    EXPECT_EQ_U(0, true_lb);
+    EXPECT_EQ_U(type_size, true_extent);
+    if (mpi_type != MPI_LONG) {
+      MPI_Type_free(&mpi_type);
+    }
+  }
+}
+#endif // MPI_IMPL_ID
@@ -476,3 +476,28 @@ TEST_F(AtomicTest, MutexInterface){
     EXPECT_EQ_U(result, static_cast<int>(dash::size())*3);
   }
 }
+
+TEST_F(AtomicTest, MutexLocalSpin){
+  dash::Mutex mx(dash::Team::All(), dash::mutex_variant::local_spin);
+
+  dash::Shared<int> shared(dash::team_unit_t{0});
+
+  if(dash::myid() == 0){
+    shared.set(0);
+  }
+  dash::barrier();
+
+  {
+    std::lock_guard<dash::Mutex> lg(mx);
+    int tmp = shared.get();
+    shared.set(tmp + 1);
+  }
+
+  dash::barrier();
+
+  mx.lock_shared();
+  EXPECT_EQ_U(static_cast<int>(dash::size()), shared.get());
+  mx.unlock_shared();
+
+  dash::barrier();
+}
@@ -1883,3 +1883,45 @@ TEST_F(ViewTest, ArrayBlockedPatternViewUnion)
                            });
 }
 */
+
+TEST_F(ViewTest, LazyExpressionReduce)
+{
+  int block_size = 17;
+  int array_size = dash::size() * block_size;
+
+  dash::Array<int> array(array_size);
+  for (size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = array.pattern().global(l);
+  }
+  array.barrier();
+
+  int sub_begin = block_size / 2;
+  int sub_end   = array_size - 3;
+
+  // Sum of squares in a sub-range, evaluated without temporary array:
+  long sum_sq = dash::reduce(
+                  dash::views::transform(
+                    dash::sub(sub_begin, sub_end, array),
+                    [](int v) { return static_cast<long>(v) * v; }),
+                  dash::plus<long>());
+  long exp_sum_sq = 0;
+  for (int g = sub_begin; g < sub_end; ++g) {
+    exp_sum_sq += static_cast<long>(g) * g;
+  }
+  EXPECT_EQ_U(exp_sum_sq, sum_sq);
+
+  // Count of odd elements, composed filter and transform on container:
+  auto odd_ones = dash::views::transform(
+                    dash::views::filter(
+                      array,
+                      [](int v) { return v % 2 != 0; }),
+                    [](int) { return 1; });
+  int n_odd     = dash::reduce(odd_ones, 0, dash::plus<int>());
+  EXPECT_EQ_U(array_size / 2, n_odd);
+
+  // Empty selection yields init value:
+  int max = dash::reduce(
+              dash::views::filter(array, [](int v) { return v < 0; }),
+              -1, dash::max<int>());
+  EXPECT_EQ_U(-1, max);
+}